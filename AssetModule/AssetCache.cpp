@@ -16,15 +16,32 @@ namespace Asset
 {
 
 const char *DEFAULT_ASSET_CACHE_PATH = "/assetcache";
+const char *DISK_CACHE_INDEX_FILE = "/index.dat";
+const char DISK_CACHE_INDEX_MAGIC[8] = { 'N', 'A', 'A', 'L', 'I', 'D', 'C', '1' };
+const char *DISK_CACHE_VERSION_FILE = "/version.dat";
+const char DISK_CACHE_VERSION_MAGIC[8] = { 'N', 'A', 'A', 'L', 'D', 'C', 'V', '1' };
 const int DEFAULT_MEMORY_CACHE_SIZE = 32 * 1024 * 1024;
-const f64 CACHE_CHECK_INTERVAL = 1.0;
-const int CACHE_MAX_DELETES = 10;
+const int DEFAULT_DISK_CACHE_SIZE = 512 * 1024 * 1024;
+
+//! Deletes a file, ignoring errors
+static void RemoveFile(const std::string& path)
+{
+    try
+    {
+        boost::filesystem::remove(path);
+    }
+    catch (std::exception &)
+    {
+    }
+}
 
 AssetCache::AssetCache(Foundation::Framework* framework) :
     framework_(framework), 
     memory_cache_size_(DEFAULT_MEMORY_CACHE_SIZE),
-    update_time_(0.0),
-    md5_engine_(0)
+    disk_cache_size_(DEFAULT_DISK_CACHE_SIZE),
+    memory_cache_total_size_(0),
+    disk_cache_total_size_(0),
+    task_manager_(framework)
 {
     // Create asset cache directory
     cache_path_ = framework_->GetPlatform()->GetApplicationDataDirectory() + DEFAULT_ASSET_CACHE_PATH;
@@ -34,21 +51,138 @@ AssetCache::AssetCache(Foundation::Framework* framework) :
     // Set size of memory cache
     memory_cache_size_ = framework_->GetDefaultConfig().DeclareSetting("AssetSystem", "memory_cache_size", DEFAULT_MEMORY_CACHE_SIZE);
 
+    // Set size of disk cache
+    disk_cache_size_ = framework_->GetDefaultConfig().DeclareSetting("AssetSystem", "disk_cache_size", DEFAULT_DISK_CACHE_SIZE);
+
     // Get path of local secondary cache
-    std::string local_cache_path = framework_->GetDefaultConfig().DeclareSetting("AssetSystem", "local_cache_path", std::string("./data/assetcache"));
+    local_cache_path_ = framework_->GetDefaultConfig().DeclareSetting("AssetSystem", "local_cache_path", std::string("./data/assetcache"));
     
-    CheckDiskCache(cache_path_);
-    CheckDiskCache(local_cache_path);
+    LoadDiskCacheIndex();
+    CheckDiskCache(local_cache_path_, local_cache_contents_);
 
-    md5_engine_ = new QCryptographicHash(QCryptographicHash::Md5);
+    task_manager_.AddThreadTask(Foundation::ThreadTaskPtr(new DiskCacheTask()));
 }
 
 AssetCache::~AssetCache()
 {
-    SAFE_DELETE(md5_engine_);
+    // Finish pending writes & deletes before saving the index
+    task_manager_.RemoveThreadTasks();
+    SaveDiskCacheIndex();
+}
+
+void AssetCache::LoadDiskCacheIndex()
+{
+    disk_cache_index_.clear();
+    disk_cache_lru_.clear();
+    disk_cache_total_size_ = 0;
+
+    // An index is valid only in a directory of the current format, see below
+    std::ifstream filestr((cache_path_ + DISK_CACHE_INDEX_FILE).c_str(), std::ios::in | std::ios::binary);
+    if (filestr.good() && IsDiskCacheVersionCurrent())
+    {
+        char magic[sizeof(DISK_CACHE_INDEX_MAGIC)];
+        u32 count = 0;
+        filestr.read(magic, sizeof(magic));
+        filestr.read((char *)&count, sizeof(count));
+        if (filestr.good() && memcmp(magic, DISK_CACHE_INDEX_MAGIC, sizeof(magic)) == 0)
+        {
+            // Entries are stored oldest first
+            for (u32 i = 0; i < count; ++i)
+            {
+                RexUUID key;
+                u32 size = 0;
+                filestr.read((char *)key.data, RexUUID::cSizeBytes);
+                filestr.read((char *)&size, sizeof(size));
+                if (!filestr.good())
+                    break;
+                AddDiskCacheEntry(key, size);
+            }
+
+            if (disk_cache_index_.size() == count)
+            {
+                AssetModule::LogDebug("Loaded disk cache index with " + ToString<uint>(count) + " assets");
+                // The index is saved again on exit. Delete it now, so that a crash will not leave a stale one that
+                // misses the files written during this session.
+                filestr.close();
+                RemoveFile(cache_path_ + DISK_CACHE_INDEX_FILE);
+                return;
+            }
+        }
+
+        AssetModule::LogWarning("Invalid disk cache index, rebuilding");
+        disk_cache_index_.clear();
+        disk_cache_lru_.clear();
+        disk_cache_total_size_ = 0;
+    }
+
+    // No valid index, scan the cache directory. Delete the index file so a crash before exit will not leave a stale one.
+    filestr.close();
+    RemoveFile(cache_path_ + DISK_CACHE_INDEX_FILE);
+
+    DiskCacheKeySet keys;
+    CheckDiskCache(cache_path_, keys);
+
+    // Files of the old cache format are named by the MD5 digest of any asset id, so their names can not be told from
+    // the current ones, and UUID assets stored in them would never be found. Delete them once, and mark the directory.
+    if (!IsDiskCacheVersionCurrent())
+    {
+        if (!keys.empty())
+            AssetModule::LogInfo("Deleting " + ToString<uint>(keys.size()) + " files of the old disk cache format");
+        for (DiskCacheKeySet::const_iterator i = keys.begin(); i != keys.end(); ++i)
+            RemoveFile(cache_path_ + "/" + GetFileName(*i));
+        keys.clear();
+        SaveDiskCacheVersion();
+    }
+
+    for (DiskCacheKeySet::const_iterator i = keys.begin(); i != keys.end(); ++i)
+    {
+        try
+        {
+            AddDiskCacheEntry(*i, boost::filesystem::file_size(cache_path_ + "/" + GetFileName(*i)));
+        }
+        catch (std::exception &)
+        {
+        }
+    }
+}
+
+bool AssetCache::IsDiskCacheVersionCurrent()
+{
+    std::ifstream filestr((cache_path_ + DISK_CACHE_VERSION_FILE).c_str(), std::ios::in | std::ios::binary);
+    char magic[sizeof(DISK_CACHE_VERSION_MAGIC)];
+    filestr.read(magic, sizeof(magic));
+    return filestr.good() && memcmp(magic, DISK_CACHE_VERSION_MAGIC, sizeof(magic)) == 0;
+}
+
+void AssetCache::SaveDiskCacheVersion()
+{
+    std::ofstream filestr((cache_path_ + DISK_CACHE_VERSION_FILE).c_str(), std::ios::out | std::ios::binary);
+    filestr.write(DISK_CACHE_VERSION_MAGIC, sizeof(DISK_CACHE_VERSION_MAGIC));
+    if (!filestr.good())
+        AssetModule::LogError("Could not save disk cache version");
 }
 
-void AssetCache::CheckDiskCache(const std::string& path)
+void AssetCache::SaveDiskCacheIndex()
+{
+    std::ofstream filestr((cache_path_ + DISK_CACHE_INDEX_FILE).c_str(), std::ios::out | std::ios::binary);
+    if (!filestr.good())
+    {
+        AssetModule::LogError("Could not save disk cache index");
+        return;
+    }
+
+    u32 count = disk_cache_lru_.size();
+    filestr.write(DISK_CACHE_INDEX_MAGIC, sizeof(DISK_CACHE_INDEX_MAGIC));
+    filestr.write((const char *)&count, sizeof(count));
+    for (DiskCacheLruList::const_iterator i = disk_cache_lru_.begin(); i != disk_cache_lru_.end(); ++i)
+    {
+        u32 size = disk_cache_index_[*i].size_;
+        filestr.write((const char *)i->data, RexUUID::cSizeBytes);
+        filestr.write((const char *)&size, sizeof(size));
+    }
+}
+
+void AssetCache::CheckDiskCache(const std::string& path, DiskCacheKeySet& keys)
 {
     try
     {
@@ -56,10 +190,9 @@ void AssetCache::CheckDiskCache(const std::string& path)
         boost::filesystem::directory_iterator end_iter;
         while (i != end_iter)
         {
-            if (boost::filesystem::is_regular_file(i->status()))
-            {
-                disk_cache_contents_.insert(i->path().native_directory_string());
-            }
+            RexUUID key;
+            if (boost::filesystem::is_regular_file(i->status()) && ParseFileName(i->path().leaf(), key))
+                keys.insert(key);
             ++i;
         }
     }
@@ -68,142 +201,243 @@ void AssetCache::CheckDiskCache(const std::string& path)
     }
 }
 
-bool CompareAssetAge(RexAsset* lhs, RexAsset* rhs)
+void AssetCache::AddDiskCacheEntry(const RexUUID& key, uint size)
 {
-    // Favor oldest assets for deletion
-    return lhs->GetAge() > rhs->GetAge();
+    DiskCacheIndex::iterator i = disk_cache_index_.find(key);
+    if (i != disk_cache_index_.end())
+    {
+        disk_cache_total_size_ -= i->second.size_;
+        disk_cache_lru_.erase(i->second.lru_);
+    }
+    else
+        i = disk_cache_index_.insert(std::make_pair(key, DiskCacheEntry())).first;
+
+    i->second.size_ = size;
+    i->second.lru_ = disk_cache_lru_.insert(disk_cache_lru_.end(), key);
+    disk_cache_total_size_ += size;
+
+    // Delete least recently used files, but never the one just added
+    while (disk_cache_total_size_ > disk_cache_size_ && disk_cache_lru_.size() > 1)
+    {
+        RexUUID oldest = disk_cache_lru_.front();
+        RemoveDiskCacheEntry(oldest);
+
+        DiskCacheRequestPtr request(new DiskCacheRequest());
+        request->operation_ = DiskCacheRequest::Delete;
+        request->path_ = cache_path_ + "/" + GetFileName(oldest);
+        QueueDiskRequest(request);
+    }
 }
 
-void AssetCache::Update(f64 frametime)
+void AssetCache::RemoveDiskCacheEntry(const RexUUID& key)
 {
-    update_time_ += frametime;
-    if (update_time_ < CACHE_CHECK_INTERVAL)
+    DiskCacheIndex::iterator i = disk_cache_index_.find(key);
+    if (i == disk_cache_index_.end())
         return;
-    
-    AssetMap::iterator i = assets_.begin();
-    std::vector<RexAsset*> oldest_assets;
-    
-    uint total_size = 0;
-    while (i != assets_.end())
+
+    disk_cache_total_size_ -= i->second.size_;
+    disk_cache_lru_.erase(i->second.lru_);
+    disk_cache_index_.erase(i);
+}
+
+void AssetCache::QueueDiskRequest(DiskCacheRequestPtr request)
+{
+    // The task is added only after the index has been loaded; no file operations are queued while loading
+    if (task_manager_.GetThreadTask("AssetDiskCache"))
+        task_manager_.AddRequest<DiskCacheRequest>("AssetDiskCache", request);
+    else if (request->operation_ == DiskCacheRequest::Delete)
+        RemoveFile(request->path_);
+}
+
+bool AssetCache::FindDiskAsset(const std::string& asset_id, std::string& path)
+{
+    RexUUID key = GetDiskCacheKey(asset_id);
+    DiskCacheIndex::iterator i = disk_cache_index_.find(key);
+    if (i != disk_cache_index_.end())
     {
-        RexAsset* asset = dynamic_cast<RexAsset*>(i->second.get());
-        if (asset)
-        {
-            asset->AddAge(update_time_);
-            oldest_assets.push_back(asset);
-            total_size += asset->GetSize();
-        }
-        
-        ++i;
+        // Mark as most recently used
+        disk_cache_lru_.splice(disk_cache_lru_.end(), disk_cache_lru_, i->second.lru_);
+        path = cache_path_ + "/" + GetFileName(key);
+        return true;
     }
-    
-    std::sort(oldest_assets.begin(), oldest_assets.end(), CompareAssetAge);
-    
-    int deletes = 0;
-    while ((total_size > memory_cache_size_) && (deletes < CACHE_MAX_DELETES) && (oldest_assets.size()))
+
+    if (!local_cache_contents_.empty())
     {
-        RexAsset* asset = *oldest_assets.begin();
-        AssetMap::iterator i = assets_.begin();
-        while (i != assets_.end())
+        RexUUID hash = GetHash(asset_id);
+        if (local_cache_contents_.find(hash) != local_cache_contents_.end())
         {
-            if (i->second.get() == asset)
-            {
-                total_size -= asset->GetSize();
-                AssetModule::LogDebug("Removed cached asset " + asset->GetId() + " age " + ToString<Real>(asset->GetAge()));
-                assets_.erase(i);
-                oldest_assets.erase(oldest_assets.begin());
-                break;
-            }
-            ++i;
+            path = local_cache_path_ + "/" + GetFileName(hash);
+            return true;
         }
-        
-        ++deletes;
     }
-    
-    update_time_ = 0.0;
+
+    return false;
 }
 
-Foundation::AssetPtr AssetCache::GetAsset(const std::string& asset_id, bool check_memory, bool check_disk)
+void AssetCache::StoreMemoryAsset(Foundation::AssetPtr asset)
+{
+    const std::string& asset_id = asset->GetId();
+
+    AssetMap::iterator i = assets_.find(asset_id);
+    if (i != assets_.end())
+        RemoveMemoryAsset(i);
+
+    AssetEntry& entry = assets_[asset_id];
+    entry.asset_ = asset;
+    entry.size_ = asset->GetSize();
+    entry.lru_ = assets_lru_.insert(assets_lru_.end(), asset_id);
+    memory_cache_total_size_ += entry.size_;
+
+    Foundation::AssetCacheInfo& info = cache_info_[asset->GetType()];
+    info.count_++;
+    info.size_ += entry.size_;
+
+    // Evict least recently used assets, but never the one just stored
+    while (memory_cache_total_size_ > memory_cache_size_ && assets_lru_.size() > 1)
+    {
+        AssetMap::iterator oldest = assets_.find(assets_lru_.front());
+        assert(oldest != assets_.end());
+        AssetModule::LogDebug("Removed cached asset " + oldest->first);
+        cache_info_[oldest->second.asset_->GetType()].evictions_++;
+        RemoveMemoryAsset(oldest);
+    }
+}
+
+void AssetCache::RemoveMemoryAsset(AssetMap::iterator i)
+{
+    Foundation::AssetCacheInfo& info = cache_info_[i->second.asset_->GetType()];
+    info.count_--;
+    info.size_ -= i->second.size_;
+
+    memory_cache_total_size_ -= i->second.size_;
+    assets_lru_.erase(i->second.lru_);
+    assets_.erase(i);
+}
+
+Foundation::AssetPtr AssetCache::GetAsset(const std::string& asset_id, bool check_memory, bool check_disk, const std::string& asset_type)
 {
     if (check_memory)
     {
         AssetMap::iterator i = assets_.find(asset_id);
         if (i != assets_.end())
         {
-            RexAsset* asset = dynamic_cast<RexAsset*>(i->second.get());            
-            if (asset)
-                asset->ResetAge();
+            // Mark as most recently used
+            assets_lru_.splice(assets_lru_.end(), assets_lru_, i->second.lru_);
+            if (!asset_type.empty())
+                cache_info_[i->second.asset_->GetType()].hits_++;
         
-            return i->second;
+            return i->second.asset_;
         }
+
+        if (!asset_type.empty())
+            cache_info_[asset_type].misses_++;
     }
     
-    std::string asset_hash = GetHash(asset_id);
-    
-    if (check_disk)
+    // If an asynchronous read is pending, do not read the same file again synchronously
+    if (check_disk && !IsDiskReadPending(asset_id))
     {
-        std::set<std::string>::iterator i = disk_cache_contents_.begin();
-        while (i != disk_cache_contents_.end())
+        // If a write is pending, the file may be incomplete, so take the asset being written instead
+        PendingWriteMap::const_iterator w = pending_writes_.find(asset_id);
+        if (w != pending_writes_.end())
         {
-            if (i->find(asset_hash) != std::string::npos)
-                break;
-            ++i;
+            Foundation::AssetPtr asset = w->second.asset_;
+            StoreMemoryAsset(asset);
+            return asset;
         }
-        
-        if (i != disk_cache_contents_.end())
+
+        std::string path;
+        if (FindDiskAsset(asset_id, path))
         {
-            boost::filesystem::path file_path(*i);
-            std::ifstream filestr(file_path.native_directory_string().c_str(), std::ios::in | std::ios::binary);
-            if (filestr.good())
+            std::string type;
+            std::vector<u8> data;
+            if (DiskCacheTask::ReadCacheFile(path, type, data))
             {
-                filestr.seekg(0, std::ios::end);
-                uint length = filestr.tellg();
-                filestr.seekg(0, std::ios::beg);
-
-                if (length > 1)
-                {
-                    std::string type;
-                    char c = 0;
-                    uint name_length = 0;
-                    
-                    do
-                    {
-                        filestr.read(&c, 1);
-                        if (c)
-                        {
-                            type.append(1, c);
-                            name_length++;
-                        }
-                        length--;
-                    } while (c && name_length < 256);
-                            
-                    if ((name_length > 2) || (name_length < 256))
-                    {
-                        RexAsset* new_asset = new RexAsset(asset_id, type);
-                        assets_[asset_id] = Foundation::AssetPtr(new_asset);
-                    
-                        RexAsset::AssetDataVector& data = new_asset->GetDataInternal();
-                        data.resize(length);
-                        filestr.read((char *)&data[0], length);
-                        filestr.close();
-                        return assets_[asset_id];
-                    }
-                }
-
-                AssetModule::LogError("Malformed asset file " + asset_id + " found in cache.");
-                disk_cache_contents_.erase(i);
+                RexAsset* new_asset = new RexAsset(asset_id, type);
+                new_asset->GetDataInternal().swap(data);
+                Foundation::AssetPtr asset(new_asset);
+                StoreMemoryAsset(asset);
+                return asset;
+            }
 
-                filestr.close();
+            AssetModule::LogError("Malformed or missing asset file " + asset_id + " in cache.");
+            RemoveDiskCacheEntry(GetDiskCacheKey(asset_id));
+        }
+    }
+    
+    return Foundation::AssetPtr();
+}
+
+bool AssetCache::HasDiskAsset(const std::string& asset_id)
+{
+    if (disk_cache_index_.find(GetDiskCacheKey(asset_id)) != disk_cache_index_.end())
+        return true;
+
+    return !local_cache_contents_.empty() && local_cache_contents_.find(GetHash(asset_id)) != local_cache_contents_.end();
+}
+
+bool AssetCache::RequestDiskAsset(const std::string& asset_id)
+{
+    if (IsDiskReadPending(asset_id))
+        return true;
+
+    std::string path;
+    if (!FindDiskAsset(asset_id, path))
+        return false;
+
+    DiskCacheRequestPtr request(new DiskCacheRequest());
+    request->operation_ = DiskCacheRequest::Read;
+    request->asset_id_ = asset_id;
+    request->path_ = path;
+    QueueDiskRequest(request);
+
+    pending_reads_.insert(asset_id);
+    return true;
+}
+
+void AssetCache::GetFinishedDiskReads(std::vector<std::pair<std::string, Foundation::AssetPtr> >& assets)
+{
+    std::vector<Foundation::ThreadTaskResultPtr> results = task_manager_.GetResults();
+    for (uint i = 0; i < results.size(); ++i)
+    {
+        DiskCacheResult* result = checked_static_cast<DiskCacheResult*>(results[i].get());
+        if (result->operation_ == DiskCacheRequest::Write)
+        {
+            PendingWriteMap::iterator j = pending_writes_.find(result->asset_id_);
+            if (j != pending_writes_.end() && --j->second.count_ == 0)
+            {
+                pending_writes_.erase(j);
+                // Do not leave the file of a failed write in the index
+                if (!result->success_)
+                    RemoveDiskCacheEntry(GetDiskCacheKey(result->asset_id_));
             }
+            continue;
+        }
+
+        pending_reads_.erase(result->asset_id_);
+
+        Foundation::AssetPtr asset;
+        if (result->success_)
+        {
+            // The asset may have arrived from elsewhere while the read was pending
+            AssetMap::iterator j = assets_.find(result->asset_id_);
+            if (j != assets_.end())
+                asset = j->second.asset_;
             else
             {
-                // File got deleted by someone else while program was running, or something, do not re-check
-                disk_cache_contents_.erase(i);
+                RexAsset* new_asset = new RexAsset(result->asset_id_, result->asset_type_);
+                new_asset->GetDataInternal().swap(result->data_);
+                asset = Foundation::AssetPtr(new_asset);
+                StoreMemoryAsset(asset);
             }
         }
+        else
+        {
+            AssetModule::LogError("Malformed or missing asset file " + result->asset_id_ + " in cache.");
+            RemoveDiskCacheEntry(GetDiskCacheKey(result->asset_id_));
+        }
+
+        assets.push_back(std::make_pair(result->asset_id_, asset));
     }
-    
-    return Foundation::AssetPtr();
 }
 
 void AssetCache::StoreAsset(Foundation::AssetPtr asset)
@@ -213,39 +447,69 @@ void AssetCache::StoreAsset(Foundation::AssetPtr asset)
     AssetModule::LogDebug("Storing complete asset " + asset_id);
 
     // Store to memory cache
-    assets_[asset_id] = asset;
+    StoreMemoryAsset(asset);
+
+    // Store to disk cache. The index is updated right away; the write is queued before any later read of the same file.
+    RexUUID key = GetDiskCacheKey(asset_id);
+    AddDiskCacheEntry(key, asset->GetType().size() + 1 + asset->GetSize());
+
+    DiskCacheRequestPtr request(new DiskCacheRequest());
+    request->operation_ = DiskCacheRequest::Write;
+    request->asset_id_ = asset_id;
+    request->path_ = cache_path_ + "/" + GetFileName(key);
+    request->asset_ = asset;
+    QueueDiskRequest(request);
 
-    // Store to disk cache
-    boost::filesystem::path file_path(cache_path_ + "/" + GetHash(asset_id));
-    std::ofstream filestr(file_path.native_directory_string().c_str(), std::ios::out | std::ios::binary);
-    if (filestr.good())
+    // Until the write finishes, disk reads of the asset are served from it. The reads queued to the disk cache
+    // thread are served after the write, so only the synchronous reads need this.
+    if (task_manager_.GetThreadTask("AssetDiskCache"))
     {
-        const u8* data = asset->GetData();
-        uint size = asset->GetSize();
+        PendingWrite& pending = pending_writes_[asset_id];
+        pending.asset_ = asset;
+        pending.count_++;
+    }
+}
+
+RexUUID AssetCache::GetDiskCacheKey(const std::string& asset_id)
+{
+    if (RexUUID::IsValid(asset_id))
+        return RexUUID(asset_id);
 
-        // Store first the asset type, then the actual data
-        const std::string& type = asset->GetType();
-        const char* type_cstr = type.c_str();
+    return GetHash(asset_id);
+}
 
-        filestr.write((const char *)type_cstr, type.size() + 1);
-        filestr.write((const char *)&data[0], size);
-        filestr.close();
+RexUUID AssetCache::GetHash(const std::string& asset_id)
+{
+    QByteArray md5 = QCryptographicHash::hash(QByteArray(asset_id.c_str(), asset_id.size()), QCryptographicHash::Md5);
+    RexUUID key;
+    memcpy(key.data, md5.constData(), RexUUID::cSizeBytes);
+    return key;
+}
 
-        disk_cache_contents_.insert(file_path.native_directory_string());
-    }
-    else
+std::string AssetCache::GetFileName(const RexUUID& key)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+    std::string filename(RexUUID::cSizeBytes * 2, '0');
+    for (uint i = 0; i < RexUUID::cSizeBytes; ++i)
     {
-        AssetModule::LogError("Error storing asset " + asset_id + " to cache.");
+        filename[i * 2] = hex_digits[key.data[i] >> 4];
+        filename[i * 2 + 1] = hex_digits[key.data[i] & 0xf];
     }
+    return filename;
 }
 
-std::string AssetCache::GetHash(const std::string &asset_id)
+bool AssetCache::ParseFileName(const std::string& filename, RexUUID& key)
 {
-    QCryptographicHash md5_engine_(QCryptographicHash::Md5);
-    md5_engine_.addData(asset_id.c_str(), asset_id.size());
-    QString md5_hash(md5_engine_.result().toHex());
-    md5_engine_.reset();
-    return md5_hash.toStdString();
+    if (filename.length() != RexUUID::cSizeBytes * 2)
+        return false;
+    for (uint i = 0; i < filename.length(); ++i)
+    {
+        if (!isxdigit(filename[i]))
+            return false;
+    }
+
+    key.FromString(filename);
+    return true;
 }
 
 }
@@ -3,16 +3,41 @@
 #ifndef incl_Asset_AssetCache_h
 #define incl_Asset_AssetCache_h
 
-class QCryptographicHash;
+#include "RexUUID.h"
+#include "ThreadTaskManager.h"
+#include "DiskCacheTask.h"
+#include "AssetServiceInterface.h"
+
+#include <boost/unordered_map.hpp>
+#include <boost/unordered_set.hpp>
 
 namespace Asset
 {
+    //! Hash function for disk cache keys. The keys are either UUIDs or MD5 digests, so any of their bytes are well distributed.
+    struct DiskCacheKeyHash
+    {
+        std::size_t operator()(const RexUUID& key) const
+        {
+            std::size_t hash;
+            memcpy(&hash, key.data, sizeof(hash));
+            return hash;
+        }
+    };
+
     //! Stores assets to memory and/or disk based cache. Created and used by AssetManager.
+    /*! The memory cache is a hash map combined with a least recently used list, and its total size is tracked as
+        assets are added and removed. When the size limit is exceeded, least recently used assets are evicted in
+        constant time per asset.
+
+        The disk cache is indexed by a 16-byte key: the asset UUID for UUID asset ids, and the MD5 digest of the id
+        for others (for example http urls). The index, with the size of each file in least recently used order,
+        is stored to the cache directory on exit and loaded and deleted at startup, so the cache directory does not
+        need to be scanned unless the previous session crashed. The total size of the disk cache is bounded; least recently used files are deleted when it
+        is exceeded. Disk reads and writes are performed in a DiskCacheTask thread.
+     */
     class AssetCache
     {
     public:
-        typedef std::map<std::string, Foundation::AssetPtr> AssetMap;
-            
         //! Constructor
         /*! \param framework Framework
          */ 
@@ -22,56 +47,188 @@ namespace Asset
         ~AssetCache();
 
         //! Tries to get asset from cache, memory first, then disk
-        /*! \param asset_id Asset ID
+        /*! Note: the disk read is synchronous. Use RequestDiskAsset() to read without blocking.
+            \param asset_id Asset ID
             \param check_memory Whether to check memory cache
             \param check_disk Whether to check disk cache
+            \param asset_type Asset type for the memory cache hit & miss statistics. If empty, the lookup is not counted.
             \return Pointer to asset if found, or null if not
          */
-        Foundation::AssetPtr GetAsset(const std::string& asset_id, bool check_memory = true, bool check_disk = true);
+        Foundation::AssetPtr GetAsset(const std::string& asset_id, bool check_memory = true, bool check_disk = true, const std::string& asset_type = std::string());
 
         //! Stores asset to cache. Posts ASSET_READY event when done.
         /*! \param asset Asset
          */
         void StoreAsset(Foundation::AssetPtr asset);
 
-        //! Returns all assets
-        const AssetMap& GetAssets() const { return assets_; }
-        
-        //! Update. Adds age to assets, removes oldest if cache size too big
-        void Update(f64 frametime);
+        //! Returns whether asset is in disk cache, without reading it
+        /*! \param asset_id Asset ID
+         */
+        bool HasDiskAsset(const std::string& asset_id);
+
+        //! Queues an asynchronous read of an asset from disk cache
+        /*! When finished, the asset is stored to memory cache and returned by GetFinishedDiskReads().
+            \param asset_id Asset ID
+            \return true if asset is in disk cache and read was queued or is already pending, false if not in disk cache
+         */
+        bool RequestDiskAsset(const std::string& asset_id);
+
+        //! Returns whether an asynchronous disk read is pending for an asset
+        bool IsDiskReadPending(const std::string& asset_id) const { return pending_reads_.find(asset_id) != pending_reads_.end(); }
+
+        //! Collects finished asynchronous disk reads, and forgets finished writes
+        /*! \param assets Vector to receive the finished reads as asset id & asset pairs. Asset is null if the read failed.
+         */
+        void GetFinishedDiskReads(std::vector<std::pair<std::string, Foundation::AssetPtr> >& assets);
+
+        //! Returns memory cache contents & statistics per asset type
+        const Foundation::AssetCacheInfoMap& GetCacheInfo() const { return cache_info_; }
 
     private:
+        //! Least recently used order of memory cache assets, oldest first
+        typedef std::list<std::string> AssetLruList;
+
+        //! Memory cache entry
+        struct AssetEntry
+        {
+            //! The asset
+            Foundation::AssetPtr asset_;
+            //! Asset size at the time it was stored
+            uint size_;
+            //! Position in the LRU list
+            AssetLruList::iterator lru_;
+        };
+
+        typedef boost::unordered_map<std::string, AssetEntry> AssetMap;
+
+        //! Stores an asset to the memory cache as most recently used, and evicts least recently used assets if needed
+        void StoreMemoryAsset(Foundation::AssetPtr asset);
+
+        //! Removes an asset from the memory cache
+        void RemoveMemoryAsset(AssetMap::iterator i);
+
+        //! Least recently used order of disk cache files, oldest first
+        typedef std::list<RexUUID> DiskCacheLruList;
+
+        //! Disk cache index entry
+        struct DiskCacheEntry
+        {
+            //! File size in bytes
+            uint size_;
+            //! Position in the LRU list
+            DiskCacheLruList::iterator lru_;
+        };
+
+        //! Asynchronous disk write that has not finished yet
+        struct PendingWrite
+        {
+            PendingWrite() : count_(0) {}
+
+            //! Latest asset queued for writing
+            Foundation::AssetPtr asset_;
+            //! Number of writes queued for the asset
+            uint count_;
+        };
+
+        typedef boost::unordered_map<std::string, PendingWrite> PendingWriteMap;
+
+        typedef boost::unordered_map<RexUUID, DiskCacheEntry, DiskCacheKeyHash> DiskCacheIndex;
+        typedef boost::unordered_set<RexUUID, DiskCacheKeyHash> DiskCacheKeySet;
+
+        //! Loads the disk cache index and deletes the file. If it does not exist or is invalid, builds the index by scanning the cache directory
+        void LoadDiskCacheIndex();
+
+        //! Returns whether the cache directory is marked to hold files of the current format
+        bool IsDiskCacheVersionCurrent();
+
+        //! Marks the cache directory to hold files of the current format
+        void SaveDiskCacheVersion();
+
+        //! Saves the disk cache index
+        void SaveDiskCacheIndex();
+
         //! Check contents of a disk cache path
         /*! \param path Disk cache path
+            \param keys Set to receive the keys of the files found
          */
-        void CheckDiskCache(const std::string& path);
+        void CheckDiskCache(const std::string& path, DiskCacheKeySet& keys);
+
+        //! Finds a file from the disk cache. Marks it as most recently used.
+        /*! \param asset_id Asset ID
+            \param path String to receive full path of the file
+            \return true if found
+         */
+        bool FindDiskAsset(const std::string& asset_id, std::string& path);
+
+        //! Adds or updates a disk cache index entry as most recently used, and deletes least recently used files if needed
+        void AddDiskCacheEntry(const RexUUID& key, uint size);
+
+        //! Removes a disk cache index entry
+        void RemoveDiskCacheEntry(const RexUUID& key);
+
+        //! Queues a disk cache file operation
+        void QueueDiskRequest(DiskCacheRequestPtr request);
+
+        //! Returns disk cache key for an asset id
+        static RexUUID GetDiskCacheKey(const std::string& asset_id);
+
+        //! Calculates MD5 hash from given asset id
+        static RexUUID GetHash(const std::string& asset_id);
 
-        //! Calculates hash from given asset id
-        //! Used for file name generation
-        std::string GetHash(const std::string &asset_id);
+        //! Returns file name for a disk cache key
+        static std::string GetFileName(const RexUUID& key);
+
+        //! Parses a disk cache key from a file name. Returns false if file name is not a disk cache file name
+        static bool ParseFileName(const std::string& filename, RexUUID& key);
 
         //! Asset memory cache
         AssetMap assets_;
 
+        //! Least recently used order of memory cache assets
+        AssetLruList assets_lru_;
+
+        //! Total size of assets in memory cache
+        uint memory_cache_total_size_;
+
+        //! Memory cache contents & statistics per asset type
+        Foundation::AssetCacheInfoMap cache_info_;
+
         //! Current disk asset cache path
         std::string cache_path_;
         
+        //! Local secondary (read-only) disk cache path
+        std::string local_cache_path_;
+
         //! Maximum memory cache size
         uint memory_cache_size_;
         
-        //! Update time accumulator
-        f64 update_time_;
+        //! Maximum disk cache size
+        uint disk_cache_size_;
+
+        //! Index of assets in disk cache
+        DiskCacheIndex disk_cache_index_;
 
-        //! Assets known to be in disk cache
-        //! Values are hash values from asset id's
-        std::set<std::string> disk_cache_contents_;
+        //! Least recently used order of disk cache index entries
+        DiskCacheLruList disk_cache_lru_;
+
+        //! Total size of files in disk cache
+        boost::uint64_t disk_cache_total_size_;
+
+        //! Assets known to be in local secondary cache. Files there are named by the MD5 hash of the asset id.
+        DiskCacheKeySet local_cache_contents_;
+
+        //! Assets with a pending asynchronous disk read
+        std::set<std::string> pending_reads_;
+
+        //! Assets with a pending asynchronous disk write. Their files may be incomplete.
+        PendingWriteMap pending_writes_;
+
+        //! Thread task manager for the disk cache thread. Results are polled by the cache instead of sent as events.
+        Foundation::ThreadTaskManager task_manager_;
 
         //! Framework
         Foundation::Framework* framework_;
-
-        //! MD5 Engine
-        QCryptographicHash *md5_engine_;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -34,7 +34,7 @@ namespace Asset
     
     Foundation::AssetPtr AssetManager::GetAsset(const std::string& asset_id, const std::string& asset_type)
     {
-        return GetFromCache(asset_id);
+        return GetFromCache(asset_id, asset_type);
     }
   
     bool AssetManager::IsValidId(const std::string& asset_id)
@@ -56,7 +56,7 @@ namespace Asset
     {
         request_tag_t tag = framework_->GetEventManager()->GetNextRequestTag();
         
-        Foundation::AssetPtr asset = GetFromCache(asset_id);
+        Foundation::AssetPtr asset = cache_->GetAsset(asset_id, true, false, asset_type);
         if (asset)
         {
             Events::AssetReady* event_data = new Events::AssetReady(asset->GetId(), asset->GetType(), asset, tag);
@@ -65,18 +65,47 @@ namespace Asset
             return tag;
         }
         
+        // If not in memory and no transfer in progress, read from disk cache without blocking. ASSET_READY will be sent when done.
+        bool in_progress = false;
+        AssetProviderVector::iterator i = providers_.begin();
+        while (i != providers_.end())
+        {
+            if ((*i)->InProgress(asset_id))
+            {
+                in_progress = true;
+                break;
+            }
+            ++i;
+        }
+        
+        if (!in_progress && cache_->RequestDiskAsset(asset_id))
+        {
+            PendingDiskRequest& pending = pending_disk_requests_[asset_id];
+            pending.asset_type_ = asset_type;
+            pending.tags_.push_back(tag);
+            return tag;
+        }
+        
+        if (RequestFromProviders(asset_id, asset_type, tag))
+            return tag;
+        
+        AssetModule::LogInfo("No asset provider would accept request for asset " + asset_id);
+        return 0;
+    }
+    
+    bool AssetManager::RequestFromProviders(const std::string& asset_id, const std::string& asset_type, request_tag_t tag)
+    {
         AssetProviderVector::iterator i = providers_.begin();
         while (i != providers_.end())
         {
             // See if a provider can handle request
             if ((*i)->RequestAsset(asset_id, asset_type, tag))
-                return tag;
+                return true;
             
             ++i;
         }
         
-        AssetModule::LogInfo("No asset provider would accept request for asset " + asset_id);
-        return 0;
+        return false;
     }
     
     Foundation::AssetPtr AssetManager::GetIncompleteAsset(const std::string& asset_id, const std::string& asset_type, uint received)
@@ -113,6 +142,10 @@ namespace Asset
             ++i;
         }          
         
+        // If being read from disk cache, status is not known until the read finishes
+        if (cache_->IsDiskReadPending(asset_id))
+            return false;
+        
         // If not ongoing, check cache
         Foundation::AssetPtr asset = GetFromCache(asset_id);
         if (asset)
@@ -189,14 +222,41 @@ namespace Asset
             ++i;
         }      
         
-        // Update cache
-        cache_->Update(frametime); 
+        ProcessDiskCacheReads();
+    }
+    
+    void AssetManager::ProcessDiskCacheReads()
+    {
+        std::vector<std::pair<std::string, Foundation::AssetPtr> > reads;
+        cache_->GetFinishedDiskReads(reads);
+        
+        for (uint i = 0; i < reads.size(); ++i)
+        {
+            PendingDiskRequestMap::iterator j = pending_disk_requests_.find(reads[i].first);
+            if (j == pending_disk_requests_.end())
+                continue;
+            
+            Foundation::AssetPtr asset = reads[i].second;
+            const RequestTagVector& tags = j->second.tags_;
+            for (uint k = 0; k < tags.size(); ++k)
+            {
+                if (asset)
+                {
+                    Events::AssetReady event_data(asset->GetId(), asset->GetType(), asset, tags[k]);
+                    framework_->GetEventManager()->SendEvent(event_category_, Events::ASSET_READY, &event_data);
+                }
+                else if (!RequestFromProviders(reads[i].first, j->second.asset_type_, tags[k]))
+                    AssetModule::LogInfo("No asset provider would accept request for asset " + reads[i].first);
+            }
+            
+            pending_disk_requests_.erase(j);
+        }
     }
     
-    Foundation::AssetPtr AssetManager::GetFromCache(const std::string& asset_id)
+    Foundation::AssetPtr AssetManager::GetFromCache(const std::string& asset_id, const std::string& asset_type)
     {
         // First check memory cache
-        Foundation::AssetPtr asset = cache_->GetAsset(asset_id, true, false);
+        Foundation::AssetPtr asset = cache_->GetAsset(asset_id, true, false, asset_type);
         if (asset)
             return asset;
 
@@ -216,20 +276,10 @@ namespace Asset
     
     Foundation::AssetCacheInfoMap AssetManager::GetAssetCacheInfo()
     {
-        Foundation::AssetCacheInfoMap ret;
         if (!cache_)
-            return ret;
+            return Foundation::AssetCacheInfoMap();
             
-        const AssetCache::AssetMap& assets = cache_->GetAssets();
-        AssetCache::AssetMap::const_iterator i = assets.begin();
-        while (i != assets.end())
-        {
-            ret[i->second->GetType()].count_++;
-            ret[i->second->GetType()].size_ += i->second->GetSize();
-            ++i;
-        }
-        
-        return ret;
+        return cache_->GetCacheInfo();
     }    
     
     Foundation::AssetTransferInfoVector AssetManager::GetAssetTransferInfo()
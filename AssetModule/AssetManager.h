@@ -99,7 +99,7 @@ namespace Asset
         virtual void StoreAsset(Foundation::AssetPtr asset);
                 
         //! Performs time-based update
-        /*! Calls update function of all registered asset providers, and of cache
+        /*! Calls update function of all registered asset providers, and handles finished disk cache reads
             \param frametime Seconds since last frame
          */
         void Update(f64 frametime);            
@@ -110,8 +110,17 @@ namespace Asset
         
         //! Gets asset from cache
         /*! \param asset_id Asset ID
+            \param asset_type Asset type for cache statistics, empty if not known
          */
-        Foundation::AssetPtr GetFromCache(const std::string& asset_id);
+        Foundation::AssetPtr GetFromCache(const std::string& asset_id, const std::string& asset_type = std::string());
+
+        //! Sends ASSET_READY events for finished disk cache reads, or passes the requests on to asset providers if the reads failed
+        void ProcessDiskCacheReads();
+
+        //! Passes an asset request on to the asset providers
+        /*! \return true if a provider accepted the request
+         */
+        bool RequestFromProviders(const std::string& asset_id, const std::string& asset_type, request_tag_t tag);
           
         //! Framework we belong to
         Foundation::Framework* framework_;
@@ -126,6 +135,19 @@ namespace Asset
         //! Asset providers
         typedef std::vector<Foundation::AssetProviderPtr> AssetProviderVector;
         AssetProviderVector providers_;           
+
+        //! Asset request waiting for an asynchronous disk cache read
+        struct PendingDiskRequest
+        {
+            //! Asset type
+            std::string asset_type_;
+            //! Request tags
+            RequestTagVector tags_;
+        };
+
+        //! Asset requests waiting for asynchronous disk cache reads, by asset id
+        typedef std::map<std::string, PendingDiskRequest> PendingDiskRequestMap;
+        PendingDiskRequestMap pending_disk_requests_;
     };
 }
 
@@ -53,6 +53,7 @@ namespace Asset
         }
 
         framework_category_id_ = framework_->GetEventManager()->QueryEventCategory("Framework");
+        framework_->GetEventManager()->SubscribeEvent(this, framework_category_id_, Foundation::NETWORKING_REGISTERED);
     }
 
     void AssetModule::PostInitialize()
@@ -70,12 +71,17 @@ namespace Asset
         network_state_category_id_ = framework_->GetEventManager()->QueryEventCategory("NetworkState");
         if (network_state_category_id_ == 0)
             LogWarning("Failed to query \"NetworkState\" event category");
+        else
+            framework_->GetEventManager()->SubscribeEvent(this, network_state_category_id_, ProtocolUtilities::Events::EVENT_SERVER_DISCONNECTED);
 
         inboundcategory_id_ = framework_->GetEventManager()->QueryEventCategory("NetworkIn");
         if (inboundcategory_id_ == 0 )
             LogWarning("Unable to find event category for OpenSimNetwork events!");
         else
+        {
+            framework_->GetEventManager()->SubscribeEventCategory(this, inboundcategory_id_);
             LogInfo("System " + Name() + " subscribed to network events [NetworkIn]");
+        }
     }
 
     void AssetModule::UnsubscribeNetworkEvents()
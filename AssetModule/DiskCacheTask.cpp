@@ -0,0 +1,121 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "AssetModule.h"
+#include "DiskCacheTask.h"
+#include "Profiler.h"
+
+namespace Asset
+{
+
+const uint MAX_TYPE_NAME_LENGTH = 256;
+
+DiskCacheTask::DiskCacheTask() :
+    Foundation::ThreadTask("AssetDiskCache")
+{
+}
+
+void DiskCacheTask::Work()
+{
+    // Keep serving requests after being told to stop until the queue is empty, so that no writes are lost on exit
+    for (;;)
+    {
+        WaitForRequests();
+
+        DiskCacheRequestPtr request = GetNextRequest<DiskCacheRequest>();
+        if (!request && !ShouldRun())
+            break;
+
+        if (request)
+        {
+            PROFILE(DiskCacheTask_Request);
+            switch (request->operation_)
+            {
+            case DiskCacheRequest::Read:
+                {
+                    DiskCacheResultPtr result(new DiskCacheResult());
+                    result->tag_ = request->tag_;
+                    result->asset_id_ = request->asset_id_;
+                    result->success_ = ReadCacheFile(request->path_, result->asset_type_, result->data_);
+                    QueueResult<DiskCacheResult>(result);
+                }
+                break;
+
+            case DiskCacheRequest::Write:
+                {
+                    DiskCacheResultPtr result(new DiskCacheResult());
+                    result->tag_ = request->tag_;
+                    result->operation_ = DiskCacheRequest::Write;
+                    result->asset_id_ = request->asset_id_;
+                    result->success_ = WriteCacheFile(request->path_, request->asset_);
+                    if (!result->success_)
+                        AssetModule::LogError("Error storing asset " + request->asset_id_ + " to cache.");
+                    QueueResult<DiskCacheResult>(result);
+                }
+                break;
+
+            case DiskCacheRequest::Delete:
+                try
+                {
+                    boost::filesystem::remove(request->path_);
+                }
+                catch (std::exception &)
+                {
+                }
+                break;
+            }
+        }
+
+        RESETPROFILER
+    }
+}
+
+bool DiskCacheTask::ReadCacheFile(const std::string& path, std::string& asset_type, std::vector<u8>& data)
+{
+    std::ifstream filestr(path.c_str(), std::ios::in | std::ios::binary);
+    if (!filestr.good())
+        return false;
+
+    filestr.seekg(0, std::ios::end);
+    uint length = filestr.tellg();
+    filestr.seekg(0, std::ios::beg);
+
+    asset_type.clear();
+    char c = 0;
+    do
+    {
+        if (!length)
+            return false;
+        filestr.read(&c, 1);
+        if (c)
+            asset_type.append(1, c);
+        length--;
+    } while (c && asset_type.length() < MAX_TYPE_NAME_LENGTH);
+
+    if (c || asset_type.length() < 2 || !length)
+        return false;
+
+    data.resize(length);
+    filestr.read((char *)&data[0], length);
+    return filestr.good();
+}
+
+bool DiskCacheTask::WriteCacheFile(const std::string& path, Foundation::AssetPtr asset)
+{
+    if (!asset)
+        return false;
+
+    std::ofstream filestr(path.c_str(), std::ios::out | std::ios::binary);
+    if (!filestr.good())
+        return false;
+
+    // Store first the asset type, then the actual data
+    const std::string& type = asset->GetType();
+    filestr.write(type.c_str(), type.size() + 1);
+    if (asset->GetSize())
+        filestr.write((const char *)asset->GetData(), asset->GetSize());
+
+    return filestr.good();
+}
+
+}
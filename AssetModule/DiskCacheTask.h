@@ -0,0 +1,94 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_Asset_DiskCacheTask_h
+#define incl_Asset_DiskCacheTask_h
+
+#include "ThreadTask.h"
+#include "AssetInterface.h"
+
+namespace Asset
+{
+    //! Disk cache file operation, used internally by AssetCache
+    class DiskCacheRequest : public Foundation::ThreadTaskRequest
+    {
+    public:
+        enum Operation
+        {
+            //! Read asset from file
+            Read,
+            //! Write asset to file
+            Write,
+            //! Delete file
+            Delete
+        };
+
+        //! Operation to perform
+        Operation operation_;
+
+        //! Asset ID
+        std::string asset_id_;
+
+        //! Full path of the cache file
+        std::string path_;
+
+        //! Asset to write (Write only)
+        Foundation::AssetPtr asset_;
+    };
+
+    typedef boost::shared_ptr<DiskCacheRequest> DiskCacheRequestPtr;
+
+    //! Disk cache read or write result, used internally by AssetCache. Deletes do not produce results.
+    class DiskCacheResult : public Foundation::ThreadTaskResult
+    {
+    public:
+        DiskCacheResult() : operation_(DiskCacheRequest::Read), success_(false) {}
+
+        //! Operation that was performed
+        DiskCacheRequest::Operation operation_;
+
+        //! Asset ID
+        std::string asset_id_;
+
+        //! Asset type read from the file (Read only)
+        std::string asset_type_;
+
+        //! Asset data read from the file (Read only)
+        std::vector<u8> data_;
+
+        //! Whether the operation succeeded
+        bool success_;
+    };
+
+    typedef boost::shared_ptr<DiskCacheResult> DiskCacheResultPtr;
+
+    //! Performs disk cache file I/O in a thread, so that the main thread does not stall on disk access.
+    /*! Requests are served in the order they were queued, so a read always sees the preceding writes
+        and deletes of the same file.
+     */
+    class DiskCacheTask : public Foundation::ThreadTask
+    {
+    public:
+        //! Constructor
+        DiskCacheTask();
+
+        //! Work function
+        virtual void Work();
+
+        //! Reads a cache file. The file contains the null-terminated asset type, followed by the asset data.
+        /*! \param path Full path of the cache file
+            \param asset_type String to receive the asset type
+            \param data Vector to receive the asset data
+            \return true if successful
+         */
+        static bool ReadCacheFile(const std::string& path, std::string& asset_type, std::vector<u8>& data);
+
+        //! Writes a cache file
+        /*! \param path Full path of the cache file
+            \param asset Asset to write
+            \return true if successful
+         */
+        static bool WriteCacheFile(const std::string& path, Foundation::AssetPtr asset);
+    };
+}
+
+#endif
@@ -35,23 +35,15 @@ namespace Asset
         virtual uint GetSize() const { return data_.size(); }
         
         //! returns asset data
-        virtual const u8* GetData() const { ResetAge(); return &data_[0]; }
+        virtual const u8* GetData() const { return &data_[0]; }
         
         //! returns asset data vector, non-const. For internal use
-        AssetDataVector& GetDataInternal() { ResetAge(); return data_; }
+        AssetDataVector& GetDataInternal() { return data_; }
 
 		//! returns asset metadata
-		virtual Foundation::AssetMetadataInterface* GetMetadata() const { ResetAge(); return (Foundation::AssetMetadataInterface*)&metadata_;}
+		virtual Foundation::AssetMetadataInterface* GetMetadata() const { return (Foundation::AssetMetadataInterface*)&metadata_;}
 
-        //! returns asset age (for caching)
-        f64 GetAge() const { return age_; }
 
-        //! adds age to asset
-        void AddAge(f64 time) const { age_ += time; }
-        
-        //! resets age of asset
-        void ResetAge() const { age_ = 0.0; }
-        
     private:
         //! asset id
         std::string asset_id_;
@@ -61,8 +53,6 @@ namespace Asset
         AssetDataVector data_;
 		//! asset metadata
 		RexAssetMetadata metadata_;
-		//! asset age
-		mutable f64 age_;
     };
 
 }
@@ -3,6 +3,7 @@
 #include "StableHeaders.h"
 #include "NetworkEvents.h"
 #include "RealXtend/RexProtocolMsgIDs.h"
+#include "RealXtend/RexProtocolMessages.h"
 #include "ProtocolModuleOpenSim.h"
 #include "AssetEvents.h"
 #include "AssetManager.h"
@@ -435,7 +436,16 @@ namespace Asset
 
     void UDPAssetProvider::HandleTextureData(ProtocolUtilities::NetInMessage* msg)
     {
-        RexUUID asset_id = msg->ReadUUID();
+        // Texture data is the bulk of the asset traffic, so decode it with the generated codec
+        ProtocolUtilities::Messages::ImagePacket packet;
+        const std::vector<uint8_t>& content = msg->GetData();
+        if ((content.empty()) || (!packet.Decode(&content[0], content.size())))
+        {
+            AssetModule::LogDebug("Malformed ImagePacket received");
+            return;
+        }
+
+        const RexUUID& asset_id = packet.ImageID.ID;
         UDPAssetTransferMap::iterator i = texture_transfers_.find(asset_id);
         if (i == texture_transfers_.end())
         {
@@ -445,12 +455,7 @@ namespace Asset
 
         UDPAssetTransfer& transfer = i->second;
 
-        u16 packet_index = msg->ReadU16();
-
-        //uint data_size; 
-        size_t data_size;
-        const u8* data = msg->ReadBuffer(&data_size); // ImageData block
-        transfer.ReceiveData(packet_index, data, data_size);
+        transfer.ReceiveData(packet.ImageID.Packet, packet.ImageData.Data.data, packet.ImageData.Data.size);
 
         SendAssetProgress(transfer);
 
@@ -2,7 +2,9 @@
 #ifndef incl_Core_HighPerfClock_h
 #define incl_Core_HighPerfClock_h
 
-#include <QDateTime>
+#ifndef _WINDOWS
+#include <time.h>
+#endif
 
 namespace Core
 {
@@ -16,8 +18,9 @@ inline tick_t GetCurrentClockTime()
     QueryPerformanceCounter(&now);
     return *(tick_t*)&now;
 #else
-    uint now = QDateTime::currentDateTime().toTime_t();
-    return now;
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (tick_t)now.tv_sec * 1000000000 + now.tv_nsec;
 #endif
 }
 
@@ -28,7 +31,7 @@ inline tick_t GetCurrentClockFreq()
     QueryPerformanceFrequency(&now);
     return *(tick_t*)&now;
 #else
-    return 1;
+    return 1000000000;
 #endif
 }
 
@@ -17,6 +17,7 @@
 #include "Framework.h"
 #include "EventManager.h"
 #include "ModuleManager.h"
+#include "ThreadTaskManager.h"
 #include "ConsoleCommandServiceInterface.h"
 #include "WorldStream.h"
 #include "SceneEvents.h"
@@ -33,6 +34,8 @@
 #include "EC_OpenSimPresence.h"
 
 #include <utility>
+#include <algorithm>
+#include <sstream>
 
 #include "MemoryLeakCheck.h"
 
@@ -47,7 +50,8 @@ DebugStatsModule::DebugStatsModule() :
     networkEventCategory_(0),
     networkStateEventCategory_(0),
     profilerWindow_(0),
-    participantWindow_(0)
+    participantWindow_(0),
+    lastTaskPoolStatsTime_(0)
 {
 }
 
@@ -57,9 +61,7 @@ DebugStatsModule::~DebugStatsModule()
 
 void DebugStatsModule::PostInitialize()
 {
-#ifdef _WINDOWS
-    QueryPerformanceCounter(&lastCallTime);
-#endif
+    lastCallTime = Core::GetCurrentClockTime();
 
 #ifdef PROFILING
     RegisterConsoleCommand(Console::CreateCommand("Prof", 
@@ -79,9 +81,20 @@ void DebugStatsModule::PostInitialize()
         "Shows the participant window.",
         Console::Bind(this, &DebugStatsModule::ShowParticipantWindow)));
 
+    RegisterConsoleCommand(Console::CreateCommand("EventDispatchStats", 
+        "Prints how many times each event has been sent and how many handlers it has visited. "
+        "Usage: EventDispatchStats(count=20)",
+        Console::Bind(this, &DebugStatsModule::PrintEventDispatchStats)));
+
+    RegisterConsoleCommand(Console::CreateCommand("TaskPoolStats", 
+        "Prints the utilization and queue depth of each task pool worker since the previous call.",
+        Console::Bind(this, &DebugStatsModule::PrintTaskPoolStats)));
+
     frameworkEventCategory_ = framework_->GetEventManager()->QueryEventCategory("Framework");
     if (frameworkEventCategory_ == 0)
         LogError("Failed to query \"Framework\" event category");
+    else
+        framework_->GetEventManager()->SubscribeEvent(this, frameworkEventCategory_, Foundation::WORLD_STREAM_READY);
 }
 
 Console::CommandResult DebugStatsModule::ShowProfilingWindow(const StringVector &params)
@@ -143,19 +156,16 @@ void DebugStatsModule::Update(f64 frametime)
 {
     RESETPROFILER;
 
-#ifdef _WINDOWS
-    LARGE_INTEGER now;
-    QueryPerformanceCounter(&now);
-    double timeSpent = Foundation::ProfilerBlock::ElapsedTimeSeconds(lastCallTime, now);
+    Core::tick_t now = Core::GetCurrentClockTime();
+    double timeSpent = (double)(now - lastCallTime) / Core::GetCurrentClockFreq();
     lastCallTime = now;
 
-    frameTimes.push_back(make_pair(*(boost::uint64_t*)&now, timeSpent));
+    frameTimes.push_back(make_pair(now, timeSpent));
     if (frameTimes.size() > 2048) // Maintain an upper bound in the frame history.
         frameTimes.erase(frameTimes.begin());
 
     if (profilerWindow_)
         profilerWindow_->RedrawFrameTimeHistoryGraph(frameTimes);
-#endif
 }
 
 bool DebugStatsModule::HandleEvent(event_category_id_t category_id, event_id_t event_id, Foundation::EventDataInterface *data)
@@ -173,13 +183,21 @@ bool DebugStatsModule::HandleEvent(event_category_id_t category_id, event_id_t e
             if (profilerWindow_)
                 profilerWindow_->SetWorldStreamPtr(current_world_stream_);
 
-            networkEventCategory_ = framework_->GetEventManager()->QueryEventCategory("NetworkIn");
+            Foundation::EventManagerPtr event_manager = framework_->GetEventManager();
+            networkEventCategory_ = event_manager->QueryEventCategory("NetworkIn");
             if (networkEventCategory_ == 0)
                 LogError("Failed to query \"NetworkIn\" event category");
+            else
+                event_manager->SubscribeEvent(this, networkEventCategory_, RexNetMsgSimStats);
 
-            networkStateEventCategory_ = framework_->GetEventManager()->QueryEventCategory("NetworkState");
+            networkStateEventCategory_ = event_manager->QueryEventCategory("NetworkState");
             if (networkStateEventCategory_ == 0)
                 LogError("Failed to query \"NetworkState\" event category");
+            else
+            {
+                event_manager->SubscribeEvent(this, networkStateEventCategory_, ProtocolUtilities::Events::EVENT_USER_CONNECTED);
+                event_manager->SubscribeEvent(this, networkStateEventCategory_, ProtocolUtilities::Events::EVENT_USER_DISCONNECTED);
+            }
 
             return false;
         }
@@ -307,6 +325,103 @@ Console::CommandResult DebugStatsModule::SendRandomNetworkOutPacket(const String
     return Console::ResultSuccess();
 }
 
+/// Orders events by the number of handlers they have visited, most first.
+static bool CompareHandlersVisited(const std::pair<std::pair<event_category_id_t, event_id_t>, Foundation::EventManager::EventDispatchList> &lhs,
+    const std::pair<std::pair<event_category_id_t, event_id_t>, Foundation::EventManager::EventDispatchList> &rhs)
+{
+    return lhs.second.handlers_visited_ > rhs.second.handlers_visited_;
+}
+
+Console::CommandResult DebugStatsModule::PrintEventDispatchStats(const StringVector &params)
+{
+    size_t count = 20;
+    try
+    {
+        if (params.size() > 0)
+            count = ParseString<int>(params[0]);
+    }
+    catch(std::exception &)
+    {
+        return Console::ResultFailure("Usage: EventDispatchStats(count=20)");
+    }
+
+    Foundation::EventManagerPtr event_manager = framework_->GetEventManager();
+    const Foundation::EventManager::EventDispatchMap &dispatch_lists = event_manager->GetEventDispatchMap();
+    const Foundation::EventManager::EventMap &event_names = event_manager->GetEventMap();
+
+    std::vector<std::pair<std::pair<event_category_id_t, event_id_t>, Foundation::EventManager::EventDispatchList> > events(
+        dispatch_lists.begin(), dispatch_lists.end());
+    std::sort(events.begin(), events.end(), CompareHandlersVisited);
+
+    uint total_sends = 0;
+    uint total_visited = 0;
+    for(size_t i = 0; i < events.size(); ++i)
+    {
+        total_sends += events[i].second.sends_;
+        total_visited += events[i].second.handlers_visited_;
+    }
+
+    std::stringstream ss;
+    ss << "Events sent: " << total_sends << ", handlers visited: " << total_visited << std::endl;
+    for(size_t i = 0; i < events.size() && i < count; ++i)
+    {
+        event_category_id_t category_id = events[i].first.first;
+        event_id_t event_id = events[i].first.second;
+        const Foundation::EventManager::EventDispatchList &list = events[i].second;
+
+        ss << event_manager->QueryEventCategoryName(category_id) << "/";
+        Foundation::EventManager::EventMap::const_iterator category = event_names.find(category_id);
+        std::map<event_id_t, std::string>::const_iterator name;
+        if (category != event_names.end() && (name = category->second.find(event_id)) != category->second.end())
+            ss << name->second;
+        else
+            ss << event_id;
+        ss << ": sent " << list.sends_ << ", handlers visited " << list.handlers_visited_
+            << ", subscribers " << list.subscribers_.size() << std::endl;
+    }
+
+    return Console::ResultSuccess(ss.str());
+}
+
+Console::CommandResult DebugStatsModule::PrintTaskPoolStats(const StringVector &params)
+{
+    Foundation::TaskPool *pool = framework_->GetThreadTaskManager()->GetTaskPool();
+    if (!pool)
+        return Console::ResultFailure("No task pool.");
+
+    std::vector<Foundation::TaskPool::WorkerStats> stats;
+    pool->GetWorkerStats(stats);
+    Core::tick_t now = Core::GetCurrentClockTime();
+
+    // Utilization over the time since the previous call, or since the pool was started on the first call
+    bool have_previous = lastTaskPoolStatsTime_ != 0 && lastTaskPoolStats_.size() == stats.size();
+    double elapsed = have_previous ? (double)(now - lastTaskPoolStatsTime_) / Core::GetCurrentClockFreq() : 0.0;
+
+    std::stringstream ss;
+    ss << "Task pool workers: " << stats.size() << ", queued jobs: " << pool->GetQueueDepth() << std::endl;
+    for(size_t i = 0; i < stats.size(); ++i)
+    {
+        const Foundation::TaskPool::WorkerStats &current = stats[i];
+        ss << "Worker " << i << ": queue " << current.queue_depth_;
+        if (have_previous && elapsed > 0.0)
+        {
+            const Foundation::TaskPool::WorkerStats &previous = lastTaskPoolStats_[i];
+            ss << ", utilization " << (int)(100.0 * (current.busy_time_ - previous.busy_time_) / elapsed) << "%"
+                << ", jobs " << current.jobs_run_ - previous.jobs_run_
+                << ", stolen " << current.jobs_stolen_ - previous.jobs_stolen_;
+        }
+        else
+        {
+            ss << ", busy " << current.busy_time_ << " s, jobs " << current.jobs_run_ << ", stolen " << current.jobs_stolen_;
+        }
+        ss << std::endl;
+    }
+
+    lastTaskPoolStats_ = stats;
+    lastTaskPoolStatsTime_ = now;
+    return Console::ResultSuccess(ss.str());
+}
+
 }
 
 extern "C" void POCO_LIBRARY_API SetProfiler(Foundation::Profiler *profiler);
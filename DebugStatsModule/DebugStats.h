@@ -14,6 +14,8 @@
 #include "ModuleInterface.h"
 #include "ModuleLoggingFunctions.h"
 #include "RexTypes.h"
+#include "TaskPool.h"
+#include "HighPerfClock.h"
 
 #include <QObject>
 #include <QPointer>
@@ -80,13 +82,17 @@ public slots:
         /// Sends random NetOutMessage packet
         Console::CommandResult SendRandomNetworkOutPacket(const StringVector &params);
 
+        /// Prints how many times each event has been sent and how many handlers it has visited
+        Console::CommandResult PrintEventDispatchStats(const StringVector &params);
+
+        /// Prints the utilization and queue depth of each task pool worker since the previous call
+        Console::CommandResult PrintTaskPoolStats(const StringVector &params);
+
         /// A history of estimated frame times.
         std::vector<std::pair<uint64_t, double> > frameTimes;
 
-#ifdef _WINDOWS
         /// Last call time of Update() function
-        LARGE_INTEGER lastCallTime;
-#endif
+        Core::tick_t lastCallTime;
 
         /// Framework event category
         event_category_id_t frameworkEventCategory_;
@@ -105,6 +111,12 @@ public slots:
 
         /// World stream pointer.
         ProtocolUtilities::WorldStreamPtr current_world_stream_;
+
+        /// Task pool worker statistics at the previous TaskPoolStats command.
+        std::vector<Foundation::TaskPool::WorkerStats> lastTaskPoolStats_;
+
+        /// Time of the previous TaskPoolStats command.
+        Core::tick_t lastTaskPoolStatsTime_;
     };
 }
 
@@ -11,6 +11,7 @@
 #include "NetworkMessages/NetInMessage.h"
 #include "NetworkMessages/NetMessageManager.h"
 #include "AssetServiceInterface.h"
+#include "TextureServiceInterface.h"
 #include "WorldStream.h"
 
 #include <utility>
@@ -122,6 +123,8 @@ TimeProfilerWindow::TimeProfilerWindow(Foundation::Framework *fw) : framework_(f
     tree_asset_transfers_ = findChild<QTreeWidget*>("treeAssetTransfers");
     assert(tree_asset_cache_);
     assert(tree_asset_transfers_);
+    label_texture_decode_stats_ = findChild<QLabel*>("labelTextureDecodeStats");
+    assert(label_texture_decode_stats_);
     tree_asset_cache_->header()->resizeSection(1, 60);
     tree_asset_transfers_->header()->resizeSection(0, 240);
     tree_asset_transfers_->header()->resizeSection(1, 90);
@@ -282,12 +285,7 @@ void TimeProfilerWindow::RedrawFrameTimeHistoryGraph(const std::vector<std::pair
     const QPixmap *pixmap = label_frame_time_history_->pixmap();
     QImage image = pixmap->toImage();
 
-#ifdef _WINDOWS
-    LARGE_INTEGER now;
-    LARGE_INTEGER freq;
-    QueryPerformanceCounter(&now);
-    QueryPerformanceFrequency(&freq);
-#endif
+    const double freq = (double)Core::GetCurrentClockFreq();
     const int numEntries = min<int>(frameTimes.size(), image.width());
     const int firstEntry = max<int>(0, frameTimes.size() - numEntries);
 
@@ -314,11 +312,8 @@ void TimeProfilerWindow::RedrawFrameTimeHistoryGraph(const std::vector<std::pair
         double r = 1.0 - min(1.0, frameTimes[firstEntry + i].second / maxTime);
         int y = (int)((image.height()-1)*r);
 
-        uint color = colorOdd;
-#ifdef _WINDOWS
-        double age = (double)frameTimes[firstEntry + i].first / freq.QuadPart;// Foundation::ProfilerBlock::ElapsedTimeSeconds(*(LARGE_INTEGER*)&frameTimes[firstEntry + i].first, now);
-        color = (fmod(age, 2.0) >= 1.0) ? colorOdd : colorEven;
-#endif
+        double age = (double)frameTimes[firstEntry + i].first / freq;
+        uint color = (fmod(age, 2.0) >= 1.0) ? colorOdd : colorEven;
         if ((frameTimes[firstEntry + i].second / maxTime >= 1.0 &&
             frameTimes[firstEntry + i].second >= okFrameTime) || frameTimes[firstEntry + i].second >= maxAllowedFrameTime)
             color = colorTrouble;
@@ -734,6 +729,23 @@ void TimeProfilerWindow::RefreshNetworkProfilingData()
         sprintf(str, "%.2f p/sec", (float)packetLossPerSec);
         findChild<QLabel*>("labelPacketLossIn")->setText(str);
 
+        netMessageManager->lostOutboundPackets.OutputBucketedAccumulated(dstAccum, numEntries, bucketSize, &dstOccur);
+        double packetLossOutPerSec = EventHistory::SmoothedAvgPerSecond(dstAccum, bucketSize, smoothingCoeff);
+        sprintf(str, "%.2f p/sec", (float)packetLossOutPerSec);
+        findChild<QLabel*>("labelPacketLossOut")->setText(str);
+
+        if (netMessageManager->GetRoundTripTime() > 0.0)
+            sprintf(str, "%.0f ms (timeout %.0f ms)", (float)(netMessageManager->GetRoundTripTime() * 1000.0),
+                (float)(netMessageManager->GetRetransmitTimeout() * 1000.0));
+        else
+            sprintf(str, "-");
+        findChild<QLabel*>("labelRoundTripTime")->setText(str);
+
+        findChild<QLabel*>("labelDataInFlight")->setText(FormatBytes((int)netMessageManager->GetBytesInFlight()).c_str());
+
+        sprintf(str, "%.2f sec", (float)netMessageManager->GetTimeSinceLastReceived());
+        findChild<QLabel*>("labelLastHeardSince")->setText(str);
+
         netMessageManager->duplicatesReceived.OutputBucketedAccumulated(dstAccum, numEntries, bucketSize, &dstOccur);
         double duplicatesRecvPerSec = EventHistory::SmoothedAvgPerSecond(dstAccum, bucketSize, smoothingCoeff);
         sprintf(str, "%.2f p/sec", (float)duplicatesRecvPerSec);
@@ -874,6 +886,9 @@ void TimeProfilerWindow::RefreshAssetProfilingData()
         item->setText(0, QString(i->first.c_str()));
         item->setText(1, QString(QString("%1").arg(i->second.count_)));
         item->setText(2, QString(FormatBytes((int)i->second.size_).c_str()));
+        item->setText(3, QString(QString("%1").arg(i->second.hits_)));
+        item->setText(4, QString(QString("%1").arg(i->second.misses_)));
+        item->setText(5, QString(QString("%1").arg(i->second.evictions_)));
         
         ++i;
     }
@@ -893,6 +908,18 @@ void TimeProfilerWindow::RefreshAssetProfilingData()
         ++j;
     }
 
+    boost::shared_ptr<Foundation::TextureServiceInterface> texture_service = 
+        framework_->GetServiceManager()->GetService<Foundation::TextureServiceInterface>(Foundation::Service::ST_Texture).lock();
+    if (texture_service)
+    {
+        Foundation::TextureDecodeStatistics stats = texture_service->GetDecodeStatistics();
+        char str[512];
+        sprintf(str, "Texture decoding: %u decodes, %.2f Mpixels in %.2fs. Saved: %u skipped quality levels (%.2f Mpixels), %u superseded decodes",
+            stats.decodes_, stats.decoded_pixels_ / 1000000.0, stats.decode_time_, stats.skipped_levels_, 
+            stats.skipped_pixels_ / 1000000.0, stats.superseded_decodes_);
+        label_texture_decode_stats_->setText(str);
+    }
+
     QTimer::singleShot(500, this, SLOT(RefreshAssetProfilingData()));
 }
 
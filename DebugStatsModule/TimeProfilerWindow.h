@@ -95,6 +95,7 @@ namespace DebugStats
         QPushButton *push_button_show_unused_;
         QTreeWidget *tree_asset_cache_;
         QTreeWidget *tree_asset_transfers_;
+        QLabel *label_texture_decode_stats_;
 
         int frame_time_update_x_pos_;
 
@@ -14,6 +14,7 @@
 #include "EC_OgrePlaceable.h"
 #include "Entity.h"
 #include "OgreMaterialUtils.h"
+#include "LabelAtlas.h"
 
 #include <Ogre.h>
 #include <OgreBillboardSet.h>
@@ -27,13 +28,23 @@
 
 //#include "MemoryLeakCheck.h"
 
+namespace
+{
+/// Labels are rendered at this fraction of the size they are drawn at, which is plenty for billboards in the world.
+const float cLabelScale = 0.5f;
+
+/// Billboard size per drawn pixel. The bubble is drawn at the scale of a 1600x800 canvas on a 2x1 billboard.
+const float cBillboardUnitsPerPixel = 2.0f / 1600.0f;
+}
+
 EC_ChatBubble::EC_ChatBubble(Foundation::ModuleInterface *module) :
     Foundation::ComponentInterface(module->GetFramework()),
     font_(QFont("Arial", 100)),
     bubbleColor_(QColor(48, 113, 255, 255)),
     textColor_(Qt::white),
     billboardSet_(0),
-    billboard_(0)
+    billboard_(0),
+    labelId_(0)
 {
     renderer_ = framework_->GetServiceManager()->GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer);
 }
@@ -129,60 +140,67 @@ void EC_ChatBubble::Refresh()
     if (messages_.size() == 0)
     {
         billboardSet_->setVisible(false);
+        ReleaseLabel();
         return;
     }
     else
         billboardSet_->setVisible(true);
 
-    // Get pixmap with chat bubble and text rendered to it.
-    QPixmap pixmap = GetChatBubblePixmap();
-    if (pixmap.isNull())
+    boost::shared_ptr<OgreRenderer::LabelAtlas> atlas = renderer_.lock()->GetLabelAtlas();
+
+    // Chat bubbles with the same messages and colors share one label in the atlas
+    QString chatLog = GetChatLog();
+    std::string key = "ChatBubble|" + std::string(font_.toString().toUtf8().constData()) + "|" + ToString(textColor_.rgba()) + "|" +
+        ToString(bubbleColor_.rgba()) + "|" + chatLog.toUtf8().constData();
+    if (labelId_ && key == labelKey_)
         return;
 
-    // Create texture
-    QImage img = pixmap.toImage();
-    Ogre::DataStreamPtr stream(new Ogre::MemoryDataStream((void*)img.bits(), img.byteCount()));
-    std::string tex_name("ChatBubbleTexture" + renderer_.lock()->GetUniqueObjectName());
-    Ogre::TextureManager &manager = Ogre::TextureManager::getSingleton();
-    Ogre::Texture *tex = checked_static_cast<Ogre::Texture *>(manager.create(
-        tex_name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME).get());
-    assert(tex);
+    uint labelId = atlas->AcquireLabel(key);
+    if (!labelId)
+    {
+        // Get image with chat bubble and text rendered to it.
+        QImage image = GetChatBubbleImage(chatLog);
+        if (image.isNull())
+            return;
+
+        labelId = atlas->AddLabel(key, image);
+        if (!labelId)
+            return;
+    }
+
+    ReleaseLabel();
+    labelId_ = labelId;
+    labelKey_ = key;
 
-    tex->loadRawData(stream, img.width(), img.height(), Ogre::PF_A8R8G8B8);
+    // Show the label's part of the atlas texture, at the size the bubble was drawn at
+    const OgreRenderer::LabelAtlas::Label *label = atlas->GetLabel(labelId_);
+    assert(label);
+    billboard_->setTexcoordRect(label->uv_);
+    billboard_->setDimensions(label->width_ / cLabelScale * cBillboardUnitsPerPixel,
+        label->height_ / cLabelScale * cBillboardUnitsPerPixel);
 
-    // Set new texture for the material
+    // The material changes only if the label is in another atlas texture
     assert(!materialName_.empty());
-    if (!materialName_.empty())
+    if (!materialName_.empty() && label->texture_name_ != textureName_)
     {
         Ogre::MaterialManager &mgr = Ogre::MaterialManager::getSingleton();
         Ogre::MaterialPtr material = mgr.getByName(materialName_);
         assert(material.get());
-        OgreRenderer::SetTextureUnitOnMaterial(material, tex_name);
+        OgreRenderer::SetTextureUnitOnMaterial(material, label->texture_name_);
+        textureName_ = label->texture_name_;
     }
 }
 
-QPixmap EC_ChatBubble::GetChatBubblePixmap()
+void EC_ChatBubble::ReleaseLabel()
 {
-    if (renderer_.expired())
-        return 0;
-
-///\todo    Resize the chat bubble and font size according to the render window size and distance
-///         avatar's distance from the camera.
-//    const int minWidth =
-//    const int minHeight =
-//    Ogre::Viewport* viewport = renderer_.lock()->GetViewport();
-//    const int max_width = viewport->getActualWidth()/4;
-//    int max_height = viewport->getActualHeight()/10;
-
-    const int max_width = 1600;
-    int max_height = 800;
-    QRect max_rect(0, 0, max_width, max_height);
-
-    // Create transparent pixmap
-    QPixmap pixmap(max_rect.size());
-    pixmap.fill(Qt::transparent);
+    if (labelId_ && !renderer_.expired())
+        renderer_.lock()->GetLabelAtlas()->ReleaseLabel(labelId_);
+    labelId_ = 0;
+    labelKey_.clear();
+}
 
-    // Gather chat log and calculate the bounding rect size.
+QString EC_ChatBubble::GetChatLog() const
+{
     QStringListIterator it(messages_);
     QString fullChatLog;
     while(it.hasNext())
@@ -209,21 +227,45 @@ QPixmap EC_ChatBubble::GetChatBubblePixmap()
             fullChatLog.append('\n');
     }
 
-    // Create painter
-    QPainter painter(&pixmap);
-    painter.setFont(font_);
+    return fullChatLog;
+}
+
+QImage EC_ChatBubble::GetChatBubbleImage(const QString &chatLog)
+{
+    if (renderer_.expired())
+        return QImage();
+
+///\todo    Resize the chat bubble and font size according to the render window size and distance
+///         avatar's distance from the camera.
+//    const int minWidth =
+//    const int minHeight =
+//    Ogre::Viewport* viewport = renderer_.lock()->GetViewport();
+//    const int max_width = viewport->getActualWidth()/4;
+//    int max_height = viewport->getActualHeight()/10;
+
+    const int max_width = 1600;
+    int max_height = 800;
+    QRect max_rect(0, 0, max_width, max_height);
 
     // Set padding for text.
     // Make the font size temporarily bigger when calculating bounding rect
     // so we get padding without need to modify the rect itself.
-    QFont origFont = painter.font();
-    painter.setFont(QFont(origFont.family(), origFont.pointSize()+12));
-    QRect rect = painter.boundingRect(max_rect, Qt::AlignCenter | Qt::TextWordWrap, fullChatLog);
-    painter.setFont(origFont);
+    QFontMetrics paddingMetric(QFont(font_.family(), font_.pointSize()+12));
+    QRect rect = paddingMetric.boundingRect(max_rect, Qt::AlignCenter | Qt::TextWordWrap, chatLog);
     rect.setHeight(rect.height() - 10);
     // could also try this:
     // QFontMetrics metric(any_qfont); int width = metric.width(mytext) + padding;
 
+    // Create transparent image of the bubble, large enough for its outline, at the label scale
+    QImage image((int)ceil((rect.width() + 1) * cLabelScale), (int)ceil((rect.height() + 1) * cLabelScale), QImage::Format_ARGB32_Premultiplied);
+    image.fill(0);
+
+    // Create painter, drawing the bubble at the origin of the image
+    QPainter painter(&image);
+    painter.scale(cLabelScale, cLabelScale);
+    painter.translate(-rect.topLeft());
+    painter.setFont(font_);
+
     // Color setup
     QLinearGradient grad(rect.topLeft(), rect.bottomLeft());
     grad.setColorAt(0, QColor(39, 92, 206, 255));
@@ -236,8 +278,7 @@ QPixmap EC_ChatBubble::GetChatBubblePixmap()
 
     // Draw text
     painter.setPen(textColor_);
-    painter.drawText(rect, Qt::AlignCenter | Qt::TextWordWrap, fullChatLog);
+    painter.drawText(rect, Qt::AlignCenter | Qt::TextWordWrap, chatLog);
 
-    return pixmap;
+    return image;
 }
-
@@ -77,8 +77,15 @@ private slots:
     void Refresh();
 
 private:
-    /// Returns pixmap with chat bubble and current messages renderer to it.
-    QPixmap GetChatBubblePixmap();
+    /// Returns the current messages as one text, with overlong words split for word wrapping.
+    QString GetChatLog() const;
+
+    /// Returns image with chat bubble and the chat log rendered to it, cropped to the bubble.
+    /// @param chatLog Chat log.
+    QImage GetChatBubbleImage(const QString &chatLog);
+
+    /// Releases the label of the chat bubble from the label atlas.
+    void ReleaseLabel();
 
     /// Renderer pointer.
     boost::weak_ptr<OgreRenderer::Renderer> renderer_;
@@ -92,6 +99,15 @@ private:
     /// Name of the material used for the billboard set.
     std::string materialName_;
 
+    /// Id of the label in the renderer's label atlas, 0 if none.
+    uint labelId_;
+
+    /// Key of the label in the label atlas.
+    std::string labelKey_;
+
+    /// Name of the atlas texture set on the material.
+    std::string textureName_;
+
     /// For used for the chat bubble text.
     QFont font_;
 
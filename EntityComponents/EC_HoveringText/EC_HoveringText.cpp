@@ -14,6 +14,7 @@
 #include "EC_OgrePlaceable.h"
 #include "Entity.h"
 #include "OgreMaterialUtils.h"
+#include "LabelAtlas.h"
 
 #include <Ogre.h>
 #include <OgreBillboardSet.h>
@@ -27,6 +28,21 @@
 
 //#include "MemoryLeakCheck.h"
 
+namespace
+{
+/// Labels are rendered at this fraction of the size they are drawn at, which is plenty for billboards in the world.
+const float cLabelScale = 0.5f;
+
+/// Billboard size per drawn pixel. The text is drawn at the scale of a 1600x800 canvas on a 2x1 billboard.
+const float cBillboardUnitsPerPixel = 2.0f / 1600.0f;
+
+/// Returns a color as a string for a label key.
+std::string ColorKey(const QColor &color)
+{
+    return ToString(color.rgba());
+}
+}
+
 EC_HoveringText::EC_HoveringText(Foundation::ModuleInterface *module) :
     Foundation::ComponentInterface(module->GetFramework()),
     font_(QFont("Arial", 100)),
@@ -34,6 +50,7 @@ EC_HoveringText::EC_HoveringText(Foundation::ModuleInterface *module) :
     textColor_(Qt::black),
     billboardSet_(0),
     billboard_(0),
+    labelId_(0),
     text_(""),
     visibility_animation_timeline_(new QTimeLine(1000, this)),
     visibility_timer_(new QTimer(this)),
@@ -51,6 +68,7 @@ EC_HoveringText::EC_HoveringText(Foundation::ModuleInterface *module) :
 
 EC_HoveringText::~EC_HoveringText()
 {
+    ReleaseLabel();
 }
 
 void EC_HoveringText::SetPosition(const Vector3df& position)
@@ -216,34 +234,72 @@ void EC_HoveringText::Redraw()
     if (renderer_.expired() || !billboardSet_ || !billboard_)
         return;
 
-    // Get pixmap with text rendered to it.
-    QPixmap pixmap = GetTextPixmap();
-    if (pixmap.isNull())
+    boost::shared_ptr<OgreRenderer::LabelAtlas> atlas = renderer_.lock()->GetLabelAtlas();
+
+    // Hovering texts with the same text and style share one label in the atlas
+    std::string key = GetLabelKey();
+    if (labelId_ && key == labelKey_)
         return;
 
-    // Create texture
-    QImage img = pixmap.toImage();
-    Ogre::DataStreamPtr stream(new Ogre::MemoryDataStream((void*)img.bits(), img.byteCount()));
-    std::string tex_name("HoveringTextTexture" + renderer_.lock()->GetUniqueObjectName());
-    Ogre::TextureManager &manager = Ogre::TextureManager::getSingleton();
-    Ogre::Texture *tex = checked_static_cast<Ogre::Texture *>(manager.create(
-        tex_name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME).get());
-    assert(tex);
+    uint labelId = atlas->AcquireLabel(key);
+    if (!labelId)
+    {
+        // Get image with text rendered to it.
+        QImage image = GetTextImage();
+        if (image.isNull())
+            return;
+
+        labelId = atlas->AddLabel(key, image);
+        if (!labelId)
+            return;
+    }
 
-    tex->loadRawData(stream, img.width(), img.height(), Ogre::PF_A8R8G8B8);
+    ReleaseLabel();
+    labelId_ = labelId;
+    labelKey_ = key;
 
-    // Set new texture for the material
+    // Show the label's part of the atlas texture, at the size the text was drawn at
+    const OgreRenderer::LabelAtlas::Label *label = atlas->GetLabel(labelId_);
+    assert(label);
+    billboard_->setTexcoordRect(label->uv_);
+    billboard_->setDimensions(label->width_ / cLabelScale * cBillboardUnitsPerPixel,
+        label->height_ / cLabelScale * cBillboardUnitsPerPixel);
+
+    // The material changes only if the label is in another atlas texture
     assert(!materialName_.empty());
-    if (!materialName_.empty())
+    if (!materialName_.empty() && label->texture_name_ != textureName_)
     {
         Ogre::MaterialManager &mgr = Ogre::MaterialManager::getSingleton();
         Ogre::MaterialPtr material = mgr.getByName(materialName_);
         assert(material.get());
-        OgreRenderer::SetTextureUnitOnMaterial(material, tex_name);
+        OgreRenderer::SetTextureUnitOnMaterial(material, label->texture_name_);
+        textureName_ = label->texture_name_;
+    }
+}
+
+void EC_HoveringText::ReleaseLabel()
+{
+    if (labelId_ && !renderer_.expired())
+        renderer_.lock()->GetLabelAtlas()->ReleaseLabel(labelId_);
+    labelId_ = 0;
+    labelKey_.clear();
+}
+
+std::string EC_HoveringText::GetLabelKey() const
+{
+    std::string key = "HoveringText|" + std::string(font_.toString().toUtf8().constData()) + "|" + ColorKey(textColor_) + "|";
+    if (using_gradient_)
+    {
+        QGradientStops stops = bg_grad_.stops();
+        for(int i = 0; i < stops.size(); ++i)
+            key += ToString(stops[i].first) + ":" + ColorKey(stops[i].second) + ",";
     }
+    else
+        key += ColorKey(backgroundColor_);
+    return key + "|" + text_.toUtf8().constData();
 }
 
-QPixmap EC_HoveringText::GetTextPixmap()
+QImage EC_HoveringText::GetTextImage()
 {
 ///\todo Resize the font size according to the render window size and distance
 /// avatar's distance from the camera
@@ -254,27 +310,22 @@ QPixmap EC_HoveringText::GetTextPixmap()
 //    int max_height = viewport->getActualHeight()/10;
 
     if (renderer_.expired() || text_.isEmpty() || text_ == " ")
-        return 0;
-
-    QRect max_rect(0, 0, 1600, 800);
-
-    // Create transparent pixmap
-    QPixmap pixmap(max_rect.size());
-    pixmap.fill(Qt::transparent);
+        return QImage();
 
-    // Init painter with pixmap as the paint device
-    QPainter painter(&pixmap);
-
-    // Ask painter the rect for the text
-    painter.setFont(font_);
-    QRect rect = painter.boundingRect(max_rect, Qt::AlignCenter | Qt::TextWordWrap, text_);
-
-    // Add some padding to it
+    // Rect for the text, with some padding
     QFontMetrics metric(font_); 
     int width = metric.width(text_) + metric.averageCharWidth();
     int height = metric.height() + 20;
-    rect.setWidth(width);
-    rect.setHeight(height);
+    QRect rect(0, 0, width, height);
+
+    // Create transparent image, large enough for the outline of the background, at the label scale
+    QImage image((int)ceil((width + 1) * cLabelScale), (int)ceil((height + 1) * cLabelScale), QImage::Format_ARGB32_Premultiplied);
+    image.fill(0);
+
+    // Init painter with image as the paint device
+    QPainter painter(&image);
+    painter.scale(cLabelScale, cLabelScale);
+    painter.setFont(font_);
 
     // Set background brush
     if (using_gradient_)
@@ -294,6 +345,5 @@ QPixmap EC_HoveringText::GetTextPixmap()
     painter.setPen(textColor_);
     painter.drawText(rect, Qt::AlignCenter | Qt::TextWordWrap, text_);
 
-    return pixmap;
+    return image;
 }
-
@@ -107,8 +107,14 @@ private slots:
     void Redraw();
 
 private:
-    /// Returns pixmap with chat bubble and current messages renderer to it.
-    QPixmap GetTextPixmap();
+    /// Returns image with the hovering text rendered to it, cropped to the text's background.
+    QImage GetTextImage();
+
+    /// Returns a key identifying the text and style of the hovering text, under which its label is shared in the label atlas.
+    std::string GetLabelKey() const;
+
+    /// Releases the label of the hovering text from the label atlas.
+    void ReleaseLabel();
 
     /// Renderer pointer.
     boost::weak_ptr<OgreRenderer::Renderer> renderer_;
@@ -122,6 +128,15 @@ private:
     /// Name of the material used for the billboard set.
     std::string materialName_;
 
+    /// Id of the label in the renderer's label atlas, 0 if none.
+    uint labelId_;
+
+    /// Key of the label in the label atlas.
+    std::string labelKey_;
+
+    /// Name of the atlas texture set on the material.
+    std::string textureName_;
+
     /// For used for the hovering text.
     QFont font_;
 
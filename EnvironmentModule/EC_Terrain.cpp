@@ -39,7 +39,8 @@ void EC_Terrain::Destroy()
     for(int y = 0; y < cNumPatchesPerEdge; ++y)
         for(int x = 0; x < cNumPatchesPerEdge; ++x)
         {
-            Ogre::SceneNode *node = GetPatch(x, y).node;
+            Patch &patch = GetPatch(x, y);
+            Ogre::SceneNode *node = patch.node;
             if (!node)
                 continue;
 
@@ -47,6 +48,17 @@ void EC_Terrain::Destroy()
 //                sceneMgr->destroyManualObject(dynamic_cast<Ogre::ManualObject*>(node->getAttachedObject(0)));
             node->detachAllObjects();
             sceneMgr->destroySceneNode(node);
+            patch.node = 0;
+
+            // Each patch owns its mesh, remove it along with the entity.
+            if (patch.entity)
+            {
+                Ogre::MeshPtr mesh = patch.entity->getMesh();
+                sceneMgr->destroyEntity(patch.entity);
+                Ogre::MeshManager::getSingleton().remove(mesh->getHandle());
+                patch.entity = 0;
+                patch.lod_key = -1;
+            }
         }
 }
 
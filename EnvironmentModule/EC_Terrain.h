@@ -11,6 +11,7 @@
 namespace Ogre
 {
     class SceneNode;
+    class Entity;
 }
 
 namespace Environment
@@ -27,7 +28,7 @@ namespace Environment
         /// Describes a single patch that is present in the scene.
         struct Patch
         {
-            Patch():x(0),y(0), node(0), patch_geometry_dirty(true) {}
+            Patch():x(0),y(0), node(0), entity(0), lod_key(-1), geometry_generation(0), patch_geometry_dirty(true) {}
 
             static const int cNumVerticesPerPatchEdge = 16;
 
@@ -44,6 +45,15 @@ namespace Environment
             /// Ogre -specific: Store a reference to the actual render hierarchy node.
             Ogre::SceneNode *node;
 
+            /// Ogre -specific: The entity of the patch mesh, attached to the node. Null until the first mesh has been built.
+            Ogre::Entity *entity;
+
+            /// Key of the index list the mesh is drawn with, from GetTerrainLodKey(). -1 if none is set.
+            int lod_key;
+
+            /// Number of the latest mesh build started for this patch. Results of earlier builds are discarded.
+            uint geometry_generation;
+
             /// If true, the CPU-side heightmap data has changed, but we haven't yet updated
             /// the GPU-side geometry resources since the neighboring patches haven't been loaded
             /// in yet.
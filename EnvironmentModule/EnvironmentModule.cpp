@@ -25,6 +25,9 @@
 #include "ModuleManager.h"
 #include "EventManager.h"
 #include "RexNetworkUtils.h"
+#include "TerrainDecoder.h"
+#include "BitStream.h"
+#include "HighPerfClock.h"
 
 namespace Environment
 {
@@ -84,6 +87,10 @@ namespace Environment
         input_event_category_ = event_manager_->QueryEventCategory("Input");
         if (input_event_category_ == 0)
             LogError("Failed to query \"Input\" event category");
+
+        RegisterConsoleCommand(Console::CreateCommand("TerrainDecodeBenchmark",
+            "Measures decoding of the recently received terrain LayerData packets. Usage: TerrainDecodeBenchmark(iterations)",
+            Console::Bind(this, &EnvironmentModule::ConsoleTerrainDecodeBenchmark)));
     }
 
     void EnvironmentModule::SubscribeToNetworkEvents()
@@ -117,6 +124,13 @@ namespace Environment
         if (environment_editor_ == 0 && terrain_.get() != 0 && water_.get() != 0)
             environment_editor_ = new EnvironmentEditor(this);
 
+        if (terrain_.get())
+        {
+            if (terrain_->UpdateDecodedPatches() && environment_editor_)
+                environment_editor_->UpdateTerrain();
+            terrain_->UpdateGeometry();
+        }
+
         if ((currentWorldStream_) && currentWorldStream_->IsConnected())
         {
             if (environment_.get())
@@ -226,11 +240,7 @@ namespace Environment
         {
             if(terrain_.get())
             {
-                static int count = 0;
-                bool kill_event = terrain_->HandleOSNE_LayerData(netdata);
-                if (environment_editor_)
-                    environment_editor_->UpdateTerrain();
-                return kill_event;
+                return terrain_->HandleOSNE_LayerData(netdata);
             }
         }
         case RexNetMsgGenericMessage:
@@ -503,6 +513,64 @@ namespace Environment
         }
     }
 
+    Console::CommandResult EnvironmentModule::ConsoleTerrainDecodeBenchmark(const StringVector &params)
+    {
+        int iterations = 20;
+        try
+        {
+            if (params.size() > 0)
+                iterations = ParseString<int>(params[0]);
+        }
+        catch (std::exception &)
+        {
+            return Console::ResultFailure("Usage: TerrainDecodeBenchmark(iterations)");
+        }
+        if (iterations <= 0)
+            return Console::ResultFailure("Usage: TerrainDecodeBenchmark(iterations)");
+
+        if (!terrain_.get() || terrain_->GetRecordedLayerData().empty())
+            return Console::ResultFailure("No terrain LayerData packets received yet.");
+
+        const std::deque<LayerDataPayloadPtr> &payloads = terrain_->GetRecordedLayerData();
+        uint num_patches = 0;
+        Real max_difference = 0.f;
+
+        Core::tick_t scalar_time = 0;
+        Core::tick_t decode_time = 0;
+        for (int i = 0; i < iterations; ++i)
+            for (size_t j = 0; j < payloads.size(); ++j)
+            {
+                const std::vector<u8> &payload = *payloads[j];
+
+                std::vector<DecodedTerrainPatch> scalar_patches;
+                Core::tick_t start = Core::GetCurrentClockTime();
+                ProtocolUtilities::BitStream bits(&payload[0], payload.size());
+                TerrainPatchGroupHeader header = DecodePatchGroupHeader(bits);
+                DecompressLandScalar(scalar_patches, bits, header);
+                scalar_time += Core::GetCurrentClockTime() - start;
+
+                start = Core::GetCurrentClockTime();
+                DecodedLayerDataPtr decoded = DecodeLayerData(payloads[j]);
+                decode_time += Core::GetCurrentClockTime() - start;
+
+                if (i == 0)
+                {
+                    num_patches += decoded->patches.size();
+                    for (size_t k = 0; k < decoded->patches.size() && k < scalar_patches.size(); ++k)
+                        for (size_t l = 0; l < decoded->patches[k].heightData.size(); ++l)
+                            max_difference = std::max(max_difference,
+                                (Real)fabs(decoded->patches[k].heightData[l] - scalar_patches[k].heightData[l]));
+                }
+            }
+
+        double freq = (double)Core::GetCurrentClockFreq();
+        double scalar_ms = scalar_time * 1000.0 / freq / iterations;
+        double decode_ms = decode_time * 1000.0 / freq / iterations;
+        return Console::ResultSuccess("Decoded " + ToString(payloads.size()) + " LayerData packets with " + ToString(num_patches) +
+            " patches: scalar " + ToString(scalar_ms) + " ms, vectorized " + ToString(decode_ms) + " ms, max height difference " +
+            ToString(max_difference));
+    }
+
     void EnvironmentModule::CreateTerrain()
     {
         terrain_ = TerrainPtr(new Terrain(this));
@@ -12,6 +12,7 @@
 #include "ModuleInterface.h"
 #include "ModuleLoggingFunctions.h"
 #include "WorldStream.h"
+#include "ConsoleCommandServiceInterface.h"
 
 namespace Foundation
 {
@@ -122,6 +123,9 @@ namespace Environment
          */
         void SendModifyLandMessage(f32 x, f32 y, u8 brush, u8 action, Real seconds, Real height);
 
+        //! Console command that times the terrain decoder against the original scalar one on the recently received LayerData packets.
+        Console::CommandResult ConsoleTerrainDecodeBenchmark(const StringVector &params);
+
         MODULE_LOGGING_FUNCTIONS
 
         //! @return Returns name of this module. Needed for logging.
@@ -15,6 +15,7 @@
 
 #include "EC_OgrePlaceable.h"
 #include "Renderer.h"
+#include "MeshBvhCache.h"
 #include "OgreTextureResource.h"
 #include "OgreMaterialUtils.h"
 #include "OgreConversionUtils.h"
@@ -28,11 +29,17 @@
 #include "ServiceManager.h"
 #include "RexTypes.h"
 #include "NetworkMessages/NetInMessage.h"
+#include "ThreadTaskManager.h"
+#include "ConfigurationManager.h"
 
 #include "Entity.h"
 
 #include <OgreMesh.h>
+#include <OgreSubMesh.h>
+#include <OgreMeshManager.h>
+#include <OgreHardwareBufferManager.h>
 #include <OgreEntity.h>
+#include <OgreCamera.h>
 
 namespace
 {
@@ -63,6 +70,7 @@ namespace Environment
     Terrain::Terrain(EnvironmentModule *owner)
     :owner_(owner)
     {
+        lod_distance_ = owner_->GetFramework()->GetDefaultConfig().DeclareSetting("EnvironmentModule", "terrain_lod_distance", 64.f);
     }
 
     Terrain::~Terrain()
@@ -144,137 +152,219 @@ namespace Environment
         manual->setDebugDisplayEnabled(true);
     }
 
-    /// Creates Ogre geometry data for the single given patch, or updates the geometry for an existing
-    /// patch if the associated Ogre resources already exist.
-    void Terrain::GenerateTerrainGeometryForOnePatch(Scene::Entity &entity, EC_Terrain &terrain, EC_Terrain::Patch &patch)
+    /// Copies the heights the mesh of the given patch needs and starts building the mesh in the task pool.
+    /// The heights are copied so that the height data can keep changing while the mesh is being built.
+    void Terrain::StartPatchGeometryBuild(Scene::Entity &entity, EC_Terrain &terrain, EC_Terrain::Patch &patch)
     {
-        boost::shared_ptr<OgreRenderer::Renderer> renderer = owner_->GetFramework()->GetServiceManager()->GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer).lock();
-        if (!renderer)
-            return;
+        TerrainPatchHeightsPtr heights(new TerrainPatchHeights());
+        heights->patchX = patch.x;
+        heights->patchY = patch.y;
+        heights->generation = ++patch.geometry_generation;
+
+        const int originX = patch.x * EC_Terrain::cPatchSize - 1;
+        const int originY = patch.y * EC_Terrain::cPatchSize - 1;
+        for(int y = 0; y < TerrainPatchHeights::cEdge; ++y)
+            for(int x = 0; x < TerrainPatchHeights::cEdge; ++x)
+                heights->heights[y * TerrainPatchHeights::cEdge + x] = terrain.GetPoint(originX + x, originY + y);
+
+        patch.patch_geometry_dirty = false;
 
-        Ogre::SceneNode *node = patch.node;
-        bool firstTimeFill = (node == 0);
-        if (!node)
+        Foundation::TaskPool *pool = owner_->GetFramework()->GetThreadTaskManager()->GetTaskPool();
+        if (pool)
         {
-            CreateOgreTerrainPatchNode(node, patch.x, patch.y);
-            patch.node = node;
+            pending_geometry_.push_back(pool->Submit<TerrainPatchGeometryPtr>(boost::bind(&BuildTerrainPatchGeometry, heights)));
         }
-        assert(node);
+        else
+        {
+            UploadPatchGeometry(entity, terrain, *BuildTerrainPatchGeometry(heights));
+            emit HeightmapGeometryUpdated();
+        }
+    }
 
-        Ogre::MaterialPtr terrainMaterial = OgreRenderer::GetOrCreateLitTexturedMaterial(terrainMaterialName);
+    /// Copies the built vertices of a patch to its Ogre mesh. The mesh and its entity are created for the first build of the
+    /// patch, later builds overwrite the vertex buffer.
+    void Terrain::UploadPatchGeometry(Scene::Entity &entity, EC_Terrain &terrain, const TerrainPatchGeometry &geometry)
+    {
+        boost::shared_ptr<OgreRenderer::Renderer> renderer = owner_->GetFramework()->GetServiceManager()->GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer).lock();
+        if (!renderer)
+            return;
 
-        Ogre::SceneManager *sceneMgr = renderer->GetSceneManager();
-        Ogre::ManualObject *manual = sceneMgr->createManualObject(renderer->GetUniqueObjectName());
-        manual->setCastShadows(false);
+        EC_Terrain::Patch &patch = terrain.GetPatch(geometry.patchX, geometry.patchY);
+        if (!patch.node)
+            CreateOgreTerrainPatchNode(patch.node, patch.x, patch.y);
+        assert(patch.node);
 
-        manual->clear();
-        manual->estimateVertexCount(17*17);
-        manual->estimateIndexCount(17*17*3*2);
-        manual->begin(terrainMaterial->getName(), Ogre::RenderOperation::OT_TRIANGLE_LIST);
+        if (!patch.entity)
+        {
+            Ogre::MeshPtr mesh = Ogre::MeshManager::getSingleton().createManual(renderer->GetUniqueObjectName(),
+                Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+            mesh->setAutoBuildEdgeLists(false);
+
+            Ogre::SubMesh *subMesh = mesh->createSubMesh();
+            subMesh->useSharedVertices = false;
+            subMesh->vertexData = new Ogre::VertexData();
+            subMesh->vertexData->vertexStart = 0;
+            subMesh->vertexData->vertexCount = cNumPatchMeshVertices;
+
+            // Same layout as the vertices from BuildTerrainPatchGeometry().
+            Ogre::VertexDeclaration *decl = subMesh->vertexData->vertexDeclaration;
+            size_t offset = 0;
+            offset += decl->addElement(0, offset, Ogre::VET_FLOAT3, Ogre::VES_POSITION).getSize();
+            offset += decl->addElement(0, offset, Ogre::VET_FLOAT3, Ogre::VES_NORMAL).getSize();
+            offset += decl->addElement(0, offset, Ogre::VET_FLOAT2, Ogre::VES_TEXTURE_COORDINATES, 0).getSize();
+            assert(offset == cPatchMeshVertexFloats * sizeof(float));
+
+            // Shadowed, so that Renderer::Raycast() can read the vertices back.
+            Ogre::HardwareVertexBufferSharedPtr buffer = Ogre::HardwareBufferManager::getSingleton().createVertexBuffer(
+                offset, cNumPatchMeshVertices, Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY, true);
+            subMesh->vertexData->vertexBufferBinding->setBinding(0, buffer);
+
+            Ogre::MaterialPtr terrainMaterial = OgreRenderer::GetOrCreateLitTexturedMaterial(terrainMaterialName);
+            subMesh->setMaterialName(terrainMaterial->getName());
+
+            // Start at full detail until UpdatePatchLods() selects the level.
+            const int fullDetail[4] = { 0, 0, 0, 0 };
+            const LodIndices &indices = GetLodIndices(GetTerrainLodKey(0, fullDetail));
+            subMesh->indexData->indexBuffer = indices.buffer;
+            subMesh->indexData->indexStart = 0;
+            subMesh->indexData->indexCount = indices.count;
+            patch.lod_key = GetTerrainLodKey(0, fullDetail);
+
+            mesh->_setBounds(Ogre::AxisAlignedBox(0.f, 0.f, 0.f, (float)EC_Terrain::cPatchSize, (float)EC_Terrain::cPatchSize, 0.f));
+            mesh->load();
 
-        const float vertexSpacingX = 1.f;
-        const float vertexSpacingY = 1.f;
-        const float patchSpacingX = 16 * vertexSpacingX;
-        const float patchSpacingY = 16 * vertexSpacingY;
-//        const Ogre::Vector3 patchOrigin(patch.y * patchSpacingY, 0.f, patch.x * patchSpacingX);
-        const Ogre::Vector3 patchOrigin(patch.x * patchSpacingX, patch.y * patchSpacingY, 0.f);
+            Ogre::SceneManager *sceneMgr = renderer->GetSceneManager();
+            patch.entity = sceneMgr->createEntity(renderer->GetUniqueObjectName(), mesh->getName());
+            patch.entity->setUserAny(Ogre::Any(&entity));
+            patch.entity->setCastShadows(false);
+            patch.node->attachObject(patch.entity);
+        }
 
-        int curIndex = 0;
+        Ogre::MeshPtr mesh = patch.entity->getMesh();
+        Ogre::HardwareVertexBufferSharedPtr buffer = mesh->getSubMesh(0)->vertexData->vertexBufferBinding->getBuffer(0);
+        buffer->writeData(0, buffer->getSizeInBytes(), &geometry.vertices[0], true);
+        // The buffer is rewritten in place, so the raycast cache cannot tell that the triangles changed.
+        renderer->GetMeshBvhCache()->Invalidate(mesh);
 
-        const int stride = (patch.x + 1 >= terrain.cNumPatchesPerEdge) ? 16 : 17;
+        const Ogre::AxisAlignedBox bounds(0.f, 0.f, geometry.minHeight, (float)EC_Terrain::cPatchSize, (float)EC_Terrain::cPatchSize, geometry.maxHeight);
+        mesh->_setBounds(bounds);
+        mesh->_setBoundingSphereRadius(bounds.getHalfSize().length());
+        patch.node->needUpdate();
+    }
 
-        const int patchSize = EC_Terrain::Patch::cNumVerticesPerPatchEdge;
+    void Terrain::UpdateGeometry()
+    {
+        PROFILE(Terrain_UpdateGeometry);
 
-        const float uScale = 1e-2f*13;
-        const float vScale = 1e-2f*13;
+        Scene::EntityPtr terrain = GetTerrainEntity().lock();
+        EC_Terrain *terrainComponent = terrain ? terrain->GetComponent<EC_Terrain>().get() : 0;
 
-        for(int y = 0; y <= patchSize; ++y)
-            for(int x = 0; x <= patchSize; ++x)
+        // Upload the finished meshes. A result is dropped if the patch has been rebuilt since, or if the terrain is gone.
+        bool uploaded = false;
+        for(size_t i = 0; i < pending_geometry_.size();)
+        {
+            if (!pending_geometry_[i].IsReady())
             {
-                if ((patch.x + 1 >= terrain.cNumPatchesPerEdge && x == patchSize) ||
-                    (patch.y + 1 >= terrain.cNumPatchesPerEdge && y == patchSize))
-                    continue;
-                // These coordinates are directly generated to our Ogre coordinate system, i.e. are cycled from OpenSim XYZ -> our YZX.
-                // see OpenSimToOgreCoordinateAxes.
-                Ogre::Vector3 pos;
-// Ogre:                pos.x = vertexSpacingY * y;
-// Ogre:                pos.z = vertexSpacingX * x;
-                pos.x = vertexSpacingX * x;
-                pos.y = vertexSpacingY * y;
-
-                EC_Terrain::Patch *thisPatch;
-                int X = x;
-                int Y = y;
-                if (x < patchSize && y < patchSize)
-                {
-                    thisPatch = &patch;
-
-                    if ((patch.x + 1 < terrain.cNumPatchesPerEdge || x+1 < patchSize) &&
-                        (patch.y + 1 < terrain.cNumPatchesPerEdge || y+1 < patchSize))
-                    {
-                        manual->index(curIndex);
-                        manual->index(curIndex+1);
-                        manual->index(curIndex+stride);
+                ++i;
+                continue;
+            }
 
-                        manual->index(curIndex+1);
-                        manual->index(curIndex+stride+1);
-                        manual->index(curIndex+stride);
-                    }
-                }
-                else if (x == patchSize && y == patchSize)
-                {
-                    thisPatch = &terrain.GetPatch(patch.x + 1, patch.y + 1);
-                    X = 0;
-                    Y = 0;
-                }
-                else if (x == patchSize)
-                {
-                    thisPatch = &terrain.GetPatch(patch.x + 1, patch.y);
-                    X = 0;
-                }
-                else // (y == patchSize)
+            try
+            {
+                TerrainPatchGeometryPtr geometry = pending_geometry_[i].Get();
+                if (terrainComponent &&
+                    terrainComponent->GetPatch(geometry->patchX, geometry->patchY).geometry_generation == geometry->generation)
                 {
-                    thisPatch = &terrain.GetPatch(patch.x, patch.y + 1);
-                    Y = 0;
+                    UploadPatchGeometry(*terrain, *terrainComponent, *geometry);
+                    uploaded = true;
                 }
+            }
+            catch(Exception &e)
+            {
+                EnvironmentModule::LogError(std::string("Failed to build terrain patch mesh: ") + e.what());
+            }
+            pending_geometry_.erase(pending_geometry_.begin() + i);
+        }
 
-// Ogre:        pos.y = thisPatch->heightData[Y*patchSize+X];
-                pos.z = thisPatch->heightData[Y*patchSize+X];
+        if (uploaded)
+            emit HeightmapGeometryUpdated();
 
-                manual->position(pos);
-                manual->normal(OgreRenderer::ToOgreVector3(terrain.CalculateNormal(thisPatch->x, thisPatch->y, X, Y)));
-// Ogre:                manual->textureCoord((patchOrigin.x + pos.x) * uScale, (patchOrigin.z + pos.z) * vScale);
-                manual->textureCoord((patchOrigin.x + pos.x) * uScale, (patchOrigin.y + pos.y) * vScale);
-                ++curIndex;
-            }
+        if (terrainComponent)
+            UpdatePatchLods(*terrainComponent);
+    }
 
-        manual->end();
+    /// Selects the level of detail of each patch by the distance of its center from the camera. A patch next to a coarser
+    /// patch is drawn with an index list that matches the coarser edge.
+    void Terrain::UpdatePatchLods(EC_Terrain &terrain)
+    {
+        boost::shared_ptr<OgreRenderer::Renderer> renderer = owner_->GetFramework()->GetServiceManager()->GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer).lock();
+        if (!renderer || !renderer->GetCurrentCamera())
+            return;
 
-        std::string mesh_name = renderer->GetUniqueObjectName();
-        Ogre::MeshPtr terrainMesh = manual->convertToMesh(mesh_name);
+        const Ogre::Vector3 cameraPos = renderer->GetCurrentCamera()->getDerivedPosition();
 
-        // Odd: destroyManualObject seems to leave behind a memory leak if we don't call manualObject->clear first.
-        manual->clear();
-        sceneMgr->destroyManualObject(manual);
+        int lods[EC_Terrain::cNumPatchesPerEdge][EC_Terrain::cNumPatchesPerEdge];
+        for(int y = 0; y < EC_Terrain::cNumPatchesPerEdge; ++y)
+            for(int x = 0; x < EC_Terrain::cNumPatchesPerEdge; ++x)
+            {
+                const EC_Terrain::Patch &patch = terrain.GetPatch(x, y);
+                lods[y][x] = 0;
+                if (patch.entity)
+                {
+                    const Ogre::Vector3 center = patch.node->_getDerivedPosition() + patch.entity->getBoundingBox().getCenter();
+                    lods[y][x] = SelectTerrainLod(center.distance(cameraPos), lod_distance_);
+                }
+            }
 
-        Ogre::Entity *ogre_entity = sceneMgr->createEntity(renderer->GetUniqueObjectName(), mesh_name);
-        ogre_entity->setUserAny(Ogre::Any(&entity));
-        ogre_entity->setCastShadows(false);
+        // Past the edge of the terrain there is nothing to match, treat those neighbors as being at the same level.
+        const int last = EC_Terrain::cNumPatchesPerEdge - 1;
+        for(int y = 0; y < EC_Terrain::cNumPatchesPerEdge; ++y)
+            for(int x = 0; x < EC_Terrain::cNumPatchesPerEdge; ++x)
+            {
+                EC_Terrain::Patch &patch = terrain.GetPatch(x, y);
+                if (!patch.entity)
+                    continue;
 
-        // Explicitly destroy all attached MovableObjects previously bound to this terrain node.
-        Ogre::SceneNode::ObjectIterator iter = node->getAttachedObjectIterator();
-        while(iter.hasMoreElements())
-        {
-            Ogre::MovableObject *obj = iter.getNext();
-            sceneMgr->destroyMovableObject(obj);
-        }
-        node->detachAllObjects();
-        // Now attach the new built terrain mesh.
-        node->attachObject(ogre_entity);
+                const int lod = lods[y][x];
+                const int neighborLods[4] =
+                {
+                    x > 0 ? lods[y][x-1] : lod,
+                    x < last ? lods[y][x+1] : lod,
+                    y > 0 ? lods[y-1][x] : lod,
+                    y < last ? lods[y+1][x] : lod
+                };
+                SetPatchLod(patch, GetTerrainLodKey(lod, neighborLods));
+            }
+    }
 
-        patch.patch_geometry_dirty = false;
+    void Terrain::SetPatchLod(EC_Terrain::Patch &patch, int lodKey)
+    {
+        if (patch.lod_key == lodKey)
+            return;
 
-        emit HeightmapGeometryUpdated();
+        const LodIndices &indices = GetLodIndices(lodKey);
+        Ogre::IndexData *indexData = patch.entity->getMesh()->getSubMesh(0)->indexData;
+        indexData->indexBuffer = indices.buffer;
+        indexData->indexStart = 0;
+        indexData->indexCount = indices.count;
+        patch.lod_key = lodKey;
+    }
+
+    const Terrain::LodIndices &Terrain::GetLodIndices(int lodKey)
+    {
+        std::map<int, LodIndices>::iterator iter = lod_indices_.find(lodKey);
+        if (iter != lod_indices_.end())
+            return iter->second;
+
+        std::vector<u16> indexList;
+        BuildTerrainPatchIndices(lodKey, indexList);
+
+        LodIndices &indices = lod_indices_[lodKey];
+        indices.count = indexList.size();
+        indices.buffer = Ogre::HardwareBufferManager::getSingleton().createIndexBuffer(Ogre::HardwareIndexBuffer::IT_16BIT,
+            indexList.size(), Ogre::HardwareBuffer::HBU_STATIC_WRITE_ONLY, true);
+        indices.buffer->writeData(0, indices.buffer->getSizeInBytes(), &indexList[0], true);
+        return indices;
     }
 
     void Terrain::CreateOgreTerrainPatchNode(Ogre::SceneNode *&node, int patchX, int patchY)
@@ -389,7 +479,7 @@ namespace Environment
                 }
 
                 if (neighborsLoaded)
-                    GenerateTerrainGeometryForOnePatch(*terrain, *terrainComponent, scenePatch);
+                    StartPatchGeometryBuild(*terrain, *terrainComponent, scenePatch);
             }
     }
 
@@ -439,25 +529,24 @@ namespace Environment
         if (!packedData)
             return false;
         ProtocolUtilities::BitStream bits(packedData, sizeBytes);
-        TerrainPatchGroupHeader header;
-
-        header.stride = bits.ReadBits(16);
-        header.patchSize = bits.ReadBits(8);
-        header.layerType = bits.ReadBits(8);
+        TerrainPatchGroupHeader header = DecodePatchGroupHeader(bits);
 
         switch(header.layerType)
         {
         case TPLayerLand:
         {
-            std::vector<DecodedTerrainPatch> patches;
-            DecompressLand(patches, bits, header);
-            for(size_t i = 0; i < patches.size(); ++i)
-                CreateOrUpdateTerrainPatchHeightData(patches[i], header.patchSize);
-
-            // Now that we have updated all the height map data for each patch, see if
-            // we have enough of the patches loaded in to regenerate the GPU-side resources
-            // as well.
-            RegenerateDirtyTerrainPatches();
+            // Copy the packet data out of the message, and decode it in the task pool if there is one.
+            // The decoded patches are applied in arrival order by UpdateDecodedPatches().
+            LayerDataPayloadPtr payload(new std::vector<u8>(packedData, packedData + sizeBytes));
+            recorded_layer_data_.push_back(payload);
+            if (recorded_layer_data_.size() > cMaxRecordedLayerData)
+                recorded_layer_data_.pop_front();
+
+            Foundation::TaskPool *pool = owner_->GetFramework()->GetThreadTaskManager()->GetTaskPool();
+            if (pool)
+                pending_layer_data_.push_back(pool->Submit<DecodedLayerDataPtr>(boost::bind(&DecodeLayerData, payload)));
+            else
+                ApplyDecodedLayerData(DecodeLayerData(payload));
             break;
         }
         default:
@@ -467,6 +556,38 @@ namespace Environment
         return false;
     }
 
+    bool Terrain::UpdateDecodedPatches()
+    {
+        bool applied = false;
+        while(!pending_layer_data_.empty() && pending_layer_data_.front().IsReady())
+        {
+            try
+            {
+                ApplyDecodedLayerData(pending_layer_data_.front().Get());
+                applied = true;
+            }
+            catch(Exception &e)
+            {
+                EnvironmentModule::LogError("Failed to decode terrain LayerData: " + std::string(e.what()));
+            }
+            pending_layer_data_.pop_front();
+        }
+        return applied;
+    }
+
+    void Terrain::ApplyDecodedLayerData(DecodedLayerDataPtr decoded)
+    {
+        PROFILE(ApplyDecodedLayerData);
+
+        for(size_t i = 0; i < decoded->patches.size(); ++i)
+            CreateOrUpdateTerrainPatchHeightData(decoded->patches[i], decoded->header.patchSize);
+
+        // Now that we have updated all the height map data for each patch, see if
+        // we have enough of the patches loaded in to regenerate the GPU-side resources
+        // as well.
+        RegenerateDirtyTerrainPatches();
+    }
+
     void Terrain::SetTerrainTextures(const RexAssetID textures[num_terrain_textures])
     {
         bool texturesChanged = false;
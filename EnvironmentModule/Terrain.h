@@ -10,6 +10,11 @@
 #include "EC_Terrain.h"
 #include "EnvironmentModuleApi.h"
 #include "RexTypes.h"
+#include "TerrainDecoder.h"
+#include "TerrainPatchGeometry.h"
+#include "TaskPool.h"
+
+#include <OgreHardwareIndexBuffer.h>
 
 #include <QObject>
 
@@ -29,7 +34,6 @@ namespace ProtocolUtilities
 namespace Environment
 {
     class EnvironmentModule;
-    struct DecodedTerrainPatch;
 
     //! Handles the logic related to the OpenSim Terrain. Note - partially lacks support for multiple scenes - the Terrain object is not instantiated
     //! per-scene, but it contains data that should be stored per-scene. This doesn't affect anything unless we will some day actually have several scenes.
@@ -47,9 +51,24 @@ namespace Environment
         ~Terrain();
 
         //! Called to handle an OpenSim LayerData packet.
-        //! Decodes terrain data from a LayerData packet and generates terrain patches accordingly.
+        //! Starts decoding terrain data from a LayerData packet in the task pool. The patches are generated in UpdateDecodedPatches().
         bool HandleOSNE_LayerData(ProtocolUtilities::NetworkEventInboundData* data);
 
+        //! Applies the LayerData packets that have been decoded, in the order they arrived, and generates terrain patches accordingly.
+        //! Called each frame by EnvironmentModule.
+        //! @return True if any height data was applied.
+        bool UpdateDecodedPatches();
+
+        //! Uploads the patch meshes that have been built in the task pool, and selects the level of detail of each patch
+        //! by its distance from the camera. Called each frame by EnvironmentModule.
+        void UpdateGeometry();
+
+        //! Maximum number of LayerData packets kept by GetRecordedLayerData().
+        static const size_t cMaxRecordedLayerData = 256;
+
+        //! Returns the packet data of the most recent land LayerData packets, for TerrainDecodeBenchmark.
+        const std::deque<LayerDataPayloadPtr> &GetRecordedLayerData() const { return recorded_layer_data_; }
+
         //! The OpenSim terrain has a hardcoded size of four textures. When/if we lift that, change the amount here or remove altogether if dynamic.
         static const int num_terrain_textures = 4;
 
@@ -117,13 +136,46 @@ namespace Environment
 
         Scene::EntityWeakPtr cachedTerrainEntity_;
 
+        /// LayerData packets being decoded in the task pool, in arrival order.
+        std::deque<Foundation::TaskFuture<DecodedLayerDataPtr> > pending_layer_data_;
+
+        /// The most recent land LayerData packets.
+        std::deque<LayerDataPayloadPtr> recorded_layer_data_;
+
+        /// Patch meshes being built in the task pool.
+        std::vector<Foundation::TaskFuture<TerrainPatchGeometryPtr> > pending_geometry_;
+
+        /// Index list of a level of detail, shared by all the patch meshes drawn with it.
+        struct LodIndices
+        {
+            Ogre::HardwareIndexBufferSharedPtr buffer;
+            size_t count;
+        };
+
+        /// Index lists by the key from GetTerrainLodKey(), created when first needed.
+        std::map<int, LodIndices> lod_indices_;
+
+        /// Distance up to which the patches are drawn at full detail, from the terrain_lod_distance setting.
+        float lod_distance_;
+
+        void ApplyDecodedLayerData(DecodedLayerDataPtr decoded);
+
         void CreateOrUpdateTerrainPatchHeightData(const DecodedTerrainPatch &patch, int patchSize);
 
         void RegenerateDirtyTerrainPatches();
 
         void CreateOgreTerrainPatchNode(Ogre::SceneNode *&node, int patchX, int patchY);
 
-        void GenerateTerrainGeometryForOnePatch(Scene::Entity &entity, EC_Terrain &terrain, EC_Terrain::Patch &patch);
+        void StartPatchGeometryBuild(Scene::Entity &entity, EC_Terrain &terrain, EC_Terrain::Patch &patch);
+
+        void UploadPatchGeometry(Scene::Entity &entity, EC_Terrain &terrain, const TerrainPatchGeometry &geometry);
+
+        void UpdatePatchLods(EC_Terrain &terrain);
+
+        void SetPatchLod(EC_Terrain::Patch &patch, int lodKey);
+
+        const LodIndices &GetLodIndices(int lodKey);
+
         void GenerateTerrainGeometry(EC_Terrain &terrain);
         void GenerateTerrainGeometryForSinglePatch(EC_Terrain &terrain, int patchX, int patchY);
         void DebugGenerateTerrainVisData(Ogre::SceneNode *node, const DecodedTerrainPatch &patch, int patchSize);
@@ -11,6 +11,11 @@
 #include "TerrainDecoder.h"
 #include "EnvironmentModule.h"
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define TERRAINDECODER_SSE
+#endif
+
 namespace Environment
 {
 
@@ -30,10 +35,15 @@ public:
         BuildQuantizeTable16();
         SetupCosines16();
         BuildCopyMatrix16();
+        BuildIDCTMatrices16();
     }
 
     float dequantizeTable16[16*16];
     float cosineTable16[16*16];
+    /// The IDCT basis in matrix form: row u holds the weights of coefficient u for each output sample n.
+    float idctMatrix16[16*16];
+    /// Transpose of idctMatrix16.
+    float idctMatrixTransposed16[16*16];
     int copyMatrix16[16*16];
     float quantizeTable16[16*16];
 
@@ -60,6 +70,17 @@ public:
                 cosineTable16[u*16 + n] = (float)cosf((2.0f * (float)n + 1.0f) * (float)u * hposz);
     }
 
+    void BuildIDCTMatrices16()
+    {
+        for (int u = 0; u < 16; u++)
+            for (int n = 0; n < 16; n++)
+            {
+                float weight = (u == 0) ? OO_SQRT2 : cosineTable16[u*16 + n];
+                idctMatrix16[u*16 + n] = weight;
+                idctMatrixTransposed16[n*16 + u] = weight;
+            }
+    }
+
     void BuildCopyMatrix16()
     {
         bool diag = false;
@@ -149,6 +170,132 @@ void DecodeTerrainPatch(int *patches, ProtocolUtilities::BitStream &bits, const
                 patches[i] = 0;
             return;
         }
+
+        // Each coefficient starts with a 'patches present' flag, an 'end of patch data' flag and the sign bit. Look at all three at once.
+        u32 flags = bits.PeekBits(3);
+        if (!(flags & 4))
+        {
+            bits.SkipBits(1);
+            patches[i] = 0;
+            continue;
+        }
+
+        if (!(flags & 2))
+        {
+            bits.SkipBits(2);
+            for(; i < size * size; ++i)
+                patches[i] = 0;
+            return;
+        }
+
+        bits.SkipBits(3);
+        u32 data = (u32)bits.ReadBits(header.wordBits);
+        patches[i] = (flags & 1) ? -(s32)data : (s32)data;
+    }
+}
+
+/// Multiplies two 16x16 matrices: dest = weights * rows.
+/// Each row of dest is accumulated as a weighted sum of the rows of the second matrix, which maps directly to vector multiply-adds.
+void MatrixMultiply16(const float *weights, const float *rows, float *dest)
+{
+    for (int r = 0; r < 16; r++)
+    {
+        const float *w = weights + r * 16;
+#ifdef TERRAINDECODER_SSE
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps();
+        __m128 acc3 = _mm_setzero_ps();
+        for (int u = 0; u < 16; u++)
+        {
+            const __m128 weight = _mm_set1_ps(w[u]);
+            const float *row = rows + u * 16;
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(weight, _mm_loadu_ps(row)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(weight, _mm_loadu_ps(row + 4)));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(weight, _mm_loadu_ps(row + 8)));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(weight, _mm_loadu_ps(row + 12)));
+        }
+        float *out = dest + r * 16;
+        _mm_storeu_ps(out, acc0);
+        _mm_storeu_ps(out + 4, acc1);
+        _mm_storeu_ps(out + 8, acc2);
+        _mm_storeu_ps(out + 12, acc3);
+#else
+        float acc[16] = { 0 };
+        for (int u = 0; u < 16; u++)
+        {
+            const float weight = w[u];
+            const float *row = rows + u * 16;
+            for (int c = 0; c < 16; c++)
+                acc[c] += weight * row[c];
+        }
+        for (int c = 0; c < 16; c++)
+            dest[r * 16 + c] = acc[c];
+#endif
+    }
+}
+
+/// Code adapted from libopenmetaverse.org project, TerrainCompressor.cs / TerrainManager.cs
+/// Dequantizes the coefficients of a 16x16 patch and performs the 2D IDCT as two matrix products, IDCT^T * block * IDCT.
+/// @param output [out] 16*16 height values.
+void DecompressTerrainPatch(float *output, const int *patchData, const TerrainPatchHeader &patchHeader)
+{
+    int prequant = (patchHeader.quantWBits >> 4) + 2;
+    int quantize = 1 << prequant;
+    float ooq = 1.0f / (float)quantize;
+    float mult = ooq * (float)patchHeader.range;
+    float addval = mult * (float)(1 << (prequant - 1)) + patchHeader.dcOffset;
+
+    float block[16*16];
+    float temp[16*16];
+
+    for(int n = 0; n < 16 * 16; n++)
+        block[n] = patchData[precompTables.copyMatrix16[n]] * precompTables.dequantizeTable16[n];
+
+    MatrixMultiply16(precompTables.idctMatrixTransposed16, block, temp); // Columns
+    MatrixMultiply16(temp, precompTables.idctMatrix16, block); // Lines
+
+    // The 2/16 normalization of the line transform is folded into the final scale
+    const float scale = mult * (2.0f / 16.0f);
+    for (int j = 0; j < 16 * 16; j++)
+        output[j] = block[j] * scale + addval;
+}
+
+/// The original decoding functions, kept for comparison in TerrainDecodeBenchmark.
+namespace Scalar
+{
+
+/// Reads bits one at a time, in the same order as BitStream::ReadBits().
+u32 ReadBits(ProtocolUtilities::BitStream &bits, int count)
+{
+    u8 data[4] = { 0 };
+    int cur_byte = 0;
+    int cur_bit = 0;
+    int total_bits = std::min(8, count);
+    while(count-- > 0)
+    {
+        if (bits.ReadBit())
+            data[cur_byte] |= 1 << (total_bits - 1 - cur_bit);
+        if (++cur_bit >= 8)
+        {
+            ++cur_byte;
+            cur_bit = 0;
+            total_bits = std::min(8, count);
+        }
+    }
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
+}
+
+void DecodeTerrainPatch(int *patches, ProtocolUtilities::BitStream &bits, const TerrainPatchHeader &header, int size)
+{
+    for(int i = 0; i < size * size; ++i)
+    {
+        if (bits.BitsLeft() == 0)
+        {
+            for(; i < size * size; ++i)
+                patches[i] = 0;
+            return;
+        }
         bool v = bits.ReadBit(); // 'Patches present' flag?
         if (!v)
         {
@@ -165,12 +312,11 @@ void DecodeTerrainPatch(int *patches, ProtocolUtilities::BitStream &bits, const
         }
 
         bool signNegative = bits.ReadBit();
-        u32 data = (u32)bits.ReadBits(header.wordBits);
+        u32 data = ReadBits(bits, header.wordBits);
         patches[i] = signNegative ? -(s32)data : (s32)data;
     }
 }
 
-/// Code adapted from libopenmetaverse.org project, TerrainCompressor.cs / TerrainManager.cs
 /// Performs IDCT on a single column of 16 elements of data. (stride assumed to be 16 elements)
 void IDCTColumn16(const float *linein, float *lineout, int column)
 {
@@ -188,7 +334,6 @@ void IDCTColumn16(const float *linein, float *lineout, int column)
     }
 }
 
-/// Code adapted from libopenmetaverse.org project, TerrainCompressor.cs / TerrainManager.cs
 /// Performs IDCT on a single row of 16 elements of data.
 void IDCTLine16(const float *linein, float *lineout, int line)
 {
@@ -209,7 +354,6 @@ void IDCTLine16(const float *linein, float *lineout, int line)
     }
 }
 
-/// Code adapted from libopenmetaverse.org project, TerrainCompressor.cs / TerrainManager.cs
 void DecompressTerrainPatch(std::vector<float> &output, int *patchData, const TerrainPatchHeader &patchHeader, const TerrainPatchGroupHeader &groupHeader)
 {
     std::vector<float> block(groupHeader.patchSize * groupHeader.patchSize);
@@ -223,10 +367,7 @@ void DecompressTerrainPatch(std::vector<float> &output, int *patchData, const Te
     float addval = mult * (float)(1 << (prequant - 1)) + patchHeader.dcOffset;
 
     if (groupHeader.patchSize != 16)
-    {
-        ///\todo Output log warning - unsupported patch size present!
         return;
-    }
 
     for(int n = 0; n < 16 * 16; n++)
         block[n] = patchData[precompTables.copyMatrix16[n]] * precompTables.dequantizeTable16[n];
@@ -242,23 +383,29 @@ void DecompressTerrainPatch(std::vector<float> &output, int *patchData, const Te
         output[j] = block[j] * mult + addval;
 }
 
+} // ~Scalar
+
 } // ~unnamed namespace
 
 /// Code adapted from libopenmetaverse.org project, TerrainCompressor.cs / TerrainManager.cs
 void DecompressLand(std::vector<DecodedTerrainPatch> &patches, ProtocolUtilities::BitStream &bits, const TerrainPatchGroupHeader &groupHeader)
 {
-    while(bits.BitsLeft() > 0)
+    if (groupHeader.patchSize != 16)
     {
-        DecodedTerrainPatch patch;
-        patch.header = DecodePatchHeader(bits);
+        EnvironmentModule::LogWarning("Unsupported terrain patch size " + ToString<int>(groupHeader.patchSize) + "!");
+        return;
+    }
 
-        if (patch.header.quantWBits == cEndOfPatches)
+    while(bits.BitsLeft() > 0)
+    {
+        TerrainPatchHeader header = DecodePatchHeader(bits);
+        if (header.quantWBits == cEndOfPatches)
             break;
 
         const int cPatchesPerEdge = 16;
 
         // The MSB of header.x and header.y are unused, or used for some other purpose?
-        if (patch.header.x >= cPatchesPerEdge || patch.header.y >= cPatchesPerEdge)
+        if (header.x >= cPatchesPerEdge || header.y >= cPatchesPerEdge)
         {
             ///\todo Log out warning - invalid packet?
             EnvironmentModule::LogInfo("Invalid patch data!");
@@ -266,12 +413,60 @@ void DecompressLand(std::vector<DecodedTerrainPatch> &patches, ProtocolUtilities
         }
 
         int patchData[16*16];
-        DecodeTerrainPatch(patchData, bits, patch.header, groupHeader.patchSize);
+        DecodeTerrainPatch(patchData, bits, header, 16);
+
+        // Decode straight into the output vector, to avoid copying the height data
+        patches.push_back(DecodedTerrainPatch());
+        DecodedTerrainPatch &patch = patches.back();
+        patch.header = header;
+        patch.heightData.resize(16 * 16);
+        DecompressTerrainPatch(&patch.heightData[0], patchData, header);
+    }
+}
+
+void DecompressLandScalar(std::vector<DecodedTerrainPatch> &patches, ProtocolUtilities::BitStream &bits, const TerrainPatchGroupHeader &groupHeader)
+{
+    while(bits.BitsLeft() > 0)
+    {
+        DecodedTerrainPatch patch;
+        patch.header = DecodePatchHeader(bits);
 
-        DecompressTerrainPatch(patch.heightData, patchData, patch.header, groupHeader);
+        if (patch.header.quantWBits == cEndOfPatches)
+            break;
 
-        patches.push_back(patch); ///\todo Can optimize out a copy of heavy struct by push_backing early in the loop.
+        if (patch.header.x >= 16 || patch.header.y >= 16 || groupHeader.patchSize != 16)
+            return;
+
+        int patchData[16*16];
+        Scalar::DecodeTerrainPatch(patchData, bits, patch.header, groupHeader.patchSize);
+
+        Scalar::DecompressTerrainPatch(patch.heightData, patchData, patch.header, groupHeader);
+
+        patches.push_back(patch);
     }
 }
 
+TerrainPatchGroupHeader DecodePatchGroupHeader(ProtocolUtilities::BitStream &bits)
+{
+    TerrainPatchGroupHeader header;
+    header.stride = bits.ReadBits(16);
+    header.patchSize = bits.ReadBits(8);
+    header.layerType = bits.ReadBits(8);
+    return header;
+}
+
+DecodedLayerDataPtr DecodeLayerData(LayerDataPayloadPtr payload)
+{
+    DecodedLayerDataPtr decoded(new DecodedLayerData());
+    if (!payload || payload->empty())
+        return decoded;
+
+    ProtocolUtilities::BitStream bits(&(*payload)[0], payload->size());
+    decoded->header = DecodePatchGroupHeader(bits);
+    if (decoded->header.layerType == TPLayerLand)
+        DecompressLand(decoded->patches, bits, decoded->header);
+
+    return decoded;
+}
+
 }
@@ -46,12 +46,36 @@ struct DecodedTerrainPatch
     TerrainPatchHeader header;
 };
 
-/// Decompresses a single patch of terrain height data from a LayerData packet.
+/// Height data decoded from one LayerData packet.
+struct DecodedLayerData
+{
+    TerrainPatchGroupHeader header;
+    std::vector<DecodedTerrainPatch> patches;
+};
+
+typedef boost::shared_ptr<DecodedLayerData> DecodedLayerDataPtr;
+
+/// The packed data of a LayerData packet, copied out of the network message so it can be decoded later or in another thread.
+typedef boost::shared_ptr<const std::vector<u8> > LayerDataPayloadPtr;
+
+/// Reads the Patch Group Header from the start of a LayerData packet.
+TerrainPatchGroupHeader DecodePatchGroupHeader(ProtocolUtilities::BitStream &bits);
+
+/// Decompresses the patches of terrain height data from a LayerData packet.
+/// The IDCT is done as two 16x16 matrix products using SSE when available. Threadsafe.
 /// @param patches [out] The resulting patch data will be output here.
 /// @param bits [in] The LayerData packet, of which the Patch Group Header has already been read.
 /// @param groupHeader 
 void DecompressLand(std::vector<DecodedTerrainPatch> &patches, ProtocolUtilities::BitStream &bits, const TerrainPatchGroupHeader &groupHeader);
 
+/// Same as DecompressLand() up to float rounding, using the original per-column IDCT and bit-by-bit reads.
+/// Used to measure DecompressLand() against.
+void DecompressLandScalar(std::vector<DecodedTerrainPatch> &patches, ProtocolUtilities::BitStream &bits, const TerrainPatchGroupHeader &groupHeader);
+
+/// Decodes a whole LayerData packet. Only land layers are decompressed, for others the result has no patches.
+/// Threadsafe, so that it can be run as a task pool job.
+DecodedLayerDataPtr DecodeLayerData(LayerDataPayloadPtr payload);
+
 }
 
 #endif
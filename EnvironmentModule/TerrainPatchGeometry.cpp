@@ -0,0 +1,163 @@
+/// @file TerrainPatchGeometry.cpp
+/// @brief Builds the vertex and index data of terrain patch meshes.
+/// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "TerrainPatchGeometry.h"
+#include "EC_Terrain.h"
+
+namespace Environment
+{
+
+namespace
+{
+const int cLastPoint = EC_Terrain::cNumPatchesPerEdge * EC_Terrain::cPatchSize - 1;
+const int cLastVertex = cPatchMeshVerticesPerEdge - 1;
+
+/// Texture coordinate scale of the terrain material.
+const float cUVScale = 1e-2f * 13;
+
+/// Returns the height of a terrain point from the heights copied for a patch.
+inline float GetHeight(const TerrainPatchHeights &heights, int originX, int originY, int px, int py)
+{
+    return heights.heights[(py - originY + 1) * TerrainPatchHeights::cEdge + (px - originX + 1)];
+}
+
+/// Snaps a coordinate along an edge to a multiple of the edge step, toward the nearer end of the edge.
+/// Snapping toward the corners keeps the triangles of the two edges meeting at a corner from overlapping.
+inline int SnapToStep(int c, int edgeStep)
+{
+    int remainder = c % edgeStep;
+    if (!remainder)
+        return c;
+    return (c < cLastVertex / 2) ? c - remainder : c - remainder + edgeStep;
+}
+
+/// Snaps a vertex on an edge next to a coarser neighbor to a vertex the neighbor draws.
+/// @param edgeSteps Vertex steps along the edges at -x, +x, -y and +y.
+inline void SnapToEdges(int &x, int &y, const int edgeSteps[4])
+{
+    if (x == 0)
+        y = SnapToStep(y, edgeSteps[0]);
+    else if (x == cLastVertex)
+        y = SnapToStep(y, edgeSteps[1]);
+    if (y == 0)
+        x = SnapToStep(x, edgeSteps[2]);
+    else if (y == cLastVertex)
+        x = SnapToStep(x, edgeSteps[3]);
+}
+}
+
+TerrainPatchGeometryPtr BuildTerrainPatchGeometry(TerrainPatchHeightsPtr heights)
+{
+    const TerrainPatchHeights &h = *heights;
+    const int originX = heights->patchX * EC_Terrain::cPatchSize;
+    const int originY = heights->patchY * EC_Terrain::cPatchSize;
+
+    TerrainPatchGeometryPtr geometry(new TerrainPatchGeometry());
+    geometry->patchX = heights->patchX;
+    geometry->patchY = heights->patchY;
+    geometry->generation = heights->generation;
+    geometry->vertices.resize(cNumPatchMeshVertices * cPatchMeshVertexFloats);
+    geometry->minHeight = 1e9f;
+    geometry->maxHeight = -1e9f;
+
+    float *vertex = &geometry->vertices[0];
+    for(int y = 0; y < cPatchMeshVerticesPerEdge; ++y)
+        for(int x = 0; x < cPatchMeshVerticesPerEdge; ++x)
+        {
+            // The point on the terrain. Past the last point the vertex is folded onto the last one.
+            const int px = std::min(originX + x, cLastPoint);
+            const int py = std::min(originY + y, cLastPoint);
+            const float height = GetHeight(h, originX, originY, px, py);
+
+            // Same as EC_Terrain::CalculateNormal()
+            float xSlope = GetHeight(h, originX, originY, std::max(px - 1, 0), py) - GetHeight(h, originX, originY, std::min(px + 1, cLastPoint), py);
+            if (px <= 0)
+                xSlope *= 2;
+            float ySlope = GetHeight(h, originX, originY, px, std::max(py - 1, 0)) - GetHeight(h, originX, originY, px, std::min(py + 1, cLastPoint));
+            if (py <= 0)
+                ySlope *= 2;
+
+            const float length = sqrtf(xSlope * xSlope + ySlope * ySlope + 4.f);
+
+            vertex[0] = (float)(px - originX);
+            vertex[1] = (float)(py - originY);
+            vertex[2] = height;
+            vertex[3] = xSlope / length;
+            vertex[4] = ySlope / length;
+            vertex[5] = 2.f / length;
+            vertex[6] = px * cUVScale;
+            vertex[7] = py * cUVScale;
+            vertex += cPatchMeshVertexFloats;
+
+            geometry->minHeight = std::min(geometry->minHeight, height);
+            geometry->maxHeight = std::max(geometry->maxHeight, height);
+        }
+
+    return geometry;
+}
+
+int GetTerrainLodKey(int lod, const int neighborLods[4])
+{
+    int key = lod;
+    for(int i = 0; i < 4; ++i)
+        key = key * cNumTerrainLodLevels + std::max(lod, neighborLods[i]);
+    return key;
+}
+
+void BuildTerrainPatchIndices(int lodKey, std::vector<u16> &indices)
+{
+    int edgeSteps[4];
+    for(int i = 3; i >= 0; --i)
+    {
+        edgeSteps[i] = 1 << (lodKey % cNumTerrainLodLevels);
+        lodKey /= cNumTerrainLodLevels;
+    }
+    const int step = 1 << lodKey;
+
+    indices.clear();
+    indices.reserve((cLastVertex / step) * (cLastVertex / step) * 6);
+
+    for(int y = 0; y < cLastVertex; y += step)
+        for(int x = 0; x < cLastVertex; x += step)
+        {
+            int corners[4][2] = { { x, y }, { x + step, y }, { x, y + step }, { x + step, y + step } };
+            u16 vertex[4];
+            for(int i = 0; i < 4; ++i)
+            {
+                SnapToEdges(corners[i][0], corners[i][1], edgeSteps);
+                vertex[i] = (u16)(corners[i][1] * cPatchMeshVerticesPerEdge + corners[i][0]);
+            }
+
+            // Same winding as the full detail mesh. Triangles that collapse on a stitched edge are left out.
+            if (vertex[0] != vertex[1] && vertex[1] != vertex[2] && vertex[0] != vertex[2])
+            {
+                indices.push_back(vertex[0]);
+                indices.push_back(vertex[1]);
+                indices.push_back(vertex[2]);
+            }
+            if (vertex[1] != vertex[3] && vertex[3] != vertex[2] && vertex[1] != vertex[2])
+            {
+                indices.push_back(vertex[1]);
+                indices.push_back(vertex[3]);
+                indices.push_back(vertex[2]);
+            }
+        }
+}
+
+int SelectTerrainLod(float distance, float lodDistance)
+{
+    if (lodDistance <= 0.f)
+        return 0;
+
+    int lod = 0;
+    while(distance > lodDistance && lod < cNumTerrainLodLevels - 1)
+    {
+        distance *= 0.5f;
+        ++lod;
+    }
+    return lod;
+}
+
+}
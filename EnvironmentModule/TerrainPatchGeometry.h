@@ -0,0 +1,82 @@
+/// @file TerrainPatchGeometry.h
+/// @brief Builds the vertex and index data of terrain patch meshes. Independent of Ogre, so that the vertices can be built in worker threads.
+/// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_Environment_TerrainPatchGeometry_h
+#define incl_Environment_TerrainPatchGeometry_h
+
+#include "CoreTypes.h"
+
+namespace Environment
+{
+
+/// Number of vertices on each edge of a patch mesh. The last row and column lie on the first ones of the next patches.
+const int cPatchMeshVerticesPerEdge = 17;
+
+/// Number of vertices in a patch mesh.
+const int cNumPatchMeshVertices = cPatchMeshVerticesPerEdge * cPatchMeshVerticesPerEdge;
+
+/// Number of floats in each vertex: position, normal and texture coordinate.
+const int cPatchMeshVertexFloats = 8;
+
+/// Number of geomipmap levels. Level n draws every 2^n:th vertex, so the coarsest level has 2x2 quads.
+const int cNumTerrainLodLevels = 4;
+
+/// Heights needed to build the mesh of one patch, copied from EC_Terrain so that the mesh can be built in another thread.
+struct TerrainPatchHeights
+{
+    /// Number of height values on each edge: the patch vertices and one more on each side for the normals.
+    static const int cEdge = cPatchMeshVerticesPerEdge + 2;
+
+    /// Patch coordinates on the grid of patches.
+    int patchX;
+    int patchY;
+
+    /// Number of the build, to recognize results superseded by a later build of the same patch.
+    uint generation;
+
+    /// Heights from one point before the patch to one point past its last vertex, clamped to the terrain as EC_Terrain::GetPoint() does.
+    float heights[cEdge * cEdge];
+};
+
+typedef boost::shared_ptr<TerrainPatchHeights> TerrainPatchHeightsPtr;
+
+/// Vertices of one patch mesh, in patch local coordinates.
+struct TerrainPatchGeometry
+{
+    int patchX;
+    int patchY;
+    uint generation;
+
+    /// cNumPatchMeshVertices vertices of cPatchMeshVertexFloats floats, row by row.
+    std::vector<float> vertices;
+
+    /// Height range of the vertices, for the bounding box.
+    float minHeight;
+    float maxHeight;
+};
+
+typedef boost::shared_ptr<TerrainPatchGeometry> TerrainPatchGeometryPtr;
+
+/// Builds the vertices of a patch mesh, with the same normals and texture coordinates as EC_Terrain::CalculateNormal() and the
+/// terrain material expect. On the last patches of the terrain the last row or column is folded onto the one before, so that the
+/// terrain does not extend past its last height value. Threadsafe, so that it can be run as a task pool job.
+TerrainPatchGeometryPtr BuildTerrainPatchGeometry(TerrainPatchHeightsPtr heights);
+
+/// Returns a key that identifies the index list of a patch at a level of detail next to neighbors at the given levels.
+/// Neighbors at the same or a finer level do not affect the patch, so they give the same key.
+/// @param lod Level of the patch, [0, cNumTerrainLodLevels-1].
+/// @param neighborLods Levels of the neighbors at -x, +x, -y and +y.
+int GetTerrainLodKey(int lod, const int neighborLods[4]);
+
+/// Builds the triangle list indices of a patch mesh for a key from GetTerrainLodKey(). Along an edge next to a coarser neighbor the
+/// vertices the neighbor skips are snapped to the ones it draws, so that no cracks show between the patches.
+void BuildTerrainPatchIndices(int lodKey, std::vector<u16> &indices);
+
+/// Selects the level of detail for a patch at a distance from the camera. The level increases by one each time the distance doubles.
+/// @param lodDistance Distance up to which patches are drawn at full detail. Zero or less draws all patches at full detail.
+int SelectTerrainLod(float distance, float lodDistance);
+
+}
+
+#endif
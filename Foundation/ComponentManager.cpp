@@ -35,4 +35,43 @@ namespace Foundation
         
         return newComponent;
     }
+
+    uint ComponentManager::GetTypeId(const std::string &type)
+    {
+        MutexLock lock(type_ids_mutex_);
+        ComponentTypeIdMap::const_iterator iter = type_ids_.find(type);
+        if (iter != type_ids_.end())
+            return iter->second;
+
+        uint type_id = type_ids_.size();
+        type_ids_[type] = type_id;
+        return type_id;
+    }
+
+    void ComponentManager::RegisterComponent(ComponentInterface *component, uint type_id)
+    {
+        assert(component && component->registry_index_ == ComponentInterface::cNotRegistered);
+        if (type_id >= components_.size())
+            components_.resize(type_id + 1);
+
+        ComponentList &list = components_[type_id];
+        component->registry_index_ = list.size();
+        list.push_back(component);
+    }
+
+    void ComponentManager::UnregisterComponent(ComponentInterface *component, uint type_id)
+    {
+        assert(component);
+        if (type_id >= components_.size() || component->registry_index_ == ComponentInterface::cNotRegistered)
+            return;
+
+        // Move the last component to the removed one's place
+        ComponentList &list = components_[type_id];
+        const size_t index = component->registry_index_;
+        assert(index < list.size() && list[index] == component);
+        list[index] = list.back();
+        list[index]->registry_index_ = index;
+        list.pop_back();
+        component->registry_index_ = ComponentInterface::cNotRegistered;
+    }
 }
@@ -4,8 +4,10 @@
 #define incl_Foundation_ComponentManager_h
 
 #include "ForwardDefines.h"
+#include "CoreThread.h"
 
 #include <map>
+#include <boost/unordered_map.hpp>
 
 namespace Foundation
 {
@@ -19,29 +21,43 @@ namespace Foundation
 
 
     //! Manages components. Also works as a component factory.
-    /*! \ingroup Foundation_group
+    /*! Keeps a registry of the components attached to entities for each component type, so that systems can
+        iterate just the components they care about instead of all entities:
+
+        \code
+        const ComponentManager::ComponentList &sounds = component_manager->GetComponents<EC_AttachedSound>();
+        for (size_t i = 0; i < sounds.size(); ++i)
+            checked_static_cast<EC_AttachedSound*>(sounds[i])->Update(frametime);
+        \endcode
+
+        The registries are updated by Scene::Entity::AddComponent() and RemoveComponent(), and when an entity is
+        destroyed. They are not thread safe, use them from the main thread only.
+
+        \ingroup Foundation_group
         \ingroup Scene_group
     */
     class ComponentManager
     {
     public:
-        typedef std::list<ComponentWeakPtr> ComponentList;
-        typedef std::map< std::string, ComponentList > ComponentTypeMap;
+        typedef std::vector<ComponentInterface*> ComponentList;
+        typedef std::vector<ComponentList> ComponentTypeMap;
         typedef ComponentList::iterator iterator;
         typedef ComponentList::const_iterator const_iterator;
         typedef std::map<std::string, ComponentFactoryInterfacePtr> ComponentFactoryMap;
-        
+        typedef boost::unordered_map<std::string, uint> ComponentTypeIdMap;
+
         //! default constructor
         ComponentManager(Framework *framework) : framework_(framework) {}
         //! destructor
         ~ComponentManager() { }
 
-        //! register factory for the component
+        //! register factory for the component. Also assigns a type id to the component type.
         void RegisterFactory(const std::string &component, const ComponentFactoryInterfacePtr &factory)
         {
             assert(factories_.find(component) == factories_.end());
 
             factories_[component] = factory;
+            GetTypeId(component);
         }
 
         //! Unregister the component. Removes the factory.
@@ -74,7 +90,62 @@ namespace Foundation
         //! Get all component factories
         const ComponentFactoryMap GetComponentFactoryMap() const { return factories_; }
 
+        //! Returns the type id of a component type, assigning a new one if the type has none yet.
+        /*! Type ids are small integers assigned in the order the types are first seen, normally the order the
+            factories are registered in. They stay the same for the lifetime of the component manager, also when
+            the factory is unregistered. Entities use them for looking up components without comparing type names.
+
+            \param type name of the component type
+        */
+        uint GetTypeId(const std::string &type);
+
+        //! Returns the components of a type that are attached to entities, in no particular order.
+        /*! The list holds the components of the entities of every scene, so check the entity's scene if only one
+            scene is of interest. Adding or removing components of the type invalidates iterators to the list, so
+            iterate by index if that may happen.
+
+            \param type_id type id of the components
+        */
+        const ComponentList &GetComponents(uint type_id) const
+        {
+            if (type_id < components_.size())
+                return components_[type_id];
+            return empty_components_;
+        }
+
+        //! Returns the components of a type that are attached to entities, in no particular order.
+        template <class T> const ComponentList &GetComponents()
+        {
+            static const uint type_id = GetTypeId(T::TypeNameStatic());
+            return GetComponents(type_id);
+        }
+
+        //! Adds a component to the registry of its type. Called when the component is attached to an entity.
+        /*! 
+            \param component component to add, not already in a registry
+            \param type_id type id of the component
+        */
+        void RegisterComponent(ComponentInterface *component, uint type_id);
+
+        //! Removes a component from the registry of its type. Called when the component is detached from an entity.
+        /*! 
+            \param component component to remove
+            \param type_id type id of the component
+        */
+        void UnregisterComponent(ComponentInterface *component, uint type_id);
+
     private:
+        //! components attached to entities, indexed by type id
+        ComponentTypeMap components_;
+
+        //! returned for types that have no components
+        ComponentList empty_components_;
+
+        //! map of component type names to type ids
+        ComponentTypeIdMap type_ids_;
+
+        //! Mutex for type_ids_, as typed component lookups may happen outside the main thread
+        Mutex type_ids_mutex_;
 
         //! map of component factories
         ComponentFactoryMap factories_;
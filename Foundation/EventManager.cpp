@@ -12,6 +12,53 @@
 
 #include <algorithm>
 
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace
+{
+    typedef Foundation::EventManager::DelayedEvent DelayedEvent;
+
+    //! Replaces head with value if it still equals comparand. Returns the previous value of head.
+    DelayedEvent* CompareExchange(DelayedEvent* volatile* head, DelayedEvent* value, DelayedEvent* comparand)
+    {
+#ifdef _WIN32
+        return static_cast<DelayedEvent*>(InterlockedCompareExchangePointer((PVOID volatile*)head, value, comparand));
+#else
+        return __sync_val_compare_and_swap(head, comparand, value);
+#endif
+    }
+
+    //! Pushes an event to the front of a lock-free stack. Safe to call from any number of threads.
+    void PushEvent(DelayedEvent* volatile* head, DelayedEvent* event)
+    {
+        DelayedEvent* old_head = *head;
+        for(;;)
+        {
+            event->next_ = old_head;
+            DelayedEvent* seen = CompareExchange(head, event, old_head);
+            if (seen == old_head)
+                return;
+            old_head = seen;
+        }
+    }
+
+    //! Takes all events from a lock-free stack, newest first. Events are never popped one by one, so the stack
+    //! is not prone to the ABA problem.
+    DelayedEvent* TakeEvents(DelayedEvent* volatile* head)
+    {
+        DelayedEvent* old_head = *head;
+        for(;;)
+        {
+            DelayedEvent* seen = CompareExchange(head, 0, old_head);
+            if (seen == old_head)
+                return old_head;
+            old_head = seen;
+        }
+    }
+}
+
 namespace Foundation
 {
     EventManager::EventManager(Framework *framework) : 
@@ -19,12 +66,27 @@ namespace Foundation
         next_category_id_(1),
         next_request_tag_(1),
         event_subscriber_root_(EventSubscriberPtr(new EventSubscriber())),
+        dispatch_generation_(1),
+        submitted_events_(0),
+        current_time_(0.0),
+        next_sequence_(0),
         main_thread_id_(QThread::currentThreadId())
     {
     }
 
     EventManager::~EventManager()
     {
+        DelayedEvent* event = TakeEvents(&submitted_events_);
+        while (event)
+        {
+            DelayedEvent* next = event->next_;
+            delete event;
+            event = next;
+        }
+        for(size_t i = 0; i < delayed_events_.size(); ++i)
+            delete delayed_events_[i];
+        delayed_events_.clear();
+
         event_subscriber_root_.reset();
     }
     
@@ -102,13 +164,24 @@ namespace Foundation
             return false;
         }    
             
-        return SendEvent(event_subscriber_root_.get(), category_id, event_id, data);
+        EventDispatchList& list = GetDispatchList(category_id, event_id);
+        ++list.sends_;
+        
+        // Index and size are re-read on every round, as a handler may cause the list to be rebuilt
+        for(size_t i = 0; i < list.subscribers_.size(); ++i)
+        {
+            if (ModuleSharedPtr module = list.subscribers_[i]->module_.lock())
+            {
+                ++list.handlers_visited_;
+                if (module->HandleEvent(category_id, event_id, data))
+                    return true;
+            }
+        }
+        return false;
     }
     
     void EventManager::SendDelayedEvent(event_category_id_t category_id, event_id_t event_id, EventDataPtr data, f64 delay)
     {
-        MutexLock lock(delayed_events_mutex_);
-        
         // Do not send messages after exit
         if (framework_->IsExiting())
             return;
@@ -119,32 +192,85 @@ namespace Foundation
             return;
         }    
         
-        DelayedEvent new_delayed_event;
-        new_delayed_event.category_id_ = category_id;
-        new_delayed_event.event_id_ = event_id;
-        new_delayed_event.data_ = data;
-        new_delayed_event.delay_ = delay;
+        DelayedEvent* new_delayed_event = new DelayedEvent();
+        new_delayed_event->category_id_ = category_id;
+        new_delayed_event->event_id_ = event_id;
+        new_delayed_event->data_ = data;
+        new_delayed_event->delay_ = delay;
+        new_delayed_event->due_time_ = 0.0;
+        new_delayed_event->sequence_ = 0;
         
-        new_delayed_events_.push_back(new_delayed_event);
+        PushEvent(&submitted_events_, new_delayed_event);
     }
     
-    bool EventManager::SendEvent(EventSubscriber* node, event_category_id_t category_id, event_id_t event_id, EventDataInterface* data) const
+    EventManager::EventDispatchList& EventManager::GetDispatchList(event_category_id_t category_id, event_id_t event_id) const
     {
-        if (ModuleSharedPtr module = node->module_.lock())
+        EventDispatchList& list = dispatch_lists_[std::make_pair(category_id, event_id)];
+        if (list.generation_ != dispatch_generation_)
         {
-            if (module->HandleEvent(category_id, event_id, data))
-                return true;
+            list.subscribers_.clear();
+            BuildDispatchList(event_subscriber_root_.get(), category_id, event_id, list);
+            list.generation_ = dispatch_generation_;
         }
+        return list;
+    }
+    
+    void EventManager::BuildDispatchList(EventSubscriber* node, event_category_id_t category_id, event_id_t event_id, EventDispatchList& list) const
+    {
+        // Same order as the tree was walked when sending: the node itself first, then its children
+        if (!node->module_name_.empty() && IsInterested(node->module_name_, category_id, event_id))
+            list.subscribers_.push_back(node);
         
         EventSubscriberVector::const_iterator i = node->children_.begin();
         while (i != node->children_.end())
         {
-            if (SendEvent((*i).get(), category_id, event_id, data))
-                return true;
-                
+            BuildDispatchList((*i).get(), category_id, event_id, list);
             ++i;
         }
-        return false;
+    }
+    
+    bool EventManager::IsInterested(const std::string& module_name, event_category_id_t category_id, event_id_t event_id) const
+    {
+        EventInterestMap::const_iterator i = event_interests_.find(module_name);
+        if (i == event_interests_.end())
+            return true;
+        
+        const EventInterest& interest = i->second;
+        return interest.categories_.find(category_id) != interest.categories_.end() ||
+            interest.events_.find(std::make_pair(category_id, event_id)) != interest.events_.end();
+    }
+    
+    void EventManager::SubscribeEventCategory(ModuleInterface* module, event_category_id_t category_id)
+    {
+        assert (module);
+        if (category_id == IllegalEventCategory)
+        {
+            Foundation::RootLogWarning(module->Name() + " attempted to subscribe to illegal event category");
+            return;
+        }
+        
+        event_interests_[module->Name()].categories_.insert(category_id);
+        InvalidateDispatchLists();
+    }
+    
+    void EventManager::SubscribeEvent(ModuleInterface* module, event_category_id_t category_id, event_id_t event_id)
+    {
+        assert (module);
+        if (category_id == IllegalEventCategory)
+        {
+            Foundation::RootLogWarning(module->Name() + " attempted to subscribe to an event with illegal category");
+            return;
+        }
+        
+        event_interests_[module->Name()].events_.insert(std::make_pair(category_id, event_id));
+        InvalidateDispatchLists();
+    }
+    
+    void EventManager::UnsubscribeEvents(ModuleInterface* module)
+    {
+        assert (module);
+        if (event_interests_.erase(module->Name()))
+            InvalidateDispatchLists();
     }
     
     bool ComparePriority(EventManager::EventSubscriberPtr const& e1, EventManager::EventSubscriberPtr const& e2)
@@ -181,6 +307,7 @@ namespace Foundation
         new_node->priority_ = priority;
         node->children_.push_back(new_node);
         std::sort(node->children_.rbegin(), node->children_.rend(), ComparePriority);
+        InvalidateDispatchLists();
         return true;
     }
     
@@ -201,6 +328,7 @@ namespace Foundation
             if ((*i)->module_.lock().get() == module)
             {
                 node->children_.erase(i);
+                InvalidateDispatchLists();
                 return true;
             }
             
@@ -220,6 +348,7 @@ namespace Foundation
     void EventManager::ValidateEventSubscriberTree()
     {
         ValidateEventSubscriberTree(event_subscriber_root_.get());
+        InvalidateDispatchLists();
     }
 
     void EventManager::ValidateEventSubscriberTree(EventSubscriber* node)
@@ -360,26 +489,61 @@ namespace Foundation
     
     void EventManager::ProcessDelayedEvents(f64 frametime)
     {
+        due_events_.clear();
+        
+        // Events that were waiting from earlier frames go first, in the order they are due
+        while (!delayed_events_.empty() && delayed_events_.front()->due_time_ <= current_time_)
         {
-            MutexLock lock(delayed_events_mutex_);
-            delayed_events_.insert(delayed_events_.end(), new_delayed_events_.begin(), new_delayed_events_.end());
-            new_delayed_events_.clear();
+            std::pop_heap(delayed_events_.begin(), delayed_events_.end(), LaterDelayedEvent());
+            due_events_.push_back(delayed_events_.back());
+            delayed_events_.pop_back();
         }
         
-        DelayedEventVector::iterator i = delayed_events_.begin();
+        TakeSubmittedEvents();
         
-        while (i != delayed_events_.end())
+        for(size_t i = 0; i < due_events_.size(); ++i)
         {
-            if (i->delay_ <= 0.0)
-            {
-                SendEvent(i->category_id_, i->event_id_, i->data_.get());
-                i = delayed_events_.erase(i);
-            }
+            DelayedEvent* event = due_events_[i];
+            event_category_id_t category_id = event->category_id_;
+            event_id_t event_id = event->event_id_;
+            EventDataPtr data = event->data_;
+            delete event;
+            
+            SendEvent(category_id, event_id, data.get());
+        }
+        due_events_.clear();
+        
+        current_time_ += frametime;
+    }
+    
+    void EventManager::TakeSubmittedEvents()
+    {
+        // The stack holds the newest event first, reverse it to get the submission order
+        DelayedEvent* newest = TakeEvents(&submitted_events_);
+        DelayedEvent* event = 0;
+        while (newest)
+        {
+            DelayedEvent* next = newest->next_;
+            newest->next_ = event;
+            event = newest;
+            newest = next;
+        }
+        
+        while (event)
+        {
+            DelayedEvent* next = event->next_;
+            event->next_ = 0;
+            event->sequence_ = next_sequence_++;
+            
+            if (event->delay_ <= 0.0)
+                due_events_.push_back(event);
             else
-            {   
-                i->delay_ -= frametime;
-                ++i;
+            {
+                event->due_time_ = current_time_ + event->delay_;
+                delayed_events_.push_back(event);
+                std::push_heap(delayed_events_.begin(), delayed_events_.end(), LaterDelayedEvent());
             }
+            event = next;
         }
     }
 }
@@ -9,6 +9,8 @@
 
 #include <qnamespace.h>
 
+#include <boost/unordered_map.hpp>
+
 class QDomElement;
 
 namespace Foundation
@@ -39,13 +41,37 @@ namespace Foundation
             EventSubscriberVector children_;
         };
         
+        //! Precomputed list of subscribers an event is dispatched to, with dispatch counters. Used internally by EventManager.
+        struct EventDispatchList
+        {
+            EventDispatchList() : generation_(0), sends_(0), handlers_visited_(0) {}
+            
+            //! Subscriber tree nodes interested in the event, in dispatch order
+            std::vector<EventSubscriber*> subscribers_;
+            //! Subscription generation the list was built in. The list is rebuilt when it does not match the current one.
+            uint generation_;
+            //! How many times the event has been sent
+            uint sends_;
+            //! How many HandleEvent() calls sending the event has made in total
+            uint handlers_visited_;
+        };
+        
+        typedef boost::unordered_map<std::pair<event_category_id_t, event_id_t>, EventDispatchList> EventDispatchMap;
+        
         //! Delayed event. Used internally by EventManager.
         struct DelayedEvent
         {
             event_category_id_t category_id_;
             event_id_t event_id_;
             EventDataPtr data_;
+            //! Delay in seconds, as given by the sender
             f64 delay_;
+            //! Absolute time at which the event is sent, in seconds of EventManager time
+            f64 due_time_;
+            //! Running number assigned when the event is taken into processing, so that events due at the same time are sent in order
+            uint sequence_;
+            //! Next event in the submission queue
+            DelayedEvent* next_;
         };
         
         EventManager(Framework *framework);
@@ -128,6 +154,26 @@ namespace Foundation
          */
         bool UnregisterEventSubscriber(ModuleInterface* module);
         
+        //! Declares that a module is interested in all events of a category
+        /*! A module that has not declared any interests receives every event, as with the plain subscriber tree.
+            Once it declares an interest, it receives only the events it has declared. The priority order of the
+            subscriber tree is kept.
+            \param module Module, does not need to be in the subscriber tree yet
+            \param category_id Event category ID
+         */
+        void SubscribeEventCategory(ModuleInterface* module, event_category_id_t category_id);
+        
+        //! Declares that a module is interested in a single event
+        /*! See SubscribeEventCategory().
+            \param module Module, does not need to be in the subscriber tree yet
+            \param category_id Event category ID
+            \param event_id Event ID
+         */
+        void SubscribeEvent(ModuleInterface* module, event_category_id_t category_id, event_id_t event_id);
+        
+        //! Removes all interests a module has declared, so that it receives every event again
+        void UnsubscribeEvents(ModuleInterface* module);
+        
         //! Checks if module is registered as an event subscriber
         /*! \param module Module to check
             \return true if is registered
@@ -138,9 +184,14 @@ namespace Foundation
         void ValidateEventSubscriberTree();
         
         //! Processes delayed events. Called by the framework.
-        /*! \param frametime Time since last frame
+        /*! Takes in the events submitted since the last call and sends the ones that are due. Only the due events
+            are touched, so the cost does not depend on how many events are waiting for a later frame.
+            \param frametime Time since last frame
          */ 
         void ProcessDelayedEvents(f64 frametime);
+
+        //! Returns number of delayed events waiting to be sent, not counting ones submitted since the last ProcessDelayedEvents()
+        size_t GetNumDelayedEvents() const { return delayed_events_.size(); }
         
         //! Loads event subscriber tree from an XML file
         /*! \param filename Path/filename of XML file
@@ -156,6 +207,9 @@ namespace Foundation
         
         //! Returns event map
         const EventMap &GetEventMap() const { return event_map_; }
+        
+        //! Returns the dispatch lists of the events sent so far, with their send and handler call counters
+        const EventDispatchMap &GetEventDispatchMap() const { return dispatch_lists_; }
          
         //! Returns next unused non-zero request tag for asset/resource request events
         /*! By having a global source for the tags there is no risk for collisions between
@@ -181,14 +235,22 @@ namespace Foundation
          */
         EventSubscriber* FindNodeWithChild(EventSubscriber* node, ModuleInterface* module) const;
         
-        //! Sends event to a module in the subscriber tree, propagate to children as necessary
-        /*! \param node Which tree node to send to
+        //! Returns the dispatch list of an event, rebuilding it if subscriptions have changed since it was built
+        EventDispatchList& GetDispatchList(event_category_id_t category_id, event_id_t event_id) const;
+        
+        //! Appends the subscribers of a subtree that are interested in an event to a dispatch list, in dispatch order
+        /*! \param node Subtree root
             \param category_id Event category ID
             \param event_id Event ID
-            \param data Pointer to event data structure (event-specific)
-            \return true if event handled and further nodes should not be processed
+            \param list Dispatch list to append to
          */
-        bool SendEvent(EventSubscriber* node, event_category_id_t category_id, event_id_t event_id, EventDataInterface* data) const;
+        void BuildDispatchList(EventSubscriber* node, event_category_id_t category_id, event_id_t event_id, EventDispatchList& list) const;
+        
+        //! Checks if a module wants to receive an event
+        bool IsInterested(const std::string& module_name, event_category_id_t category_id, event_id_t event_id) const;
+        
+        //! Invalidates all dispatch lists. Called when the subscriber tree or the declared interests change.
+        void InvalidateDispatchLists() { ++dispatch_generation_; }
         
         //! Populates subscriber tree from xml elements
         /*! \param node Pointer to xml element
@@ -196,6 +258,20 @@ namespace Foundation
          */
         void BuildTreeFromNode(QDomElement& elem, const std::string parent_name);
 
+        //! Moves the events submitted from any thread since the last call to the delayed event heap. Main thread only.
+        void TakeSubmittedEvents();
+
+        //! Orders the delayed event heap so that the event that is due first is on top
+        struct LaterDelayedEvent
+        {
+            bool operator()(const DelayedEvent* lhs, const DelayedEvent* rhs) const
+            {
+                if (lhs->due_time_ != rhs->due_time_)
+                    return lhs->due_time_ > rhs->due_time_;
+                return (int)(lhs->sequence_ - rhs->sequence_) > 0;
+            }
+        };
+
         //! Next event category ID that will be assigned
         event_category_id_t next_category_id_;
         
@@ -210,14 +286,40 @@ namespace Foundation
         
         //! Event subscriber tree root node
         EventSubscriberPtr event_subscriber_root_;
+        
+        //! Events a module has declared interest in
+        struct EventInterest
+        {
+            std::set<event_category_id_t> categories_;
+            std::set<std::pair<event_category_id_t, event_id_t> > events_;
+        };
+        
+        //! Declared interests by module name. Modules that are not in the map receive every event.
+        typedef std::map<std::string, EventInterest> EventInterestMap;
+        EventInterestMap event_interests_;
+        
+        //! Dispatch lists by event, built when an event is first sent
+        mutable EventDispatchMap dispatch_lists_;
+        
+        //! Current subscription generation
+        uint dispatch_generation_;
       
-        //! Delayed events
-        typedef std::vector<DelayedEvent> DelayedEventVector;
-        DelayedEventVector new_delayed_events_;
+        //! Delayed events waiting to be sent, as a min-heap ordered by due time
+        typedef std::vector<DelayedEvent*> DelayedEventVector;
         DelayedEventVector delayed_events_;
-        
-        //! Mutex for new delayed events
-        Mutex delayed_events_mutex_;
+
+        //! Events that are due this frame, kept to avoid reallocation
+        DelayedEventVector due_events_;
+
+        //! Newly submitted delayed events, as a lock-free stack with the newest event first. Pushed to by any thread,
+        //! emptied by the main thread in TakeSubmittedEvents().
+        DelayedEvent* volatile submitted_events_;
+
+        //! Time processed by ProcessDelayedEvents() so far, in seconds
+        f64 current_time_;
+
+        //! Next sequence number for delayed events
+        uint next_sequence_;
         
         //! Framework
         Framework *framework_;
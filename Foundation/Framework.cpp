@@ -117,7 +117,20 @@ namespace Foundation
             component_manager_ = ComponentManagerPtr(new ComponentManager(this));
             service_manager_ = ServiceManagerPtr(new ServiceManager(this));
             event_manager_ = EventManagerPtr(new EventManager(this));
-            thread_task_manager_ = ThreadTaskManagerPtr(new ThreadTaskManager(this));
+
+            // By default leave one core for the main thread
+            int default_pool_threads = boost::thread::hardware_concurrency() - 1;
+            if (default_pool_threads <= 0)
+                default_pool_threads = 1;
+            int pool_threads = config_manager_->DeclareSetting(Framework::ConfigurationGroup(), std::string("task_pool_threads"), default_pool_threads);
+            if (pool_threads <= 0)
+                pool_threads = 1;
+            thread_task_manager_ = ThreadTaskManagerPtr(new ThreadTaskManager(this, pool_threads));
+            // Spread bursts of task results over several frames, 0 delivers all results at once
+            int max_task_results = config_manager_->DeclareSetting(Framework::ConfigurationGroup(), std::string("max_task_results_per_frame"), 100);
+            if (max_task_results < 0)
+                max_task_results = 0;
+            thread_task_manager_->SetMaxResultsPerFrame(max_task_results);
 
             Scene::Events::RegisterSceneEvents(event_manager_);
             Resource::Events::RegisterResourceEvents(event_manager_);
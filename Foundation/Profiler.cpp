@@ -13,6 +13,8 @@ namespace Foundation
 #ifdef _WINDOWS
     LARGE_INTEGER ProfilerBlock::frequency_;
     LARGE_INTEGER ProfilerBlock::api_overhead_;
+#else
+    boost::int64_t ProfilerBlock::api_overhead_ = 0;
 #endif
 
     Profiler *ProfilerSection::profiler_ = 0;
@@ -22,6 +24,18 @@ namespace Foundation
 #ifdef _WINDOWS
         BOOL result = QueryPerformanceFrequency(&frequency_);
         supported_ = (result != 0);
+#else
+        timespec res;
+        supported_ = (clock_getres(CLOCK_MONOTONIC, &res) == 0);
+        if (supported_)
+        {
+            // Estimate the cost of reading the clock, so it can be subtracted from the measured blocks.
+            const int samples = 64;
+            boost::int64_t start = GetMonotonicNanoseconds();
+            for(int i = 0; i < samples; ++i)
+                GetMonotonicNanoseconds();
+            api_overhead_ = (GetMonotonicNanoseconds() - start) / (samples + 1);
+        }
 #endif
         return supported_;
     }
@@ -49,6 +63,8 @@ namespace Foundation
         if (!node)
         {
             node = new ProfilerNode(name);
+            // Only the reporting code can contend for this lock, and only the first entry to a block gets here.
+            boost::mutex::scoped_lock lock(thread_specific_root_->mutex_);
             parent->AddChild(boost::shared_ptr<ProfilerNodeTree>(node));
         }
 
@@ -126,7 +142,7 @@ namespace Foundation
     {
         std::string rootObjectName = GetThisThreadRootBlockName();
 
-        ProfilerNodeTree *root = new ProfilerNodeTree(rootObjectName);
+        ProfilerThreadRootNode *root = new ProfilerThreadRootNode(rootObjectName);
         thread_specific_root_.reset(root);
 
         // Each thread root block is added as a child of a dummy node root_ owned by
@@ -144,10 +160,11 @@ namespace Foundation
     void Profiler::RemoveThreadRootBlock(ProfilerNodeTree *rootBlock)
     {
         mutex_.lock();
-        for(std::list<ProfilerNodeTree*>::iterator iter = thread_root_nodes_.begin(); iter != thread_root_nodes_.end(); ++iter)
+        for(std::list<ProfilerThreadRootNode*>::iterator iter = thread_root_nodes_.begin(); iter != thread_root_nodes_.end(); ++iter)
             if (*iter == rootBlock)
             {
                 thread_root_nodes_.erase(iter);
+                root_.RemoveChild(rootBlock);
                 mutex_.unlock();
                 return;
             }
@@ -158,12 +175,27 @@ namespace Foundation
 
     void Profiler::ThreadedReset()
     {
-        ProfilerNodeTree *root = GetThreadRootBlock();
+        ProfilerThreadRootNode *root = thread_specific_root_.get();
         if (!root)
             return;
 
-        mutex_.lock();
+        // Per-thread lock, so that threads resetting their own trees never wait for each other.
+        boost::mutex::scoped_lock lock(root->mutex_);
         root->ResetValues();
+    }
+
+    ProfilerNodeTree *Profiler::Lock()
+    {
+        mutex_.lock();
+        for(std::list<ProfilerThreadRootNode*>::iterator iter = thread_root_nodes_.begin(); iter != thread_root_nodes_.end(); ++iter)
+            (*iter)->mutex_.lock();
+        return &root_;
+    }
+
+    void Profiler::Release()
+    {
+        for(std::list<ProfilerThreadRootNode*>::iterator iter = thread_root_nodes_.begin(); iter != thread_root_nodes_.end(); ++iter)
+            (*iter)->mutex_.unlock();
         mutex_.unlock();
     }
 
@@ -178,7 +210,7 @@ namespace Foundation
         // We are going down.. tell all root blocks that they don't need to notify back to the Profiler that they've been deleted.
         // i.e. 'detach' all the (thread specific) root blocks so that they delete themselves at their leisure when their threads die.
         mutex_.lock();
-        for(std::list<ProfilerNodeTree*>::iterator iter = thread_root_nodes_.begin(); iter != thread_root_nodes_.end(); ++iter)
+        for(std::list<ProfilerThreadRootNode*>::iterator iter = thread_root_nodes_.begin(); iter != thread_root_nodes_.end(); ++iter)
             (*iter)->MarkAsRootBlock(0);
         mutex_.unlock();
     }
@@ -6,10 +6,13 @@
 #ifdef _WINDOWS
 #include <Winsock2.h>
 #include <Windows.h>
+#else
+#include <time.h>
 #endif
 
 #include "boost/thread.hpp"
-#if defined(_WINDOWS) && defined(PROFILING)
+#include "boost/cstdint.hpp"
+#if defined(PROFILING)
 //! Profiles a block of code in current scope. Ends the profiling when it goes out of scope
 /*! Name of the profiling block must be unique in the scope, so do not use the name of the function
     as the name of the profiling block!
@@ -36,7 +39,7 @@
 #endif
 
 #ifndef _WINDOWS
-    typedef int LONGLONG;
+    typedef long long LONGLONG;
 #endif
 
 
@@ -45,7 +48,11 @@ namespace Foundation
 {
     class ProfilerNodeTree;
 
-    //! Profiles a block of code using Windows API function QueryPerformanceCounter
+    //! Profiles a block of code
+    /*! On Windows the timing is done using QueryPerformanceCounter, on other platforms
+        using the monotonic clock (clock_gettime(CLOCK_MONOTONIC)), which on Linux is
+        serviced from the vDSO without a system call.
+    */
     class ProfilerBlock
     {
         friend class ProfilerNode;
@@ -69,6 +76,8 @@ namespace Foundation
                 // boost::this_thread::yield();
 #ifdef _WINDOWS
                 QueryPerformanceCounter(&start_time_);
+#else
+                start_time_ = GetMonotonicNanoseconds();
 #endif
             }
 	    }
@@ -79,6 +88,8 @@ namespace Foundation
             {
 #ifdef _WINDOWS
                 QueryPerformanceCounter(&end_time_);
+#else
+                end_time_ = GetMonotonicNanoseconds();
 #endif
             }
         }
@@ -94,6 +105,12 @@ namespace Foundation
          
                 return (elapsed_s < 0 ? 0 : elapsed_s);
             }
+#else
+            if (supported_)
+            {
+                boost::int64_t elapsed_ns = end_time_ - start_time_ - api_overhead_;
+                return (elapsed_ns < 0 ? 0.0 : elapsed_ns * 1e-9);
+            }
 #endif
             return 0.0;
 	    }
@@ -122,10 +139,26 @@ namespace Foundation
 
                 return (elapsed_ms < 0 ? 0 : (LONGLONG)0);
             }
+#else
+            if (supported_)
+            {
+                boost::int64_t elapsed_ns = end_time_ - start_time_ - api_overhead_;
+                return (elapsed_ns < 0 ? 0 : static_cast<LONGLONG>(elapsed_ns / 1000));
+            }
 #endif
             return 0;
 	    }
 
+#ifndef _WINDOWS
+        //! Returns current value of the monotonic clock in nanoseconds
+        static boost::int64_t GetMonotonicNanoseconds()
+        {
+            timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return static_cast<boost::int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+        }
+#endif
+
     private:
         //! is high frequency perf counter supported in this platform
         static bool supported_;
@@ -141,6 +174,12 @@ namespace Foundation
         LARGE_INTEGER end_time_;
    
         LARGE_INTEGER time_elapsed_;
+#else
+        //! Time taken to read the monotonic clock, in nanoseconds
+        static boost::int64_t api_overhead_;
+
+        boost::int64_t start_time_;
+        boost::int64_t end_time_;
 #endif
     };
 
@@ -235,6 +274,9 @@ namespace Foundation
             owner_ = owner;
         }
 
+        //! Returns the profiler owning this root block, or 0 if this is not a root block
+        Profiler *Owner() const { return owner_; }
+
     private:
         //! list of all children for this node
         NodeList children_;
@@ -250,6 +292,31 @@ namespace Foundation
     };
     typedef boost::shared_ptr<ProfilerNodeTree> ProfilerNodeTreePtr;
 
+    //! Root node of the profiling tree of a single thread.
+    /*! Each thread has its own lock for its tree. It is only taken by the owning thread when
+        the shape of the tree changes or the per-frame values are reset, and by Profiler::Lock()
+        when reporting, so profiled threads never contend with each other.
+    */
+    class ProfilerThreadRootNode : public ProfilerNodeTree
+    {
+        ProfilerThreadRootNode(const ProfilerThreadRootNode &rhs); // N/I
+    public:
+        explicit ProfilerThreadRootNode(const std::string &name) : ProfilerNodeTree(name) {}
+
+        //! Detaches from the owning profiler while the lock is still alive.
+        virtual ~ProfilerThreadRootNode()
+        {
+            if (Owner())
+            {
+                RemoveThreadRootBlock();
+                MarkAsRootBlock(0);
+            }
+        }
+
+        //! Guards the children of this node and the per-frame values of the tree
+        boost::mutex mutex_;
+    };
+
     //! Data container for profiling data for a profiling block
     class ProfilerNode : public ProfilerNodeTree
     {
@@ -272,7 +339,7 @@ namespace Foundation
           elapsed_max_current_(0.0),
           num_called_custom_(0),
           total_custom_(0),
-          custom_elapsed_min_(0),
+          custom_elapsed_min_(1e9),
           custom_elapsed_max_(0)
           {
           }
@@ -416,16 +483,12 @@ namespace Foundation
         ProfilerNodeTree *GetOrCreateThreadRootBlock();
 
         //! Returns root profiling node for all threads.
-        ProfilerNodeTree *Lock()
-        {
-            mutex_.lock();
-            return &root_;
-        }
+        /*! Locks the profiler and the trees of all threads for reporting. Call Release() when done.
+        */
+        ProfilerNodeTree *Lock();
 
-        void Release()
-        {
-            mutex_.unlock();
-        }
+        //! Releases the locks taken by Lock()
+        void Release();
 
         ProfilerNodeTree *GetRoot() { return &root_; }
 
@@ -438,13 +501,14 @@ namespace Foundation
         ProfilerNodeTree root_;
 
         //! Contains the root profile block for each thread.
-        boost::thread_specific_ptr<ProfilerNodeTree> thread_specific_root_;
+        boost::thread_specific_ptr<ProfilerThreadRootNode> thread_specific_root_;
         //! Points to the current topmost profile block in the stack for each thread.
         boost::thread_specific_ptr<ProfilerNodeTree> current_node_;
 
         //! container for all the root profile nodes for each thread.
-        std::list<ProfilerNodeTree*> thread_root_nodes_;
+        std::list<ProfilerThreadRootNode*> thread_root_nodes_;
 
+        //! Guards root_ and thread_root_nodes_. Not taken while profiling blocks.
         boost::mutex mutex_;
     };
 
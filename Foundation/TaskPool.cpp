@@ -0,0 +1,279 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "TaskPool.h"
+#include "HighPerfClock.h"
+
+namespace Foundation
+{
+    TaskCompletion::TaskCompletion(TaskPool* pool) :
+        pool_(pool),
+        done_(false)
+    {
+    }
+
+    bool TaskCompletion::IsDone() const
+    {
+        MutexLock lock(mutex_);
+        return done_;
+    }
+
+    void TaskCompletion::Wait()
+    {
+        if (pool_ && pool_->IsWorkerThread())
+        {
+            // Keep the worker busy with other jobs, the job waited for may be in the queue behind them
+            while (!IsDone())
+            {
+                if (!pool_->RunPendingJob())
+                {
+                    ScopedLock lock(mutex_);
+                    if (!done_)
+                        condition_.timed_wait(lock, boost::posix_time::milliseconds(1));
+                }
+            }
+        }
+        else
+        {
+            ScopedLock lock(mutex_);
+            while (!done_)
+                condition_.wait(lock);
+        }
+    }
+
+    void TaskCompletion::Then(const TaskJob& continuation)
+    {
+        {
+            MutexLock lock(mutex_);
+            if (!done_)
+            {
+                continuations_.push_back(continuation);
+                return;
+            }
+        }
+
+        pool_->Submit(continuation);
+    }
+
+    void TaskCompletion::Complete()
+    {
+        std::vector<TaskJob> continuations;
+        {
+            MutexLock lock(mutex_);
+            done_ = true;
+            continuations.swap(continuations_);
+        }
+        condition_.notify_all();
+
+        for (uint i = 0; i < continuations.size(); ++i)
+            pool_->Submit(continuations[i]);
+    }
+
+    TaskPool::TaskPool(uint num_workers) :
+        current_worker_(&KeepWorker),
+        pending_(0),
+        stopping_(false),
+        next_worker_(0)
+    {
+        if (!num_workers)
+            num_workers = 1;
+
+        for (uint i = 0; i < num_workers; ++i)
+        {
+            workers_.push_back(new Worker());
+            workers_.back()->index_ = i;
+        }
+        for (uint i = 0; i < num_workers; ++i)
+            workers_[i]->thread_ = boost::thread(boost::bind(&TaskPool::WorkerLoop, this, i));
+    }
+
+    TaskPool::~TaskPool()
+    {
+        {
+            MutexLock lock(wake_mutex_);
+            stopping_ = true;
+        }
+        wake_condition_.notify_all();
+
+        for (uint i = 0; i < workers_.size(); ++i)
+        {
+            workers_[i]->thread_.join();
+            delete workers_[i];
+        }
+        workers_.clear();
+    }
+
+    TaskCompletionPtr TaskPool::Submit(const TaskJob& job)
+    {
+        QueuedJob queued;
+        queued.job_ = job;
+        queued.completion_ = TaskCompletionPtr(new TaskCompletion(this));
+
+        // Jobs submitted by a worker stay with it, others are dealt in turn
+        uint index;
+        int current = GetCurrentWorker();
+        if (current >= 0)
+            index = current;
+        else
+        {
+            MutexLock lock(wake_mutex_);
+            index = next_worker_++ % workers_.size();
+        }
+
+        {
+            MutexLock lock(workers_[index]->mutex_);
+            workers_[index]->queue_.push_back(queued);
+        }
+        {
+            MutexLock lock(wake_mutex_);
+            ++pending_;
+        }
+        wake_condition_.notify_one();
+
+        return queued.completion_;
+    }
+
+    uint TaskPool::GetQueueDepth() const
+    {
+        uint depth = 0;
+        for (uint i = 0; i < workers_.size(); ++i)
+        {
+            MutexLock lock(workers_[i]->mutex_);
+            depth += workers_[i]->queue_.size();
+        }
+        return depth;
+    }
+
+    void TaskPool::GetWorkerStats(std::vector<WorkerStats>& stats) const
+    {
+        const f64 freq = (f64)Core::GetCurrentClockFreq();
+
+        stats.resize(workers_.size());
+        for (uint i = 0; i < workers_.size(); ++i)
+        {
+            const Worker* worker = workers_[i];
+            MutexLock lock(worker->mutex_);
+            stats[i].busy_time_ = worker->busy_ticks_ / freq;
+            stats[i].jobs_run_ = worker->jobs_run_;
+            stats[i].jobs_stolen_ = worker->jobs_stolen_;
+            stats[i].queue_depth_ = worker->queue_.size();
+        }
+    }
+
+    bool TaskPool::RunPendingJob()
+    {
+        int current = GetCurrentWorker();
+        if (current < 0)
+            return false;
+
+        QueuedJob job;
+        bool stolen;
+        if (!TakeJob(current, job, stolen))
+            return false;
+
+        RunJob(current, job, stolen);
+        return true;
+    }
+
+    void TaskPool::WorkerLoop(uint index)
+    {
+        current_worker_.reset(workers_[index]);
+
+        for (;;)
+        {
+            QueuedJob job;
+            bool stolen;
+            if (TakeJob(index, job, stolen))
+            {
+                RunJob(index, job, stolen);
+                continue;
+            }
+
+            ScopedLock lock(wake_mutex_);
+            while (pending_ <= 0 && !stopping_)
+                wake_condition_.wait(lock);
+            if (pending_ <= 0 && stopping_)
+                break;
+        }
+    }
+
+    bool TaskPool::TakeJob(uint index, QueuedJob& job, bool& stolen)
+    {
+        stolen = false;
+        bool found = false;
+
+        // Newest job of the own queue first
+        {
+            Worker* worker = workers_[index];
+            MutexLock lock(worker->mutex_);
+            if (!worker->queue_.empty())
+            {
+                job = worker->queue_.back();
+                worker->queue_.pop_back();
+                found = true;
+            }
+        }
+
+        // Then the oldest job of any other queue
+        for (uint i = 1; i < workers_.size() && !found; ++i)
+        {
+            Worker* victim = workers_[(index + i) % workers_.size()];
+            MutexLock lock(victim->mutex_);
+            if (!victim->queue_.empty())
+            {
+                job = victim->queue_.front();
+                victim->queue_.pop_front();
+                found = stolen = true;
+            }
+        }
+
+        if (found)
+        {
+            MutexLock lock(wake_mutex_);
+            --pending_;
+        }
+        return found;
+    }
+
+    void TaskPool::RunJob(uint index, QueuedJob& job, bool stolen)
+    {
+        Worker* worker = workers_[index];
+        ++worker->depth_;
+        Core::tick_t start = Core::GetCurrentClockTime();
+        try
+        {
+            job.job_();
+        }
+        catch (std::exception& e)
+        {
+            RootLogError(std::string("Task pool job threw an exception: ") + e.what());
+        }
+        catch (...)
+        {
+            RootLogError("Task pool job threw an unknown exception");
+        }
+        Core::tick_t end = Core::GetCurrentClockTime();
+        --worker->depth_;
+
+        {
+            // Jobs run while another job waits are already counted in its time
+            MutexLock lock(worker->mutex_);
+            if (!worker->depth_)
+                worker->busy_ticks_ += end - start;
+            ++worker->jobs_run_;
+            if (stolen)
+                ++worker->jobs_stolen_;
+        }
+
+        // Release the job before signaling completion, so that whatever it holds is freed when the waiter wakes up
+        TaskCompletionPtr completion = job.completion_;
+        job = QueuedJob();
+        completion->Complete();
+    }
+
+    int TaskPool::GetCurrentWorker() const
+    {
+        Worker* worker = current_worker_.get();
+        return worker ? (int)worker->index_ : -1;
+    }
+}
@@ -0,0 +1,297 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_Foundation_TaskPool_h
+#define incl_Foundation_TaskPool_h
+
+#include "ForwardDefines.h"
+#include "CoreTypes.h"
+#include "CoreThread.h"
+#include "CoreException.h"
+
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/optional.hpp>
+#include <boost/thread/tss.hpp>
+#include <deque>
+
+namespace Foundation
+{
+    class TaskPool;
+
+    //! A job run by a TaskPool
+    typedef boost::function<void ()> TaskJob;
+
+    //! Completion state of a job submitted to a TaskPool. All functions are threadsafe.
+    class TaskCompletion
+    {
+        friend class TaskPool;
+
+    public:
+        //! Constructor
+        /*! \param pool Pool that runs the continuations
+         */
+        explicit TaskCompletion(TaskPool* pool);
+
+        //! Returns whether the job has finished
+        bool IsDone() const;
+
+        //! Waits for the job to finish
+        /*! When called from a pool worker, runs other pool jobs while waiting, so that jobs waiting for each other
+            can not exhaust the workers.
+         */
+        void Wait();
+
+        //! Adds a job that is submitted to the pool when this job finishes, or right away if it already has
+        void Then(const TaskJob& continuation);
+
+        //! Marks the job finished and submits its continuations
+        void Complete();
+
+        //! Returns the pool
+        TaskPool* GetPool() const { return pool_; }
+
+    private:
+        //! Pool
+        TaskPool* pool_;
+        //! Mutex for the state
+        mutable Mutex mutex_;
+        //! Condition signaled when finished
+        Condition condition_;
+        //! Finished flag
+        bool done_;
+        //! Continuations to submit when finished
+        std::vector<TaskJob> continuations_;
+    };
+
+    typedef boost::shared_ptr<TaskCompletion> TaskCompletionPtr;
+
+    //! Result of a job submitted to a TaskPool with TaskPool::Submit<T>()
+    template <class T> class TaskFuture
+    {
+        friend class TaskPool;
+
+    public:
+        //! Constructs a future that is not bound to any job
+        TaskFuture() {}
+
+        //! Returns whether the future is bound to a job
+        bool IsValid() const { return completion_.get() != 0; }
+
+        //! Returns whether the job has finished
+        bool IsReady() const { return completion_ && completion_->IsDone(); }
+
+        //! Waits for the job to finish and returns its result
+        /*! Throws Exception if the job ended with an exception.
+         */
+        const T& Get() const
+        {
+            completion_->Wait();
+            if (!*value_)
+                throw Exception("Task pool job did not produce a result");
+            return value_->get();
+        }
+
+        //! Returns the completion state, for waiting or adding untyped continuations
+        TaskCompletionPtr GetCompletion() const { return completion_; }
+
+        //! Runs a function on the result in the pool when the job finishes
+        /*! \param continuation Function to run. Is not run if the job ended with an exception, in which case the
+                   returned future fails as well.
+            \return Future of the value the continuation returns
+         */
+        template <class U> TaskFuture<U> Then(const boost::function<U (const T&)>& continuation) const
+        {
+            TaskFuture<U> next;
+            next.completion_ = TaskCompletionPtr(new TaskCompletion(completion_->GetPool()));
+            next.value_ = boost::shared_ptr<boost::optional<U> >(new boost::optional<U>());
+            completion_->Then(boost::bind(&TaskFuture<T>::template RunContinuation<U>, continuation, value_, next.completion_, next.value_));
+            return next;
+        }
+
+    private:
+        template <class U> friend class TaskFuture;
+
+        //! Runs a continuation of Then() and stores its value
+        template <class U> static void RunContinuation(boost::function<U (const T&)> continuation,
+            boost::shared_ptr<boost::optional<T> > value, TaskCompletionPtr next_completion, boost::shared_ptr<boost::optional<U> > next_value)
+        {
+            try
+            {
+                if (*value)
+                    *next_value = continuation(value->get());
+            }
+            catch (std::exception& e)
+            {
+                RootLogError(std::string("Task pool continuation threw an exception: ") + e.what());
+            }
+            catch (...)
+            {
+                RootLogError("Task pool continuation threw an unknown exception");
+            }
+            next_completion->Complete();
+        }
+
+        //! Runs a job of TaskPool::Submit<T>() and stores its value
+        static void Run(boost::function<T ()> job, boost::shared_ptr<boost::optional<T> > value)
+        {
+            *value = job();
+        }
+
+        //! Completion state
+        TaskCompletionPtr completion_;
+        //! Result, empty until the job has finished or if it threw
+        boost::shared_ptr<boost::optional<T> > value_;
+    };
+
+    //! Work-stealing pool of worker threads for short CPU-bound jobs.
+    /*! Each worker has its own job queue. A job submitted from a worker goes to that worker's queue, which the
+        worker runs newest first to keep its data in cache. Jobs submitted from other threads are spread among the
+        workers. A worker whose queue is empty steals the oldest job from another worker's queue.
+
+        Jobs should not block for long, e.g. on network or disk I/O, as that keeps a worker from running other
+        jobs. Use a ThreadTask with a dedicated thread for those.
+
+        The framework's ThreadTaskManager owns a pool, see ThreadTaskManager::GetTaskPool(). ThreadTasks that are
+        constructed in pooled mode serve their requests as jobs of that pool.
+
+        \code
+        TaskFuture<int> sum = pool->Submit<int>(boost::bind(&SumRange, data, 0, 1000));
+        TaskFuture<std::string> text = sum.Then<std::string>(&ToString<int>);
+        ...
+        if (text.IsReady())
+            LogInfo(text.Get());
+        \endcode
+     */
+    class TaskPool
+    {
+    public:
+        //! Statistics of a worker
+        struct WorkerStats
+        {
+            //! Time spent running jobs, in seconds
+            f64 busy_time_;
+            //! Number of jobs run
+            uint jobs_run_;
+            //! Number of jobs run that were stolen from other workers
+            uint jobs_stolen_;
+            //! Number of jobs currently in the worker's queue
+            uint queue_depth_;
+        };
+
+        //! Constructor. Starts the worker threads.
+        /*! \param num_workers Number of worker threads, at least 1
+         */
+        explicit TaskPool(uint num_workers);
+
+        //! Destructor. Runs the jobs still queued, then stops the worker threads.
+        ~TaskPool();
+
+        //! Submits a job
+        /*! \return Completion state of the job
+         */
+        TaskCompletionPtr Submit(const TaskJob& job);
+
+        //! Submits a job that returns a value
+        /*! \return Future of the value
+         */
+        template <class T> TaskFuture<T> Submit(const boost::function<T ()>& job)
+        {
+            TaskFuture<T> future;
+            future.value_ = boost::shared_ptr<boost::optional<T> >(new boost::optional<T>());
+            future.completion_ = Submit(boost::bind(&TaskFuture<T>::Run, job, future.value_));
+            return future;
+        }
+
+        //! Returns number of worker threads
+        uint GetNumWorkers() const { return workers_.size(); }
+
+        //! Returns number of jobs queued and not yet started
+        uint GetQueueDepth() const;
+
+        //! Returns statistics of each worker. The times and counts accumulate from the start of the pool.
+        void GetWorkerStats(std::vector<WorkerStats>& stats) const;
+
+        //! Returns whether the calling thread is a worker of this pool
+        bool IsWorkerThread() const { return GetCurrentWorker() >= 0; }
+
+        //! Runs one queued job in the calling worker thread, if there is one. Used when a worker waits for a job.
+        /*! \return true if a job was run
+         */
+        bool RunPendingJob();
+
+    private:
+        TaskPool(const TaskPool&);
+        void operator=(const TaskPool&);
+
+        //! A queued job
+        struct QueuedJob
+        {
+            TaskJob job_;
+            TaskCompletionPtr completion_;
+        };
+
+        //! A worker thread and its job queue
+        struct Worker
+        {
+            Worker() : index_(0), depth_(0), busy_ticks_(0), jobs_run_(0), jobs_stolen_(0) {}
+
+            //! Index in the worker vector
+            uint index_;
+            //! Number of jobs the worker is running, more than one when a job waits for another. Used by the worker thread only.
+            uint depth_;
+            //! Mutex for the queue and statistics
+            mutable Mutex mutex_;
+            //! Job queue. The owner takes jobs from the back, thieves from the front.
+            std::deque<QueuedJob> queue_;
+            //! The thread
+            Thread thread_;
+            //! Clock ticks spent running jobs
+            boost::uint64_t busy_ticks_;
+            //! Number of jobs run
+            uint jobs_run_;
+            //! Number of stolen jobs run
+            uint jobs_stolen_;
+        };
+
+        //! Worker thread entry point
+        void WorkerLoop(uint index);
+
+        //! Takes a job for a worker, from its own queue or by stealing
+        /*! \param index Worker index
+            \param job [out] The job
+            \param stolen [out] Whether the job was stolen
+            \return true if a job was taken
+         */
+        bool TakeJob(uint index, QueuedJob& job, bool& stolen);
+
+        //! Runs a taken job in a worker and updates its statistics
+        void RunJob(uint index, QueuedJob& job, bool stolen);
+
+        //! Returns the index of the worker running the calling thread, or -1 if not a worker
+        int GetCurrentWorker() const;
+
+        //! Cleanup function of current_worker_. Does nothing, as the pool owns the workers.
+        static void KeepWorker(Worker* worker) {}
+
+        //! Workers
+        std::vector<Worker*> workers_;
+
+        //! The worker of the calling thread, null if not a worker thread
+        boost::thread_specific_ptr<Worker> current_worker_;
+
+        //! Mutex for sleeping and waking up workers
+        Mutex wake_mutex_;
+        //! Condition signaled when jobs are submitted or the pool is stopping
+        Condition wake_condition_;
+        //! Number of queued jobs. May briefly go negative, as a job can be taken before the submitter counts it.
+        int pending_;
+        //! Stop flag
+        bool stopping_;
+        //! Next worker to give a job submitted from outside the pool
+        uint next_worker_;
+    };
+
+    typedef boost::shared_ptr<TaskPool> TaskPoolPtr;
+}
+
+#endif // incl_Foundation_TaskPool_h
@@ -8,9 +8,11 @@
 
 namespace Foundation
 {
-    ThreadTask::ThreadTask(const std::string& task_description) :
+    ThreadTask::ThreadTask(const std::string& task_description, ExecutionMode mode) :
         keep_running_(true),
         task_description_(task_description),
+        mode_(mode),
+        pooled_requests_(0),
         task_manager_(0),
         running_(false),
         finished_(false)
@@ -25,15 +27,41 @@ namespace Foundation
     void ThreadTask::Stop()
     {
         keep_running_ = false;
-        request_condition_.notify_one();
+        request_condition_.notify_all();
         
         thread_.join();
+        
+        ScopedLock lock(request_mutex_);
+        while (pooled_requests_)
+            request_condition_.wait(lock);
+    }
+
+    void ThreadTask::Start()
+    {
+        if (!running_)
+        {
+            thread_.join(); // Make sure it's really stopped, not just set the flag to false
+            running_ = true;
+            finished_ = false;
+            thread_ = boost::thread(boost::ref(*this));
+        }
     }
 
     void ThreadTask::AddRequest(ThreadTaskRequestPtr request)
     {
         if (request)
         {
+            TaskPool* pool = (mode_ == Pooled && task_manager_) ? task_manager_->GetTaskPool() : 0;
+            if (pool)
+            {
+                {
+                    MutexLock lock(request_mutex_);
+                    ++pooled_requests_;
+                }
+                pool->Submit(boost::bind(&ThreadTask::RunPooledRequest, this, request));
+                return;
+            }
+            
             if (!running_)
             {
                 thread_.join(); // Make sure it's really stopped, not just set the flag to false
@@ -63,6 +91,28 @@ namespace Foundation
         return result_;
     }
 
+    void ThreadTask::RunPooledRequest(ThreadTaskRequestPtr request)
+    {
+        if (ShouldRun())
+            ProcessRequest(request);
+        
+        MutexLock lock(request_mutex_);
+        if (!--pooled_requests_)
+            request_condition_.notify_all();
+    }
+    
+    void ThreadTask::Work()
+    {
+        while (ShouldRun())
+        {
+            WaitForRequests();
+            
+            ThreadTaskRequestPtr request = GetNextRequest();
+            if (request)
+                ProcessRequest(request);
+        }
+    }
+    
     void ThreadTask::operator() ()
     {
         Work();
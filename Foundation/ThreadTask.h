@@ -44,27 +44,48 @@ namespace Foundation
         - one-shot, use SetResult() and terminate work thread
         - continuous, use QueueResult() to queue results to the thread task manager, while work thread keeps running
           In this mode a thread task manager is needed to post results to, otherwise results will be lost
+        
+        Tasks whose requests are independent and CPU-bound should instead be constructed in Pooled mode and implement
+        ProcessRequest(). Their requests are then served in parallel by the TaskPool of the thread task manager,
+        instead of one by one in a thread of their own. Results are queued with QueueResult() as for continuous tasks.
+        A pooled task that has no thread task manager falls back to serving its requests in a dedicated thread.
      */
     class ThreadTask
     {
         friend class ThreadTaskManager;
         
     public:
+        //! How the requests of a task are served
+        enum ExecutionMode
+        {
+            //! Work() runs in a thread of the task's own
+            DedicatedThread,
+            //! Each request is served by ProcessRequest() as a job of the thread task manager's task pool
+            Pooled
+        };
+        
         //! Constructor
         /*! \param task_description Description of the work this thread will be doing. Should be unique,
             if work requests are to be communicated via the foundation's default ThreadTaskManager
+            \param mode How requests are served
          */
-        ThreadTask(const std::string& task_description);
+        ThreadTask(const std::string& task_description, ExecutionMode mode = DedicatedThread);
         
         //! Destructor
         /*! Calls Stop(). Note that in subclass destructors, it would be safest to call Stop() first, at least before
-            accessing any data that the still running work thread may also be accessing
+            accessing any data that the still running work thread may also be accessing. Pooled tasks must call Stop()
+            in their destructor, as the pool may otherwise call ProcessRequest() of a partly destroyed object.
          */
         virtual ~ThreadTask();
         
         //! Returns task description.
         const std::string& GetTaskDescription() { return task_description_; }
         
+        //! Starts the work thread if not running, without adding a request
+        /*! For tasks that get their work from elsewhere than the request queue of the task.
+         */
+        void Start();
+
         //! Adds a work request and starts the work thread if not running
         void AddRequest(ThreadTaskRequestPtr request);
         
@@ -92,6 +113,9 @@ namespace Foundation
         bool HasFinished() const { return finished_; }
         
         //! Commands the work thread to stop after current iteration is complete (continuous tasks only)
+        /*! For pooled tasks, waits for the requests being processed and drops the ones not yet started.
+            Do not call from ProcessRequest().
+         */
         void Stop();
         
         //! Thread entry point
@@ -100,8 +124,15 @@ namespace Foundation
     protected:
         //! Performs work thread activity.
         /*! Note: if doing a loop, check ShouldRun() function and terminate when it returns false
+            The default implementation serves requests with ProcessRequest() until stopped.
+         */
+        virtual void Work();
+        
+        //! Serves a single request. Override in pooled tasks.
+        /*! Called from a task pool worker, possibly for several requests of the task at the same time.
+            \param request Request to serve
          */
-        virtual void Work() = 0;
+        virtual void ProcessRequest(ThreadTaskRequestPtr request) {}
         
         //! Waits for request queue to contain at least one item, or ShouldRun() becomes false
         /*! \return true if a request did arrive, false if ShouldRun() becomes false
@@ -161,8 +192,15 @@ namespace Foundation
          */
         void SetThreadTaskManager(ThreadTaskManager* manager) { task_manager_ = manager; }
         
+        //! Serves a request as a task pool job
+        void RunPooledRequest(ThreadTaskRequestPtr request);
+        
         //! Task description
         std::string task_description_;
+        //! How requests are served
+        ExecutionMode mode_;
+        //! Number of requests submitted to the task pool and not yet finished
+        uint pooled_requests_;
         //! Mutex for request queue
         Mutex request_mutex_;
         //! Mutex for result
@@ -9,9 +9,13 @@
 namespace Foundation
 {
 
-    ThreadTaskManager::ThreadTaskManager(Framework* framework) :
+    ThreadTaskManager::ThreadTaskManager(Framework* framework, uint task_pool_threads) :
+        num_results_(0),
+        max_results_per_frame_(0),
         framework_(framework)
     {
+        if (task_pool_threads)
+            task_pool_ = TaskPoolPtr(new TaskPool(task_pool_threads));
     }
 
     ThreadTaskManager::~ThreadTaskManager()
@@ -23,6 +27,21 @@ namespace Foundation
             (*i)->SetThreadTaskManager(0);
             ++i;
         }
+        
+        // Finish the pool's jobs while the rest of the manager still exists
+        task_pool_.reset();
+    }
+    
+    TaskPool* ThreadTaskManager::GetTaskPool()
+    {
+        if (task_pool_)
+            return task_pool_.get();
+        
+        ThreadTaskManagerPtr framework_manager = framework_->GetThreadTaskManager();
+        if (framework_manager && framework_manager.get() != this)
+            return framework_manager->task_pool_.get();
+        
+        return 0;
     }
 
     void ThreadTaskManager::AddThreadTask(ThreadTaskPtr task)
@@ -131,23 +150,89 @@ namespace Foundation
         return 0;
     }
     
+    void ThreadTaskManager::SetResultHandler(const std::string& task_description, const ResultHandler& handler)
+    {
+        MutexLock lock(result_mutex_);
+        result_queues_[task_description].handler_ = handler;
+    }
+    
+    void ThreadTaskManager::RemoveResultHandler(const std::string& task_description)
+    {
+        MutexLock lock(result_mutex_);
+        ResultQueueMap::iterator i = result_queues_.find(task_description);
+        if (i != result_queues_.end())
+            i->second.handler_.clear();
+    }
+    
     void ThreadTaskManager::QueueResult(ThreadTaskResultPtr result)
     {
         MutexLock lock(result_mutex_);
-        results_.push_back(result);
+        result_queues_[result->task_description_].results_.push_back(result);
+        ++num_results_;
+    }
+    
+    void ThreadTaskManager::CollectFinishedTasks(const std::string& task_description)
+    {
+        std::vector<ThreadTaskPtr>::iterator i = tasks_.begin();
+        while (i != tasks_.end())
+        {
+            if ((task_description.empty() || (*i)->GetTaskDescription() == task_description) && ((*i)->HasFinished()))
+            {
+                ThreadTaskResultPtr result = (*i)->GetResult();
+                if (result)
+                    QueueResult(result);
+                i = tasks_.erase(i);
+            }
+            else ++i;
+        }
     }
 
     void ThreadTaskManager::SendResultEvents()
     {
-        std::vector<ThreadTaskResultPtr> results = GetResults();
+        CollectFinishedTasks();
+        
+        // Take the results to deliver this frame, one from each task description in turn so that a busy task does
+        // not hold back the others. Continue from where the previous frame stopped.
+        std::vector<std::pair<ThreadTaskResultPtr, ResultHandler> > deliveries;
+        {
+            MutexLock lock(result_mutex_);
+            
+            uint budget = num_results_;
+            if (max_results_per_frame_ && max_results_per_frame_ < budget)
+                budget = max_results_per_frame_;
+            deliveries.reserve(budget);
+            
+            ResultQueueMap::iterator i = result_queues_.upper_bound(last_delivered_);
+            while (deliveries.size() < budget)
+            {
+                if (i == result_queues_.end())
+                    i = result_queues_.begin();
+                
+                ResultQueue& queue = i->second;
+                if (!queue.results_.empty())
+                {
+                    deliveries.push_back(std::make_pair(queue.results_.front(), queue.handler_));
+                    queue.results_.pop_front();
+                    --num_results_;
+                    last_delivered_ = i->first;
+                }
+                ++i;
+            }
+        }
+        
+        if (deliveries.empty())
+            return;
+        
+        // Deliver outside the lock, the handlers may add requests or change handlers
         EventManagerPtr event_manager = framework_->GetEventManager();
         event_category_id_t threadtask_category = event_manager->QueryEventCategory("Task");
         
-        std::vector<ThreadTaskResultPtr>::iterator i = results.begin();
-        while (i != results.end())
+        for (uint i = 0; i < deliveries.size(); ++i)
         {
-            event_manager->SendEvent(threadtask_category, Task::Events::REQUEST_COMPLETED, (*i).get());
-            ++i;
+            if (deliveries[i].second)
+                deliveries[i].second(deliveries[i].first);
+            else
+                event_manager->SendEvent(threadtask_category, Task::Events::REQUEST_COMPLETED, deliveries[i].first.get());
         }
     }
 
@@ -155,32 +240,20 @@ namespace Foundation
     {
         std::vector<ThreadTaskResultPtr> results;
         
-        // Get non-queued results from tasks, delete finished tasks
-        std::vector<ThreadTaskPtr>::iterator i = tasks_.begin();
-        while (i != tasks_.end())
-        {
-            if ((*i)->HasFinished())
-            {
-                ThreadTaskResultPtr result = (*i)->GetResult();
-                if (result)
-                    results.push_back(result);
-                i = tasks_.erase(i);
-            }
-            else ++i;
-        }
+        CollectFinishedTasks();
         
-        // Add queued results
         {
             MutexLock lock(result_mutex_);
-
-            std::list<ThreadTaskResultPtr>::iterator i = results_.begin();
-            while (i != results_.end())
+            
+            ResultQueueMap::iterator i = result_queues_.begin();
+            while (i != result_queues_.end())
             {
-                results.push_back(*i);
+                results.insert(results.end(), i->second.results_.begin(), i->second.results_.end());
+                i->second.results_.clear();
                 ++i;
             }
             
-            results_.clear();
+            num_results_ = 0;
         }
         
         return results;
@@ -190,33 +263,17 @@ namespace Foundation
     {
         std::vector<ThreadTaskResultPtr> results;
         
-        // Get non-queued results from tasks, delete finished tasks
-        std::vector<ThreadTaskPtr>::iterator i = tasks_.begin();
-        while (i != tasks_.end())
-        {
-            if (((*i)->GetTaskDescription() == task_description) && ((*i)->HasFinished()))
-            {
-                ThreadTaskResultPtr result = (*i)->GetResult();
-                if (result)
-                    results.push_back(result);
-                i = tasks_.erase(i);
-            }
-            else ++i;
-        }
+        CollectFinishedTasks(task_description);
         
-        // Add queued results
         {
             MutexLock lock(result_mutex_);
-
-            std::list<ThreadTaskResultPtr>::iterator i = results_.begin();
-            while (i != results_.end())
+            
+            ResultQueueMap::iterator i = result_queues_.find(task_description);
+            if (i != result_queues_.end())
             {
-                if ((*i)->task_description_ == task_description)
-                {
-                    results.push_back(*i);
-                    i = results_.erase(i);
-                }
-                else ++i;
+                results.assign(i->second.results_.begin(), i->second.results_.end());
+                i->second.results_.clear();
+                num_results_ -= results.size();
             }
         }
         
@@ -226,24 +283,15 @@ namespace Foundation
     uint ThreadTaskManager::GetNumResults()
     {
         MutexLock lock(result_mutex_);
-        return results_.size();
+        return num_results_;
     }
     
     uint ThreadTaskManager::GetNumResults(const std::string& task_description)
     {
-        uint num = 0;
-        
-        {
-            MutexLock lock(result_mutex_);
-            std::list<ThreadTaskResultPtr>::iterator i = results_.begin();
-            while (i != results_.end())
-            {
-                if ((*i)->task_description_ == task_description)
-                    ++num;
-                ++i;
-            }
-        }
-        
-        return num;
+        MutexLock lock(result_mutex_);
+        ResultQueueMap::const_iterator i = result_queues_.find(task_description);
+        if (i == result_queues_.end())
+            return 0;
+        return i->second.results_.size();
     }
 }
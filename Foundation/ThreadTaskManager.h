@@ -4,6 +4,9 @@
 #define incl_Foundation_ThreadTaskManager_h
 
 #include "ThreadTask.h"
+#include "TaskPool.h"
+
+#include <boost/function.hpp>
 
 namespace Foundation
 {
@@ -13,16 +16,27 @@ namespace Foundation
     /*! Takes ownership of ThreadTasks to handle results from them. Necessary to use ThreadTasks in queued result mode.
         There exists a system-wide ThreadTaskManager in the framework, but nothing prevents you creating your own additional
         ThreadTaskManager and registering tasks to it instead.
+
+        The system-wide ThreadTaskManager also owns the framework's TaskPool, which runs the requests of pooled
+        ThreadTasks and can be given other CPU-bound jobs directly. Additional managers share it.
+        
+        Results are queued per task description. The owner of a task can register a result handler for its
+        description, in which case SendResultEvents() passes the results straight to the handler instead of
+        sending them as events to all modules.
      */
     class ThreadTaskManager
     {
         friend class ThreadTask;
         
     public:
+        //! Function that receives the results of a task. Called in the main thread.
+        typedef boost::function<void (ThreadTaskResultPtr)> ResultHandler;
+        
         //! Constructor
         /*! \param framework Framework, needed for sending events
+            \param task_pool_threads Number of worker threads in an own task pool. If zero, the framework's task pool is used.
          */
-        explicit ThreadTaskManager(Framework* framework);
+        explicit ThreadTaskManager(Framework* framework, uint task_pool_threads = 0);
         
         //! Destructor
         ~ThreadTaskManager();
@@ -71,8 +85,30 @@ namespace Foundation
             return AddRequest(task_description, boost::dynamic_pointer_cast<ThreadTaskRequest>(request));
         }
         
-        //! Checks for results and sends them as events. Deletes finished ThreadTasks.
-        /*! Framework calls this for the system-wide ThreadTaskManager on each run of the main loop.
+        //! Sets the function that receives the results of tasks with a certain description
+        /*! The results are then no longer sent as events. Remove the handler before the object it calls is destroyed.
+            \param task_description Task description
+            \param handler Result handler
+         */
+        void SetResultHandler(const std::string& task_description, const ResultHandler& handler);
+        
+        //! Removes a result handler. The results of the tasks are sent as events again.
+        /*! \param task_description Task description
+         */
+        void RemoveResultHandler(const std::string& task_description);
+        
+        //! Sets the maximum number of results delivered by one SendResultEvents() call
+        /*! Results over the budget are left queued for the next call.
+            \param max_results Maximum number of results, 0 for no limit
+         */
+        void SetMaxResultsPerFrame(uint max_results) { max_results_per_frame_ = max_results; }
+        
+        //! Returns the maximum number of results delivered by one SendResultEvents() call, 0 if not limited
+        uint GetMaxResultsPerFrame() const { return max_results_per_frame_; }
+        
+        //! Checks for results and delivers them to their result handlers, or as events if there is none. Deletes finished ThreadTasks.
+        /*! Framework calls this for the system-wide ThreadTaskManager on each run of the main loop. Delivers at most
+            GetMaxResultsPerFrame() results, taking them from the tasks in turn.
          */
         void SendResultEvents();
         
@@ -88,23 +124,54 @@ namespace Foundation
         //! Gets amount of results in queue for certain task type
         uint GetNumResults(const std::string& task_description);
         
+        //! Returns the task pool, either the own one or the framework's
+        /*! \return Task pool, or null if none exists
+         */
+        TaskPool* GetTaskPool();
+        
     private:
         //! Queues a result. Called from ThreadTask work thread.
         /*! \param result Result to queue
          */
         void QueueResult(ThreadTaskResultPtr result);
         
+        //! Queues the final results of finished one-shot tasks and deletes the tasks
+        /*! \param task_description Only handle tasks with this description, or all if empty
+         */
+        void CollectFinishedTasks(const std::string& task_description = std::string());
+        
+        //! Results and result handler of the tasks with one description
+        struct ResultQueue
+        {
+            std::list<ThreadTaskResultPtr> results_;
+            ResultHandler handler_;
+        };
+        
+        typedef std::map<std::string, ResultQueue> ResultQueueMap;
+        
         //! Owned ThreadTasks
         std::vector<ThreadTaskPtr> tasks_;
         
-        //! Result queue
-        std::list<ThreadTaskResultPtr> results_;
+        //! Result queues by task description
+        ResultQueueMap result_queues_;
+        
+        //! Number of results in all queues
+        uint num_results_;
         
-        //! Result queue mutex
+        //! Maximum number of results delivered per SendResultEvents() call, 0 for no limit
+        uint max_results_per_frame_;
+        
+        //! Task description of the last delivered result, the next delivery starts after it
+        std::string last_delivered_;
+        
+        //! Result queue and result handler mutex
         Mutex result_mutex_;
         
         //! Framework
         Framework* framework_;
+        
+        //! Own task pool, null if the framework's pool is used
+        TaskPoolPtr task_pool_;
     };
 }
 
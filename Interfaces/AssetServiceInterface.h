@@ -17,12 +17,23 @@ namespace Foundation
     //! Asset cache info per assettype
     struct AssetCacheInfo
     {
+        //! Amount of assets in cache
         uint count_;
+        //! Total size of assets in cache
         uint size_;
+        //! Amount of cache lookups that found the asset
+        uint hits_;
+        //! Amount of cache lookups that did not find the asset
+        uint misses_;
+        //! Amount of assets evicted from cache to stay within its size limit
+        uint evictions_;
         
         AssetCacheInfo() :
             count_(0),
-            size_(0)
+            size_(0),
+            hits_(0),
+            misses_(0),
+            evictions_(0)
         {
         }
     };
@@ -12,11 +12,13 @@
 namespace Foundation
 {
 
-ComponentInterface::ComponentInterface(Foundation::Framework *framework) : framework_(framework), parent_entity_(0)
+ComponentInterface::ComponentInterface(Foundation::Framework *framework) : framework_(framework), parent_entity_(0),
+    registry_index_(cNotRegistered)
 {
 }
 
-ComponentInterface::ComponentInterface(const ComponentInterface &rhs) : QObject(), framework_(rhs.framework_), parent_entity_(rhs.parent_entity_)
+ComponentInterface::ComponentInterface(const ComponentInterface &rhs) : QObject(), framework_(rhs.framework_), parent_entity_(rhs.parent_entity_),
+    registry_index_(cNotRegistered)
 {
 }
 
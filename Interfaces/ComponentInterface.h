@@ -29,6 +29,8 @@ namespace Foundation
     {
         Q_OBJECT
         
+        friend class ComponentManager;
+
     public:
         explicit ComponentInterface(Foundation::Framework *framework);
         ComponentInterface(const ComponentInterface &rhs);
@@ -51,6 +53,12 @@ namespace Foundation
         
     private:
         ComponentInterface();
+
+        //! Value of registry_index_ when not in the component manager's registry
+        static const size_t cNotRegistered = (size_t)-1;
+
+        //! Index of this component in the component manager's registry of its type
+        size_t registry_index_;
         
     protected:
         //! Helper function for starting component serialization. Creates a component element with name, adds it to the document, and returns it
@@ -7,6 +7,33 @@
 
 namespace Foundation
 {    
+    //! Texture decoding statistics
+    struct TextureDecodeStatistics
+    {
+        //! Amount of decodes performed
+        uint decodes_;
+        //! Amount of pixels decoded, over all quality levels
+        boost::uint64_t decoded_pixels_;
+        //! Total time spent decoding, in seconds
+        f64 decode_time_;
+        //! Amount of quality levels that were not decoded, because enough data for a better level had arrived
+        uint skipped_levels_;
+        //! Amount of pixels the skipped quality levels would have had
+        boost::uint64_t skipped_pixels_;
+        //! Amount of queued decodes that were replaced by a better quality level before they started
+        uint superseded_decodes_;
+
+        TextureDecodeStatistics() :
+            decodes_(0),
+            decoded_pixels_(0),
+            decode_time_(0.0),
+            skipped_levels_(0),
+            skipped_pixels_(0),
+            superseded_decodes_(0)
+        {
+        }
+    };
+
     //! Texture decoding service.
     /*!
         \ingroup Services_group
@@ -28,6 +55,18 @@ namespace Foundation
             \return request tag, will be sent back along with RESOURCE_READY event
          */
         virtual request_tag_t RequestTexture(const std::string& asset_id) = 0;
+
+        //! Sets decode priority of a requested texture
+        /*! Requesters may use this to pass hints like distance or visibility of the texture. Textures with higher
+            priority are decoded first. The default priority is 0, and a difference of 1 weighs as much as one
+            quality level.
+            \param asset_id texture ID
+            \param priority decode priority
+         */
+        virtual void SetTexturePriority(const std::string& asset_id, float priority) = 0;
+
+        //! Returns statistics of the decoding work done and avoided
+        virtual TextureDecodeStatistics GetDecodeStatistics() const = 0;
     };
 }
 
@@ -16,6 +16,7 @@ namespace OgreRenderer
         object_(0),
         entity_(0),
         attached_(false),
+        owns_mesh_(false),
         cast_shadows_(false),
         draw_distance_(0.0f)
     {
@@ -63,34 +64,59 @@ namespace OgreRenderer
         if (!object_->getNumSections())
             return true;
             
+        std::string mesh_name = renderer->GetUniqueObjectName();
         try
         {
-            std::string mesh_name = renderer->GetUniqueObjectName();
             object_->convertToMesh(mesh_name);
             object_->clear();
+        }
+        catch (Ogre::Exception& e)
+        {
+            OgreRenderingModule::LogError("Could not convert manualobject to mesh: " + std::string(e.what()));
+            return false;
+        }
         
-            Ogre::SceneManager* scene_mgr = renderer->GetSceneManager();
-
+        owns_mesh_ = true;
+        return CreateEntity(mesh_name);
+    }
+    
+    bool EC_OgreCustomObject::SetMesh(const std::string& mesh_name)
+    {
+        if (renderer_.expired())
+            return false;
+        
+        DestroyEntity();
+        
+        owns_mesh_ = false;
+        return CreateEntity(mesh_name);
+    }
+    
+    bool EC_OgreCustomObject::CreateEntity(const std::string& mesh_name)
+    {
+        RendererPtr renderer = renderer_.lock();
+        Ogre::SceneManager* scene_mgr = renderer->GetSceneManager();
+        
+        try
+        {
             entity_ = scene_mgr->createEntity(renderer->GetUniqueObjectName(), mesh_name);
-            if (entity_)
-            {
-                AttachEntity();
-                entity_->setRenderingDistance(draw_distance_);
-                entity_->setCastShadows(cast_shadows_);
-                entity_->setUserAny(Ogre::Any(GetParentEntity()));
-            }
-            else
-            {
-                OgreRenderingModule::LogError("Could not create entity from manualobject mesh");
-                return false;
-            }
-        }   
+        }
         catch (Ogre::Exception& e)
         {
-            OgreRenderingModule::LogError("Could not convert manualobject to mesh: " + std::string(e.what()));
+            OgreRenderingModule::LogError("Could not create entity from mesh " + mesh_name + ": " + std::string(e.what()));
             return false;
         }
         
+        if (!entity_)
+        {
+            OgreRenderingModule::LogError("Could not create entity from mesh " + mesh_name);
+            return false;
+        }
+        
+        AttachEntity();
+        entity_->setRenderingDistance(draw_distance_);
+        entity_->setCastShadows(cast_shadows_);
+        entity_->setUserAny(Ogre::Any(GetParentEntity()));
+        
         return true;
     }
     
@@ -189,11 +215,14 @@ namespace OgreRenderer
             std::string mesh_name = entity_->getMesh()->getName();
             scene_mgr->destroyEntity(entity_);
             entity_ = 0;
-            try
+            if (owns_mesh_)
             {
-                Ogre::MeshManager::getSingleton().remove(mesh_name);
+                try
+                {
+                    Ogre::MeshManager::getSingleton().remove(mesh_name);
+                }
+                catch (...) {}
             }
-            catch (...) {}
         }
     }
 
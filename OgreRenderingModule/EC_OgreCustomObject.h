@@ -65,6 +65,13 @@ namespace OgreRenderer
          */
         bool CommitChanges();
 
+        //! Shows an existing mesh instead of committed geometry
+        /*! The mesh may be shared with other objects, so it is not removed when the entity is destroyed.
+            \param mesh_name mesh name
+            \return true if successful
+         */
+        bool SetMesh(const std::string& mesh_name);
+
         //! Sets material on already committed geometry, similar to EC_OgreMesh
         /*! \param index submesh index
             \param material_name material name
@@ -101,7 +108,10 @@ namespace OgreRenderer
         //! detaches entity from placeable
         void DetachEntity();
         
-        //! removes old entity and mesh
+        //! creates the entity from a mesh & attaches it to placeable
+        bool CreateEntity(const std::string& mesh_name);
+
+        //! removes old entity, and the mesh if it was committed from the manual object
         void DestroyEntity();
         
         //! placeable component 
@@ -118,6 +128,9 @@ namespace OgreRenderer
         
         //! object attached to placeable -flag
         bool attached_;
+
+        //! whether the entity's mesh was committed from the manual object, and is removed along with the entity
+        bool owns_mesh_;
         
         //! whether should cast shadows
         bool cast_shadows_;
@@ -4,6 +4,8 @@
 #include "OgreRenderingModule.h"
 #include "Renderer.h"
 #include "EC_OgrePlaceable.h"
+#include "SceneManager.h"
+#include "Framework.h"
 #include <Ogre.h>
 
 #include "XMLUtilities.h"
@@ -20,7 +22,8 @@ namespace OgreRenderer
         scene_node_(0),
         link_scene_node_(0),
         attached_(false),
-        select_priority_(0)
+        select_priority_(0),
+        indexed_(false)
     {
         RendererPtr renderer = renderer_.lock();      
         Ogre::SceneManager* scene_mgr = renderer->GetSceneManager();
@@ -38,6 +41,12 @@ namespace OgreRenderer
             return;
         RendererPtr renderer = renderer_.lock();  
         Ogre::SceneManager* scene_mgr = renderer->GetSceneManager();
+        
+        if (parent_)
+        {
+            std::vector<EC_OgrePlaceable*>& siblings = checked_static_cast<EC_OgrePlaceable*>(parent_.get())->children_;
+            siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+        }
                         
         if (scene_node_ && link_scene_node_)
         {
@@ -67,8 +76,16 @@ namespace OgreRenderer
             return;
         }
         DetachNode();
+        if (parent_)
+        {
+            std::vector<EC_OgrePlaceable*>& siblings = checked_static_cast<EC_OgrePlaceable*>(parent_.get())->children_;
+            siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+        }
         parent_ = placeable;
+        if (parent_)
+            checked_static_cast<EC_OgrePlaceable*>(parent_.get())->children_.push_back(this);
         AttachNode();
+        UpdateSpatialIndex();
     }
     
     Vector3df EC_OgrePlaceable::GetPosition() const
@@ -93,11 +110,15 @@ namespace OgreRenderer
     {
         link_scene_node_->setPosition(Ogre::Vector3(position.x, position.y, position.z));
         AttachNode(); // Nodes become visible only after having their position set at least once
+
+        indexed_ = true;
+        UpdateSpatialIndex();
     }
 
     void EC_OgrePlaceable::SetOrientation(const Quaternion& orientation)
     {
         link_scene_node_->setOrientation(Ogre::Quaternion(orientation.w, orientation.x, orientation.y, orientation.z));
+        UpdateChildrenSpatialIndex();
     }
 
     void EC_OgrePlaceable::LookAt(const Vector3df& look_at)
@@ -106,21 +127,25 @@ namespace OgreRenderer
         // so start in identity transform
         link_scene_node_->setOrientation(Ogre::Quaternion::IDENTITY);
         link_scene_node_->lookAt(Ogre::Vector3(look_at.x, look_at.y, look_at.z), Ogre::Node::TS_WORLD);        
+        UpdateChildrenSpatialIndex();
     }
     
     void EC_OgrePlaceable::Yaw(Real radians)
     {
         link_scene_node_->yaw(Ogre::Radian(radians), Ogre::Node::TS_WORLD);
+        UpdateChildrenSpatialIndex();
     }
 
     void EC_OgrePlaceable::Pitch(Real radians)
     {
         link_scene_node_->pitch(Ogre::Radian(radians));
+        UpdateChildrenSpatialIndex();
     }
  
    void EC_OgrePlaceable::Roll(Real radians)
     {
         link_scene_node_->roll(Ogre::Radian(radians));
+        UpdateChildrenSpatialIndex();
     } 
     
     void EC_OgrePlaceable::SetScale(const Vector3df& scale)
@@ -128,6 +153,46 @@ namespace OgreRenderer
         scene_node_->setScale(Ogre::Vector3(scale.x, scale.y, scale.z));
     }       
 
+    void EC_OgrePlaceable::GetWorldTransform(Ogre::Vector3& position, Ogre::Quaternion& orientation) const
+    {
+        // Computed from the placeables instead of read from the scene nodes, as Ogre updates the derived transforms
+        // of the nodes lazily. Scale is on the geometry node, so it does not affect linked placeables.
+        position = link_scene_node_->getPosition();
+        orientation = link_scene_node_->getOrientation();
+        if (parent_)
+        {
+            Ogre::Vector3 parent_position;
+            Ogre::Quaternion parent_orientation;
+            checked_static_cast<EC_OgrePlaceable*>(parent_.get())->GetWorldTransform(parent_position, parent_orientation);
+            position = parent_position + parent_orientation * position;
+            orientation = parent_orientation * orientation;
+        }
+    }
+
+    void EC_OgrePlaceable::UpdateSpatialIndex()
+    {
+        if (indexed_)
+        {
+            Scene::Entity* entity = GetParentEntity();
+            const Scene::ScenePtr& scene = framework_->GetDefaultWorldScene();
+            if (entity && scene)
+            {
+                Ogre::Vector3 position;
+                Ogre::Quaternion orientation;
+                GetWorldTransform(position, orientation);
+                scene->UpdateEntityPosition(entity->GetId(), Vector3df(position.x, position.y, position.z));
+            }
+        }
+        
+        UpdateChildrenSpatialIndex();
+    }
+
+    void EC_OgrePlaceable::UpdateChildrenSpatialIndex()
+    {
+        for (size_t i = 0; i < children_.size(); ++i)
+            children_[i]->UpdateSpatialIndex();
+    }
+
     void EC_OgrePlaceable::AttachNode()
     {
         if (renderer_.expired())
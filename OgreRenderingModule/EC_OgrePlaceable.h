@@ -14,6 +14,8 @@
 namespace Ogre
 {
     class SceneNode;
+    class Vector3;
+    class Quaternion;
 }
 
 namespace OgreRenderer
@@ -24,7 +26,9 @@ namespace OgreRenderer
     typedef boost::weak_ptr<Renderer> RendererWeakPtr;
     
     //! Ogre placeable (scene node) component
-    /*! \ingroup OgreRenderingModuleClient
+    /*! Reports the world position of its entity to the default world scene's spatial index, once the position has been
+        set. Linked placeables are reported again when their parent moves or turns.
+        \ingroup OgreRenderingModuleClient
      */
     class OGRE_MODULE_API EC_OgrePlaceable : public Foundation::ComponentInterface
     {
@@ -126,12 +130,27 @@ namespace OgreRenderer
         //! detaches scenenode from parent
         void DetachNode();
         
+        //! returns world position & orientation, computed through the parent placeables
+        void GetWorldTransform(Ogre::Vector3& position, Ogre::Quaternion& orientation) const;
+        
+        //! reports the world position of this and the linked placeables to the world scene's spatial index
+        void UpdateSpatialIndex();
+        
+        //! reports the world positions of the linked placeables to the world scene's spatial index
+        void UpdateChildrenSpatialIndex();
+        
         //! renderer
         RendererWeakPtr renderer_;
         
         //! parent placeable
         Foundation::ComponentPtr parent_;
         
+        //! placeables linked to this one. They hold a reference to this as their parent, so they unlink themselves.
+        std::vector<EC_OgrePlaceable*> children_;
+        
+        //! position set flag, after which the entity is in the spatial index
+        bool indexed_;
+        
         //! Ogre scene node for geometry. scale is handled here
         Ogre::SceneNode* scene_node_;
 
@@ -0,0 +1,302 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "LabelAtlas.h"
+#include "OgreRenderingModule.h"
+
+#include <Ogre.h>
+
+#include <QImage>
+#include <QPainter>
+
+namespace OgreRenderer
+{
+    namespace
+    {
+        //! Width and height of a texture page
+        const int cPageSize = 2048;
+
+        //! Transparent border around each label, so that filtering does not pick up neighboring labels
+        const int cPadding = 8;
+
+        //! Mipmap levels of a page. The padding covers the texels that the smallest level blends together.
+        const int cNumMipmaps = 3;
+
+        //! Shelf heights are rounded up to a multiple of this
+        const int cShelfGranularity = 16;
+    }
+
+    LabelAtlas::LabelAtlas() :
+        next_page_id_(1),
+        next_label_id_(1)
+    {
+    }
+
+    LabelAtlas::~LabelAtlas()
+    {
+        Clear();
+    }
+
+    uint LabelAtlas::AcquireLabel(const std::string& key)
+    {
+        KeyMap::const_iterator i = keys_.find(key);
+        if (i == keys_.end())
+            return 0;
+
+        ++labels_[i->second].refs_;
+        ++stats_.hits_;
+        return i->second;
+    }
+
+    uint LabelAtlas::AddLabel(const std::string& key, const QImage& image)
+    {
+        if (image.isNull() || !Ogre::TextureManager::getSingletonPtr())
+            return 0;
+
+        int width = image.width() + 2 * cPadding;
+        int height = image.height() + 2 * cPadding;
+        if (width > cPageSize || height > cPageSize)
+        {
+            OgreRenderingModule::LogWarning("Label of " + ToString(image.width()) + "x" + ToString(image.height()) +
+                " pixels does not fit in the label atlas");
+            return 0;
+        }
+
+        // Find room on the existing pages, or create a new page
+        uint page_id = 0;
+        int x = 0, y = 0;
+        for(PageMap::iterator i = pages_.begin(); i != pages_.end(); ++i)
+            if (Allocate(i->second, width, height, x, y))
+            {
+                page_id = i->first;
+                break;
+            }
+        if (!page_id)
+        {
+            page_id = CreatePage();
+            if (!page_id || !Allocate(pages_[page_id], width, height, x, y))
+                return 0;
+        }
+        Page& page = pages_[page_id];
+
+        // Upload the label with its padding, which clears what was left in the rectangle by earlier labels
+        QImage padded(width, height, QImage::Format_ARGB32_Premultiplied);
+        padded.fill(0);
+        {
+            QPainter painter(&padded);
+            painter.setCompositionMode(QPainter::CompositionMode_Source);
+            painter.drawImage(cPadding, cPadding, image);
+        }
+        Ogre::PixelBox src(width, height, 1, Ogre::PF_A8R8G8B8, (void*)padded.bits());
+        try
+        {
+            page.texture_->getBuffer()->blitFromMemory(src, Ogre::Box(x, y, x + width, y + height));
+        }
+        catch (Ogre::Exception& e)
+        {
+            OgreRenderingModule::LogError("Could not upload label to the label atlas: " + std::string(e.what()));
+            Free(page, y, x, width);
+            return 0;
+        }
+
+        uint id = next_label_id_++;
+        LabelEntry& entry = labels_[id];
+        entry.key_ = key;
+        entry.page_ = page_id;
+        entry.shelf_y_ = y;
+        entry.x_ = x;
+        entry.width_ = width;
+        entry.height_ = height;
+        entry.refs_ = 1;
+        entry.label_.texture_name_ = page.texture_->getName();
+        entry.label_.width_ = image.width();
+        entry.label_.height_ = image.height();
+        entry.label_.uv_ = Ogre::FloatRect((float)(x + cPadding) / cPageSize, (float)(y + cPadding) / cPageSize,
+            (float)(x + cPadding + image.width()) / cPageSize, (float)(y + cPadding + image.height()) / cPageSize);
+
+        ++page.num_labels_;
+        keys_[key] = id;
+        ++stats_.uploads_;
+        return id;
+    }
+
+    void LabelAtlas::ReleaseLabel(uint id)
+    {
+        LabelMap::iterator i = labels_.find(id);
+        if (i == labels_.end())
+            return;
+
+        LabelEntry& entry = i->second;
+        if (--entry.refs_)
+            return;
+
+        PageMap::iterator page = pages_.find(entry.page_);
+        if (page != pages_.end())
+        {
+            Free(page->second, entry.shelf_y_, entry.x_, entry.width_);
+            if (!--page->second.num_labels_ && pages_.size() > 1)
+            {
+                Ogre::TextureManager::getSingleton().remove(page->second.texture_->getHandle());
+                pages_.erase(page);
+            }
+        }
+
+        KeyMap::iterator key = keys_.find(entry.key_);
+        if (key != keys_.end() && key->second == id)
+            keys_.erase(key);
+        labels_.erase(i);
+    }
+
+    const LabelAtlas::Label* LabelAtlas::GetLabel(uint id) const
+    {
+        LabelMap::const_iterator i = labels_.find(id);
+        if (i == labels_.end())
+            return 0;
+        return &i->second.label_;
+    }
+
+    void LabelAtlas::Clear()
+    {
+        if (Ogre::TextureManager::getSingletonPtr())
+            for(PageMap::iterator i = pages_.begin(); i != pages_.end(); ++i)
+                Ogre::TextureManager::getSingleton().remove(i->second.texture_->getHandle());
+        pages_.clear();
+        labels_.clear();
+        keys_.clear();
+    }
+
+    float LabelAtlas::GetUsage() const
+    {
+        if (pages_.empty())
+            return 0.0f;
+
+        double area = 0.0;
+        for(LabelMap::const_iterator i = labels_.begin(); i != labels_.end(); ++i)
+            area += (double)i->second.width_ * i->second.height_;
+        return (float)(area / ((double)cPageSize * cPageSize * pages_.size()));
+    }
+
+    bool LabelAtlas::Allocate(Page& page, int width, int height, int& x, int& y)
+    {
+        // Use the lowest shelf that the label fits in, but not one so high that most of it would be wasted
+        Shelf* best_shelf = 0;
+        size_t best_span = 0;
+        for(size_t i = 0; i < page.shelves_.size(); ++i)
+        {
+            Shelf& shelf = page.shelves_[i];
+            if (shelf.height_ < height || shelf.height_ > height * 2 || (best_shelf && shelf.height_ >= best_shelf->height_))
+                continue;
+            for(size_t j = 0; j < shelf.free_.size(); ++j)
+                if (shelf.free_[j].width_ >= width)
+                {
+                    best_shelf = &shelf;
+                    best_span = j;
+                    break;
+                }
+        }
+
+        if (!best_shelf)
+        {
+            // Start a new shelf in the unused area
+            int shelf_height = (height + cShelfGranularity - 1) / cShelfGranularity * cShelfGranularity;
+            if (page.top_ + shelf_height > cPageSize)
+                shelf_height = height;
+            if (page.top_ + shelf_height > cPageSize)
+                return false;
+
+            Shelf shelf;
+            shelf.y_ = page.top_;
+            shelf.height_ = shelf_height;
+            Span span = { 0, cPageSize };
+            shelf.free_.push_back(span);
+            page.shelves_.push_back(shelf);
+            page.top_ += shelf_height;
+
+            best_shelf = &page.shelves_.back();
+            best_span = 0;
+        }
+
+        Span& span = best_shelf->free_[best_span];
+        x = span.x_;
+        y = best_shelf->y_;
+        span.x_ += width;
+        span.width_ -= width;
+        if (!span.width_)
+            best_shelf->free_.erase(best_shelf->free_.begin() + best_span);
+        return true;
+    }
+
+    void LabelAtlas::Free(Page& page, int shelf_y, int x, int width)
+    {
+        size_t shelf_index = 0;
+        while(shelf_index < page.shelves_.size() && page.shelves_[shelf_index].y_ != shelf_y)
+            ++shelf_index;
+        if (shelf_index == page.shelves_.size())
+            return;
+
+        // Insert the span in order, and merge it with its neighbors
+        std::vector<Span>& free = page.shelves_[shelf_index].free_;
+        size_t i = 0;
+        while(i < free.size() && free[i].x_ < x)
+            ++i;
+        Span span = { x, width };
+        free.insert(free.begin() + i, span);
+        if (i + 1 < free.size() && free[i].x_ + free[i].width_ == free[i+1].x_)
+        {
+            free[i].width_ += free[i+1].width_;
+            free.erase(free.begin() + i + 1);
+        }
+        if (i > 0 && free[i-1].x_ + free[i-1].width_ == free[i].x_)
+        {
+            free[i-1].width_ += free[i].width_;
+            free.erase(free.begin() + i);
+        }
+
+        // Return empty shelves at the bottom to the unused area, so that they can be used for labels of other heights
+        while(!page.shelves_.empty())
+        {
+            const Shelf& last = page.shelves_.back();
+            if (last.free_.size() != 1 || last.free_[0].width_ != cPageSize)
+                break;
+            page.top_ = last.y_;
+            page.shelves_.pop_back();
+        }
+    }
+
+    uint LabelAtlas::CreatePage()
+    {
+        uint id = next_page_id_++;
+        Page page;
+        page.top_ = 0;
+        page.num_labels_ = 0;
+
+        try
+        {
+            // Static, so that Direct3D 9 keeps a copy of the page in the managed pool and restores it after a device
+            // reset. Dynamic textures lose their contents then, and the page has no loader to recreate them.
+            page.texture_ = Ogre::TextureManager::getSingleton().createManual("LabelAtlas" + ToString(id),
+                Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME, Ogre::TEX_TYPE_2D, cPageSize, cPageSize, cNumMipmaps,
+                Ogre::PF_A8R8G8B8, Ogre::TU_STATIC_WRITE_ONLY | Ogre::TU_AUTOMIPMAP);
+
+            // Start transparent. Labels are uploaded to parts of the page, so the rest has to be kept between uploads.
+            Ogre::HardwarePixelBufferSharedPtr buffer = page.texture_->getBuffer();
+            buffer->lock(Ogre::HardwareBuffer::HBL_NORMAL);
+            const Ogre::PixelBox& box = buffer->getCurrentLock();
+            size_t row_bytes = box.getWidth() * Ogre::PixelUtil::getNumElemBytes(box.format);
+            size_t pitch_bytes = box.rowPitch * Ogre::PixelUtil::getNumElemBytes(box.format);
+            for(size_t y = 0; y < box.getHeight(); ++y)
+                memset(static_cast<unsigned char*>(box.data) + y * pitch_bytes, 0, row_bytes);
+            buffer->unlock();
+        }
+        catch (Ogre::Exception& e)
+        {
+            OgreRenderingModule::LogError("Could not create label atlas page: " + std::string(e.what()));
+            if (!page.texture_.isNull())
+                Ogre::TextureManager::getSingleton().remove(page.texture_->getHandle());
+            return 0;
+        }
+
+        pages_[id] = page;
+        return id;
+    }
+}
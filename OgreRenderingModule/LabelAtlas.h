@@ -0,0 +1,174 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_OgreRenderer_LabelAtlas_h
+#define incl_OgreRenderer_LabelAtlas_h
+
+#include "OgreModuleApi.h"
+
+#include <OgreTexture.h>
+#include <OgreCommon.h>
+
+class QImage;
+
+namespace OgreRenderer
+{
+    //! Packs text label images into a few large shared textures
+    /*! Labels, such as name tags and chat bubbles, are given a rectangle of a texture page, and are drawn on billboards
+        with the texture coordinates of the rectangle. Labels are reference counted by a key that identifies their content,
+        so that identical labels share one rectangle, and freed rectangles are reused.
+
+        Pages are divided into shelves of similar height labels. A page is created when the labels do not fit in the
+        existing ones, and removed when it becomes empty, unless it is the last page.
+        \ingroup OgreRenderingModuleClient
+     */
+    class OGRE_MODULE_API LabelAtlas
+    {
+    public:
+        //! Place of a label in the atlas
+        struct Label
+        {
+            //! Name of the texture the label is in
+            std::string texture_name_;
+            //! Texture coordinates of the label
+            Ogre::FloatRect uv_;
+            //! Width of the label in pixels
+            int width_;
+            //! Height of the label in pixels
+            int height_;
+        };
+
+        //! Usage statistics
+        struct Stats
+        {
+            //! Acquired labels that were in the atlas already
+            uint hits_;
+            //! Labels uploaded
+            uint uploads_;
+
+            Stats() : hits_(0), uploads_(0) {}
+        };
+
+        //! Constructor
+        LabelAtlas();
+
+        //! Destructor
+        ~LabelAtlas();
+
+        //! Adds a reference to the label with a key, if in the atlas
+        /*! \param key Key identifying the label's content
+            \return Label id, or 0 if the atlas has no label with the key
+         */
+        uint AcquireLabel(const std::string& key);
+
+        //! Adds a label to the atlas with one reference
+        /*! \param key Key identifying the label's content
+            \param image Label image. Premultiplied alpha is expected, as QPixmap::toImage() gives.
+            \return Label id, or 0 if the image is larger than a page
+         */
+        uint AddLabel(const std::string& key, const QImage& image);
+
+        //! Removes a reference to a label. The label's rectangle is freed when it has no references left.
+        void ReleaseLabel(uint id);
+
+        //! Returns a label, or null if no label has the id
+        const Label* GetLabel(uint id) const;
+
+        //! Removes all labels and textures. Called by the renderer before Ogre is shut down.
+        void Clear();
+
+        //! Returns usage statistics
+        const Stats& GetStats() const { return stats_; }
+
+        //! Returns number of labels
+        size_t GetNumLabels() const { return labels_.size(); }
+
+        //! Returns number of texture pages
+        size_t GetNumPages() const { return pages_.size(); }
+
+        //! Returns the fraction of the pages' area that labels use, including their padding
+        float GetUsage() const;
+
+    private:
+        //! Free part of a shelf
+        struct Span
+        {
+            int x_;
+            int width_;
+        };
+
+        //! Row of labels on a page
+        struct Shelf
+        {
+            int y_;
+            int height_;
+            //! Free spans, ordered by position
+            std::vector<Span> free_;
+        };
+
+        //! Texture page
+        struct Page
+        {
+            Ogre::TexturePtr texture_;
+            //! Shelves, ordered by position
+            std::vector<Shelf> shelves_;
+            //! Top of the unused area below the shelves
+            int top_;
+            //! Number of labels on the page
+            uint num_labels_;
+        };
+
+        //! Label and its rectangle
+        struct LabelEntry
+        {
+            Label label_;
+            std::string key_;
+            uint page_;
+            //! Shelf position, which identifies the shelf on its page
+            int shelf_y_;
+            //! Rectangle with padding
+            int x_;
+            int width_;
+            int height_;
+            uint refs_;
+        };
+
+        typedef std::map<uint, Page> PageMap;
+        typedef std::map<uint, LabelEntry> LabelMap;
+        typedef std::map<std::string, uint> KeyMap;
+
+        //! Allocates a rectangle from a page
+        /*! \return true if the rectangle fit
+         */
+        static bool Allocate(Page& page, int width, int height, int& x, int& y);
+
+        //! Frees a rectangle of a page
+        static void Free(Page& page, int shelf_y, int x, int width);
+
+        //! Creates a page
+        /*! \return Page id, or 0 if the texture could not be created
+         */
+        uint CreatePage();
+
+        //! Pages by id
+        PageMap pages_;
+
+        //! Labels by id
+        LabelMap labels_;
+
+        //! Label ids by key
+        KeyMap keys_;
+
+        //! Next page id
+        uint next_page_id_;
+
+        //! Next label id
+        uint next_label_id_;
+
+        //! Usage statistics
+        Stats stats_;
+    };
+
+    typedef boost::shared_ptr<LabelAtlas> LabelAtlasPtr;
+}
+
+#endif
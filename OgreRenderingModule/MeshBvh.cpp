@@ -0,0 +1,428 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "MeshBvh.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace OgreRenderer
+{
+    namespace
+    {
+        //! Triangles in a leaf, above which a node is split even if the surface area heuristic does not favor it
+        const uint cMaxLeafTriangles = 16;
+
+        //! Triangles in a leaf, at or below which a node is not split
+        const uint cMinSplitTriangles = 4;
+
+        //! Maximum depth of the hierarchy. Bounds the traversal stack.
+        const uint cMaxDepth = 48;
+
+        //! Number of bins along the split axis
+        const int cNumBins = 16;
+
+        //! Cost of traversing a node relative to testing a triangle
+        const float cTraversalCost = 1.0f;
+
+        //! Returns half the surface area of a box
+        inline float GetHalfArea(const Ogre::Vector3& min, const Ogre::Vector3& max)
+        {
+            Ogre::Vector3 size = max - min;
+            return size.x * size.y + size.y * size.z + size.z * size.x;
+        }
+
+        //! Tests a ray against a box
+        /*! \param inv_direction Reciprocals of the ray direction components
+            \param max_distance Distance of the nearest hit so far
+            \param distance Receives the distance at which the ray enters the box
+         */
+        inline bool IntersectBox(const Ogre::Vector3& min, const Ogre::Vector3& max, const Ogre::Vector3& origin,
+            const Ogre::Vector3& inv_direction, float max_distance, float& distance)
+        {
+            float tmin = 0.0f;
+            float tmax = max_distance;
+            for(int i = 0; i < 3; ++i)
+            {
+                float t1 = (min[i] - origin[i]) * inv_direction[i];
+                float t2 = (max[i] - origin[i]) * inv_direction[i];
+                if (t1 > t2)
+                    std::swap(t1, t2);
+                tmin = std::max(tmin, t1);
+                tmax = std::min(tmax, t2);
+                if (tmin > tmax)
+                    return false;
+            }
+            distance = tmin;
+            return true;
+        }
+
+        //! Tells whether a triangle's centroid falls at or left of a bin
+        struct BinPredicate
+        {
+            BinPredicate(const std::vector<Ogre::Vector3>& centroids, int axis, float min, float scale, int bin) :
+                centroids_(centroids), axis_(axis), min_(min), scale_(scale), bin_(bin) {}
+
+            bool operator ()(uint triangle) const
+            {
+                return std::min((int)((centroids_[triangle][axis_] - min_) * scale_), cNumBins - 1) <= bin_;
+            }
+
+            const std::vector<Ogre::Vector3>& centroids_;
+            int axis_;
+            float min_;
+            float scale_;
+            int bin_;
+        };
+
+        //! Orders triangles by their centroid along an axis
+        struct CentroidLess
+        {
+            CentroidLess(const std::vector<Ogre::Vector3>& centroids, int axis) : centroids_(centroids), axis_(axis) {}
+
+            bool operator ()(uint lhs, uint rhs) const
+            {
+                return centroids_[lhs][axis_] < centroids_[rhs][axis_];
+            }
+
+            const std::vector<Ogre::Vector3>& centroids_;
+            int axis_;
+        };
+    }
+
+    uint MeshTriangles::GetSubmesh(uint index) const
+    {
+        // Empty submeshes share their start index with the next one, the last submesh starting at or before the index owns it
+        std::vector<uint>::const_iterator i = std::upper_bound(submesh_start_indices_.begin(), submesh_start_indices_.end(), index);
+        if (i == submesh_start_indices_.begin())
+            return 0;
+        return (uint)(i - submesh_start_indices_.begin()) - 1;
+    }
+
+    Ogre::Vector2 MeshRayHit::GetTexCoord(const MeshTriangles& triangles) const
+    {
+        if (triangles.texcoords_.empty())
+            return Ogre::Vector2::ZERO;
+
+        const Ogre::Vector2& t0 = triangles.texcoords_[triangles.indices_[index_]];
+        const Ogre::Vector2& t1 = triangles.texcoords_[triangles.indices_[index_ + 1]];
+        const Ogre::Vector2& t2 = triangles.texcoords_[triangles.indices_[index_ + 2]];
+        return t0 * (1.0f - u_ - v_) + t1 * u_ + t2 * v_;
+    }
+
+    bool IntersectTriangle(const Ogre::Ray& ray, const Ogre::Vector3& a, const Ogre::Vector3& b, const Ogre::Vector3& c,
+        bool back_side, float& distance, float& u, float& v)
+    {
+        const Ogre::Vector3& direction = ray.getDirection();
+        Ogre::Vector3 edge1 = b - a;
+        Ogre::Vector3 edge2 = c - a;
+        Ogre::Vector3 p = direction.crossProduct(edge2);
+
+        // The determinant is the negated dot product of the unnormalized face normal and the ray direction. Front sides
+        // face against the ray; parallel rays miss, with the same epsilon as Ogre::Math::intersects().
+        float det = edge1.dotProduct(p);
+        if (back_side)
+        {
+            if (det > -std::numeric_limits<float>::epsilon())
+                return false;
+        }
+        else
+        {
+            if (det < std::numeric_limits<float>::epsilon())
+                return false;
+        }
+
+        float inv_det = 1.0f / det;
+        Ogre::Vector3 s = ray.getOrigin() - a;
+        u = s.dotProduct(p) * inv_det;
+        if (u < 0.0f || u > 1.0f)
+            return false;
+
+        Ogre::Vector3 q = s.crossProduct(edge1);
+        v = direction.dotProduct(q) * inv_det;
+        if (v < 0.0f || u + v > 1.0f)
+            return false;
+
+        distance = edge2.dotProduct(q) * inv_det;
+        return distance >= 0.0f;
+    }
+
+    bool RaycastTriangles(const MeshTriangles& triangles, const Ogre::Ray& ray, bool back_side, MeshRayHit& hit)
+    {
+        const std::vector<Ogre::Vector3>& vertices = triangles.vertices_;
+        const std::vector<uint>& indices = triangles.indices_;
+
+        bool found = false;
+        float distance, u, v;
+        for(uint i = 0; i + 2 < indices.size(); i += 3)
+        {
+            if (!IntersectTriangle(ray, vertices[indices[i]], vertices[indices[i+1]], vertices[indices[i+2]], back_side, distance, u, v))
+                continue;
+            if (!found || distance < hit.distance_)
+            {
+                hit.distance_ = distance;
+                hit.index_ = i;
+                hit.u_ = u;
+                hit.v_ = v;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    MeshBvh::MeshBvh(MeshTrianglesPtr triangles) :
+        triangles_(triangles)
+    {
+        const std::vector<Ogre::Vector3>& vertices = triangles_->vertices_;
+        const std::vector<uint>& indices = triangles_->indices_;
+        uint num_triangles = triangles_->GetNumTriangles();
+        if (!num_triangles)
+            return;
+
+        std::vector<Ogre::Vector3> centroids(num_triangles);
+        std::vector<Ogre::Vector3> mins(num_triangles);
+        std::vector<Ogre::Vector3> maxs(num_triangles);
+        order_.resize(num_triangles);
+        for(uint i = 0; i < num_triangles; ++i)
+        {
+            const Ogre::Vector3& a = vertices[indices[i*3]];
+            const Ogre::Vector3& b = vertices[indices[i*3+1]];
+            const Ogre::Vector3& c = vertices[indices[i*3+2]];
+            mins[i] = a;
+            mins[i].makeFloor(b);
+            mins[i].makeFloor(c);
+            maxs[i] = a;
+            maxs[i].makeCeil(b);
+            maxs[i].makeCeil(c);
+            centroids[i] = (mins[i] + maxs[i]) * 0.5f;
+            order_[i] = i;
+        }
+
+        // A binary tree with leaves of a few triangles has fewer nodes than triangles
+        nodes_.reserve(num_triangles / 2 + 1);
+        Node root;
+        root.first_ = 0;
+        root.count_ = num_triangles;
+        nodes_.push_back(root);
+        Split(0, centroids, mins, maxs, 0);
+    }
+
+    void MeshBvh::Split(uint node_index, const std::vector<Ogre::Vector3>& centroids, const std::vector<Ogre::Vector3>& mins,
+        const std::vector<Ogre::Vector3>& maxs, uint depth)
+    {
+        const uint first = nodes_[node_index].first_;
+        const uint count = nodes_[node_index].count_;
+        const uint end = first + count;
+
+        Ogre::Vector3 min = mins[order_[first]];
+        Ogre::Vector3 max = maxs[order_[first]];
+        Ogre::Vector3 centroid_min = centroids[order_[first]];
+        Ogre::Vector3 centroid_max = centroid_min;
+        for(uint i = first + 1; i < end; ++i)
+        {
+            uint t = order_[i];
+            min.makeFloor(mins[t]);
+            max.makeCeil(maxs[t]);
+            centroid_min.makeFloor(centroids[t]);
+            centroid_max.makeCeil(centroids[t]);
+        }
+        nodes_[node_index].min_ = min;
+        nodes_[node_index].max_ = max;
+
+        if (count <= cMinSplitTriangles || depth >= cMaxDepth)
+            return;
+
+        // Split along the axis where the centroids spread the most
+        Ogre::Vector3 extent = centroid_max - centroid_min;
+        int axis = 0;
+        if (extent.y > extent[axis])
+            axis = 1;
+        if (extent.z > extent[axis])
+            axis = 2;
+        if (extent[axis] <= 0.0f)
+            return;
+
+        // Bin the centroids, and find the bin boundary with the lowest surface area heuristic cost
+        const float bin_scale = cNumBins / extent[axis];
+        uint bin_counts[cNumBins] = { 0 };
+        Ogre::Vector3 bin_mins[cNumBins];
+        Ogre::Vector3 bin_maxs[cNumBins];
+        for(uint i = first; i < end; ++i)
+        {
+            uint t = order_[i];
+            int bin = std::min((int)((centroids[t][axis] - centroid_min[axis]) * bin_scale), cNumBins - 1);
+            if (!bin_counts[bin])
+            {
+                bin_mins[bin] = mins[t];
+                bin_maxs[bin] = maxs[t];
+            }
+            else
+            {
+                bin_mins[bin].makeFloor(mins[t]);
+                bin_maxs[bin].makeCeil(maxs[t]);
+            }
+            ++bin_counts[bin];
+        }
+
+        // Areas and counts of the bins right of each boundary
+        float right_areas[cNumBins];
+        uint right_counts[cNumBins];
+        Ogre::Vector3 right_min, right_max;
+        uint right_count = 0;
+        for(int i = cNumBins - 1; i > 0; --i)
+        {
+            if (bin_counts[i])
+            {
+                if (!right_count)
+                {
+                    right_min = bin_mins[i];
+                    right_max = bin_maxs[i];
+                }
+                else
+                {
+                    right_min.makeFloor(bin_mins[i]);
+                    right_max.makeCeil(bin_maxs[i]);
+                }
+                right_count += bin_counts[i];
+            }
+            right_counts[i] = right_count;
+            right_areas[i] = right_count ? GetHalfArea(right_min, right_max) : 0.0f;
+        }
+
+        int best_bin = -1;
+        float best_cost = std::numeric_limits<float>::max();
+        Ogre::Vector3 left_min, left_max;
+        uint left_count = 0;
+        for(int i = 0; i < cNumBins - 1; ++i)
+        {
+            if (bin_counts[i])
+            {
+                if (!left_count)
+                {
+                    left_min = bin_mins[i];
+                    left_max = bin_maxs[i];
+                }
+                else
+                {
+                    left_min.makeFloor(bin_mins[i]);
+                    left_max.makeCeil(bin_maxs[i]);
+                }
+                left_count += bin_counts[i];
+            }
+            if (!left_count || !right_counts[i+1])
+                continue;
+
+            float cost = left_count * GetHalfArea(left_min, left_max) + right_counts[i+1] * right_areas[i+1];
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_bin = i;
+            }
+        }
+
+        // Keep the node as a leaf if splitting would not pay off
+        float area = GetHalfArea(min, max);
+        float leaf_cost = count * area;
+        if (best_bin < 0 || (count <= cMaxLeafTriangles && cTraversalCost * area + best_cost >= leaf_cost))
+            return;
+
+        uint* middle = std::partition(&order_[0] + first, &order_[0] + end, BinPredicate(centroids, axis, centroid_min[axis], bin_scale, best_bin));
+        uint left_triangles = (uint)(middle - &order_[0]) - first;
+        if (!left_triangles || left_triangles == count)
+        {
+            // Cannot happen with nonempty bins on both sides, except through rounding; fall back to a median split
+            left_triangles = count / 2;
+            std::nth_element(order_.begin() + first, order_.begin() + first + left_triangles, order_.begin() + end,
+                CentroidLess(centroids, axis));
+        }
+
+        uint left = (uint)nodes_.size();
+        Node child;
+        child.first_ = first;
+        child.count_ = left_triangles;
+        nodes_.push_back(child);
+        child.first_ = first + left_triangles;
+        child.count_ = count - left_triangles;
+        nodes_.push_back(child);
+
+        nodes_[node_index].first_ = left;
+        nodes_[node_index].count_ = 0;
+
+        Split(left, centroids, mins, maxs, depth + 1);
+        Split(left + 1, centroids, mins, maxs, depth + 1);
+    }
+
+    bool MeshBvh::Raycast(const Ogre::Ray& ray, bool back_side, MeshRayHit& hit) const
+    {
+        if (nodes_.empty())
+            return false;
+
+        const std::vector<Ogre::Vector3>& vertices = triangles_->vertices_;
+        const std::vector<uint>& indices = triangles_->indices_;
+        const Ogre::Vector3& origin = ray.getOrigin();
+        const Ogre::Vector3& direction = ray.getDirection();
+
+        // Avoid zero times infinity when the ray is parallel to a slab and starts on its plane
+        Ogre::Vector3 inv_direction;
+        for(int i = 0; i < 3; ++i)
+            inv_direction[i] = 1.0f / (direction[i] != 0.0f ? direction[i] : 1e-30f);
+
+        bool found = false;
+        float closest = std::numeric_limits<float>::max();
+        float distance, u, v;
+
+        uint stack[cMaxDepth + 2];
+        uint stack_size = 0;
+        if (!IntersectBox(nodes_[0].min_, nodes_[0].max_, origin, inv_direction, closest, distance))
+            return false;
+        stack[stack_size++] = 0;
+
+        while(stack_size)
+        {
+            const Node& node = nodes_[stack[--stack_size]];
+
+            // A nearer hit may have been found since the node was pushed
+            if (!IntersectBox(node.min_, node.max_, origin, inv_direction, closest, distance))
+                continue;
+
+            if (node.count_)
+            {
+                for(uint i = node.first_; i < node.first_ + node.count_; ++i)
+                {
+                    uint index = order_[i] * 3;
+                    if (!IntersectTriangle(ray, vertices[indices[index]], vertices[indices[index+1]], vertices[indices[index+2]],
+                        back_side, distance, u, v))
+                        continue;
+                    // Among equally near triangles prefer the first, as RaycastTriangles() does
+                    if (distance < closest || (distance == closest && index < hit.index_))
+                    {
+                        closest = distance;
+                        hit.distance_ = distance;
+                        hit.index_ = index;
+                        hit.u_ = u;
+                        hit.v_ = v;
+                        found = true;
+                    }
+                }
+                continue;
+            }
+
+            // Visit the nearer child first
+            float near_distance, far_distance;
+            uint near_child = node.first_;
+            uint far_child = node.first_ + 1;
+            bool near_hit = IntersectBox(nodes_[near_child].min_, nodes_[near_child].max_, origin, inv_direction, closest, near_distance);
+            bool far_hit = IntersectBox(nodes_[far_child].min_, nodes_[far_child].max_, origin, inv_direction, closest, far_distance);
+            if (near_hit && far_hit && far_distance < near_distance)
+                std::swap(near_child, far_child);
+            if (far_hit && near_hit)
+                stack[stack_size++] = far_child;
+            if (near_hit)
+                stack[stack_size++] = near_child;
+            else if (far_hit)
+                stack[stack_size++] = far_child;
+        }
+
+        return found;
+    }
+}
@@ -0,0 +1,123 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_OgreRenderer_MeshBvh_h
+#define incl_OgreRenderer_MeshBvh_h
+
+#include "CoreTypes.h"
+
+#include <OgreVector2.h>
+#include <OgreVector3.h>
+#include <OgreRay.h>
+
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace OgreRenderer
+{
+    //! Triangles of a mesh in mesh local space, for raycasting
+    struct MeshTriangles
+    {
+        //! Vertex positions
+        std::vector<Ogre::Vector3> vertices_;
+        //! Texture coordinates of the vertices, zero if the mesh has none
+        std::vector<Ogre::Vector2> texcoords_;
+        //! Vertex indices, three per triangle
+        std::vector<uint> indices_;
+        //! Position of the first index of each submesh in the index list
+        std::vector<uint> submesh_start_indices_;
+
+        //! Returns number of triangles
+        size_t GetNumTriangles() const { return indices_.size() / 3; }
+
+        //! Returns the submesh that an index belongs to
+        /*! \param index Position in the index list
+         */
+        uint GetSubmesh(uint index) const;
+    };
+
+    typedef boost::shared_ptr<MeshTriangles> MeshTrianglesPtr;
+
+    //! Nearest triangle hit by a ray
+    struct MeshRayHit
+    {
+        //! Distance along the ray, in units of the ray direction's length
+        float distance_;
+        //! Position of the triangle's first vertex index in the index list
+        uint index_;
+        //! Barycentric coordinates of the hit point, the weights of the triangle's second and third vertex
+        float u_;
+        float v_;
+
+        //! Returns the texture coordinates at the hit point
+        Ogre::Vector2 GetTexCoord(const MeshTriangles& triangles) const;
+    };
+
+    //! Tests a ray against the front side of a triangle, as Ogre::Math::intersects(ray, a, b, c, true, false)
+    /*! \param back_side If true, tests against the back side instead, for mirrored transforms
+        \return true if hit, with the distance and barycentric coordinates set
+     */
+    bool IntersectTriangle(const Ogre::Ray& ray, const Ogre::Vector3& a, const Ogre::Vector3& b, const Ogre::Vector3& c,
+        bool back_side, float& distance, float& u, float& v);
+
+    //! Finds the nearest triangle hit by a ray by testing every triangle
+    /*! \param ray Ray in mesh local space
+        \param back_side Test against back sides, for mirrored transforms
+        \param hit Receives the hit
+        \return true if a triangle was hit
+     */
+    bool RaycastTriangles(const MeshTriangles& triangles, const Ogre::Ray& ray, bool back_side, MeshRayHit& hit);
+
+    //! Bounding volume hierarchy over the triangles of a mesh
+    /*! Built with a binned surface area heuristic. The triangles are in mesh local space, so that one hierarchy serves
+        all the entities of the mesh; rays are transformed into the mesh space instead.
+     */
+    class MeshBvh
+    {
+    public:
+        //! Builds the hierarchy. Threadsafe, so that it can be run as a task pool job.
+        explicit MeshBvh(MeshTrianglesPtr triangles);
+
+        //! Finds the nearest triangle hit by a ray. Gives the same hits as RaycastTriangles().
+        /*! \param ray Ray in mesh local space
+            \param back_side Test against back sides, for mirrored transforms
+            \param hit Receives the hit
+            \return true if a triangle was hit
+         */
+        bool Raycast(const Ogre::Ray& ray, bool back_side, MeshRayHit& hit) const;
+
+        //! Returns the triangles
+        const MeshTriangles& GetTriangles() const { return *triangles_; }
+
+        //! Returns number of nodes
+        size_t GetNumNodes() const { return nodes_.size(); }
+
+    private:
+        //! Hierarchy node. A leaf has triangles, an inner node has two children.
+        struct Node
+        {
+            Ogre::Vector3 min_;
+            Ogre::Vector3 max_;
+            //! For a leaf, first triangle in order_. For an inner node, index of the first child; the second follows it.
+            uint first_;
+            //! Number of triangles, zero for an inner node
+            uint count_;
+        };
+
+        //! Splits a node recursively
+        void Split(uint node_index, const std::vector<Ogre::Vector3>& centroids, const std::vector<Ogre::Vector3>& mins,
+            const std::vector<Ogre::Vector3>& maxs, uint depth);
+
+        //! Triangles
+        MeshTrianglesPtr triangles_;
+
+        //! Nodes, root first
+        std::vector<Node> nodes_;
+
+        //! Triangle numbers, in leaf order
+        std::vector<uint> order_;
+    };
+
+    typedef boost::shared_ptr<MeshBvh> MeshBvhPtr;
+}
+
+#endif
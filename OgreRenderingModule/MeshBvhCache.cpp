@@ -0,0 +1,267 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "MeshBvhCache.h"
+#include "OgreRenderingModule.h"
+#include "ThreadTaskManager.h"
+#include "ConfigurationManager.h"
+#include "CoreException.h"
+
+#include <Ogre.h>
+
+namespace OgreRenderer
+{
+    namespace
+    {
+        //! Meshes with fewer triangles are tested one by one without a hierarchy
+        const size_t cMinBvhTriangles = 32;
+
+        //! Builds a hierarchy. Run in the task pool.
+        MeshBvhPtr BuildMeshBvh(MeshTrianglesPtr triangles)
+        {
+            return MeshBvhPtr(new MeshBvh(triangles));
+        }
+    }
+
+    MeshBvhCache::MeshBvhCache(Foundation::Framework* framework) :
+        framework_(framework),
+        num_triangles_(0)
+    {
+        max_triangles_ = framework_->GetDefaultConfig().DeclareSetting("OgreRenderer", "raycast_cache_triangles", 1000000);
+    }
+
+    MeshBvhCache::~MeshBvhCache()
+    {
+        Clear();
+    }
+
+    bool MeshBvhCache::Raycast(const Ogre::MeshPtr& mesh, const Ogre::Ray& ray, bool back_side, MeshRayHit& hit, MeshTrianglesPtr& triangles)
+    {
+        if (mesh.isNull())
+            return false;
+
+        Entry& entry = GetEntry(mesh);
+        triangles = entry.triangles_;
+
+        if (entry.building_ && entry.pending_bvh_.IsReady())
+        {
+            entry.building_ = false;
+            try
+            {
+                entry.bvh_ = entry.pending_bvh_.Get();
+            }
+            catch (Exception& e)
+            {
+                OgreRenderingModule::LogError("Could not build raycast hierarchy for mesh " + mesh->getName() + ": " + e.what());
+            }
+            entry.pending_bvh_ = Foundation::TaskFuture<MeshBvhPtr>();
+        }
+
+        if (entry.bvh_)
+            return entry.bvh_->Raycast(ray, back_side, hit);
+        return RaycastTriangles(*triangles, ray, back_side, hit);
+    }
+
+    void MeshBvhCache::Invalidate(const Ogre::MeshPtr& mesh)
+    {
+        if (mesh.isNull())
+            return;
+
+        EntryMap::iterator i = entries_.find(mesh->getHandle());
+        if (i != entries_.end())
+            RemoveEntry(i);
+    }
+
+    void MeshBvhCache::Clear()
+    {
+        // Builds in progress finish in the task pool, and their results are dropped
+        entries_.clear();
+        lru_.clear();
+        num_triangles_ = 0;
+    }
+
+    size_t MeshBvhCache::GetNumPendingBuilds() const
+    {
+        size_t count = 0;
+        for(EntryMap::const_iterator i = entries_.begin(); i != entries_.end(); ++i)
+            if (i->second.building_)
+                ++count;
+        return count;
+    }
+
+    MeshTrianglesPtr MeshBvhCache::ExtractTriangles(const Ogre::MeshPtr& mesh, Ogre::Entity* animated_entity)
+    {
+        MeshTrianglesPtr triangles(new MeshTriangles());
+        std::vector<Ogre::Vector3>& vertices = triangles->vertices_;
+        std::vector<Ogre::Vector2>& texcoords = triangles->texcoords_;
+        std::vector<uint>& indices = triangles->indices_;
+        if (mesh.isNull())
+            return triangles;
+
+        if (animated_entity)
+            animated_entity->_updateAnimation();
+
+        bool has_texcoords = false;
+        bool added_shared = false;
+        size_t shared_offset = 0;
+        triangles->submesh_start_indices_.resize(mesh->getNumSubMeshes());
+
+        for(unsigned short i = 0; i < mesh->getNumSubMeshes(); ++i)
+        {
+            Ogre::SubMesh* submesh = mesh->getSubMesh(i);
+            triangles->submesh_start_indices_[i] = (uint)indices.size();
+
+            Ogre::VertexData* vertex_data;
+            if (animated_entity)
+                vertex_data = submesh->useSharedVertices ? animated_entity->_getSkelAnimVertexData() : animated_entity->getSubEntity(i)->_getSkelAnimVertexData();
+            else
+                vertex_data = submesh->useSharedVertices ? mesh->sharedVertexData : submesh->vertexData;
+            if (!vertex_data)
+                continue;
+
+            // The shared vertices are copied once
+            size_t offset = vertices.size();
+            if (submesh->useSharedVertices && added_shared)
+                offset = shared_offset;
+            else
+            {
+                if (submesh->useSharedVertices)
+                {
+                    added_shared = true;
+                    shared_offset = offset;
+                }
+
+                const Ogre::VertexElement* pos_elem = vertex_data->vertexDeclaration->findElementBySemantic(Ogre::VES_POSITION);
+                const Ogre::VertexElement* tex_elem = vertex_data->vertexDeclaration->findElementBySemantic(Ogre::VES_TEXTURE_COORDINATES);
+                vertices.resize(offset + vertex_data->vertexCount);
+                texcoords.resize(offset + vertex_data->vertexCount, Ogre::Vector2::ZERO);
+                if (!pos_elem)
+                    continue;
+
+                Ogre::HardwareVertexBufferSharedPtr vbuf = vertex_data->vertexBufferBinding->getBuffer(pos_elem->getSource());
+                unsigned char* vertex = static_cast<unsigned char*>(vbuf->lock(Ogre::HardwareBuffer::HBL_READ_ONLY)) +
+                    vertex_data->vertexStart * vbuf->getVertexSize();
+                float* real = 0;
+                for(size_t j = 0; j < vertex_data->vertexCount; ++j, vertex += vbuf->getVertexSize())
+                {
+                    pos_elem->baseVertexPointerToElement(vertex, &real);
+                    vertices[offset + j] = Ogre::Vector3(real[0], real[1], real[2]);
+                }
+                vbuf->unlock();
+
+                // Texture coordinates may be in a buffer of their own
+                if (tex_elem)
+                {
+                    has_texcoords = true;
+                    Ogre::HardwareVertexBufferSharedPtr tbuf = vertex_data->vertexBufferBinding->getBuffer(tex_elem->getSource());
+                    unsigned char* tex_vertex = static_cast<unsigned char*>(tbuf->lock(Ogre::HardwareBuffer::HBL_READ_ONLY)) +
+                        vertex_data->vertexStart * tbuf->getVertexSize();
+                    for(size_t j = 0; j < vertex_data->vertexCount; ++j, tex_vertex += tbuf->getVertexSize())
+                    {
+                        tex_elem->baseVertexPointerToElement(tex_vertex, &real);
+                        texcoords[offset + j] = Ogre::Vector2(real[0], real[1]);
+                    }
+                    tbuf->unlock();
+                }
+            }
+
+            Ogre::IndexData* index_data = submesh->indexData;
+            Ogre::HardwareIndexBufferSharedPtr ibuf = index_data->indexBuffer;
+            if (ibuf.isNull())
+                continue;
+
+            size_t num_indices = index_data->indexCount / 3 * 3;
+            size_t first_index = indices.size();
+            indices.resize(first_index + num_indices);
+            if (ibuf->getType() == Ogre::HardwareIndexBuffer::IT_32BIT)
+            {
+                const Ogre::uint32* src = static_cast<const Ogre::uint32*>(ibuf->lock(Ogre::HardwareBuffer::HBL_READ_ONLY)) + index_data->indexStart;
+                for(size_t k = 0; k < num_indices; ++k)
+                    indices[first_index + k] = src[k] + (uint)offset;
+            }
+            else
+            {
+                const Ogre::uint16* src = static_cast<const Ogre::uint16*>(ibuf->lock(Ogre::HardwareBuffer::HBL_READ_ONLY)) + index_data->indexStart;
+                for(size_t k = 0; k < num_indices; ++k)
+                    indices[first_index + k] = src[k] + (uint)offset;
+            }
+            ibuf->unlock();
+        }
+
+        if (!has_texcoords)
+            texcoords.clear();
+
+        return triangles;
+    }
+
+    std::vector<size_t> MeshBvhCache::GetSignature(const Ogre::MeshPtr& mesh)
+    {
+        std::vector<size_t> signature;
+        if (mesh->sharedVertexData)
+        {
+            signature.push_back((size_t)mesh->sharedVertexData);
+            signature.push_back(mesh->sharedVertexData->vertexCount);
+        }
+        for(unsigned short i = 0; i < mesh->getNumSubMeshes(); ++i)
+        {
+            Ogre::SubMesh* submesh = mesh->getSubMesh(i);
+            signature.push_back((size_t)submesh->vertexData);
+            if (submesh->vertexData)
+                signature.push_back(submesh->vertexData->vertexCount);
+            signature.push_back((size_t)submesh->indexData->indexBuffer.get());
+            signature.push_back(submesh->indexData->indexStart);
+            signature.push_back(submesh->indexData->indexCount);
+        }
+        return signature;
+    }
+
+    MeshBvhCache::Entry& MeshBvhCache::GetEntry(const Ogre::MeshPtr& mesh)
+    {
+        Ogre::ResourceHandle handle = mesh->getHandle();
+        std::vector<size_t> signature = GetSignature(mesh);
+
+        EntryMap::iterator i = entries_.find(handle);
+        if (i != entries_.end())
+        {
+            if (i->second.signature_ == signature)
+            {
+                // Mark as most recently used
+                lru_.splice(lru_.end(), lru_, i->second.lru_);
+                return i->second;
+            }
+            RemoveEntry(i);
+        }
+
+        Entry& entry = entries_[handle];
+        entry.signature_ = signature;
+        entry.triangles_ = ExtractTriangles(mesh);
+        entry.building_ = false;
+        entry.lru_ = lru_.insert(lru_.end(), handle);
+        num_triangles_ += entry.triangles_->GetNumTriangles();
+
+        if (entry.triangles_->GetNumTriangles() >= cMinBvhTriangles)
+        {
+            Foundation::TaskPool* pool = framework_->GetThreadTaskManager()->GetTaskPool();
+            if (pool)
+            {
+                entry.pending_bvh_ = pool->Submit<MeshBvhPtr>(boost::bind(&BuildMeshBvh, entry.triangles_));
+                entry.building_ = true;
+            }
+            else
+                entry.bvh_ = BuildMeshBvh(entry.triangles_);
+        }
+
+        // Forget the least recently used meshes, but never the one just added
+        while(num_triangles_ > max_triangles_ && lru_.front() != handle)
+            RemoveEntry(entries_.find(lru_.front()));
+
+        return entry;
+    }
+
+    void MeshBvhCache::RemoveEntry(EntryMap::iterator i)
+    {
+        num_triangles_ -= i->second.triangles_->GetNumTriangles();
+        lru_.erase(i->second.lru_);
+        entries_.erase(i);
+    }
+}
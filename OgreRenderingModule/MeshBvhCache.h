@@ -0,0 +1,124 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_OgreRenderer_MeshBvhCache_h
+#define incl_OgreRenderer_MeshBvhCache_h
+
+#include "OgreModuleApi.h"
+#include "MeshBvh.h"
+#include "TaskPool.h"
+
+#include <OgreMesh.h>
+
+namespace Foundation
+{
+    class Framework;
+}
+
+namespace Ogre
+{
+    class Entity;
+}
+
+namespace OgreRenderer
+{
+    //! Caches the triangles and bounding volume hierarchies of meshes for raycasting
+    /*! The triangles of a mesh are copied from its hardware buffers on first use, in mesh local space, so that all the
+        entities of a mesh share them. The hierarchy is built in the framework's task pool; until it is ready, rays are
+        tested against the triangles one by one.
+
+        An entry is rebuilt when the vertex or index buffers of its mesh are replaced. Code that rewrites buffers in place
+        has to call Invalidate(). The cache holds a bounded number of triangles of the least recently raycast meshes.
+     */
+    class OGRE_MODULE_API MeshBvhCache
+    {
+    public:
+        //! Constructor
+        /*! \param framework Framework
+         */
+        MeshBvhCache(Foundation::Framework* framework);
+
+        //! Destructor
+        ~MeshBvhCache();
+
+        //! Finds the nearest triangle of a mesh hit by a ray
+        /*! \param mesh Mesh
+            \param ray Ray in mesh local space
+            \param back_side Test against back sides, for mirrored transforms
+            \param hit Receives the hit
+            \param triangles Receives the triangles that the hit refers to
+            \return true if a triangle was hit
+         */
+        bool Raycast(const Ogre::MeshPtr& mesh, const Ogre::Ray& ray, bool back_side, MeshRayHit& hit, MeshTrianglesPtr& triangles);
+
+        //! Forgets a mesh, so that its triangles are copied again on the next raycast
+        void Invalidate(const Ogre::MeshPtr& mesh);
+
+        //! Empties the cache
+        void Clear();
+
+        //! Returns number of cached meshes
+        size_t GetNumMeshes() const { return entries_.size(); }
+
+        //! Returns number of cached triangles
+        size_t GetNumTriangles() const { return num_triangles_; }
+
+        //! Returns number of hierarchies being built
+        size_t GetNumPendingBuilds() const;
+
+        //! Copies the triangles of a mesh to mesh local space
+        /*! \param mesh Mesh
+            \param animated_entity If not null, an entity of the mesh whose software skinned vertices are copied instead
+            \return Triangles
+         */
+        static MeshTrianglesPtr ExtractTriangles(const Ogre::MeshPtr& mesh, Ogre::Entity* animated_entity = 0);
+
+    private:
+        //! Least recently used order of cached meshes, oldest first
+        typedef std::list<Ogre::ResourceHandle> LruList;
+
+        //! Cache entry
+        struct Entry
+        {
+            //! Buffers and counts of the mesh when the triangles were copied
+            std::vector<size_t> signature_;
+            //! The triangles
+            MeshTrianglesPtr triangles_;
+            //! The hierarchy, null until built
+            MeshBvhPtr bvh_;
+            //! The hierarchy being built, if building
+            Foundation::TaskFuture<MeshBvhPtr> pending_bvh_;
+            //! Whether the hierarchy is being built
+            bool building_;
+            //! Position in the LRU list
+            LruList::iterator lru_;
+        };
+
+        typedef std::map<Ogre::ResourceHandle, Entry> EntryMap;
+
+        //! Returns the buffers and counts of a mesh, which change when the mesh's geometry is replaced
+        static std::vector<size_t> GetSignature(const Ogre::MeshPtr& mesh);
+
+        //! Returns the entry of a mesh, copying its triangles and starting to build its hierarchy if needed
+        Entry& GetEntry(const Ogre::MeshPtr& mesh);
+
+        //! Removes an entry
+        void RemoveEntry(EntryMap::iterator i);
+
+        //! Framework
+        Foundation::Framework* framework_;
+
+        //! Entries by mesh handle
+        EntryMap entries_;
+
+        //! Least recently used order of entries
+        LruList lru_;
+
+        //! Number of cached triangles
+        size_t num_triangles_;
+
+        //! Number of cached triangles above which least recently used meshes are forgotten
+        uint max_triangles_;
+    };
+}
+
+#endif
@@ -26,6 +26,9 @@
 #include "ConsoleCommand.h"
 #include "ConsoleCommandServiceInterface.h"
 #include "RendererSettings.h"
+#include "MeshBvhCache.h"
+#include "LabelAtlas.h"
+#include "HighPerfClock.h"
 #include "ConfigurationManager.h"
 #include "EventManager.h"
 #include <Ogre.h>
@@ -113,6 +116,11 @@ namespace OgreRenderer
         RegisterConsoleCommand(Console::CreateCommand(
                 "RenderStats", "Prints out render statistics.", 
                 Console::Bind(this, &OgreRenderingModule::ConsoleStats)));
+
+        RegisterConsoleCommand(Console::CreateCommand(
+                "RaycastBenchmark", "Times raycasts against a synthetic mesh with and without a bounding volume hierarchy. "
+                "Usage: RaycastBenchmark(triangles, rays)",
+                Console::Bind(this, &OgreRenderingModule::ConsoleRaycastBenchmark)));
     }
 
     // virtual
@@ -221,12 +229,117 @@ namespace OgreRenderer
                 console->Print("Triangles: " + ToString(stats.triangleCount));
                 console->Print("Batches: " + ToString(stats.batchCount));
 
+                const UiCompositingStats& ui_stats = renderer_->GetUiCompositingStats();
+                console->Print("UI pixels uploaded last frame: " + ToString(ui_stats.frame_pixels_) + " in " +
+                    ToString(ui_stats.frame_rects_) + " rectangles");
+                if (ui_stats.total_window_pixels_ > 0.0)
+                    console->Print("UI pixels uploaded in " + ToString(ui_stats.total_uploads_) + " updates: " +
+                        ToString(ui_stats.total_pixels_) + ", " + ToString(ui_stats.total_pixels_ * 100.0 / ui_stats.total_window_pixels_) +
+                        "% of full window uploads");
+
+                LabelAtlasPtr atlas = renderer_->GetLabelAtlas();
+                console->Print("Label atlas: " + ToString(atlas->GetNumLabels()) + " labels in " + ToString(atlas->GetNumPages()) +
+                    " textures, " + ToString(atlas->GetUsage() * 100.0f) + "% used, " + ToString(atlas->GetStats().uploads_) +
+                    " uploads, " + ToString(atlas->GetStats().hits_) + " shared");
+
                 return Console::ResultSuccess();
             }
         }
 
         return Console::ResultFailure("No renderer found.");
     }
+
+    namespace
+    {
+        //! Returns a pseudorandom number in [0,1), repeatable between benchmark runs
+        float BenchmarkRandom(uint& seed)
+        {
+            seed = seed * 1664525 + 1013904223;
+            return (seed >> 8) / 16777216.0f;
+        }
+
+        //! Returns seconds elapsed since a clock time
+        double GetElapsedSeconds(Core::tick_t start)
+        {
+            return (Core::GetCurrentClockTime() - start) / (double)Core::GetCurrentClockFreq();
+        }
+    }
+
+    Console::CommandResult OgreRenderingModule::ConsoleRaycastBenchmark(const StringVector &params)
+    {
+        uint num_triangles = params.size() > 0 ? ParseString<uint>(params[0], 100000) : 100000;
+        uint num_rays = params.size() > 1 ? ParseString<uint>(params[1], 1000) : 1000;
+        if (num_triangles < 2 || !num_rays)
+            return Console::ResultFailure("Usage: RaycastBenchmark(triangles, rays)");
+
+        // A bumpy heightfield, like terrain or a detailed scanned mesh
+        uint edge = (uint)sqrtf(num_triangles * 0.5f);
+        MeshTrianglesPtr triangles(new MeshTriangles());
+        triangles->submesh_start_indices_.push_back(0);
+        for(uint y = 0; y <= edge; ++y)
+            for(uint x = 0; x <= edge; ++x)
+                triangles->vertices_.push_back(Ogre::Vector3((float)x, (float)y, sinf(x * 0.1f) * 5.0f + cosf(y * 0.13f) * 5.0f));
+        for(uint y = 0; y < edge; ++y)
+            for(uint x = 0; x < edge; ++x)
+            {
+                uint corner = y * (edge + 1) + x;
+                uint quad[6] = { corner, corner + 1, corner + edge + 1, corner + 1, corner + edge + 2, corner + edge + 1 };
+                triangles->indices_.insert(triangles->indices_.end(), quad, quad + 6);
+            }
+
+        std::vector<Ogre::Ray> rays;
+        uint seed = 1;
+        for(uint i = 0; i < num_rays; ++i)
+        {
+            Ogre::Vector3 origin(BenchmarkRandom(seed) * edge, BenchmarkRandom(seed) * edge, 20.0f);
+            Ogre::Vector3 target(BenchmarkRandom(seed) * edge, BenchmarkRandom(seed) * edge, -20.0f);
+            rays.push_back(Ogre::Ray(origin, (target - origin).normalisedCopy()));
+        }
+
+        Core::tick_t start = Core::GetCurrentClockTime();
+        MeshBvh bvh(triangles);
+        double build_time = GetElapsedSeconds(start);
+
+        std::vector<MeshRayHit> brute_hits(num_rays);
+        std::vector<bool> brute_found(num_rays);
+        start = Core::GetCurrentClockTime();
+        for(uint i = 0; i < num_rays; ++i)
+            brute_found[i] = RaycastTriangles(*triangles, rays[i], false, brute_hits[i]);
+        double brute_time = GetElapsedSeconds(start);
+
+        std::vector<MeshRayHit> bvh_hits(num_rays);
+        std::vector<bool> bvh_found(num_rays);
+        start = Core::GetCurrentClockTime();
+        for(uint i = 0; i < num_rays; ++i)
+            bvh_found[i] = bvh.Raycast(rays[i], false, bvh_hits[i]);
+        double bvh_time = GetElapsedSeconds(start);
+
+        uint hits = 0;
+        uint mismatches = 0;
+        for(uint i = 0; i < num_rays; ++i)
+        {
+            if (brute_found[i])
+                ++hits;
+            if (brute_found[i] != bvh_found[i] || (brute_found[i] && brute_hits[i].index_ != bvh_hits[i].index_))
+                ++mismatches;
+        }
+
+        std::string result = ToString(triangles->GetNumTriangles()) + " triangles, " + ToString(num_rays) + " rays, " + ToString(hits) + " hits\n" +
+            "Hierarchy build: " + ToString(build_time * 1000.0) + " ms, " + ToString(bvh.GetNumNodes()) + " nodes\n" +
+            "Per ray: " + ToString(brute_time * 1e6 / num_rays) + " us brute force, " + ToString(bvh_time * 1e6 / num_rays) + " us hierarchy\n" +
+            "Mismatching hits: " + ToString(mismatches);
+
+        if (renderer_)
+        {
+            MeshBvhCachePtr cache = renderer_->GetMeshBvhCache();
+            result += "\nRaycast cache: " + ToString(cache->GetNumMeshes()) + " meshes, " + ToString(cache->GetNumTriangles()) +
+                " triangles, " + ToString(cache->GetNumPendingBuilds()) + " building";
+        }
+
+        if (mismatches)
+            return Console::ResultFailure(result);
+        return Console::ResultSuccess(result);
+    }
 }
 
 extern "C" void POCO_LIBRARY_API SetProfiler(Foundation::Profiler *profiler);
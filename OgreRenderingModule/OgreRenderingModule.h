@@ -58,6 +58,12 @@ namespace OgreRenderer
         //! callback for console command
         Console::CommandResult ConsoleStats(const StringVector &params);
 
+        //! callback for console command
+        /*! Compares raycasting a synthetic mesh with and without a bounding volume hierarchy.
+            Parameters are the number of triangles and the number of rays.
+         */
+        Console::CommandResult ConsoleRaycastBenchmark(const StringVector &params);
+
         static const Foundation::Module::Type type_static_ = Foundation::Module::MT_Renderer;
 
     private:
@@ -18,7 +18,8 @@ namespace OgreRenderer
     QOgreUIView::QOgreUIView (QWidget *parent) : 
         QGraphicsView(parent),
         win_(0),
-        view_(0)
+        view_(0),
+        dirty_(false)
     {
         setScene(new QGraphicsScene(this)); // Set parent to scene for qt cleanup
         Initialize_();
@@ -68,13 +69,13 @@ namespace OgreRenderer
     void QOgreUIView::SetWorldView(QOgreWorldView *view) 
     { 
         view_ = view; 
-        connect(scene(), SIGNAL( changed(const QList<QRectF> &) ), this, SLOT( SceneChange() )); 
+        connect(scene(), SIGNAL( changed(const QList<QRectF> &) ), this, SLOT( SceneChange(const QList<QRectF> &) )); 
     }
 
     void QOgreUIView::SetScene(QGraphicsScene *new_scene)
     {
         setScene(new_scene);
-        QObject::connect(scene(), SIGNAL( changed (const QList<QRectF> &) ), this, SLOT( SceneChange() ));   
+        QObject::connect(scene(), SIGNAL( changed (const QList<QRectF> &) ), this, SLOT( SceneChange(const QList<QRectF> &) ));   
     }
 
     void QOgreUIView::InitializeWorldView(int width, int height)
@@ -219,8 +220,32 @@ namespace OgreRenderer
             scene()->setSceneRect(viewport()->rect());          
     }
 
-    void QOgreUIView::SceneChange()
+    void QOgreUIView::setDirty(bool dirty)
     {
-        setDirty(true);
+        dirty_ = dirty;
+        if (dirty)
+            dirty_region_ = QRegion(viewport()->rect());
+        else
+            dirty_region_ = QRegion();
+    }
+
+    void QOgreUIView::SceneChange(const QList<QRectF> &rects)
+    {
+        // Without rectangles, repaint everything
+        if (rects.isEmpty())
+        {
+            setDirty(true);
+            return;
+        }
+
+        QRect viewrect = viewport()->rect();
+        foreach(const QRectF &rect, rects)
+        {
+            // Pad for antialiased item edges, as QGraphicsView does
+            QRect dirty = mapFromScene(rect).boundingRect().adjusted(-2, -2, 2, 2) & viewrect;
+            if (!dirty.isEmpty())
+                dirty_region_ += dirty;
+        }
+        dirty_ = !dirty_region_.isEmpty();
     }
 }
@@ -11,6 +11,7 @@
 
 #include <QGraphicsView>
 #include <QKeyEvent>
+#include <QRegion>
 
 namespace Foundation { class KeyBindings; }
 
@@ -32,8 +33,12 @@ namespace OgreRenderer
         
         Ogre::RenderWindow *CreateRenderWindow (const std::string &name, int width, int height, int left, int top, bool fullscreen);
 
+        //! Returns the part of the viewport that has changed since the view was last set clean
+        const QRegion &GetDirtyRegion() const { return dirty_region_; }
+
     public slots:
-        void setDirty(bool dirty) { dirty_ = dirty; }
+        //! Marks the whole viewport changed, or the view clean
+        void setDirty(bool dirty);
         bool isDirty() { return dirty_; }
 
         void UpdateKeyBindings(Foundation::KeyBindings *bindings);
@@ -49,11 +54,14 @@ namespace OgreRenderer
         QOgreWorldView *view_;
         bool dirty_;
 
+        //! Changed part of the viewport, in viewport coordinates
+        QRegion dirty_region_;
+
         QList<QKeySequence> python_run_keys_;
         QList<QKeySequence> console_toggle_keys_;
 
     private slots:
-        void SceneChange();
+        void SceneChange(const QList<QRectF> &rects);
 
     signals:
         void ConsoleToggleRequest();
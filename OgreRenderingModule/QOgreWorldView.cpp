@@ -22,7 +22,7 @@ namespace OgreRenderer
         // set up off-screen texture
         ui_overlay_texture_ = Ogre::TextureManager::getSingleton().createManual(
             "test/texture/UI", Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME,
-             Ogre::TEX_TYPE_2D, width, height, 0, Ogre::PF_A8R8G8B8, Ogre::TU_DYNAMIC_WRITE_ONLY_DISCARDABLE);
+             Ogre::TEX_TYPE_2D, width, height, 0, Ogre::PF_A8R8G8B8, Ogre::TU_DYNAMIC_WRITE_ONLY);
 
         Ogre::MaterialPtr material(Ogre::MaterialManager::getSingleton().create(
             "test/material/UI", Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME));
@@ -99,6 +99,12 @@ namespace OgreRenderer
         ui_overlay_texture_->getBuffer()->blitFromMemory(ui);
     }
 
+    void QOgreWorldView::OverlayUI(const Ogre::PixelBox &ui, const Ogre::Box &dest)
+    {
+        PROFILE(QOgreWorldView_OverlayUI);
+        ui_overlay_texture_->getBuffer()->blitFromMemory(ui, dest);
+    }
+
     void QOgreWorldView::ShowUiOverlay()
     {
         ui_overlay_->show();
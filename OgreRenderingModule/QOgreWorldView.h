@@ -24,6 +24,8 @@ namespace OgreRenderer
 
             void RenderOneFrame();
             void OverlayUI(Ogre::PixelBox &ui);
+            //! Uploads part of the UI, keeping the rest of the overlay texture
+            void OverlayUI(const Ogre::PixelBox &ui, const Ogre::Box &dest);
 
             void ShowUiOverlay();
             void HideUiOverlay();
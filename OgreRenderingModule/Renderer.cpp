@@ -11,6 +11,8 @@
 #include "EC_OgrePlaceable.h"
 #include "EC_OgreCamera.h"
 #include "EC_OgreMovableTextOverlay.h"
+#include "MeshBvhCache.h"
+#include "LabelAtlas.h"
 #include "QOgreUIView.h"
 #include "QOgreWorldView.h"
 
@@ -85,6 +87,8 @@ namespace OgreRenderer
         config_filename_(config),
         plugins_filename_(plugins),
         ray_query_(0),
+        mesh_bvh_cache_(MeshBvhCachePtr(new MeshBvhCache(framework))),
+        label_atlas_(LabelAtlasPtr(new LabelAtlas())),
         window_title_(window_title),
         main_window_(0),
         q_ogre_ui_view_(0),
@@ -144,6 +148,8 @@ namespace OgreRenderer
         }
 
         resource_handler_.reset();
+        // The atlas textures must be freed while the render system still exists
+        label_atlas_->Clear();
         root_.reset();
         //main_window_->deleteLater();
         //main_window_ = 0;
@@ -437,6 +443,9 @@ namespace OgreRenderer
             resized_dirty_ = 2;
         }
 
+        ui_stats_.frame_rects_ = 0;
+        ui_stats_.frame_pixels_ = 0;
+
         if (q_ogre_ui_view_->isDirty() || resized_dirty_)
         {
             PROFILE(Renderer_Render_QtBlit);
@@ -444,19 +453,23 @@ namespace OgreRenderer
             QSize viewsize(q_ogre_ui_view_-> viewport()-> size());
             QRect viewrect(QPoint(0, 0), viewsize);
 
-            // Compositing back buffer
-            QImage buffer(viewsize, QImage::Format_ARGB32_Premultiplied);
-            buffer.fill(Qt::transparent);
-
-            // Paint ui view into buffer
-            QPainter painter(&buffer);
-            q_ogre_ui_view_->viewport()->render(&painter, QPoint(0,0), QRegion(viewrect), QWidget::DrawChildren);
+            // Repaint only what changed, unless the window was resized
+            QRegion dirty = q_ogre_ui_view_->GetDirtyRegion() & viewrect;
+            if (resized_dirty_ || ui_buffer_.size() != viewsize)
+            {
+                if (ui_buffer_.size() != viewsize)
+                    ui_buffer_ = QImage(viewsize, QImage::Format_ARGB32_Premultiplied);
+                dirty = QRegion(viewrect);
+            }
 
-            // Blit ogre view into buffer
-            Ogre::Box bounds(0, 0, viewsize.width(), viewsize.height());
-            Ogre::PixelBox bufbox(bounds, Ogre::PF_A8R8G8B8, (void *)buffer.bits());
+            if (!dirty.isEmpty())
+            {
+                CompositeUi(dirty);
+                ++ui_stats_.total_uploads_;
+                ui_stats_.total_pixels_ += ui_stats_.frame_pixels_;
+                ui_stats_.total_window_pixels_ += viewsize.width() * viewsize.height();
+            }
 
-            q_ogre_world_view_->OverlayUI(bufbox);
             if (resized_dirty_ > 0)
                 resized_dirty_--;
         }
@@ -465,190 +478,45 @@ namespace OgreRenderer
         q_ogre_ui_view_->setDirty(false);
     }
 
-    uint GetSubmeshFromIndexRange(uint index, const std::vector<uint>& submeshstartindex)
+    void Renderer::CompositeUi(const QRegion &region)
     {
-        for(uint i = 0; i < submeshstartindex.size(); ++i)
+        // Each upload has a fixed cost, so many small rectangles are merged into their bounding rectangle
+        const int max_rects = 16;
+        QVector<QRect> rects = region.rects();
+        if (rects.size() > max_rects)
         {
-            uint start = submeshstartindex[i];
-            uint end;
-            if (i < submeshstartindex.size() - 1)
-                end = submeshstartindex[i+1];
-            else
-                end = 0x7fffffff;
-            if ((index >= start) && (index < end))
-                return i;
+            rects.clear();
+            rects.push_back(region.boundingRect());
         }
-        return 0; // should never happen
-    }
 
-    // Get the mesh information for the given mesh. Version which supports animation
-    // Adapted from http://www.ogre3d.org/wiki/index.php/Raycasting_to_the_polygon_level
-    void GetMeshInformation(
-        Ogre::Entity *entity,
-        std::vector<Ogre::Vector3>& vertices,
-        std::vector<Ogre::Vector2>& texcoords,
-        std::vector<uint>& indices,
-        std::vector<uint>& submeshstartindex,
-        const Ogre::Vector3 &position,
-        const Ogre::Quaternion &orient,
-        const Ogre::Vector3 &scale)
-    {
-        bool added_shared = false;
-        size_t current_offset = 0;
-        size_t shared_offset = 0;
-        size_t next_offset = 0;
-        size_t index_offset = 0;
-        size_t vertex_count = 0;
-        size_t index_count = 0;
-        Ogre::MeshPtr mesh = entity->getMesh();
-
-        bool useSoftwareBlendingVertices = entity->hasSkeleton();
-        if (useSoftwareBlendingVertices)
-            entity->_updateAnimation();
-
-        submeshstartindex.resize(mesh->getNumSubMeshes());
-
-        // Calculate how many vertices and indices we're going to need
-        for(unsigned short i = 0; i < mesh->getNumSubMeshes(); ++i)
         {
-            Ogre::SubMesh* submesh = mesh->getSubMesh( i );
-            // We only need to add the shared vertices once
-            if (submesh->useSharedVertices)
-            {
-                if (!added_shared)
-                {
-                    vertex_count += mesh->sharedVertexData->vertexCount;
-                    added_shared = true;
-                }
-            }
-            else
+            PROFILE(Renderer_CompositeUi_Paint);
+            QPainter painter(&ui_buffer_);
+            for (int i = 0; i < rects.size(); ++i)
             {
-                vertex_count += submesh->vertexData->vertexCount;
+                // Clear the old UI, then paint the ui view over it
+                painter.setCompositionMode(QPainter::CompositionMode_Source);
+                painter.fillRect(rects[i], Qt::transparent);
+                painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+                q_ogre_ui_view_->viewport()->render(&painter, rects[i].topLeft(), QRegion(rects[i]), QWidget::DrawChildren);
             }
-
-            // Add the indices
-            submeshstartindex[i] = index_count;
-            index_count += submesh->indexData->indexCount;
         }
 
-        // Allocate space for the vertices and indices
-        vertices.resize(vertex_count);
-        texcoords.resize(vertex_count);
-        indices.resize(index_count);
-
-        added_shared = false;
-
-        // Run through the submeshes again, adding the data into the arrays
-        for(unsigned short i = 0; i < mesh->getNumSubMeshes(); ++i)
+        // Blit the changed rectangles to the overlay texture
+        PROFILE(Renderer_CompositeUi_Upload);
+        Ogre::Box bounds(0, 0, ui_buffer_.width(), ui_buffer_.height());
+        Ogre::PixelBox bufbox(bounds, Ogre::PF_A8R8G8B8, (void *)ui_buffer_.bits());
+        for (int i = 0; i < rects.size(); ++i)
         {
-            Ogre::SubMesh* submesh = mesh->getSubMesh(i);
-
-            // Get vertex data
-            //Ogre::VertexData* vertex_data = submesh->useSharedVertices ? mesh->sharedVertexData : submesh->vertexData;
-            Ogre::VertexData* vertex_data;
-
-            //When there is animation:
-            if (useSoftwareBlendingVertices)
-                vertex_data = submesh->useSharedVertices ? entity->_getSkelAnimVertexData() : entity->getSubEntity(i)->_getSkelAnimVertexData();
-            else
-                vertex_data = submesh->useSharedVertices ? mesh->sharedVertexData : submesh->vertexData;
-
-            if ((!submesh->useSharedVertices)||(submesh->useSharedVertices && !added_shared))
-            {
-                if(submesh->useSharedVertices)
-                {
-                    added_shared = true;
-                    shared_offset = current_offset;
-                }
-
-                const Ogre::VertexElement* posElem =
-                    vertex_data->vertexDeclaration->findElementBySemantic(Ogre::VES_POSITION);
-                const Ogre::VertexElement *texElem = 
-                    vertex_data->vertexDeclaration->findElementBySemantic(Ogre::VES_TEXTURE_COORDINATES);
-
-                Ogre::HardwareVertexBufferSharedPtr vbuf =
-                    vertex_data->vertexBufferBinding->getBuffer(posElem->getSource());
+            const QRect &rect = rects[i];
+            Ogre::Box box(rect.left(), rect.top(), rect.right() + 1, rect.bottom() + 1);
+            q_ogre_world_view_->OverlayUI(bufbox.getSubVolume(box), box);
 
-                unsigned char* vertex =
-                    static_cast<unsigned char*>(vbuf->lock(Ogre::HardwareBuffer::HBL_READ_ONLY));
-
-                // There is _no_ baseVertexPointerToElement() which takes an Ogre::Real or a double
-                //  as second argument. So make it float, to avoid trouble when Ogre::Real will
-                //  be comiled/typedefed as double:
-                //      Ogre::Real* pReal;
-                float* pReal = 0;
-
-                for(size_t j = 0; j < vertex_data->vertexCount; ++j, vertex += vbuf->getVertexSize())
-                {
-                    posElem->baseVertexPointerToElement(vertex, &pReal);
-
-                    Ogre::Vector3 pt(pReal[0], pReal[1], pReal[2]);
-
-                    vertices[current_offset + j] = (orient * (pt * scale)) + position;
-                    if (texElem)
-                    {
-                        texElem->baseVertexPointerToElement(vertex, &pReal);
-                        texcoords[current_offset + j] = Ogre::Vector2(pReal[0], pReal[1]);
-                    }
-                    else
-                        texcoords[current_offset + j] = Ogre::Vector2(0.0f, 0.0f);
-                }
-
-                vbuf->unlock();
-                next_offset += vertex_data->vertexCount;
-            }
-
-            Ogre::IndexData* index_data = submesh->indexData;
-            size_t numTris = index_data->indexCount / 3;
-            Ogre::HardwareIndexBufferSharedPtr ibuf = index_data->indexBuffer;
-
-            unsigned long*  pLong = static_cast<unsigned long*>(ibuf->lock(Ogre::HardwareBuffer::HBL_READ_ONLY));
-            unsigned short* pShort = reinterpret_cast<unsigned short*>(pLong);
-            size_t offset = (submesh->useSharedVertices)? shared_offset : current_offset;
-
-            bool use32bitindexes = (ibuf->getType() == Ogre::HardwareIndexBuffer::IT_32BIT);
-            if (use32bitindexes)
-                for(size_t k = 0; k < numTris*3; ++k)
-                    indices[index_offset++] = pLong[k] + static_cast<uint>(offset);
-            else
-                for(size_t k = 0; k < numTris*3; ++k)
-                    indices[index_offset++] = static_cast<uint>(pShort[k]) + static_cast<unsigned long>(offset);
-
-            ibuf->unlock();
-            current_offset = next_offset;
+            ++ui_stats_.frame_rects_;
+            ui_stats_.frame_pixels_ += rect.width() * rect.height();
         }
     }
 
-    Ogre::Vector2 FindUVs(
-        const Ogre::Ray& ray,
-        float distance,
-        const std::vector<Ogre::Vector3>& vertices,
-        const std::vector<Ogre::Vector2>& texcoords,
-        const std::vector<uint> indices, uint foundindex)
-    {
-        Ogre::Vector3 point = ray.getPoint(distance);
-
-        Ogre::Vector3 t1 = vertices[indices[foundindex]];
-        Ogre::Vector3 t2 = vertices[indices[foundindex+1]];
-        Ogre::Vector3 t3 = vertices[indices[foundindex+2]];
-
-        Ogre::Vector3 v1 = point - t1;
-        Ogre::Vector3 v2 = point - t2;
-        Ogre::Vector3 v3 = point - t3;
-
-        float area1 = (v2.crossProduct(v3)).length() / 2.0f;
-        float area2 = (v1.crossProduct(v3)).length() / 2.0f;
-        float area3 = (v1.crossProduct(v2)).length() / 2.0f;
-        float sum_area = area1 + area2 + area3;
-        if (sum_area == 0.0)
-            return Ogre::Vector2(0.0f, 0.0f);
-
-        Ogre::Vector3 bary(area1 / sum_area, area2 / sum_area, area3 / sum_area);
-        Ogre::Vector2 t = texcoords[indices[foundindex]] * bary.x + texcoords[indices[foundindex+1]] * bary.y + texcoords[indices[foundindex+2]] * bary.z;
-
-        return t;
-    }
-
     Foundation::RaycastResult Renderer::Raycast(int x, int y)
     {
         Foundation::RaycastResult result;
@@ -700,16 +568,6 @@ namespace OgreRenderer
         // Now do the real pass
         Ogre::Real closest_distance = -1.0f;
         int closest_priority = minimum_priority;
-        Ogre::Vector2 closest_uv;
-
-        static std::vector<Ogre::Vector3> vertices;
-        static std::vector<Ogre::Vector2> texcoords;
-        static std::vector<uint> indices;
-        static std::vector<uint> submeshstartindex;
-        vertices.clear();
-        texcoords.clear();
-        indices.clear();
-        submeshstartindex.clear();
 
         for (size_t i = 0; i < results.size(); ++i)
         {
@@ -753,37 +611,48 @@ namespace OgreRenderer
                 Ogre::Entity* ogre_entity = static_cast<Ogre::Entity*>(entry.movable);
                 assert(ogre_entity != 0);
 
-                // get the mesh information
-                GetMeshInformation(ogre_entity, vertices, texcoords, indices, submeshstartindex,
-                    ogre_entity->getParentNode()->_getDerivedPosition(),
-                    ogre_entity->getParentNode()->_getDerivedOrientation(),
-                    ogre_entity->getParentNode()->_getDerivedScale());
+                // Test in mesh local space, so that the triangles need not be transformed. The distance along the ray
+                // stays the same, as the direction is transformed along with the origin.
+                Ogre::Node* node = ogre_entity->getParentNode();
+                const Ogre::Vector3& scale = node->_getDerivedScale();
+                if (scale.x == 0.0f || scale.y == 0.0f || scale.z == 0.0f)
+                    continue;
+                Ogre::Quaternion inv_orientation = node->_getDerivedOrientation().Inverse();
+                Ogre::Ray local_ray(inv_orientation * (ray.getOrigin() - node->_getDerivedPosition()) / scale,
+                    inv_orientation * ray.getDirection() / scale);
+                // A mirroring scale turns the front sides of the triangles to the back
+                bool mirrored = scale.x * scale.y * scale.z < 0.0f;
+
+                MeshRayHit hit;
+                MeshTrianglesPtr triangles;
+                bool found;
+                if (ogre_entity->hasSkeleton())
+                {
+                    // Skinned vertices change every frame, so they are copied and tested one by one
+                    triangles = MeshBvhCache::ExtractTriangles(ogre_entity->getMesh(), ogre_entity);
+                    found = RaycastTriangles(*triangles, local_ray, mirrored, hit);
+                }
+                else
+                    found = mesh_bvh_cache_->Raycast(ogre_entity->getMesh(), local_ray, mirrored, hit, triangles);
 
-                // test for hitting individual triangles on the mesh
-                for (int j = 0; j < ((int)indices.size())-2; j += 3)
+                if (found)
                 {
-                    // check for a hit against this triangle
-                    std::pair<bool, Ogre::Real> hit = Ogre::Math::intersects(ray, vertices[indices[j]],
-                        vertices[indices[j+1]], vertices[indices[j+2]], true, false);
-                    if (hit.first)
+                    if ((closest_distance < 0.0f) || (hit.distance_ < closest_distance) || (current_priority > closest_priority))
                     {
-                        if ((closest_distance < 0.0f) || (hit.second < closest_distance) || (current_priority > closest_priority))
+                        if (current_priority >= closest_priority)
                         {
-                            if (current_priority >= closest_priority)
-                            {
-                                // this is the closest/best so far, save it
-                                closest_distance = hit.second;
-                                closest_priority = current_priority;
-
-                                Ogre::Vector2 uv = FindUVs(ray, hit.second, vertices, texcoords, indices, j); 
-                                Ogre::Vector3 point = ray.getPoint(closest_distance);
-
-                                result.entity_ = entity;
-                                result.pos_ = Vector3df(point.x, point.y, point.z);
-                                result.submesh_ = GetSubmeshFromIndexRange(j, submeshstartindex);
-                                result.u_ = uv.x;
-                                result.v_ = uv.y;
-                            }
+                            // this is the closest/best so far, save it
+                            closest_distance = hit.distance_;
+                            closest_priority = current_priority;
+
+                            Ogre::Vector2 uv = hit.GetTexCoord(*triangles);
+                            Ogre::Vector3 point = ray.getPoint(closest_distance);
+
+                            result.entity_ = entity;
+                            result.pos_ = Vector3df(point.x, point.y, point.z);
+                            result.submesh_ = triangles->GetSubmesh(hit.index_);
+                            result.u_ = uv.x;
+                            result.v_ = uv.y;
                         }
                     }
                 }
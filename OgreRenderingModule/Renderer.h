@@ -9,6 +9,8 @@
 #include "CoreTypes.h"
 #include <qrect.h> //for frustum scene query
 #include <QVariant>
+#include <QImage>
+#include <QRegion>
 
 //what was here before QObjectification
 #include "RenderServiceInterface.h"
@@ -43,10 +45,31 @@ namespace OgreRenderer
     class ResourceHandler;
     class QOgreUIView;
     class QOgreWorldView;
+    class MeshBvhCache;
+    class LabelAtlas;
 
     typedef boost::shared_ptr<Ogre::Root> OgreRootPtr;
     typedef boost::shared_ptr<LogListener> OgreLogListenerPtr;
     typedef boost::shared_ptr<ResourceHandler> ResourceHandlerPtr;
+    typedef boost::shared_ptr<MeshBvhCache> MeshBvhCachePtr;
+    typedef boost::shared_ptr<LabelAtlas> LabelAtlasPtr;
+
+    //! Counts of UI pixels uploaded to the overlay texture, for profiling
+    struct UiCompositingStats
+    {
+        //! Rectangles uploaded during the last frame
+        uint frame_rects_;
+        //! Pixels uploaded during the last frame
+        uint frame_pixels_;
+        //! Frames that uploaded UI pixels
+        uint total_uploads_;
+        //! Pixels uploaded in all frames
+        f64 total_pixels_;
+        //! Pixels that uploading the whole window in those frames would have taken
+        f64 total_window_pixels_;
+
+        UiCompositingStats() : frame_rects_(0), frame_pixels_(0), total_uploads_(0), total_pixels_(0.0), total_window_pixels_(0.0) {}
+    };
 
     //! Ogre renderer
     /*! Created by OgreRenderingModule. Implements the RenderServiceInterface.
@@ -174,6 +197,15 @@ namespace OgreRenderer
         //! Returns resource handler
         ResourceHandlerPtr GetResourceHandler() const { return resource_handler_; }
 
+        //! Returns UI compositing counts
+        const UiCompositingStats& GetUiCompositingStats() const { return ui_stats_; }
+
+        //! Returns the cache of mesh triangles used for raycasting
+        MeshBvhCachePtr GetMeshBvhCache() const { return mesh_bvh_cache_; }
+
+        //! Returns the shared texture atlas for text labels
+        LabelAtlasPtr GetLabelAtlas() const { return label_atlas_; }
+
         //! Removes log listener
         void RemoveLogListener();
 
@@ -231,6 +263,9 @@ namespace OgreRenderer
         //! Creates scenemanager & camera
         void SetupScene();
 
+        //! Repaints a region of the UI into the compositing buffer and uploads it to the UI overlay
+        void CompositeUi(const QRegion &region);
+
         //! Successfully initialized flag
         bool initialized_;
 
@@ -282,6 +317,12 @@ namespace OgreRenderer
         //! ray for raycasting, reusable
         Ogre::RaySceneQuery *ray_query_;
 
+        //! mesh triangles and hierarchies for raycasting
+        MeshBvhCachePtr mesh_bvh_cache_;
+
+        //! shared texture atlas for text labels
+        LabelAtlasPtr label_atlas_;
+
         //! window title to be used when creating renderwindow
         std::string window_title_;
 
@@ -306,6 +347,12 @@ namespace OgreRenderer
 
         //! resized dirty count
         int resized_dirty_;
+
+        //! UI compositing buffer, kept between frames so that only changed parts are repainted
+        QImage ui_buffer_;
+
+        //! UI compositing counts
+        UiCompositingStats ui_stats_;
     };
 }
 
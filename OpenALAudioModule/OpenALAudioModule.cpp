@@ -48,7 +48,7 @@ namespace OpenALAudio
     {
         Foundation::EventManagerPtr event_manager = framework_->GetEventManager();
         asset_event_category_ = event_manager->QueryEventCategory("Asset");
-        task_event_category_ = event_manager->QueryEventCategory("Task");
+        event_manager->SubscribeEventCategory(this, asset_event_category_);
     }
 
     void OpenALAudioModule::Uninitialize()
@@ -75,12 +75,6 @@ namespace OpenALAudio
                 return soundsystem_->HandleAssetEvent(event_id, data);
             else return false;
         }
-        if (category_id == task_event_category_)
-        {
-            if (soundsystem_)
-                return soundsystem_->HandleTaskEvent(event_id, data);
-            else return false;
-        }
         return false;
     }
 }
@@ -47,7 +47,6 @@ namespace OpenALAudio
 		SoundSystemPtr soundsystem_;
 		SoundSettingsPtr soundsettings_;
 				
-		event_category_id_t task_event_category_;
 		event_category_id_t asset_event_category_;
     };
 }
@@ -54,6 +54,14 @@ namespace OpenALAudio
         return true;
     }
     
+    void Sound::SetStreamData(VorbisDataPtr data)
+    {
+        DeleteBuffer();
+
+        stream_data_ = data;
+        size_ = data ? data->size() : 0;
+    }
+    
     bool Sound::CreateBuffer()
     {    
         if (!handle_)
@@ -74,7 +82,8 @@ namespace OpenALAudio
         {
             alDeleteBuffers(1, &handle_);
             handle_ = 0;
-            size_ = 0;
         }
+        stream_data_.reset();
+        size_ = 0;
     } 
 }
\ No newline at end of file
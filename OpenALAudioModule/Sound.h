@@ -6,10 +6,14 @@
 #include <AL/alc.h>
 
 #include "SoundServiceInterface.h"
+#include "VorbisDecoder.h"
 
 namespace OpenALAudio
 {
     //! A sound buffer containing sound data. Uses OpenAL
+    /*! Large Ogg Vorbis sounds are not decoded to a buffer, but keep their encoded data, which channels decode
+        while playing. Such a sound has no OpenAL buffer.
+     */
     class Sound
     {
     public:
@@ -23,11 +27,23 @@ namespace OpenALAudio
          */
         bool LoadFromBuffer(const Foundation::SoundServiceInterface::SoundBuffer& buffer);
 
+        //! Set Ogg Vorbis data to stream the sound from
+        /*! Any existing sound data will be erased.
+         */
+        void SetStreamData(VorbisDataPtr data);
+
+        //! Return Ogg Vorbis data of a streamed sound, null if not streamed
+        const VorbisDataPtr& GetStreamData() const { ResetAge(); return stream_data_; }
+        //! Return whether the sound is streamed
+        bool IsStreamed() const { return stream_data_.get() != 0; }
+        //! Return whether the sound has data to play, either in an OpenAL buffer or for streaming
+        bool IsLoaded() const { return handle_ || stream_data_; }
+
         //! Return sound name
         const std::string& GetName() const { return name_; }
         //! Return OpenAL handle
         ALuint GetHandle() const { ResetAge(); return handle_; }
-        //! Return datasize of sound in bytes
+        //! Return size of the sound's data in memory in bytes. For a streamed sound, this is the encoded size.
         uint GetSize() const { return size_; }
 
         //! Return age of sound (for caching)
@@ -47,6 +63,8 @@ namespace OpenALAudio
         std::string name_;
         //! OpenAL handle
         ALuint handle_;
+        //! Ogg Vorbis data, if streamed
+        VorbisDataPtr stream_data_;
         //! Total size of audio data
         uint size_;    
         //! Age of sound (resetted when last accessed)
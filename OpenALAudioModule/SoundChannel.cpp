@@ -3,6 +3,7 @@
 #include "StableHeaders.h"
 #include "OpenALAudioModule.h"
 #include "SoundChannel.h"
+#include "CoreException.h"
 
 namespace OpenALAudio
 {
@@ -10,8 +11,21 @@ namespace OpenALAudio
     static const Real DEFAULT_ROLLOFF = 2.0f;
     static const Real DEFAULT_INNER_RADIUS = 1.0f;
     static const Real DEFAULT_OUTER_RADIUS = 50.0f;
+    //! Number of OpenAL buffers a streamed sound is queued in
+    static const uint STREAM_BUFFERS = 4;
+    //! Size of a decoded chunk of a streamed sound in bytes, a multiple of the sample size
+    static const uint STREAM_CHUNK_SIZE = 65536;
     
-    SoundChannel::SoundChannel(Foundation::SoundServiceInterface::SoundType type) :
+    //! Decodes the next chunk of a streamed sound. Run in the task pool.
+    static VorbisDataPtr DecodeChunk(VorbisStreamPtr stream, bool loop)
+    {
+        VorbisDataPtr chunk(new std::vector<u8>());
+        chunk->reserve(STREAM_CHUNK_SIZE);
+        stream->Decode(*chunk, STREAM_CHUNK_SIZE, loop);
+        return chunk;
+    }
+    
+    SoundChannel::SoundChannel(Foundation::SoundServiceInterface::SoundType type, Foundation::TaskPool* task_pool) :
         type_(type),
         handle_(0),
         pitch_(1.0f),
@@ -25,7 +39,11 @@ namespace OpenALAudio
         positional_(false),
         looped_(false),
         buffered_mode_(false),
-        state_(Foundation::SoundServiceInterface::Stopped)
+        state_(Foundation::SoundServiceInterface::Stopped),
+        task_pool_(task_pool),
+        stream_format_(AL_FORMAT_MONO16),
+        decoding_(false),
+        stream_ended_(false)
     { 
     }
     
@@ -40,6 +58,7 @@ namespace OpenALAudio
         SetAttenuatedGain();
         QueueBuffers();
         UnqueueBuffers();
+        UpdateStream();
         
         if (state_ == Foundation::SoundServiceInterface::Playing)
         {
@@ -55,7 +74,8 @@ namespace OpenALAudio
                     {
                         state_ = Foundation::SoundServiceInterface::Pending;
                     }
-                    else
+                    // A stream that ran out of decoded data is restarted when the next chunk is queued
+                    else if (!stream_ || stream_ended_)
                         state_ = Foundation::SoundServiceInterface::Stopped;
                 }
             }
@@ -139,6 +159,7 @@ namespace OpenALAudio
             alSourcei(handle_, AL_BUFFER, 0);
         }
         
+        StopStream();
         pending_sounds_.clear();
         playing_sounds_.clear();
         
@@ -149,6 +170,8 @@ namespace OpenALAudio
     {   
         const static std::string empty;
         
+        if (stream_sound_)
+            return stream_sound_->GetName();
         if (playing_sounds_.size())
             return playing_sounds_[0]->GetName();
         if (pending_sounds_.size())
@@ -178,7 +201,8 @@ namespace OpenALAudio
             enable = false;
         
         looped_ = enable;
-        if (handle_)
+        // A stream loops by decoding from the start again, as the source would loop only the queued buffers
+        if (handle_ && !stream_)
             alSourcei(handle_, AL_LOOPING, looped_ ? AL_TRUE : AL_FALSE);
     }
     
@@ -282,7 +306,7 @@ namespace OpenALAudio
         // See that we do have waiting sounds and they're ready to play
         if (!pending_sounds_.size())
             return;
-        if ((*pending_sounds_.begin())->GetHandle() == 0)
+        if (!(*pending_sounds_.begin())->IsLoaded())
             return;
         
         // Create source now if did not exist already
@@ -293,6 +317,16 @@ namespace OpenALAudio
             return;
         }
         
+        // A streamed sound is played alone, and queued a chunk at a time by UpdateStream()
+        SoundPtr first_sound = *pending_sounds_.begin();
+        if (first_sound->IsStreamed())
+        {
+            pending_sounds_.clear();
+            if (!StartStream(first_sound))
+                state_ = Foundation::SoundServiceInterface::Stopped;
+            return;
+        }
+        
         bool queued = false;
         
         // Buffer pending sounds, move them to playing vector
@@ -353,7 +387,12 @@ namespace OpenALAudio
             {
                 ALuint buffer = 0;
                 alSourceUnqueueBuffers(handle_, 1, &buffer);
-                if (buffer)
+                if (buffer && stream_)
+                {
+                    // Played stream buffers are refilled
+                    free_stream_buffers_.push_back(buffer);
+                }
+                else if (buffer)
                 {
                     // See if we find matching buffer from the sounds vector.
                     // If found, erase so that the sound may be freed if not used elsewhere
@@ -370,4 +409,118 @@ namespace OpenALAudio
         }
     }
     
+    bool SoundChannel::StartStream(SoundPtr sound)
+    {
+        VorbisStreamPtr stream(new VorbisStream(sound->GetStreamData()));
+        if (!stream->Open())
+            return false;
+        
+        stream_buffers_.resize(STREAM_BUFFERS);
+        alGetError();
+        alGenBuffers(STREAM_BUFFERS, &stream_buffers_[0]);
+        if (alGetError() != AL_NONE)
+        {
+            OpenALAudioModule::LogError("Could not create OpenAL stream buffers");
+            stream_buffers_.clear();
+            return false;
+        }
+        free_stream_buffers_ = stream_buffers_;
+        
+        stream_sound_ = sound;
+        stream_ = stream;
+        stream_format_ = stream->IsStereo() ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16;
+        decoding_ = false;
+        stream_ended_ = false;
+        
+        alSourceStop(handle_);
+        alSourcei(handle_, AL_BUFFER, 0);
+        alSourcei(handle_, AL_LOOPING, AL_FALSE);
+        return true;
+    }
+    
+    void SoundChannel::UpdateStream()
+    {
+        if (!stream_ || !handle_)
+            return;
+        
+        // Keep the sound in the cache while it plays
+        stream_sound_->ResetAge();
+        
+        if (decoding_ && pending_chunk_.IsReady())
+        {
+            decoding_ = false;
+            VorbisDataPtr chunk;
+            try
+            {
+                chunk = pending_chunk_.Get();
+            }
+            catch (Exception& e)
+            {
+                OpenALAudioModule::LogError("Could not decode streamed sound " + stream_sound_->GetName() + ": " + e.what());
+            }
+            pending_chunk_ = Foundation::TaskFuture<VorbisDataPtr>();
+            QueueChunk(chunk);
+        }
+        
+        // Decode the next chunk while there are free buffers. Without a task pool, all of them are filled right away.
+        while (!decoding_ && !stream_ended_ && free_stream_buffers_.size())
+        {
+            if (task_pool_)
+            {
+                pending_chunk_ = task_pool_->Submit<VorbisDataPtr>(boost::bind(&DecodeChunk, stream_, looped_));
+                decoding_ = true;
+            }
+            else
+                QueueChunk(DecodeChunk(stream_, looped_));
+        }
+    }
+    
+    void SoundChannel::QueueChunk(VorbisDataPtr chunk)
+    {
+        // A short chunk is the end of the stream
+        if (!chunk || chunk->size() < STREAM_CHUNK_SIZE)
+            stream_ended_ = true;
+        if (!chunk || chunk->empty() || free_stream_buffers_.empty())
+        {
+            // If nothing was decoded, there is nothing to play
+            if (stream_ended_ && state_ == Foundation::SoundServiceInterface::Pending)
+                state_ = Foundation::SoundServiceInterface::Stopped;
+            return;
+        }
+        
+        ALuint buffer = free_stream_buffers_.back();
+        alGetError();
+        alBufferData(buffer, stream_format_, &(*chunk)[0], chunk->size(), stream_->GetFrequency());
+        alSourceQueueBuffers(handle_, 1, &buffer);
+        ALenum error = alGetError();
+        if (error != AL_NONE)
+        {
+            OpenALAudioModule::LogError("Could not queue OpenAL stream buffer: " + ToString<int>(error));
+            stream_ended_ = true;
+            return;
+        }
+        free_stream_buffers_.pop_back();
+        
+        // Start playback on the first chunk, and restart it if decoding fell behind
+        ALint playing;
+        alGetSourcei(handle_, AL_SOURCE_STATE, &playing);
+        if (playing != AL_PLAYING)
+            alSourcePlay(handle_);
+        state_ = Foundation::SoundServiceInterface::Playing;
+    }
+    
+    void SoundChannel::StopStream()
+    {
+        // The source has been stopped and its queue cleared, so the buffers can be deleted. A chunk still being decoded
+        // finishes in the task pool and is dropped.
+        if (stream_buffers_.size())
+            alDeleteBuffers(stream_buffers_.size(), &stream_buffers_[0]);
+        stream_buffers_.clear();
+        free_stream_buffers_.clear();
+        pending_chunk_ = Foundation::TaskFuture<VorbisDataPtr>();
+        decoding_ = false;
+        stream_ended_ = false;
+        stream_.reset();
+        stream_sound_.reset();
+    }
 }
\ No newline at end of file
@@ -4,15 +4,22 @@
 
 #include "SoundServiceInterface.h"
 #include "Sound.h"
+#include "TaskPool.h"
 
 namespace OpenALAudio
 {
     //! An OpenAL sound channel (source)
+    /*! Streamed sounds are decoded a chunk at a time in the task pool, into a small ring of OpenAL buffers that are
+        queued to the source and recycled once played. Playback starts after the first chunk.
+     */
     class SoundChannel
     {
     public:
         //! Constructor.
-        SoundChannel(Foundation::SoundServiceInterface::SoundType type);
+        /*! \param type Sound type
+            \param task_pool Task pool for decoding streamed sounds. If null, they are decoded in Update().
+         */
+        SoundChannel(Foundation::SoundServiceInterface::SoundType type, Foundation::TaskPool* task_pool = 0);
         //! Destructor.
         ~SoundChannel();
         
@@ -55,6 +62,14 @@ namespace OpenALAudio
         void QueueBuffers();
         //! Remove processed buffers
         void UnqueueBuffers();
+        //! Start streaming a sound
+        bool StartStream(SoundPtr sound);
+        //! Queue decoded chunks of the streamed sound and request more
+        void UpdateStream();
+        //! Queue a decoded chunk of the streamed sound to a free stream buffer, and play
+        void QueueChunk(VorbisDataPtr chunk);
+        //! Stop streaming and delete the stream buffers
+        void StopStream();
         //! Create OpenAL source if one does not exist yet
         bool CreateSource();
         //! Delete OpenAL source
@@ -98,6 +113,24 @@ namespace OpenALAudio
         Vector3df position_;
         //! State 
         Foundation::SoundServiceInterface::SoundState state_;
+        //! Task pool for decoding streamed sounds
+        Foundation::TaskPool* task_pool_;
+        //! Streamed sound, null if not streaming
+        SoundPtr stream_sound_;
+        //! Decoder of the streamed sound
+        VorbisStreamPtr stream_;
+        //! OpenAL format of the streamed sound
+        ALenum stream_format_;
+        //! Stream buffers
+        std::vector<ALuint> stream_buffers_;
+        //! Stream buffers not queued to the source
+        std::vector<ALuint> free_stream_buffers_;
+        //! Chunk being decoded
+        Foundation::TaskFuture<VorbisDataPtr> pending_chunk_;
+        //! Whether a chunk is being decoded
+        bool decoding_;
+        //! Whether the whole stream has been decoded
+        bool stream_ended_;
     };
     
     typedef boost::shared_ptr<SoundChannel> SoundChannelPtr;
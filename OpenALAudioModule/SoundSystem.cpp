@@ -19,6 +19,7 @@
 namespace OpenALAudio
 {
     const uint DEFAULT_SOUND_CACHE_SIZE = 32 * 1024 * 1024;
+    const uint DEFAULT_STREAM_THRESHOLD = 1024 * 1024;
     const f64 CACHE_CHECK_INTERVAL = 1.0;
     
     SoundSystem::SoundSystem(Foundation::Framework *framework) : 
@@ -31,10 +32,12 @@ namespace OpenALAudio
         capture_sample_size_(0),
         next_channel_id_(0),
         sound_cache_size_(DEFAULT_SOUND_CACHE_SIZE),
+        stream_threshold_(DEFAULT_STREAM_THRESHOLD),
         update_time_(0),
         listener_position_(0.0, 0.0, 0.0)
     {
         sound_cache_size_ = framework_->GetDefaultConfig().DeclareSetting("SoundSystem", "sound_cache_size", DEFAULT_SOUND_CACHE_SIZE);
+        stream_threshold_ = framework_->GetDefaultConfig().DeclareSetting("SoundSystem", "stream_threshold", DEFAULT_STREAM_THRESHOLD);
         
         // By default, initialize default playback device
         Initialize();
@@ -42,6 +45,7 @@ namespace OpenALAudio
         // Create vorbis decoder thread task and let the framework thread task manager handle it
         VorbisDecoder* decoder = new VorbisDecoder();
         framework_->GetThreadTaskManager()->AddThreadTask(Foundation::ThreadTaskPtr(decoder));
+        framework_->GetThreadTaskManager()->SetResultHandler("VorbisDecoder", boost::bind(&SoundSystem::HandleDecodeResult, this, _1));
         
         // Set default master gains for sound types
         master_gain_ = framework_->GetDefaultConfig().DeclareSetting("SoundSystem", "master_gain", 1.0f);
@@ -52,6 +56,7 @@ namespace OpenALAudio
 
     SoundSystem::~SoundSystem()
     {
+        framework_->GetThreadTaskManager()->RemoveResultHandler("VorbisDecoder");
         Uninitialize();
 
         framework_->GetDefaultConfig().SetSetting<Real>("SoundSystem", "master_gain", master_gain_);
@@ -229,7 +234,7 @@ namespace OpenALAudio
         if (i == channels_.end())
         {
             i = channels_.insert(
-                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type)))).first;
+                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type, framework_->GetThreadTaskManager()->GetTaskPool())))).first;
         }
         
         i->second->SetMasterGain(sound_master_gain_[type] * master_gain_);
@@ -252,7 +257,7 @@ namespace OpenALAudio
         if (i == channels_.end())
         {
             i = channels_.insert(
-                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type)))).first;
+                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type, framework_->GetThreadTaskManager()->GetTaskPool())))).first;
         }
        
         i->second->SetMasterGain(sound_master_gain_[type] * master_gain_);
@@ -272,7 +277,7 @@ namespace OpenALAudio
         if (i == channels_.end())
         {
             i = channels_.insert(
-                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type)))).first;
+                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type, framework_->GetThreadTaskManager()->GetTaskPool())))).first;
         }
         
         i->second->SetMasterGain(sound_master_gain_[type] * master_gain_);
@@ -291,7 +296,7 @@ namespace OpenALAudio
         if (i == channels_.end())
         {
             i = channels_.insert(
-                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type)))).first;
+                std::pair<sound_id_t, SoundChannelPtr>(GetNextSoundChannelID(), SoundChannelPtr(new SoundChannel(type, framework_->GetThreadTaskManager()->GetTaskPool())))).first;
         }
         
         i->second->SetMasterGain(sound_master_gain_[type] * master_gain_);
@@ -487,6 +492,7 @@ namespace OpenALAudio
 
         VorbisDecodeRequestPtr new_request(new VorbisDecodeRequest());
         new_request->name_ = name;
+        new_request->stream_threshold_ = stream_threshold_;
     
         std::filebuf *pbuf = file.rdbuf();
         size_t size = pbuf->pubseekoff(0, std::ios::end, std::ios::in);
@@ -499,13 +505,11 @@ namespace OpenALAudio
         return true;
     }
     
-    bool SoundSystem::HandleTaskEvent(event_id_t event_id, Foundation::EventDataInterface* data)
+    void SoundSystem::HandleDecodeResult(Foundation::ThreadTaskResultPtr task_result)
     {
-        if (event_id != Task::Events::REQUEST_COMPLETED)
-            return false;
-        VorbisDecodeResult* result = dynamic_cast<VorbisDecodeResult*>(data);
-        if (!result || result->task_description_ != "VorbisDecoder")
-            return false;
+        VorbisDecodeResult* result = dynamic_cast<VorbisDecodeResult*>(task_result.get());
+        if (!result)
+            return;
 
         // Check if this was for a resource request, if so, stuff the data
         for (;;)
@@ -542,15 +546,19 @@ namespace OpenALAudio
         // If we can find the sound from our cache, and the result contains data, stuff the data into the sound
         SoundMap::iterator i = sounds_.find(result->name_);
         if (i == sounds_.end())
-            return false;
+            return;
         // If sound already has data, do not stuff again
         if (i->second->GetSize() != 0)
-            return true;
+            return;
+        if (result->stream_data_)
+        {
+            i->second->SetStreamData(result->stream_data_);
+            return;
+        }
         if (!result->buffer_.data_.size())
-            return true;
+            return;
         
         i->second->LoadFromBuffer(result->buffer_);
-        return true;
     }
     
     bool SoundSystem::HandleAssetEvent(event_id_t event_id, Foundation::EventDataInterface* data)
@@ -583,6 +591,9 @@ namespace OpenALAudio
             
             VorbisDecodeRequestPtr new_request(new VorbisDecodeRequest());
             new_request->name_ = event_data->asset_id_;
+            // Resource requests want the decoded data
+            if (!resource_request)
+                new_request->stream_threshold_ = stream_threshold_;
             new_request->buffer_.resize(event_data->asset_->GetSize());
             //! \todo use asset data directly instead of copying to decode request buffer
             memcpy(&new_request->buffer_[0], event_data->asset_->GetData(), event_data->asset_->GetSize());
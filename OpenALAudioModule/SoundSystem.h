@@ -5,6 +5,7 @@
 #include "SoundServiceInterface.h"
 #include "Sound.h"
 #include "SoundChannel.h"
+#include "ThreadTask.h"
 
 #include <AL/al.h>
 #include <AL/alc.h>
@@ -205,13 +206,13 @@ namespace OpenALAudio
         //! Handles an asset event. Called from OpenALAudioModule.
         bool HandleAssetEvent(event_id_t event_id, Foundation::EventDataInterface* data);
         
-        //! Handles a thread task event. Called from OpenALAudioModule.
-        bool HandleTaskEvent(event_id_t event_id, Foundation::EventDataInterface* data);
-        
         //! Returns initialized status
         bool IsInitialized() const { return initialized_; }
 
     private:
+        //! Handles a vorbis decode result. Called from the framework's thread task manager.
+        void HandleDecodeResult(Foundation::ThreadTaskResultPtr task_result);
+        
         //! Uninitialize OpenAL sound
         void Uninitialize();
         
@@ -249,8 +250,10 @@ namespace OpenALAudio
         SoundChannelMap channels_;
         //! Currently loaded sounds
         SoundMap sounds_;
-        //! Sound cache size
+        //! Sound cache size. Streamed sounds count only their encoded data.
         uint sound_cache_size_;
+        //! Decoded size above which Ogg Vorbis sounds are streamed instead of decoded at once
+        uint stream_threshold_;
         //! Update timer (for cache)
         f64 update_time_;
         //! Next channel id
@@ -7,6 +7,8 @@
 
 #include <vorbis/vorbisfile.h>
 
+#include <algorithm>
+
 namespace OpenALAudio
 {
     static const int MAX_DECODE_SIZE = 16384;
@@ -86,28 +88,118 @@ namespace OpenALAudio
         return source->Tell();
     }
 
-    VorbisDecoder::VorbisDecoder() :
-        Foundation::ThreadTask("VorbisDecoder")
+    VorbisStream::VorbisStream(VorbisDataPtr data) :
+        data_(data),
+        file_(0),
+        frequency_(0),
+        stereo_(false),
+        decoded_size_(0)
     {
     }
-    
-    void VorbisDecoder::Work()
+
+    VorbisStream::~VorbisStream()
     {
-        while (ShouldRun())
+        if (file_)
         {
-            WaitForRequests();
-            
-            VorbisDecodeRequestPtr request = GetNextRequest<VorbisDecodeRequest>();
-            if (request)
+            ov_clear(file_);
+            delete file_;
+        }
+    }
+
+    bool VorbisStream::Open()
+    {
+        if (file_ || !data_ || data_->empty())
+            return file_ != 0;
+
+        source_.reset(new OggMemDataSource(&(*data_)[0], data_->size()));
+        file_ = new OggVorbis_File;
+
+        ov_callbacks cb;
+        cb.read_func = &OggReadCallback;
+        cb.seek_func = &OggSeekCallback;
+        cb.tell_func = &OggTellCallback;
+        cb.close_func = 0;
+
+        int ret = ov_open_callbacks(source_.get(), file_, 0, 0, cb);
+        if (ret < 0)
+        {
+            OpenALAudioModule::LogError("Not ogg vorbis format");
+            // A failed open leaves the file cleared already
+            delete file_;
+            file_ = 0;
+            return false;
+        }
+
+        vorbis_info* vi = ov_info(file_, -1);
+        if (!vi)
+        {
+            OpenALAudioModule::LogError("No ogg vorbis stream info");
+            ov_clear(file_);
+            delete file_;
+            file_ = 0;
+            return false;
+        }
+
+        frequency_ = vi->rate;
+        stereo_ = (vi->channels == 2);
+        ogg_int64_t samples = ov_pcm_total(file_, -1);
+        if (samples > 0)
+            decoded_size_ = (uint)std::min<ogg_int64_t>(samples * vi->channels * 2, (uint)-1);
+        return true;
+    }
+
+    uint VorbisStream::Decode(std::vector<u8>& data, uint max_bytes, bool loop)
+    {
+        if (!file_)
+            return 0;
+
+        uint start = data.size();
+        data.resize(start + max_bytes);
+        uint decoded_bytes = 0;
+        bool rewound = false;
+        while (decoded_bytes < max_bytes)
+        {
+            int bitstream;
+            long ret = ov_read(file_, (char*)&data[start + decoded_bytes], max_bytes - decoded_bytes, 0, 2, 1, &bitstream);
+            if (ret == OV_HOLE)
+                continue;
+            if (ret > 0)
             {
-                {
-                    PROFILE(VorbisDecoder_Decode);
-                    PerformDecode(request);
-                }
+                decoded_bytes += ret;
+                rewound = false;
+                continue;
             }
 
-            RESETPROFILER
+            // At the end, or a read error. Loop from the start, unless the start gives nothing either.
+            if (!loop || rewound || ov_pcm_seek(file_, 0) != 0)
+                break;
+            rewound = true;
+        }
+
+        data.resize(start + decoded_bytes);
+        return decoded_bytes;
+    }
+
+    VorbisDecoder::VorbisDecoder() :
+        Foundation::ThreadTask("VorbisDecoder", Foundation::ThreadTask::Pooled)
+    {
+    }
+    
+    VorbisDecoder::~VorbisDecoder()
+    {
+        Stop();
+    }
+    
+    void VorbisDecoder::ProcessRequest(Foundation::ThreadTaskRequestPtr request)
+    {
+        VorbisDecodeRequestPtr decode_request = boost::dynamic_pointer_cast<VorbisDecodeRequest>(request);
+        if (decode_request)
+        {
+            PROFILE(VorbisDecoder_Decode);
+            PerformDecode(decode_request);
         }
+
+        RESETPROFILER
     }
     
     void VorbisDecoder::PerformDecode(VorbisDecodeRequestPtr request)
@@ -122,60 +214,40 @@ namespace OpenALAudio
         result->buffer_.sixteenbit_ = true;
         result->buffer_.stereo_ = false;
         
-        OggVorbis_File vf;
-        OggMemDataSource src(&request->buffer_[0], request->buffer_.size());
-        
-        ov_callbacks cb;
-        cb.read_func = &OggReadCallback;
-        cb.seek_func = &OggSeekCallback;
-        cb.tell_func = &OggTellCallback;
-        cb.close_func = 0;
-                       
-        int ret = ov_open_callbacks(&src, &vf, 0, 0, cb);
-        if (ret < 0)
+        VorbisDataPtr data(new std::vector<u8>());
+        data->swap(request->buffer_);
+        VorbisStream stream(data);
+        if (!stream.Open())
         {
-            OpenALAudioModule::LogError("Not ogg vorbis format");
-            ov_clear(&vf);
             QueueResult<VorbisDecodeResult>(result);
             return;
         }
+
+        std::ostringstream msg;
+        msg << "Decoding ogg vorbis stream with " << (stream.IsStereo() ? 2 : 1) << " channels, frequency " << stream.GetFrequency(); 
+        OpenALAudioModule::LogDebug(msg.str()); 
         
-        vorbis_info* vi = ov_info(&vf, -1);
-        if (vi)
-        {
-            std::ostringstream msg;
-            msg << "Decoding ogg vorbis stream with " << vi->channels << " channels, frequency " << vi->rate; 
-            OpenALAudioModule::LogDebug(msg.str()); 
-            
-            result->buffer_.frequency_ = vi->rate;
-            result->buffer_.stereo_ = (vi->channels == 2); 
-        }
-        else
+        result->buffer_.frequency_ = stream.GetFrequency();
+        result->buffer_.stereo_ = stream.IsStereo();
+
+        // Large sounds are decoded while playing
+        if (request->stream_threshold_ && stream.GetDecodedSize() > request->stream_threshold_)
         {
-            OpenALAudioModule::LogError("No ogg vorbis stream info");
-            ov_clear(&vf);
+            OpenALAudioModule::LogDebug("Streaming " + ToString(stream.GetDecodedSize()) + " bytes of ogg vorbis sound data");
+            result->stream_data_ = data;
             QueueResult<VorbisDecodeResult>(result);
             return;
         }
- 
-        uint decoded_bytes = 0;
-        for (;;)
-        {
-            result->buffer_.data_.resize(decoded_bytes + MAX_DECODE_SIZE);
-            int bitstream;
-            long ret = ov_read(&vf, (char*)&result->buffer_.data_[decoded_bytes], MAX_DECODE_SIZE, 0, 2, 1, &bitstream);
-            if (ret <= 0)
-                break;
-            decoded_bytes += ret;
-        }
-        
-        result->buffer_.data_.resize(decoded_bytes);
+
+        // Reserve the whole size if known, and read in fixed steps until the end anyway
+        result->buffer_.data_.reserve(stream.GetDecodedSize());
+        while (stream.Decode(result->buffer_.data_, MAX_DECODE_SIZE, false) == (uint)MAX_DECODE_SIZE)
+            ;
         
-        std::ostringstream msg;
-        msg << "Decoded " << decoded_bytes << " bytes of ogg vorbis sound data";
-        OpenALAudioModule::LogDebug(msg.str());
+        std::ostringstream decoded_msg;
+        decoded_msg << "Decoded " << result->buffer_.data_.size() << " bytes of ogg vorbis sound data";
+        OpenALAudioModule::LogDebug(decoded_msg.str());
          
-        ov_clear(&vf);
         QueueResult<VorbisDecodeResult>(result);
     }
 }
\ No newline at end of file
@@ -5,16 +5,82 @@
 #include "SoundServiceInterface.h"
 #include "ThreadTask.h"
 
+#include <boost/scoped_ptr.hpp>
+
+struct OggVorbis_File;
+
 namespace OpenALAudio
 {
+    class OggMemDataSource;
+
+    //! Shared Ogg Vorbis or decoded audio data
+    typedef boost::shared_ptr<std::vector<u8> > VorbisDataPtr;
+
+    //! Incremental decoder of an Ogg Vorbis stream in memory
+    /*! Decodes to 16bit signed audio. A stream may be decoded in a worker thread, as long as one thread uses it at a time.
+     */
+    class VorbisStream
+    {
+    public:
+        //! Constructor
+        /*! \param data Vorbis datastream. Kept alive by the stream.
+         */
+        VorbisStream(VorbisDataPtr data);
+
+        //! Destructor
+        ~VorbisStream();
+
+        //! Opens the stream and reads its format
+        /*! \return false if the data is not an Ogg Vorbis stream
+         */
+        bool Open();
+
+        //! Decodes the next part of the stream
+        /*! \param data Vector the decoded audio is appended to
+            \param max_bytes Maximum amount to decode
+            \param loop Whether to continue from the start when the end is reached
+            \return Amount of bytes decoded, which is less than max_bytes only at the end of the stream
+         */
+        uint Decode(std::vector<u8>& data, uint max_bytes, bool loop);
+
+        //! Returns frequency
+        uint GetFrequency() const { return frequency_; }
+
+        //! Returns whether the stream is stereo
+        bool IsStereo() const { return stereo_; }
+
+        //! Returns size of the whole stream decoded, or 0 if not known
+        uint GetDecodedSize() const { return decoded_size_; }
+
+    private:
+        //! Vorbis datastream
+        VorbisDataPtr data_;
+        //! Read position in the datastream
+        boost::scoped_ptr<OggMemDataSource> source_;
+        //! Vorbisfile state, null if not open
+        OggVorbis_File* file_;
+        //! Frequency
+        uint frequency_;
+        //! Stereo flag
+        bool stereo_;
+        //! Decoded size
+        uint decoded_size_;
+    };
+
+    typedef boost::shared_ptr<VorbisStream> VorbisStreamPtr;
+
     //! Ogg vorbis decode request
     class VorbisDecodeRequest : public Foundation::ThreadTaskRequest
     {
     public:
+        VorbisDecodeRequest() : stream_threshold_(0) {}
+
         //! Name/id of sound
         std::string name_;
         //! Vorbis datastream
         std::vector<u8> buffer_;
+        //! Decoded size above which the sound is left for streaming instead of decoding. 0 to always decode.
+        uint stream_threshold_;
     };
     
     class VorbisDecodeResult : public Foundation::ThreadTaskResult
@@ -23,31 +89,36 @@ namespace OpenALAudio
         //! Name/id of sound
         std::string name_;
         //! Decoded audio data buffer. Will always be 16bit signed
-        /*! If decode failed, will be zero size
+        /*! If decode failed, or the sound is streamed, will be zero size
          */
         Foundation::SoundServiceInterface::SoundBuffer buffer_;
+        //! Vorbis datastream, if the sound is too large to decode at once and should be streamed
+        VorbisDataPtr stream_data_;
     };
     
     typedef boost::shared_ptr<VorbisDecodeRequest> VorbisDecodeRequestPtr;
     typedef boost::shared_ptr<VorbisDecodeResult> VorbisDecodeResultPtr;
 
-    //! Ogg Vorbis decoder that runs in a thread and serves decode requests, used by SoundSystem
+    //! Ogg Vorbis decoder that serves decode requests in the framework's task pool, used by SoundSystem
+    /*! Several sounds can be decoded in parallel.
+     */
     class VorbisDecoder : public Foundation::ThreadTask
     {
     public:
         //! Constructor
         VorbisDecoder();
         
-        //! Work function
-        virtual void Work();
+        //! Destructor
+        virtual ~VorbisDecoder();
+        
+        //! Decodes a request. Called from a task pool worker.
+        virtual void ProcessRequest(Foundation::ThreadTaskRequestPtr request);
         
     private:
         //! perform a decode & queue result
         /*! \param request decode request to serve
          */
         void PerformDecode(VorbisDecodeRequestPtr request);
-        
-        uint decodes_per_frame_;
     };
 }
 #endif
\ No newline at end of file
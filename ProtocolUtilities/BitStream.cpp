@@ -5,55 +5,69 @@
 
 namespace ProtocolUtilities
 {
-    //! static variables must be initialized within the compilation unit (not header)
-    const int BitStream::num_bits_in_elem_ = 8;
-
     BitStream::BitStream(const void *data, size_t num_bytes)
-        :data_(reinterpret_cast<const u8*>(data)), num_elems_((num_bytes*num_bits_in_elem_ + num_bits_in_elem_ - 1) / num_bits_in_elem_), elem_ofs_(0), bit_ofs_(0)
+        :data_(reinterpret_cast<const u8*>(data)), num_bytes_(num_bytes), num_bits_(num_bytes * 8), bit_pos_(0)
     {
         assert(data_);
     }
 
-    void BitStream::ResetPosition()
+    boost::uint64_t BitStream::LoadWord(size_t byte_ofs) const
     {
-        elem_ofs_ = 0;
-        bit_ofs_ = 0;
+        boost::uint64_t word = 0;
+        if (byte_ofs + 8 <= num_bytes_)
+        {
+            // Compilers turn this into a single load and byte swap
+            const u8 *src = data_ + byte_ofs;
+            word = ((boost::uint64_t)src[0] << 56) | ((boost::uint64_t)src[1] << 48) | ((boost::uint64_t)src[2] << 40) |
+                ((boost::uint64_t)src[3] << 32) | ((boost::uint64_t)src[4] << 24) | ((boost::uint64_t)src[5] << 16) |
+                ((boost::uint64_t)src[6] << 8) | (boost::uint64_t)src[7];
+        }
+        else
+        {
+            for(size_t i = 0; i < 8; ++i)
+                if (byte_ofs + i < num_bytes_)
+                    word |= (boost::uint64_t)data_[byte_ofs + i] << (56 - 8 * i);
+        }
+        return word;
+    }
+
+    u32 BitStream::PeekBits(int count) const
+    {
+        assert(count >= 0 && count <= 32);
+        if (count <= 0 || bit_pos_ >= num_bits_)
+            return 0;
+
+        // The field starts at most 7 bits into the word, so the 64 bits loaded always contain it
+        boost::uint64_t word = LoadWord(bit_pos_ >> 3) << (bit_pos_ & 7);
+        return (u32)(word >> (64 - count));
     }
 
     u32 BitStream::ReadBits(int count)
     {
-        u8 data[4] = { 0 };
-        int cur_byte = 0;
-        int cur_bit = 0;
-        assert(num_bits_in_elem_ == 8);
-        int total_bits = std::min(num_bits_in_elem_, count);
-        while(count-- > 0)
+        u32 bits = PeekBits(count);
+        SkipBits(count);
+        if (count <= 8)
+            return bits;
+
+        // Place each 8 bits of the field into successive bytes of the result, starting from the least significant.
+        // A last partial byte keeps its bits in the low end.
+        u32 value = 0;
+        int shift = 0;
+        for(int remaining = count; remaining > 0; remaining -= 8, shift += 8)
         {
-            if (ReadBit()) ///\note Can optimize here - read several bits at a time instead of looping bit-per-bit.
-                data[cur_byte] |= 1 << (total_bits - 1 - cur_bit);
-            if (++cur_bit >= num_bits_in_elem_)
-            {
-                ++cur_byte;
-                cur_bit = 0;
-                total_bits = std::min(num_bits_in_elem_, count);
-            }
+            int length = std::min(8, remaining);
+            value |= ((bits >> (remaining - length)) & ((1u << length) - 1)) << shift;
         }
-        return *reinterpret_cast<u32*>(data);
+        return value;
     }
 
     bool BitStream::ReadBit()
     {
-        if (BitsLeft() == 0)
+        if (bit_pos_ >= num_bits_)
             return false;
 
-        bool bit = (data_[elem_ofs_] & (1 << (num_bits_in_elem_ - 1 - bit_ofs_))) != 0;
-        ++bit_ofs_;
-        if (bit_ofs_ >= num_bits_in_elem_)
-        {
-            bit_ofs_ = 0;
-            ++elem_ofs_;
-        }
+        bool bit = ((data_[bit_pos_ >> 3] >> (7 - (bit_pos_ & 7))) & 1) != 0;
+        ++bit_pos_;
         return bit;
     }
-
 }
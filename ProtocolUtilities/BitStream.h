@@ -5,15 +5,15 @@
 
 #include "CoreTypes.h"
 
+#include <boost/cstdint.hpp>
+#include <algorithm>
+
 namespace ProtocolUtilities
 {
     /// A stream reader utility for reading a byte array bit-by-bit.
+    /// The bits are fetched from memory 64 bits at a time, so that reading a field costs a few shifts regardless of its width.
     class BitStream
     {
-    private:
-        /// The memory is now accessed per-byte, but for optimization, one could use u32 reads.
-        static const int num_bits_in_elem_;
-
     public:
         /** Constructs a BitStream reader to the given memory area.
             \param data A pointer to the data to read. \note The memory will not be copied, but the 
@@ -28,37 +28,51 @@ namespace ProtocolUtilities
             comes directly from the way existing data is stored in the SLUDP protocol.
             \param count The number of bits to read, 0 <= count <= 32.
             \return The desired amount of bits packed in an u32, populating bits from the 
-            least-significant-bits-end of the u32. The bits are filled in most-significant-bit first. */
+            least-significant-bits-end of the u32. The bits are filled in most-significant-bit first.
+            Bits past the end of the stream read as 0. */
         u32 ReadBits(int count);
 
         /// Reads a single bit from the stream and advances the current stream position.
         /// \return The next bit in the stream, or 0 if there are no bits left in the stream.
         bool ReadBit();
 
+        /** Returns the next bits of the stream without advancing the position.
+            Unlike ReadBits(), the bits are not reordered by bytes: the first bit of the stream is the
+            most significant bit of the result. Useful for reading several flag bits at once.
+            \param count The number of bits to peek, 0 <= count <= 32.
+            \return The bits in the least-significant-bits-end of the u32. Bits past the end of the stream read as 0. */
+        u32 PeekBits(int count) const;
+
+        /// Advances the current stream position, at most to the end of the stream.
+        void SkipBits(size_t count) { bit_pos_ = std::min(bit_pos_ + count, num_bits_); }
+
         /// Resets the current stream position to the beginning of the stream.
-        void ResetPosition();
+        void ResetPosition() { bit_pos_ = 0; }
 
-        /// \return The current bit position in the stream, [0, num_elems_*num_bits_in_elem_].
-        size_t BitPos() const { return elem_ofs_ * num_bits_in_elem_ + bit_ofs_; }
+        /// \return The current bit position in the stream, [0, Size()].
+        size_t BitPos() const { return bit_pos_; }
 
-        /// \return The number of bits left in this stream, [0, num_elems_*num_bits_in_elem_].
-        size_t BitsLeft() const { return num_elems_*num_bits_in_elem_ - (elem_ofs_ * num_bits_in_elem_ + bit_ofs_); }
+        /// \return The number of bits left in this stream, [0, Size()].
+        size_t BitsLeft() const { return num_bits_ - bit_pos_; }
 
-        /// \return num_elems_*num_bits_in_elem_ - the number of total bits in this stream.
-        size_t Size() const { return num_elems_*num_bits_in_elem_; }
+        /// \return The number of total bits in this stream.
+        size_t Size() const { return num_bits_; }
 
     private:
+        /// Returns the 8 bytes starting at the given byte offset as a big endian word. Bytes past the end of the stream are 0.
+        boost::uint64_t LoadWord(size_t byte_ofs) const;
+
         /// The actual data buffer, not owned by BitStream.
         const u8 *data_;
 
-        /// The number of total elements in the buffer.
-        size_t num_elems_;
+        /// The number of bytes in the buffer.
+        size_t num_bytes_;
 
-        /// The element offset the read pointer is currently at.
-        int elem_ofs_;
+        /// The number of bits in the buffer.
+        size_t num_bits_;
 
-        /// The bit index of the current element the read pointer is at. Runs up from 0 to num_bits_in_elem_-1.
-        int bit_ofs_;
+        /// The bit position the read pointer is currently at.
+        size_t bit_pos_;
     };
 }
 
@@ -0,0 +1,42 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+/// Command line tool that regenerates RealXtend/RexProtocolMessages.h and .cpp from the message template.
+/// Run by the ProtocolUtilities build whenever the template changes.
+/// Usage: MessageCodecGenerator <message_template.msg> <output header> <output source>
+
+#include "StableHeaders.h"
+#include "NetworkMessages/NetMessageList.h"
+
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char **argv)
+{
+    if (argc != 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " <message_template.msg> <output header> <output source>" << std::endl;
+        return 1;
+    }
+
+    // NetMessageList does not report a missing template, so check it here to avoid writing empty codecs.
+    std::ifstream templateFile(argv[1]);
+    if (!templateFile)
+    {
+        std::cerr << "Could not open message template " << argv[1] << std::endl;
+        return 1;
+    }
+    templateFile.close();
+
+    ProtocolUtilities::NetMessageList messageList(argv[1]);
+    messageList.GenerateCodecFiles(argv[2], argv[3]);
+
+    std::ifstream header(argv[2]);
+    std::ifstream source(argv[3]);
+    if (!header || !source)
+    {
+        std::cerr << "Could not write the message codecs to " << argv[2] << " and " << argv[3] << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -5,6 +5,11 @@
 
 #include "NetworkConnection.h"
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <cstring>
+#endif
+
 using namespace std;
 
 namespace ProtocolUtilities
@@ -40,6 +45,57 @@ int NetworkConnection::ReceiveBytes(uint8_t *bytes, size_t maxCount)
     return socket.receiveBytes(bytes, numBytes);
 }
 
+bool NetworkConnection::WaitForPackets(int timeoutMilliseconds)
+{
+    if (!bOpen)
+        return false;
+
+    return socket.poll(Poco::Timespan(timeoutMilliseconds * 1000), Poco::Net::Socket::SELECT_READ);
+}
+
+size_t NetworkConnection::ReceiveDatagrams(InboundDatagram **datagrams, size_t count)
+{
+    if (!bOpen || count == 0)
+        return 0;
+
+#if defined(__linux__) && defined(MSG_WAITFORONE)
+    // Read the whole batch with a single system call.
+    const size_t cMaxBatch = 64;
+    if (count > cMaxBatch)
+        count = cMaxBatch;
+
+    mmsghdr headers[cMaxBatch];
+    iovec buffers[cMaxBatch];
+    memset(headers, 0, sizeof(mmsghdr) * count);
+    for(size_t i = 0; i < count; ++i)
+    {
+        buffers[i].iov_base = datagrams[i]->data;
+        buffers[i].iov_len = InboundDatagram::cMaxPayload;
+        headers[i].msg_hdr.msg_iov = &buffers[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int received = recvmmsg(socket.impl()->sockfd(), headers, (unsigned int)count, MSG_DONTWAIT, 0);
+    if (received <= 0)
+        return 0;
+
+    for(int i = 0; i < received; ++i)
+        datagrams[i]->size = headers[i].msg_len;
+    return received;
+#else
+    size_t received = 0;
+    while(received < count && socket.available() > 0)
+    {
+        int numBytes = socket.receiveBytes(datagrams[received]->data, InboundDatagram::cMaxPayload);
+        if (numBytes <= 0)
+            break;
+        datagrams[received]->size = numBytes;
+        ++received;
+    }
+    return received;
+#endif
+}
+
 void NetworkConnection::SendBytes(const uint8_t *bytes, size_t count)
 {
     socket.sendBytes(bytes, (int)count);
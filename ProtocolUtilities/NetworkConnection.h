@@ -4,6 +4,7 @@
 
 #include "Poco/Net/DatagramSocket.h"
 #include "RexTypes.h"
+#include "NetworkMessages/DatagramQueue.h"
 
 namespace ProtocolUtilities
 {
@@ -23,6 +24,15 @@ namespace ProtocolUtilities
         /// @return The number of bytes that was actually filled into the buffer.
         int ReceiveBytes(uint8_t *bytes, size_t maxCount);
 
+        /// Waits until there are UDP packets available or the timeout expires.
+        /// @return True if there are packets available.
+        bool WaitForPackets(int timeoutMilliseconds);
+
+        /// Reads as many datagrams as are available, up to count, with as few system calls as possible. Doesn't block.
+        /// @param datagrams The slots to read the datagrams into. The size of each slot is set.
+        /// @return The number of datagrams read.
+        size_t ReceiveDatagrams(InboundDatagram **datagrams, size_t count);
+
         /// Pushes out a packet with the given contents.
         void SendBytes(const uint8_t *bytes, size_t count);
 
@@ -0,0 +1,128 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+#ifndef incl_ProtocolUtilities_DatagramQueue_h
+#define incl_ProtocolUtilities_DatagramQueue_h
+
+#include <vector>
+#include <cassert>
+
+#include "RexTypes.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma intrinsic(_ReadWriteBarrier)
+#endif
+
+namespace ProtocolUtilities
+{
+    /// Prevents the compiler and the processor from reordering memory accesses over this point.
+    inline void DatagramQueueMemoryBarrier()
+    {
+#ifdef _MSC_VER
+        // x86 does not reorder stores with stores or loads with loads, so a compiler barrier is enough there.
+        _ReadWriteBarrier();
+#else
+        __sync_synchronize();
+#endif
+    }
+
+    /// A received UDP datagram, stored in a preallocated slot of a DatagramQueue.
+    struct InboundDatagram
+    {
+        /// The maximum size of a datagram.
+        static const size_t cMaxPayload = 2048;
+
+        /// The datagram contents.
+        uint8_t data[cMaxPayload];
+
+        /// The number of bytes in data.
+        size_t size;
+
+        /// The number of ACK datagrams the network thread sent after receiving this datagram. For statistics.
+        size_t acksSent;
+
+        /// The number of bytes in the ACK datagrams the network thread sent after receiving this datagram. For statistics.
+        size_t ackBytesSent;
+    };
+
+    /// A fixed-size ring of preallocated datagram slots, shared by exactly one producer (the network thread) and one
+    /// consumer (the main thread) without locking. The producer fills free slots in place and publishes them with
+    /// EndPush(), the consumer processes the front slot in place and returns it to the ring with Pop(). No memory is
+    /// allocated after construction.
+    class DatagramQueue
+    {
+    public:
+        /// @param capacity The number of datagram slots. Must be a power of two.
+        explicit DatagramQueue(size_t capacity)
+        :slots_(capacity), mask_(capacity - 1), head_(0), tail_(0)
+        {
+            assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+        }
+
+        /// Producer: Gets free slots for receiving datagrams into.
+        /// @param slots [out] The free slots are returned here.
+        /// @param maxCount The maximum number of slots to return.
+        /// @return The number of slots returned, 0 if the queue is full.
+        size_t BeginPush(InboundDatagram **slots, size_t maxCount)
+        {
+            const size_t head = head_;
+            const size_t tail = tail_;
+            DatagramQueueMemoryBarrier();
+
+            size_t count = slots_.size() - (head - tail);
+            if (count > maxCount)
+                count = maxCount;
+            for(size_t i = 0; i < count; ++i)
+                slots[i] = &slots_[(head + i) & mask_];
+            return count;
+        }
+
+        /// Producer: Publishes the first count slots returned by BeginPush to the consumer.
+        void EndPush(size_t count)
+        {
+            DatagramQueueMemoryBarrier();
+            head_ = head_ + count;
+        }
+
+        /// Consumer: @return The oldest datagram in the queue, or 0 if the queue is empty.
+        InboundDatagram *Front()
+        {
+            const size_t tail = tail_;
+            if (head_ == tail)
+                return 0;
+            DatagramQueueMemoryBarrier();
+            return &slots_[tail & mask_];
+        }
+
+        /// Consumer: Returns the datagram given by Front() to the free slots.
+        void Pop()
+        {
+            assert(head_ != tail_);
+            DatagramQueueMemoryBarrier();
+            tail_ = tail_ + 1;
+        }
+
+        /// @return True if there are no datagrams waiting for the consumer.
+        bool Empty() const { return head_ == tail_; }
+
+        /// Drops all queued datagrams. Only safe to call while the producer is not running.
+        void Clear() { tail_ = head_; }
+
+    private:
+        DatagramQueue(const DatagramQueue &);
+        void operator=(const DatagramQueue &);
+
+        /// The datagram slots.
+        std::vector<InboundDatagram> slots_;
+
+        /// Mask for wrapping the running indices to slot indices.
+        const size_t mask_;
+
+        /// Running index of the next slot to be published. Written only by the producer.
+        volatile size_t head_;
+
+        /// Running index of the next slot to be consumed. Written only by the consumer.
+        volatile size_t tail_;
+    };
+}
+
+#endif
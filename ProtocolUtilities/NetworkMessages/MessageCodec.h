@@ -0,0 +1,180 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+#ifndef incl_ProtocolUtilities_MessageCodec_h
+#define incl_ProtocolUtilities_MessageCodec_h
+
+#include <cstring>
+#include <cassert>
+#include <string>
+
+#include "RexTypes.h"
+#include "RexUUID.h"
+#include "Quaternion.h"
+#include "QuatUtils.h"
+#include "NetOutMessage.h"
+
+namespace ProtocolUtilities
+{
+    /// A view to a buffer inside a network message. Doesn't own or copy the data, so it is only valid as long as the
+    /// message it was decoded from.
+    struct BufferView
+    {
+        BufferView() : data(0), size(0) {}
+        BufferView(const uint8_t *data_, size_t size_) : data(data_), size(size_) {}
+
+        /// @return The buffer as a string, without the terminating zero the protocol includes in strings.
+        std::string ToString() const
+        {
+            size_t length = size;
+            while(length > 0 && data[length-1] == 0)
+                --length;
+            return std::string((const char *)data, length);
+        }
+
+        const uint8_t *data;
+        size_t size;
+    };
+
+    /// Reads message content with the layout known at compile time, without the runtime message description
+    /// NetInMessage uses. Used by the generated message codecs in RealXtend/RexProtocolMessages.h. Running past
+    /// the end of the data marks the reader invalid, after which all reads return zeroes.
+    class MessageReader
+    {
+    public:
+        /// @param data The message content after the message ID, i.e. NetInMessage::GetData().
+        MessageReader(const uint8_t *data, size_t numBytes) : pos(data), end(data + numBytes), valid(true) {}
+
+        template<typename T>
+        void Read(T &value)
+        {
+            if (!Require(sizeof(T)))
+            {
+                memset(&value, 0, sizeof(T));
+                return;
+            }
+            memcpy(&value, pos, sizeof(T));
+            pos += sizeof(T);
+        }
+
+        void Read(bool &value)
+        {
+            uint8_t byte = 0;
+            Read(byte);
+            value = byte != 0;
+        }
+
+        void Read(Quaternion &value)
+        {
+            Vector3 packed;
+            Read(packed);
+            value = UnpackQuaternionFromFloat3(packed);
+        }
+
+        /// Reads a buffer of a size fixed by the message template.
+        void ReadFixed(BufferView &value, size_t size)
+        {
+            value = BufferView(pos, Require(size) ? size : 0);
+            pos += value.size;
+        }
+
+        /// Reads a buffer whose size is given by one byte.
+        void ReadVariable1(BufferView &value)
+        {
+            uint8_t size = 0;
+            Read(size);
+            ReadFixed(value, size);
+        }
+
+        /// Reads a buffer whose size is given by two bytes.
+        void ReadVariable2(BufferView &value)
+        {
+            uint16_t size = 0;
+            Read(size);
+            ReadFixed(value, size);
+        }
+
+        /// Reads the instance count of a variable block.
+        size_t ReadBlockCount()
+        {
+            uint8_t count = 0;
+            Read(count);
+            return count;
+        }
+
+        /// @return False if the data ended before all the content was read.
+        bool IsValid() const { return valid; }
+
+    private:
+        bool Require(size_t count)
+        {
+            if (valid && (size_t)(end - pos) >= count)
+                return true;
+            valid = false;
+            pos = end;
+            return false;
+        }
+
+        const uint8_t *pos;
+        const uint8_t *end;
+        bool valid;
+    };
+
+    /// Writes message content with the layout known at compile time straight into the message buffer. Used by the
+    /// generated message codecs in RealXtend/RexProtocolMessages.h.
+    class MessageWriter
+    {
+    public:
+        /// @param msg A message started with NetMessageManager::StartNewMessage(), with nothing added yet.
+        explicit MessageWriter(NetOutMessage &msg) : message(msg) {}
+
+        template<typename T>
+        void Write(const T &value) { message.AddBytesUnchecked(sizeof(T), &value); }
+
+        void Write(bool value)
+        {
+            uint8_t byte = value ? 1 : 0;
+            Write(byte);
+        }
+
+        void Write(const Quaternion &value) { Write(PackQuaternionToFloat3(value)); }
+
+        /// Writes a buffer of a size fixed by the message template. Pads with zeroes if the buffer is smaller.
+        void WriteFixed(const BufferView &value, size_t size)
+        {
+            const size_t count = value.size < size ? value.size : size;
+            if (count)
+                message.AddBytesUnchecked(count, value.data);
+            for(size_t i = count; i < size; ++i)
+                Write((uint8_t)0);
+        }
+
+        /// Writes a buffer whose size is given by one byte.
+        void WriteVariable1(const BufferView &value)
+        {
+            assert(value.size <= 255);
+            Write((uint8_t)value.size);
+            WriteFixed(value, (uint8_t)value.size);
+        }
+
+        /// Writes a buffer whose size is given by two bytes.
+        void WriteVariable2(const BufferView &value)
+        {
+            assert(value.size <= 65535);
+            Write((uint16_t)value.size);
+            WriteFixed(value, (uint16_t)value.size);
+        }
+
+        /// Writes the instance count of a variable block.
+        void WriteBlockCount(size_t count)
+        {
+            assert(count <= 255);
+            Write((uint8_t)count);
+        }
+
+    private:
+        void operator=(const MessageWriter &);
+
+        NetOutMessage &message;
+    };
+}
+
+#endif
@@ -102,6 +102,19 @@ static uint8_t *ComputeMessageContentStartAddrAndLength(uint8_t *data, size_t nu
 NetInMessage::NetInMessage(size_t seqNum, const uint8_t *data, size_t numBytes, bool zeroCoded) :
     messageInfo(0), sequenceNumber(seqNum)
 {
+    Reset(seqNum, data, numBytes, zeroCoded);
+}
+
+NetInMessage::NetInMessage() :
+    messageInfo(0), sequenceNumber(0), messageID(0)
+{
+}
+
+void NetInMessage::Reset(size_t seqNum, const uint8_t *data, size_t numBytes, bool zeroCoded)
+{
+    messageInfo = 0;
+    sequenceNumber = seqNum;
+
     if (zeroCoded)
     {
         size_t decodedLength = CountZeroDecodedLength(data, numBytes);
@@ -113,13 +126,10 @@ NetInMessage::NetInMessage(size_t seqNum, const uint8_t *data, size_t numBytes,
             throw Exception("Zero-decoding input data failed!");
     }
     else
-    {
-        messageData.reserve(numBytes);
-        messageData.insert(messageData.end(), data, data + numBytes);
-    }
+        messageData.assign(data, data + numBytes);
 
     size_t messageIDLength = 0;
-    messageID = ExtractNetworkMessageID(&messageData[0], numBytes, &messageIDLength);
+    messageID = ExtractNetworkMessageID(messageData.empty() ? 0 : &messageData[0], messageData.size(), &messageIDLength);
     if (messageIDLength == 0)
         throw Exception("Malformed SLUDP packet read! MessageID not present!");
     
@@ -28,12 +28,24 @@ namespace ProtocolUtilities
         /// @param zerEncoded Is this data zero-encoded.
         NetInMessage(size_t seqNum, const uint8_t *data, size_t numBytes, bool zeroEncoded);
 
+        /// Constructs an empty message, to be filled with Reset().
+        NetInMessage();
+
         /// Destructor.
         ~NetInMessage();
 
         /// Copy-constuctor.
         NetInMessage(const NetInMessage &rhs);
 
+        /// Replaces the contents of this message with new data. Reuses the already allocated data buffer, so
+        /// NetMessageManager can parse all inbound datagrams into the same message without heap allocations.
+        /// The message info needs to be set again after this.
+        /// @param seqNum Sequence number of this message.
+        /// @param data Data buffer.
+        /// @param numBytes Number of bytes.
+        /// @param zerEncoded Is this data zero-encoded.
+        void Reset(size_t seqNum, const uint8_t *data, size_t numBytes, bool zeroEncoded);
+
         /// The following functions all read data from the message and advance to the next variable in the message block.
         uint8_t  ReadU8();
         uint16_t ReadU16();
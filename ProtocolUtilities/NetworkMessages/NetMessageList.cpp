@@ -433,4 +433,239 @@ void NetMessageList::GenerateHeaderFile(const char *filename) const
     out << endl << "#endif" << endl;
 }
 
+/// @return The C++ type used for a message variable in the generated codecs.
+static const char *VariableTypeToCodecType(NetVariableType type)
+{
+    switch(type)
+    {
+    case NetVarU8: return "uint8_t";
+    case NetVarU16: return "uint16_t";
+    case NetVarU32: return "uint32_t";
+    case NetVarU64: return "uint64_t";
+    case NetVarS8: return "int8_t";
+    case NetVarS16: return "int16_t";
+    case NetVarS32: return "int32_t";
+    case NetVarS64: return "int64_t";
+    case NetVarF32: return "float";
+    case NetVarF64: return "double";
+    case NetVarVector3: return "Vector3";
+    case NetVarVector3d: return "Vector3d";
+    case NetVarVector4: return "Vector4";
+    case NetVarQuaternion: return "Quaternion";
+    case NetVarUUID: return "RexUUID";
+    case NetVarBOOL: return "bool";
+    case NetVarIPADDR: return "uint32_t";
+    case NetVarIPPORT: return "uint16_t";
+    default: return "BufferView";
+    }
+}
+
+/// @return A name that can be used as a C++ identifier in the given scope.
+static std::string CodecIdentifier(const std::string &name, const std::string &enclosingName)
+{
+    static const char *keywords[] = { "bool", "char", "class", "default", "delete", "double", "float", "int", "long",
+        "new", "operator", "private", "public", "short", "signed", "struct", "template", "this", "union", "unsigned" };
+    for(size_t i = 0; i < NUMELEMS(keywords); ++i)
+        if (name == keywords[i])
+            return name + "_";
+    if (name == enclosingName)
+        return name + "_";
+    return name;
+}
+
+/// Writes the statements that decode or encode one instance of a block.
+static void GenerateBlockInstanceCodec(ostream &out, const NetMessageBlock &block, const std::string &instance,
+    const std::string &indent, bool decode)
+{
+    const std::string blockType = block.name + "Block";
+    for(size_t i = 0; i < block.variables.size(); ++i)
+    {
+        const NetMessageVariable &var = block.variables[i];
+        const std::string field = instance + "." + CodecIdentifier(var.name, blockType);
+        out << indent;
+        switch(var.type)
+        {
+        case NetVarFixed:
+            out << (decode ? "reader.ReadFixed(" : "writer.WriteFixed(") << field << ", " << dec << var.count << ");" << endl;
+            break;
+        case NetVarBufferByte:
+            out << (decode ? "reader.ReadVariable1(" : "writer.WriteVariable1(") << field << ");" << endl;
+            break;
+        case NetVarBuffer2Bytes:
+            out << (decode ? "reader.ReadVariable2(" : "writer.WriteVariable2(") << field << ");" << endl;
+            break;
+        default:
+            out << (decode ? "reader.Read(" : "writer.Write(") << field << ");" << endl;
+            break;
+        }
+    }
+}
+
+void NetMessageList::GenerateCodecFiles(const char *headerFilename, const char *sourceFilename) const
+{
+    std::vector<NetMessageInfo> msgs;
+    for(NetworkMessageMap::const_iterator iter = messages.begin(); iter != messages.end(); ++iter)
+        msgs.push_back(iter->second);
+    std::sort(msgs.begin(), msgs.end(), NetMessageInfoCmp);
+
+    ofstream header(headerFilename);
+    header << "// For conditions of distribution and use, see copyright notice in license.txt" << endl
+        << "/* This file defines a struct for each message used in the protocol, with functions for decoding the" << endl
+        << "message straight from the received bytes and encoding it into an outbound message:" << endl
+        << endl
+        << "bool Decode(const uint8_t *data, size_t numBytes) decodes the message content after the message ID, i.e." << endl
+        << "NetInMessage::GetData(). Returns false if the message was shorter than its definition requires. Buffers are" << endl
+        << "decoded as views into the data, so they are only valid as long as the data is. Reuse the struct to avoid" << endl
+        << "reallocating the variable blocks." << endl
+        << endl
+        << "void Encode(NetOutMessage &msg) const encodes the message content to a message started with" << endl
+        << "NetMessageManager::StartNewMessage()." << endl
+        << endl
+        << "This file is automatically generated from the message template file by NetMessageList::GenerateCodecFiles," << endl
+        << "so no point modifying it here. */" << endl
+        << endl
+        << "#ifndef incl_RexProtocolMessages_h" << endl
+        << "#define incl_RexProtocolMessages_h" << endl
+        << endl
+        << "#include <vector>" << endl
+        << endl
+        << "#include \"NetworkMessages/MessageCodec.h\"" << endl
+        << endl
+        << "namespace ProtocolUtilities" << endl
+        << "{" << endl
+        << "namespace Messages" << endl
+        << "{" << endl;
+
+    ofstream source(sourceFilename);
+    source << "// For conditions of distribution and use, see copyright notice in license.txt" << endl
+        << "// This file is automatically generated from the message template file by NetMessageList::GenerateCodecFiles." << endl
+        << "#include \"StableHeaders.h\"" << endl
+        << endl
+        << "#include \"RexProtocolMessages.h\"" << endl
+        << endl
+        << "namespace ProtocolUtilities" << endl
+        << "{" << endl
+        << "namespace Messages" << endl
+        << "{" << endl;
+
+    for(std::vector<NetMessageInfo>::const_iterator iter = msgs.begin(); iter != msgs.end(); ++iter)
+    {
+        const NetMessageInfo &msg = *iter;
+
+        header << endl
+            << "    /// " << msg.name << ", " << (msg.encoding == NetZeroEncoded ? "zero-encoded" : "unencoded") << "." << endl
+            << "    struct " << msg.name << endl
+            << "    {" << endl
+            << "        static const NetMsgID cMessageID = 0x" << hex << msg.id << dec << ";" << endl;
+
+        for(size_t i = 0; i < msg.blocks.size(); ++i)
+        {
+            const NetMessageBlock &block = msg.blocks[i];
+            const std::string blockType = block.name + "Block";
+            header << endl
+                << "        struct " << blockType << endl
+                << "        {" << endl;
+            for(size_t j = 0; j < block.variables.size(); ++j)
+            {
+                const NetMessageVariable &var = block.variables[j];
+                header << "            " << VariableTypeToCodecType(var.type) << " " << CodecIdentifier(var.name, blockType) << ";" << endl;
+            }
+            header << "        };" << endl;
+
+            const std::string member = CodecIdentifier(block.name, msg.name);
+            switch(block.type)
+            {
+            case NetBlockMultiple:
+                header << "        " << blockType << " " << member << "[" << block.repeatCount << "];" << endl;
+                break;
+            case NetBlockVariable:
+                header << "        std::vector<" << blockType << "> " << member << ";" << endl;
+                break;
+            default:
+                header << "        " << blockType << " " << member << ";" << endl;
+                break;
+            }
+        }
+
+        header << endl
+            << "        bool Decode(const uint8_t *data, size_t numBytes);" << endl
+            << "        void Encode(NetOutMessage &msg) const;" << endl
+            << "    };" << endl;
+
+        // Decoder.
+        source << endl
+            << "    bool " << msg.name << "::Decode(const uint8_t *data, size_t numBytes)" << endl
+            << "    {" << endl
+            << "        MessageReader reader(data, numBytes);" << endl;
+        for(size_t i = 0; i < msg.blocks.size(); ++i)
+        {
+            const NetMessageBlock &block = msg.blocks[i];
+            const std::string member = CodecIdentifier(block.name, msg.name);
+            switch(block.type)
+            {
+            case NetBlockMultiple:
+                source << "        for(size_t i = 0; i < " << block.repeatCount << "; ++i)" << endl
+                    << "        {" << endl;
+                GenerateBlockInstanceCodec(source, block, member + "[i]", "            ", true);
+                source << "        }" << endl;
+                break;
+            case NetBlockVariable:
+                source << "        " << member << ".resize(reader.ReadBlockCount());" << endl
+                    << "        for(size_t i = 0; i < " << member << ".size(); ++i)" << endl
+                    << "        {" << endl;
+                GenerateBlockInstanceCodec(source, block, member + "[i]", "            ", true);
+                source << "        }" << endl;
+                break;
+            default:
+                GenerateBlockInstanceCodec(source, block, member, "        ", true);
+                break;
+            }
+        }
+        source << "        return reader.IsValid();" << endl
+            << "    }" << endl;
+
+        // Encoder.
+        source << endl
+            << "    void " << msg.name << "::Encode(NetOutMessage &msg) const" << endl
+            << "    {" << endl
+            << "        assert(msg.GetMessageID() == cMessageID);" << endl
+            << "        MessageWriter writer(msg);" << endl;
+        for(size_t i = 0; i < msg.blocks.size(); ++i)
+        {
+            const NetMessageBlock &block = msg.blocks[i];
+            const std::string member = CodecIdentifier(block.name, msg.name);
+            switch(block.type)
+            {
+            case NetBlockMultiple:
+                source << "        for(size_t i = 0; i < " << block.repeatCount << "; ++i)" << endl
+                    << "        {" << endl;
+                GenerateBlockInstanceCodec(source, block, member + "[i]", "            ", false);
+                source << "        }" << endl;
+                break;
+            case NetBlockVariable:
+                source << "        writer.WriteBlockCount(" << member << ".size());" << endl
+                    << "        for(size_t i = 0; i < " << member << ".size(); ++i)" << endl
+                    << "        {" << endl;
+                GenerateBlockInstanceCodec(source, block, member + "[i]", "            ", false);
+                source << "        }" << endl;
+                break;
+            default:
+                GenerateBlockInstanceCodec(source, block, member, "        ", false);
+                break;
+            }
+        }
+        source << "    }" << endl;
+    }
+
+    header << endl
+        << "}" << endl
+        << "}" << endl
+        << endl
+        << "#endif" << endl;
+
+    source << endl
+        << "}" << endl
+        << "}" << endl;
+}
+
 }
\ No newline at end of file
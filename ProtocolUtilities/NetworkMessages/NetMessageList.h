@@ -27,6 +27,13 @@ public:
     /// Generates a C++ header file out of all the IDs of the known message definitions.
     void GenerateHeaderFile(const char *filename) const;
 
+    /// Generates typed message structs with Decode() and Encode() functions for all the known message definitions.
+    /// The output is RealXtend/RexProtocolMessages.h and .cpp, which the ProtocolUtilities build regenerates with
+    /// the MessageCodecGenerator tool whenever the message template changes.
+    /// @param headerFilename The file to write the struct definitions to.
+    /// @param sourceFilename The file to write the codec functions to.
+    void GenerateCodecFiles(const char *headerFilename, const char *sourceFilename) const;
+
 private:
     NetMessageList(const NetMessageList &);
     void operator=(const NetMessageList &);
@@ -6,7 +6,10 @@
 #include <sstream>
 #include <vector>
 #include <cstring>
+#include <cmath>
+#include <algorithm>
 #include <boost/timer.hpp>
+#include <boost/bind.hpp>
 
 #include "DebugOperatorNew.h"
 
@@ -79,31 +82,6 @@ namespace ProtocolUtilities
         return data + 6 + extraHeaderSize;
     }
 
-    /// Returns a list of appended acks from packet
-    /// @param data A pointer to the message data.
-    /// @param numBytes The size of data, in bytes.
-    static std::vector<uint32_t> GetAppendedAckList(uint8_t *data, size_t numBytes)
-    {
-        std::vector<uint32_t> acks;
-        if ((data[0] & NetFlagAck) && (numBytes > 6))
-        {
-            if (numBytes > 6)
-            {
-                size_t num_acks = data[numBytes-1];
-                acks.resize(num_acks);
-                
-                int idx = numBytes - 1 - num_acks * 4;
-                if (idx < 6) return acks;
-                
-                for (size_t i = 0; i < num_acks; ++i)
-                {
-                    acks.push_back((uint32_t)ntohl(*(u_long*)&data[idx]));
-                }
-            }
-        }
-        return acks;
-    }
-
     /// const version of above.
     /*
     static const uint8_t *ComputeMessageBodyStartAddrAndLength(const uint8_t *data, size_t numBytes, size_t *messageLength)
@@ -136,28 +114,55 @@ namespace ProtocolUtilities
         return data[type];
     }
 
+    /// The number of datagram slots in the inbound queue. When the main thread falls this much behind, the network
+    /// thread leaves the packets waiting in the socket receive buffer.
+    static const size_t cInboundQueueSize = 512;
+
+    /// The maximum number of datagrams the network thread reads in one batch.
+    static const size_t cMaxReceiveBatch = 32;
+
+    /// How long the network thread waits for packets at a time before checking if it should exit.
+    static const int cNetworkThreadWaitMs = 50;
+
+    /// The retransmit timeout used before the first round-trip time sample, in seconds.
+    static const double cInitialRetransmitTimeout = 1.0;
+
+    /// The bounds of the retransmit timeout, in seconds.
+    static const double cMinRetransmitTimeout = 0.5;
+    static const double cMaxRetransmitTimeout = 5.0;
+
+    const std::string &NetMessageManager::loggerName = "NetMessageManager";
+
     NetMessageManager::NetMessageManager(const char *messageListFilename)
     :messageList(boost::shared_ptr<NetMessageList>(new NetMessageList(messageListFilename)))
     ,messageListener(0), 
+    inboundQueue(cInboundQueueSize),
+    networkThreadRunning(false),
+    networkThreadFailed(false),
+    smoothedRoundTripTime(0.0),
+    roundTripTimeVariance(0.0),
+    retransmitTimeout(cInitialRetransmitTimeout),
     sequenceNumber(1), // Note here: We always start outbound communication with PacketID==1.
-    lastReceivedSequenceNumber(0)
+    lastReceivedTime(Core::GetCurrentClockTime())
 #ifdef PROFILING
     ,sentDatagrams(65536)
     ,sentDatabytes(65536)
     ,receivedDatagrams(65536)
     ,receivedDatabytes(65536)
     ,resentPackets(65536)
+    ,lostOutboundPackets(65536)
     ,lostPackets(65536)
+    ,roundTripTimes(65536)
     ,duplicatesReceived(65536)
 #endif
     {      
-        receivedSequenceNumbers.clear();        
+        pendingACKs.reserve(cMaxReceiveBatch);
     }
 
     NetMessageManager::~NetMessageManager()
     {
+        StopNetworkThread();
         ClearMessagePoolMemory();            
-        receivedSequenceNumbers.clear();
     }
 
     void NetMessageManager::DumpNetworkMessage(NetMsgID id, NetInMessage *msg)
@@ -213,9 +218,8 @@ namespace ProtocolUtilities
         return messageList->GetMessageInfoByID(id);
     }
 
-    void NetMessageManager::HandleInboundBytes(std::vector<uint8_t> &data)
+    void NetMessageManager::HandleInboundBytes(uint8_t *data, size_t numBytes)
     {
-        const size_t numBytes = data.size();
 #ifdef PROFILING
         receivedDatagrams.InsertRecord(1.0);
         receivedDatabytes.InsertRecord(numBytes);
@@ -228,26 +232,20 @@ namespace ProtocolUtilities
             return;
         }
 
-        uint32_t seqNum = ExtractNetworkMessageSequenceNumber(&data[0], numBytes);
-
-#ifdef PROFILING
-        if (receivedSequenceNumbers.size() > 0 && seqNum - lastReceivedSequenceNumber < 16)
-        {
-            for(int i = lastReceivedSequenceNumber+1; i < seqNum; ++i)
-                if (receivedSequenceNumbers.find(i) == receivedSequenceNumbers.end())
-                    lostPackets.InsertRecord(1.0);
-        }
-#endif
-        lastReceivedSequenceNumber = seqNum;
+        uint32_t seqNum = ExtractNetworkMessageSequenceNumber(data, numBytes);
+        lastReceivedTime = Core::GetCurrentClockTime();
 
-        // Send ACK for reliable messages.
-        if ((data[0] & NetFlagReliable) != 0)
-            QueuePacketACK(seqNum);
+        // Reliable messages have already been ACKed by the network thread.
 
-        // We need to do pruning of inbound duplicates, so add the sequence number to the set of received sequence numbers, 
+        // We need to do pruning of inbound duplicates, so mark the sequence number received, 
         // and check if we've seen this packet before.
-        pair<set<uint32_t>::iterator, bool> ret = receivedSequenceNumbers.insert(seqNum);
-        if (ret.second == false) 
+        size_t numLost = 0;
+        bool isNew = receivedSequenceNumbers.Insert(seqNum, numLost);
+#ifdef PROFILING
+        if (numLost > 0)
+            lostPackets.InsertRecord(numLost);
+#endif
+        if (!isNew) 
         {
 #ifdef PROFILING
             duplicatesReceived.InsertRecord(1.0);
@@ -258,18 +256,17 @@ namespace ProtocolUtilities
 //        NetMsgID id = ExtractNetworkMessageNumber(&data[0], numBytes);
 
         size_t messageLength = 0;
-        const uint8_t *message = ComputeMessageBodyStartAddrAndLength(&data[0], numBytes, &messageLength);
+        const uint8_t *message = ComputeMessageBodyStartAddrAndLength(data, numBytes, &messageLength);
         if (!message)
         {
             cout << "Malformed packet received, could not determine message size" << endl;
             return;
         }
         
-        std::vector<uint32_t> appended_acks = GetAppendedAckList(&data[0], numBytes);
-        
         try
         {
-            NetInMessage msg(seqNum, &message[0], messageLength, (data[0] & NetFlagZeroCode) != 0);
+            NetInMessage &msg = inboundMessage;
+            msg.Reset(seqNum, &message[0], messageLength, (data[0] & NetFlagZeroCode) != 0);
 
             const NetMessageInfo *messageInfo = messageList->GetMessageInfoByID(msg.GetMessageID());
             if (!messageInfo)
@@ -279,12 +276,7 @@ namespace ProtocolUtilities
             }
             msg.SetMessageInfo(messageInfo);
 
-            // Process appended acks
-            if (appended_acks.size() > 0)
-            {
-                for(unsigned i = 0; i < appended_acks.size(); ++i)
-                    ProcessPacketACK(appended_acks[i]);
-            }
+            ProcessAppendedACKs(data, numBytes);
             
             // NetMessageManager handles all Acks and Pings. Those are not passed to the application.
             switch(msg.GetMessageID())
@@ -308,17 +300,31 @@ namespace ProtocolUtilities
         }
     }
 
-    static void FlipBits(std::vector<uint8_t> &data, int numBitsToFlip)
+    void NetMessageManager::ProcessAppendedACKs(const uint8_t *data, size_t numBytes)
+    {
+        if (!(data[0] & NetFlagAck) || numBytes <= 6)
+            return;
+
+        size_t num_acks = data[numBytes-1];
+        if (numBytes < 7 + num_acks * 4)
+            return;
+
+        size_t idx = numBytes - 1 - num_acks * 4;
+        for(size_t i = 0; i < num_acks; ++i, idx += 4)
+            ProcessPacketACK((uint32_t)ntohl(*(u_long*)&data[idx]));
+    }
+
+    static void FlipBits(uint8_t *data, size_t numBytes, int numBitsToFlip)
     {
         while(numBitsToFlip-- > 0)
         {
-            int idx = rand() % data.size();
+            int idx = rand() % numBytes;
             uint8_t bit = 1 << (rand() % 8);
             data[idx] ^= bit;
         }
     }
 
-    /// Polls the inbound socket until the message queue is empty. Also resends any timed out reliable messages.
+    /// Processes the datagrams the network thread has received. Also resends any timed out reliable messages.
     void NetMessageManager::ProcessMessages()
     {
         PROFILE (NetMessageManager_ProcessMessages);
@@ -333,16 +339,16 @@ namespace ProtocolUtilities
         boost::timer timer;
         
         PROFILE(NetMessageManager_WhilePacketsAvailable);
-        while(connection->PacketsAvailable() && timer.elapsed() < MAX_PROCESS_TIME)
+        InboundDatagram *datagram = 0;
+        while((datagram = inboundQueue.Front()) != 0 && timer.elapsed() < MAX_PROCESS_TIME)
         {
-            const int cMaxPayload = 2048;
-            std::vector<uint8_t> data(cMaxPayload, 0);
-            int numBytes = connection->ReceiveBytes(&data[0], cMaxPayload);
-            
-            if (numBytes == 0)
-                break;
-
-            data.resize(numBytes);
+#ifdef PROFILING
+            if (datagram->acksSent > 0)
+            {
+                sentDatagrams.InsertRecord(datagram->acksSent);
+                sentDatabytes.InsertRecord(datagram->ackBytesSent);
+            }
+#endif
 
 #ifdef PROTOCOL_STRESS_TEST
             const int numDuplications = 10;
@@ -350,30 +356,117 @@ namespace ProtocolUtilities
             for(int i = 0; i < numDuplications; ++i)
             {
 #endif
-                HandleInboundBytes(data);
+                HandleInboundBytes(datagram->data, datagram->size);
 #ifdef PROTOCOL_STRESS_TEST
-                FlipBits(data, (int)ceil(data.size() * bitErrorRate));
+                FlipBits(datagram->data, datagram->size, (int)ceil(datagram->size * bitErrorRate));
             }
 #endif
+            inboundQueue.Pop();
         }
         
         if (!connection->Open())
+        {
+            StopNetworkThread();
             connection.reset();
-            
-        // To keep memory footprint down and to defend against memory attacks, keep the list of seen sequence numbers to a fixed size.
-        const size_t cMaxSeqNumMemorySize = 300;
-        while(receivedSequenceNumbers.size() > cMaxSeqNumMemorySize)
-            receivedSequenceNumbers.erase(receivedSequenceNumbers.begin()); // We remove from the front to guarantee the smallest(oldest) are removed first.
+            return;
+        }
+
+        // If the network thread has died, nothing is received or ACKed anymore. Let the caller close the connection.
+        std::string error;
+        {
+            MutexLock lock(networkErrorMutex);
+            if (!networkThreadFailed)
+                return;
+            networkThreadFailed = false;
+            error = networkError;
+        }
+        StopNetworkThread();
+        throw Poco::Net::NetException(error);
+    }
+
+    double NetMessageManager::GetTimeSinceLastReceived() const
+    {
+        return (Core::GetCurrentClockTime() - lastReceivedTime) / (double)Core::GetCurrentClockFreq();
+    }
+
+    void NetMessageManager::StartNetworkThread()
+    {
+        StopNetworkThread();
+
+        inboundQueue.Clear();
+        pendingACKs.clear();
+        {
+            MutexLock lock(networkErrorMutex);
+            networkThreadFailed = false;
+            networkError.clear();
+        }
+        networkThreadRunning = true;
+        networkThread = boost::shared_ptr<Thread>(new Thread(boost::bind(&NetMessageManager::NetworkThreadLoop, this)));
+    }
+
+    void NetMessageManager::StopNetworkThread()
+    {
+        if (!networkThread)
+            return;
 
-        // Acknowledge all the new accumulated packets that the server sent as reliable.
-        SendPendingACKs();
+        networkThreadRunning = false;
+        networkThread->join();
+        networkThread.reset();
+    }
+
+    void NetMessageManager::NetworkThreadLoop()
+    {
+        InboundDatagram *batch[cMaxReceiveBatch];
+
+        try
+        {
+            while(networkThreadRunning && connection->Open())
+            {
+                if (!connection->WaitForPackets(cNetworkThreadWaitMs))
+                    continue;
+
+                // If the main thread has fallen behind and the queue is full, leave the packets to the socket receive buffer for now.
+                size_t numSlots = inboundQueue.BeginPush(batch, cMaxReceiveBatch);
+                if (numSlots == 0)
+                {
+                    boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+                    continue;
+                }
+
+                size_t numReceived = connection->ReceiveDatagrams(batch, numSlots);
+                if (numReceived == 0)
+                    continue;
+
+                // Send ACKs for reliable messages right away, instead of waiting for the main thread to get to them.
+                for(size_t i = 0; i < numReceived; ++i)
+                {
+                    batch[i]->acksSent = 0;
+                    batch[i]->ackBytesSent = 0;
+                    if (batch[i]->size >= 6 && (batch[i]->data[0] & NetFlagReliable) != 0)
+                        QueuePacketACK(ExtractNetworkMessageSequenceNumber(batch[i]->data, batch[i]->size));
+                }
+                SendPendingACKs(batch[numReceived-1]->acksSent, batch[numReceived-1]->ackBytesSent);
+
+                inboundQueue.EndPush(numReceived);
+            }
+        }
+        catch(Poco::Exception &e)
+        {
+            LogError("Network thread stopped due to a socket error: " + e.displayText());
+
+            MutexLock lock(networkErrorMutex);
+            networkThreadFailed = true;
+            networkError = e.displayText();
+        }
     }
 
     bool NetMessageManager::ConnectTo(const char *serverAddress, int port)
     {
         try
         {
+            StopNetworkThread();
             connection = boost::shared_ptr<NetworkConnection>(new NetworkConnection(serverAddress, port));
+            StartNetworkThread();
             return true;
         } catch(Poco::Net::NetException &e)
         {
@@ -384,9 +477,11 @@ namespace ProtocolUtilities
 
     void NetMessageManager::Disconnect()
     {
+        StopNetworkThread();
+        inboundQueue.Clear();
         connection->Close();
         ClearMessagePoolMemory();
-        receivedSequenceNumbers.clear();
+        receivedSequenceNumbers.Clear();
     }
 
     NetOutMessage *NetMessageManager::StartNewMessage(NetMsgID id)
@@ -496,7 +591,7 @@ namespace ProtocolUtilities
 
     void NetMessageManager::QueuePacketACK(uint32_t packetID)
     {
-        pendingACKs.insert(packetID);
+        pendingACKs.push_back(packetID);
     }
 
     void NetMessageManager::ClearMessagePoolMemory()
@@ -509,55 +604,56 @@ namespace ProtocolUtilities
         for(std::list<NetOutMessage*>::iterator iter = usedMessagePool.begin(); iter != usedMessagePool.end(); ++iter)
             delete *iter;
 
-        for(MessageResendList::iterator iter = messageResendQueue.begin(); iter != messageResendQueue.end(); ++iter)
-            delete iter->second;
+        std::vector<NetOutMessage*> unackedMessages;
+        resendWindow.Clear(unackedMessages);
+        for(size_t i = 0; i < unackedMessages.size(); ++i)
+            delete unackedMessages[i];
 
         unusedMessagePool.clear();
         usedMessagePool.clear();
-        messageResendQueue.clear();
     }
 
-    ///\todo Have better delay method for pending ACKs, currently sends everything accumulated just over one frame
-    void NetMessageManager::SendPendingACKs()
+    /// Sends the ACKs of one received batch of datagrams. The ACK messages are built directly into a reused message
+    /// and not passed through FinishMessage(), as the message pools and the listener belong to the main thread.
+    void NetMessageManager::SendPendingACKs(size_t &datagramsSent, size_t &bytesSent)
     {
-        PROFILE(NetMessageManager_SendPendingACKs);
-        // If we aren't even connected (or not connected anymore), clear any old pending ACKs and return.
-        if (!connection.get())
-        {
-            pendingACKs.clear();
-            return;
-        }
+        datagramsSent = 0;
+        bytesSent = 0;
 
         static const size_t max_acks_in_msg = 100;
 
-        while (pendingACKs.size() > 0)
+        const NetMessageInfo *info = messageList->GetMessageInfoByID(RexNetMsgPacketAck);
+        assert(info);
+
+        size_t i = 0;
+        while (i < pendingACKs.size())
         {
-            size_t acks_to_send = pendingACKs.size();
+            size_t acks_to_send = pendingACKs.size() - i;
             if (acks_to_send > max_acks_in_msg)
                 acks_to_send = max_acks_in_msg;
 
-            NetOutMessage *m = StartNewMessage(RexNetMsgPacketAck);
-            assert(m);
-            m->SetVariableBlockCount(acks_to_send);
-            
-            std::set<uint32_t>::iterator i = pendingACKs.begin();
-            size_t added_acks = 0;
+            ackMessage.ResetWriting();
+            ackMessage.SetMessageInfo(info);
+            ackMessage.AddMessageHeader();
+            ackMessage.SetVariableBlockCount(acks_to_send);
             
-            while (added_acks < acks_to_send)
+            for(size_t added_acks = 0; added_acks < acks_to_send; ++added_acks, ++i)
             {
                 // Note! Horrible protocol design issue! The sequence numbers that both
                 // server and client use are sent in big endian, but in the ACK packets
                 // they need to be transferred in little endian. !! So, no conversion to
                 // big endian here.
-                m->AddU32(*i);
-                ++added_acks;
-                ++i;
+                ackMessage.AddU32(pendingACKs[i]);
             }
             
-            FinishMessage(m);
-            
-            pendingACKs.erase(pendingACKs.begin(), i);
+            ackMessage.SetSequenceNumber(GetNewSequenceNumber());
+            connection->SendBytes(&ackMessage.GetData()[0], ackMessage.BytesFilled());
+
+            ++datagramsSent;
+            bytesSent += ackMessage.BytesFilled();
         }
+
+        pendingACKs.clear();
     }
 
     void NetMessageManager::ProcessPacketACK(NetInMessage *msg)
@@ -573,6 +669,30 @@ namespace ProtocolUtilities
         RemoveMessageFromResendQueue(id);
     }
 
+    /// Estimates the round-trip time and the retransmit timeout as in RFC 2988.
+    void NetMessageManager::UpdateRoundTripTime(double sample)
+    {
+#ifdef PROFILING
+        roundTripTimes.InsertRecord(sample);
+#endif
+        if (smoothedRoundTripTime == 0.0)
+        {
+            smoothedRoundTripTime = sample;
+            roundTripTimeVariance = sample / 2.0;
+        }
+        else
+        {
+            roundTripTimeVariance = 0.75 * roundTripTimeVariance + 0.25 * fabs(smoothedRoundTripTime - sample);
+            smoothedRoundTripTime = 0.875 * smoothedRoundTripTime + 0.125 * sample;
+        }
+
+        retransmitTimeout = smoothedRoundTripTime + 4.0 * roundTripTimeVariance;
+        if (retransmitTimeout < cMinRetransmitTimeout)
+            retransmitTimeout = cMinRetransmitTimeout;
+        if (retransmitTimeout > cMaxRetransmitTimeout)
+            retransmitTimeout = cMaxRetransmitTimeout;
+    }
+
     void NetMessageManager::SendCompletePingCheck(uint8_t pingID)
     {
         NetOutMessage *m = StartNewMessage(RexNetMsgCompletePingCheck);
@@ -581,61 +701,56 @@ namespace ProtocolUtilities
         FinishMessage(m);
     }
 
-    /// A unary find predicate that looks for a NetOutMessage that has the given desired sequence number in a resendqueue container.
-    class MsgSeqNumMatchPred
-    {
-    public:
-        MsgSeqNumMatchPred(uint32_t seqNum_):seqNum(seqNum_) {}
-
-        bool operator()(const std::pair<time_t, NetOutMessage*> &elem) const { return elem.second && elem.second->GetSequenceNumber() == seqNum; }
-    private:
-        uint32_t seqNum;
-    };
-
     void NetMessageManager::AddMessageToResendQueue(NetOutMessage *msg)
     {
+        const Core::tick_t timeout = (Core::tick_t)(retransmitTimeout * Core::GetCurrentClockFreq());
+
         // Don't add this message to the queue, if it already exists in the queue, i.e. it has already been resent once due to a timeout.
-        MessageResendList::iterator it = std::find_if(messageResendQueue.begin(), messageResendQueue.end(), MsgSeqNumMatchPred(msg->GetSequenceNumber()));
-        if (it != messageResendQueue.end())
+        if (!resendWindow.Add(msg, Core::GetCurrentClockTime(), timeout))
         {
             // If the sequence numbers matched but these are different message structs, add the message to unusedMessagePool, it's extraneous.
-            if (it->second != msg)
+            if (resendWindow.Find((uint32_t)msg->GetSequenceNumber()) != msg)
                 unusedMessagePool.push_back(msg);
-            return;
         }
-
-        messageResendQueue.push_back(std::make_pair(time(0), msg));
     }
 
     void NetMessageManager::RemoveMessageFromResendQueue(uint32_t packetID)
     {
-        MessageResendList::iterator it = std::find_if(messageResendQueue.begin(), messageResendQueue.end(), MsgSeqNumMatchPred(packetID));
+        ReliableMessageWindow::Entry entry;
+        NetOutMessage *msg = resendWindow.Remove(packetID, &entry);
+        if (!msg)
+            return;
 
-        if (it != messageResendQueue.end())
-        {
-            unusedMessagePool.push_back(it->second);
-            messageResendQueue.erase(it);
-        }
+        // Sample the round-trip time only from messages sent once, otherwise it's unknown which send the ACK is for.
+        if (!entry.resent)
+            UpdateRoundTripTime((Core::GetCurrentClockTime() - entry.sendTime) / (double)Core::GetCurrentClockFreq());
+
+        unusedMessagePool.push_back(msg);
     }
 
     void NetMessageManager::ProcessResendQueue()
     {
         PROFILE(NetMessageManager_ProcessResendQueue);
-        const int cTimeoutSeconds = 5;
 
-        const time_t timeNow = time(0);
-        for(MessageResendList::iterator it = messageResendQueue.begin(); it != messageResendQueue.end(); ++it)
+        const Core::tick_t timeNow = Core::GetCurrentClockTime();
+        resendWindow.CollectTimedOut(timeNow, timedOutMessages);
+
+        const Core::tick_t maxTimeout = (Core::tick_t)(cMaxRetransmitTimeout * Core::GetCurrentClockFreq());
+        for(size_t i = 0; i < timedOutMessages.size(); ++i)
         {
-            if (timeNow - it->first >= cTimeoutSeconds)
-            {
-                it->first = timeNow;
-                it->second->MarkResend();
-                SendProcessedMessage(it->second);
-                //std::cout << "Resending packet " << it->second->GetSequenceNumber() << std::endl;
+            ReliableMessageWindow::Entry *entry = timedOutMessages[i];
 #ifdef PROFILING
-                resentPackets.InsertRecord(1.0);
+            if (!entry->resent)
+                lostOutboundPackets.InsertRecord(1.0);
+            resentPackets.InsertRecord(1.0);
 #endif
-            }
+            entry->message->MarkResend();
+            SendProcessedMessage(entry->message);
+            //std::cout << "Resending packet " << entry->sequenceNumber << std::endl;
+
+            // Back off exponentially while the message keeps getting lost.
+            entry->timeout = std::min(entry->timeout * 2, maxTimeout);
+            resendWindow.Reschedule(entry, timeNow);
         }
     }
 
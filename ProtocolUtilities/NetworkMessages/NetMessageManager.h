@@ -3,15 +3,19 @@
 #define incl_ProtocolUtilities_NetMessageManager_h
 
 #include <list>
-#include <set>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 
+#include "CoreThread.h"
 #include "NetworkConnection.h"
+#include "DatagramQueue.h"
+#include "SequenceWindow.h"
 #include "NetInMessage.h"
 #include "NetOutMessage.h"
 #include "NetMessage.h"
 #include "Interfaces/INetMessageListener.h"
 #include "EventHistory.h"
+#include "ModuleLoggingFunctions.h"
 
 namespace ProtocolUtilities
 {
@@ -19,9 +23,18 @@ namespace ProtocolUtilities
     /// Manages both in- and outbound UDP communication. Implements a packet queue, packet sequence numbering, ACKing,
     /// pinging, and reliable communications. reX-protocol specific. Used internally by OpenSimProtocolModule, external
     /// module users don't need to work on this.
+    /// While connected, a network thread reads the socket in batches into a ring of preallocated datagrams and ACKs
+    /// reliable packets as soon as they arrive. The main thread parses and dispatches the datagrams in ProcessMessages().
     class NetMessageManager
     {
     public:
+        MODULE_LOGGING_FUNCTIONS;
+        /// @return Name used for logging.
+        static const std::string &NameStatic() { return loggerName; }
+
+        /// Name used for logging.
+        static const std::string &loggerName;
+
         /// The message manager starts in a disconnected state.
         /// @param The filename to take the message definitions from.
         NetMessageManager(const char *messageListFilename);
@@ -40,8 +53,9 @@ namespace ProtocolUtilities
         /// To tell the manager that building the message is now finished and can be put into the outbound queue, call this.
         void FinishMessage(NetOutMessage *message);
         
-        /// Reads in all inbound UDP messages and processes them forward to the application through the listener.
-        /// Checks and resends any timed out reliable outbound messages. This could be moved into a separate thread, but not that timing specific so not necessary atm.
+        /// Processes the inbound UDP messages received by the network thread forward to the application through the listener.
+        /// Checks and resends any timed out reliable outbound messages.
+        /// @throw Poco::Net::NetException if the network thread has stopped due to a socket error.
         void ProcessMessages();
 
         /// Interprets the given byte stream as a message and dumps it contents out to the log. Useful only for diagnostics and such.
@@ -60,6 +74,18 @@ namespace ProtocolUtilities
         void RegisterNetworkListener(INetMessageListener *listener) { messageListener = listener; }
         void UnregisterNetworkListener(INetMessageListener *listener) { messageListener = 0; }
 
+        /// @return The smoothed round-trip time to the server in seconds, or 0 if not yet known.
+        double GetRoundTripTime() const { return smoothedRoundTripTime; }
+
+        /// @return The current retransmit timeout for reliable messages, in seconds.
+        double GetRetransmitTimeout() const { return retransmitTimeout; }
+
+        /// @return The number of bytes in reliable messages that have not been ACKed yet.
+        size_t GetBytesInFlight() const { return resendWindow.GetBytesInFlight(); }
+
+        /// @return The time since a datagram was last received from the server, in seconds.
+        double GetTimeSinceLastReceived() const;
+
 #ifdef PROFILING
         EventHistory sentDatagrams;
         EventHistory sentDatabytes;
@@ -67,8 +93,12 @@ namespace ProtocolUtilities
         EventHistory receivedDatabytes;
         /// A history of occurrences of when a packet has had to be resent.
         EventHistory resentPackets;
-        /// A history of occurrences when we assume we have lost an incoming packet (we generate false positives when receiving data out-of-order, but that's not critical)
+        /// A history of occurrences of when an outbound packet was first resent, i.e. it was most likely lost.
+        EventHistory lostOutboundPackets;
+        /// A history of occurrences when an incoming packet slid out of the received sequence number window without ever arriving.
         EventHistory lostPackets;
+        /// A history of round-trip time samples, in seconds, measured from the ACKs of reliable messages.
+        EventHistory roundTripTimes;
         /// A history of occurrences of when we have received a duplicate packet and have discarded it.
         EventHistory duplicatesReceived;
 #endif
@@ -77,17 +107,31 @@ namespace ProtocolUtilities
         /// Deallocates all memory used for outbound message structs.
         void ClearMessagePoolMemory();
     
-        /// @return A new sequence number for outbound UDP messages.
-        size_t GetNewSequenceNumber() { return sequenceNumber++; }
+        /// @return A new sequence number for outbound UDP messages. Called from both the main and the network thread.
+        size_t GetNewSequenceNumber() { MutexLock lock(sequenceNumberMutex); return sequenceNumber++; }
+
+        /// Starts the network thread for the current connection.
+        void StartNetworkThread();
 
-        /// Queues acking the packet with the given packetID.
+        /// Stops the network thread and waits for it to exit.
+        void StopNetworkThread();
+
+        /// The network thread main loop. Receives datagrams into inboundQueue and ACKs the reliable ones.
+        void NetworkThreadLoop();
+
+        /// Queues acking the packet with the given packetID. Called from the network thread.
         void QueuePacketACK(uint32_t packetID);
         
-        /// Sends pending acks to the server.
-        void SendPendingACKs();
+        /// Sends pending acks to the server. Called from the network thread.
+        /// @param datagramsSent [out] The number of ACK datagrams sent.
+        /// @param bytesSent [out] The number of bytes sent.
+        void SendPendingACKs(size_t &datagramsSent, size_t &bytesSent);
 
         /// Processes a single raw datagram received from the network.
-        void HandleInboundBytes(std::vector<uint8_t> &data);
+        void HandleInboundBytes(uint8_t *data, size_t numBytes);
+
+        /// Processes the acks appended to the end of a datagram.
+        void ProcessAppendedACKs(const uint8_t *data, size_t numBytes);
 
         /// Processes a received PacketAck message.
         void ProcessPacketACK(NetInMessage *msg);
@@ -108,11 +152,14 @@ namespace ProtocolUtilities
         void RemoveMessageFromResendQueue(uint32_t packetID);
         
         /// @return True, if the resend queue is empty, false otherwise.
-        bool ResendQueueIsEmpty() const { return messageResendQueue.empty(); }
+        bool ResendQueueIsEmpty() const { return resendWindow.GetSize() == 0; }
 
-        /// Checks each reliable message in outbound queue and resends any of the if an Ack was not received within a time-out period.
+        /// Resends the reliable messages whose ACK has not arrived within the retransmit timeout.
         void ProcessResendQueue();
 
+        /// Updates the round-trip time estimate and the retransmit timeout with a new sample.
+        void UpdateRoundTripTime(double sample);
+
         NetMessageManager(const NetMessageManager &);
         void operator=(const NetMessageManager &);
 
@@ -131,22 +178,59 @@ namespace ProtocolUtilities
         /// A pool of NetOutMessage structures, which have been handed out to the application and are currently being built.
         std::list<NetOutMessage*> usedMessagePool;
         
-        /// Packet acks pending to be sent
-        std::set<uint32_t> pendingACKs;
+        /// Packet acks pending to be sent. Accessed only by the network thread.
+        std::vector<uint32_t> pendingACKs;
+
+        /// The message the network thread builds ACKs into. Reused to avoid allocations.
+        NetOutMessage ackMessage;
+
+        /// Datagrams received by the network thread, waiting to be processed by the main thread.
+        DatagramQueue inboundQueue;
 
-        typedef std::list<std::pair<time_t, NetOutMessage*> > MessageResendList;
-        /// A pool of NetOutMessages that are in the outbound queue. Need to keep the unacked reliable messages in
-        /// memory for possible resending.
-        MessageResendList messageResendQueue;
+        /// The inbound message the main thread parses datagrams into. Reused to avoid allocations.
+        NetInMessage inboundMessage;
+
+        /// The network thread.
+        boost::shared_ptr<Thread> networkThread;
+
+        /// Tells the network thread to keep running.
+        volatile bool networkThreadRunning;
+
+        /// Set by the network thread when it stops due to a socket error. Guarded by networkErrorMutex.
+        bool networkThreadFailed;
+
+        /// The socket error that stopped the network thread. Guarded by networkErrorMutex.
+        std::string networkError;
+
+        /// Guards networkThreadFailed and networkError.
+        Mutex networkErrorMutex;
+
+        /// Guards sequenceNumber.
+        Mutex sequenceNumberMutex;
+
+        /// The reliable NetOutMessages that have been sent but not ACKed. Need to keep them in memory for possible resending.
+        ReliableMessageWindow resendWindow;
+
+        /// The messages collected for resending in ProcessResendQueue. Reused to avoid allocations.
+        std::vector<ReliableMessageWindow::Entry*> timedOutMessages;
+
+        /// Smoothed round-trip time, in seconds. 0 until the first sample.
+        double smoothedRoundTripTime;
+
+        /// Round-trip time variation, in seconds.
+        double roundTripTimeVariance;
+
+        /// The timeout after which an unACKed reliable message is resent, in seconds.
+        double retransmitTimeout;
         
         /// A running sequence number for outbound messages.
         size_t sequenceNumber;
 
-        /// The sequence number of the most recent packet we received. Note that this can go up and down if we receive data out of order (or if we receive spoofed data)
-        size_t lastReceivedSequenceNumber;
-        
-        /// A set of received messages' sequence numbers.
-        std::set<uint32_t> receivedSequenceNumbers;
+        /// The sequence numbers of the recently received messages, for discarding duplicates.
+        ReceivedSequenceWindow receivedSequenceNumbers;
+
+        /// The time a datagram was last received.
+        Core::tick_t lastReceivedTime;
     };
 
 }
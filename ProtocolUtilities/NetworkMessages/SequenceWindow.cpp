@@ -0,0 +1,195 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+#include "StableHeaders.h"
+
+#include <cstring>
+#include <cassert>
+
+#include "SequenceWindow.h"
+#include "NetOutMessage.h"
+
+namespace ProtocolUtilities
+{
+
+ReliableMessageWindow::ReliableMessageWindow(size_t initialCapacity)
+:slots(initialCapacity), mask(initialCapacity - 1), count(0), bytesInFlight(0), nextDeadline(0)
+{
+    assert(initialCapacity > 0 && (initialCapacity & (initialCapacity - 1)) == 0);
+    for(size_t i = 0; i < slots.size(); ++i)
+        slots[i].message = 0;
+}
+
+bool ReliableMessageWindow::Add(NetOutMessage *message, Core::tick_t now, Core::tick_t timeout)
+{
+    assert(message);
+    const uint32_t sequenceNumber = (uint32_t)message->GetSequenceNumber();
+
+    // Two messages in flight map to the same slot, make room.
+    while(slots[sequenceNumber & mask].message && slots[sequenceNumber & mask].sequenceNumber != sequenceNumber)
+        Grow();
+
+    Entry &entry = slots[sequenceNumber & mask];
+    if (entry.message)
+        return false;
+
+    entry.message = message;
+    entry.sequenceNumber = sequenceNumber;
+    entry.sendTime = now;
+    entry.timeout = timeout;
+    entry.deadline = now + timeout;
+    entry.resent = false;
+
+    if (count == 0 || entry.deadline < nextDeadline)
+        nextDeadline = entry.deadline;
+    ++count;
+    bytesInFlight += message->GetData().size();
+    return true;
+}
+
+NetOutMessage *ReliableMessageWindow::Remove(uint32_t sequenceNumber, Entry *removed)
+{
+    Entry &entry = slots[sequenceNumber & mask];
+    if (!entry.message || entry.sequenceNumber != sequenceNumber)
+        return 0;
+
+    if (removed)
+        *removed = entry;
+
+    NetOutMessage *message = entry.message;
+    entry.message = 0;
+    --count;
+    bytesInFlight -= message->GetData().size();
+    // The next deadline is left as is. At worst CollectTimedOut() is called once in vain and corrects it.
+    return message;
+}
+
+void ReliableMessageWindow::CollectTimedOut(Core::tick_t now, std::vector<Entry*> &timedOut)
+{
+    timedOut.clear();
+    if (count == 0 || now < nextDeadline)
+        return;
+
+    bool first = true;
+    for(size_t i = 0; i < slots.size(); ++i)
+    {
+        Entry &entry = slots[i];
+        if (!entry.message)
+            continue;
+
+        if (entry.deadline <= now)
+            timedOut.push_back(&entry);
+        else if (first || entry.deadline < nextDeadline)
+        {
+            nextDeadline = entry.deadline;
+            first = false;
+        }
+    }
+
+    // All the messages timed out, Reschedule() will set the next deadline.
+    if (first)
+        nextDeadline = (Core::tick_t)(-1) >> 1;
+}
+
+void ReliableMessageWindow::Reschedule(Entry *entry, Core::tick_t now)
+{
+    assert(entry && entry->message);
+    entry->sendTime = now;
+    entry->deadline = now + entry->timeout;
+    entry->resent = true;
+    if (entry->deadline < nextDeadline)
+        nextDeadline = entry->deadline;
+}
+
+void ReliableMessageWindow::Clear(std::vector<NetOutMessage*> &messages)
+{
+    for(size_t i = 0; i < slots.size(); ++i)
+        if (slots[i].message)
+        {
+            messages.push_back(slots[i].message);
+            slots[i].message = 0;
+        }
+
+    count = 0;
+    bytesInFlight = 0;
+    nextDeadline = 0;
+}
+
+void ReliableMessageWindow::Grow()
+{
+    std::vector<Entry> oldSlots(slots.size() * 2);
+    oldSlots.swap(slots);
+    mask = slots.size() - 1;
+
+    for(size_t i = 0; i < slots.size(); ++i)
+        slots[i].message = 0;
+
+    for(size_t i = 0; i < oldSlots.size(); ++i)
+        if (oldSlots[i].message)
+            slots[oldSlots[i].sequenceNumber & mask] = oldSlots[i];
+}
+
+ReceivedSequenceWindow::ReceivedSequenceWindow()
+{
+    Clear();
+}
+
+void ReceivedSequenceWindow::Clear()
+{
+    memset(bits, 0, sizeof(bits));
+    highest = 0;
+    first = 0;
+    empty = true;
+}
+
+bool ReceivedSequenceWindow::Insert(uint32_t sequenceNumber, size_t &lostCount)
+{
+    lostCount = 0;
+
+    if (empty)
+    {
+        highest = sequenceNumber;
+        first = sequenceNumber;
+        empty = false;
+        Set(sequenceNumber);
+        return true;
+    }
+
+    const int32_t diff = (int32_t)(sequenceNumber - highest);
+    if (diff > 0)
+    {
+        if ((uint32_t)diff >= cWindowSize)
+        {
+            // A jump over the whole window is more likely a corrupted or spoofed packet than a burst of
+            // lost packets, so restart the window without counting losses.
+            memset(bits, 0, sizeof(bits));
+            first = sequenceNumber;
+        }
+        else
+        {
+            // Slide the window forward. The slots being reused belonged to the sequence numbers that now
+            // fall out of the window. If any of those never arrived, it is counted as lost.
+            for(uint32_t s = highest + 1; s != sequenceNumber + 1; ++s)
+            {
+                const uint32_t old = s - cWindowSize;
+                if ((int32_t)(old - first) >= 0 && !IsSet(old))
+                    ++lostCount;
+                Unset(s);
+            }
+        }
+
+        highest = sequenceNumber;
+        Set(sequenceNumber);
+        return true;
+    }
+
+    // Too old to tell, accept it rather than risk dropping a packet that was never processed.
+    if ((uint32_t)(-diff) >= cWindowSize)
+        return true;
+
+    if (IsSet(sequenceNumber))
+        return false;
+
+    Set(sequenceNumber);
+    return true;
+}
+
+}
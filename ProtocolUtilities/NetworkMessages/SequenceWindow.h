@@ -0,0 +1,141 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+#ifndef incl_ProtocolUtilities_SequenceWindow_h
+#define incl_ProtocolUtilities_SequenceWindow_h
+
+#include <vector>
+
+#include "RexTypes.h"
+#include "HighPerfClock.h"
+
+namespace ProtocolUtilities
+{
+    class NetOutMessage;
+
+    /// Holds the reliable outbound messages that are waiting for an ACK, indexed by their sequence number. Adding and
+    /// ACKing a message are O(1). The window grows if two messages in flight would map to the same slot.
+    class ReliableMessageWindow
+    {
+    public:
+        /// A reliable message in flight.
+        struct Entry
+        {
+            /// The message, or 0 if the slot is free.
+            NetOutMessage *message;
+
+            /// The sequence number of the message.
+            uint32_t sequenceNumber;
+
+            /// The time the message was last sent.
+            Core::tick_t sendTime;
+
+            /// The time the message is resent if no ACK has arrived by then.
+            Core::tick_t deadline;
+
+            /// The current retransmit timeout of this message, in clock ticks. Doubled on each resend.
+            Core::tick_t timeout;
+
+            /// True if the message has been resent. Round-trip time is not sampled from resent messages, as it is
+            /// unknown which send the ACK is for.
+            bool resent;
+        };
+
+        /// @param initialCapacity The initial number of slots. Must be a power of two.
+        explicit ReliableMessageWindow(size_t initialCapacity = 256);
+
+        /// Adds a sent message to the window.
+        /// @param now The time the message was sent.
+        /// @param timeout The retransmit timeout, in clock ticks.
+        /// @return False if a message with the same sequence number is already in the window.
+        bool Add(NetOutMessage *message, Core::tick_t now, Core::tick_t timeout);
+
+        /// Removes an ACKed message from the window.
+        /// @param removed [out] If not null, the entry of the removed message is copied here.
+        /// @return The removed message, or 0 if no message with the sequence number was in the window.
+        NetOutMessage *Remove(uint32_t sequenceNumber, Entry *removed = 0);
+
+        /// @return The message with the given sequence number, or 0 if it is not in the window.
+        NetOutMessage *Find(uint32_t sequenceNumber) const
+        {
+            const Entry &entry = slots[sequenceNumber & mask];
+            return (entry.message && entry.sequenceNumber == sequenceNumber) ? entry.message : 0;
+        }
+
+        /// @return The earliest time any of the messages needs to be resent.
+        Core::tick_t GetNextDeadline() const { return nextDeadline; }
+
+        /// Collects the messages whose deadline has passed. The collected entries should be resent and given a new
+        /// deadline with Reschedule(). The pointers are valid until the window is next modified.
+        void CollectTimedOut(Core::tick_t now, std::vector<Entry*> &timedOut);
+
+        /// Sets a new deadline for a message that was resent.
+        void Reschedule(Entry *entry, Core::tick_t now);
+
+        /// Removes all messages from the window.
+        /// @param messages [out] The removed messages are appended here.
+        void Clear(std::vector<NetOutMessage*> &messages);
+
+        /// @return The number of messages in the window.
+        size_t GetSize() const { return count; }
+
+        /// @return The number of bytes in the messages in the window.
+        size_t GetBytesInFlight() const { return bytesInFlight; }
+
+    private:
+        /// Doubles the number of slots.
+        void Grow();
+
+        /// The slots, indexed by sequence number modulo the slot count.
+        std::vector<Entry> slots;
+
+        /// Mask for mapping a sequence number to a slot index.
+        size_t mask;
+
+        /// The number of messages in the window.
+        size_t count;
+
+        /// The number of bytes in the messages in the window.
+        size_t bytesInFlight;
+
+        /// The earliest deadline of the messages in the window.
+        Core::tick_t nextDeadline;
+    };
+
+    /// Remembers which of the most recent inbound sequence numbers have been received, as a bitmap that slides
+    /// forward with the highest received sequence number. Detects duplicates in O(1), and counts the packets that
+    /// slid out of the window without ever arriving as lost.
+    class ReceivedSequenceWindow
+    {
+    public:
+        /// The number of sequence numbers the window remembers.
+        static const uint32_t cWindowSize = 512;
+
+        ReceivedSequenceWindow();
+
+        /// Marks a sequence number as received.
+        /// @param lostCount [out] The number of packets that slid out of the window without arriving is returned here.
+        /// @return False if the sequence number had already been received.
+        bool Insert(uint32_t sequenceNumber, size_t &lostCount);
+
+        /// Forgets all received sequence numbers.
+        void Clear();
+
+    private:
+        bool IsSet(uint32_t sequenceNumber) const { return (bits[(sequenceNumber % cWindowSize) / 32] & (1u << (sequenceNumber % 32))) != 0; }
+        void Set(uint32_t sequenceNumber) { bits[(sequenceNumber % cWindowSize) / 32] |= 1u << (sequenceNumber % 32); }
+        void Unset(uint32_t sequenceNumber) { bits[(sequenceNumber % cWindowSize) / 32] &= ~(1u << (sequenceNumber % 32)); }
+
+        /// One bit per sequence number in the window.
+        uint32_t bits[cWindowSize / 32];
+
+        /// The highest received sequence number.
+        uint32_t highest;
+
+        /// The first received sequence number. Packets before it are not counted as lost.
+        uint32_t first;
+
+        /// True if nothing has been received yet.
+        bool empty;
+    };
+}
+
+#endif
@@ -0,0 +1,12807 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+// This file is automatically generated from the message template file by NetMessageList::GenerateCodecFiles.
+#include "StableHeaders.h"
+
+#include "RexProtocolMessages.h"
+
+namespace ProtocolUtilities
+{
+namespace Messages
+{
+
+    bool StartPingCheck::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(PingID.PingID);
+        reader.Read(PingID.OldestUnacked);
+        return reader.IsValid();
+    }
+
+    void StartPingCheck::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(PingID.PingID);
+        writer.Write(PingID.OldestUnacked);
+    }
+
+    bool CompletePingCheck::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(PingID.PingID);
+        return reader.IsValid();
+    }
+
+    void CompletePingCheck::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(PingID.PingID);
+    }
+
+    bool NeighborList::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        for(size_t i = 0; i < 4; ++i)
+        {
+            reader.Read(NeighborBlock[i].IP);
+            reader.Read(NeighborBlock[i].Port);
+            reader.Read(NeighborBlock[i].PublicIP);
+            reader.Read(NeighborBlock[i].PublicPort);
+            reader.Read(NeighborBlock[i].RegionID);
+            reader.ReadVariable1(NeighborBlock[i].Name);
+            reader.Read(NeighborBlock[i].SimAccess);
+        }
+        return reader.IsValid();
+    }
+
+    void NeighborList::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        for(size_t i = 0; i < 4; ++i)
+        {
+            writer.Write(NeighborBlock[i].IP);
+            writer.Write(NeighborBlock[i].Port);
+            writer.Write(NeighborBlock[i].PublicIP);
+            writer.Write(NeighborBlock[i].PublicPort);
+            writer.Write(NeighborBlock[i].RegionID);
+            writer.WriteVariable1(NeighborBlock[i].Name);
+            writer.Write(NeighborBlock[i].SimAccess);
+        }
+    }
+
+    bool AgentUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.BodyRotation);
+        reader.Read(AgentData.HeadRotation);
+        reader.Read(AgentData.State);
+        reader.Read(AgentData.CameraCenter);
+        reader.Read(AgentData.CameraAtAxis);
+        reader.Read(AgentData.CameraLeftAxis);
+        reader.Read(AgentData.CameraUpAxis);
+        reader.Read(AgentData.Far);
+        reader.Read(AgentData.ControlFlags);
+        reader.Read(AgentData.Flags);
+        return reader.IsValid();
+    }
+
+    void AgentUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.BodyRotation);
+        writer.Write(AgentData.HeadRotation);
+        writer.Write(AgentData.State);
+        writer.Write(AgentData.CameraCenter);
+        writer.Write(AgentData.CameraAtAxis);
+        writer.Write(AgentData.CameraLeftAxis);
+        writer.Write(AgentData.CameraUpAxis);
+        writer.Write(AgentData.Far);
+        writer.Write(AgentData.ControlFlags);
+        writer.Write(AgentData.Flags);
+    }
+
+    bool AgentAnimation::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        AnimationList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AnimationList.size(); ++i)
+        {
+            reader.Read(AnimationList[i].AnimID);
+            reader.Read(AnimationList[i].StartAnim);
+        }
+        PhysicalAvatarEventList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < PhysicalAvatarEventList.size(); ++i)
+        {
+            reader.ReadVariable1(PhysicalAvatarEventList[i].TypeData);
+        }
+        return reader.IsValid();
+    }
+
+    void AgentAnimation::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(AnimationList.size());
+        for(size_t i = 0; i < AnimationList.size(); ++i)
+        {
+            writer.Write(AnimationList[i].AnimID);
+            writer.Write(AnimationList[i].StartAnim);
+        }
+        writer.WriteBlockCount(PhysicalAvatarEventList.size());
+        for(size_t i = 0; i < PhysicalAvatarEventList.size(); ++i)
+        {
+            writer.WriteVariable1(PhysicalAvatarEventList[i].TypeData);
+        }
+    }
+
+    bool AgentRequestSit::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(TargetObject.TargetID);
+        reader.Read(TargetObject.Offset);
+        return reader.IsValid();
+    }
+
+    void AgentRequestSit::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(TargetObject.TargetID);
+        writer.Write(TargetObject.Offset);
+    }
+
+    bool AgentSit::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void AgentSit::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool RequestImage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        RequestImage_.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RequestImage_.size(); ++i)
+        {
+            reader.Read(RequestImage_[i].Image);
+            reader.Read(RequestImage_[i].DiscardLevel);
+            reader.Read(RequestImage_[i].DownloadPriority);
+            reader.Read(RequestImage_[i].Packet);
+            reader.Read(RequestImage_[i].Type);
+        }
+        return reader.IsValid();
+    }
+
+    void RequestImage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(RequestImage_.size());
+        for(size_t i = 0; i < RequestImage_.size(); ++i)
+        {
+            writer.Write(RequestImage_[i].Image);
+            writer.Write(RequestImage_[i].DiscardLevel);
+            writer.Write(RequestImage_[i].DownloadPriority);
+            writer.Write(RequestImage_[i].Packet);
+            writer.Write(RequestImage_[i].Type);
+        }
+    }
+
+    bool ImageData::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ImageID.ID);
+        reader.Read(ImageID.Codec);
+        reader.Read(ImageID.Size);
+        reader.Read(ImageID.Packets);
+        reader.ReadVariable2(ImageData_.Data);
+        return reader.IsValid();
+    }
+
+    void ImageData::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ImageID.ID);
+        writer.Write(ImageID.Codec);
+        writer.Write(ImageID.Size);
+        writer.Write(ImageID.Packets);
+        writer.WriteVariable2(ImageData_.Data);
+    }
+
+    bool ImagePacket::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ImageID.ID);
+        reader.Read(ImageID.Packet);
+        reader.ReadVariable2(ImageData.Data);
+        return reader.IsValid();
+    }
+
+    void ImagePacket::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ImageID.ID);
+        writer.Write(ImageID.Packet);
+        writer.WriteVariable2(ImageData.Data);
+    }
+
+    bool LayerData::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(LayerID.Type);
+        reader.ReadVariable2(LayerData_.Data);
+        return reader.IsValid();
+    }
+
+    void LayerData::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(LayerID.Type);
+        writer.WriteVariable2(LayerData_.Data);
+    }
+
+    bool ObjectUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RegionData.RegionHandle);
+        reader.Read(RegionData.TimeDilation);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ID);
+            reader.Read(ObjectData[i].State);
+            reader.Read(ObjectData[i].FullID);
+            reader.Read(ObjectData[i].CRC);
+            reader.Read(ObjectData[i].PCode);
+            reader.Read(ObjectData[i].Material);
+            reader.Read(ObjectData[i].ClickAction);
+            reader.Read(ObjectData[i].Scale);
+            reader.ReadVariable1(ObjectData[i].ObjectData);
+            reader.Read(ObjectData[i].ParentID);
+            reader.Read(ObjectData[i].UpdateFlags);
+            reader.Read(ObjectData[i].PathCurve);
+            reader.Read(ObjectData[i].ProfileCurve);
+            reader.Read(ObjectData[i].PathBegin);
+            reader.Read(ObjectData[i].PathEnd);
+            reader.Read(ObjectData[i].PathScaleX);
+            reader.Read(ObjectData[i].PathScaleY);
+            reader.Read(ObjectData[i].PathShearX);
+            reader.Read(ObjectData[i].PathShearY);
+            reader.Read(ObjectData[i].PathTwist);
+            reader.Read(ObjectData[i].PathTwistBegin);
+            reader.Read(ObjectData[i].PathRadiusOffset);
+            reader.Read(ObjectData[i].PathTaperX);
+            reader.Read(ObjectData[i].PathTaperY);
+            reader.Read(ObjectData[i].PathRevolutions);
+            reader.Read(ObjectData[i].PathSkew);
+            reader.Read(ObjectData[i].ProfileBegin);
+            reader.Read(ObjectData[i].ProfileEnd);
+            reader.Read(ObjectData[i].ProfileHollow);
+            reader.ReadVariable2(ObjectData[i].TextureEntry);
+            reader.ReadVariable1(ObjectData[i].TextureAnim);
+            reader.ReadVariable2(ObjectData[i].NameValue);
+            reader.ReadVariable2(ObjectData[i].Data);
+            reader.ReadVariable1(ObjectData[i].Text);
+            reader.ReadFixed(ObjectData[i].TextColor, 4);
+            reader.ReadVariable1(ObjectData[i].MediaURL);
+            reader.ReadVariable1(ObjectData[i].PSBlock);
+            reader.ReadVariable1(ObjectData[i].ExtraParams);
+            reader.Read(ObjectData[i].Sound);
+            reader.Read(ObjectData[i].OwnerID);
+            reader.Read(ObjectData[i].Gain);
+            reader.Read(ObjectData[i].Flags);
+            reader.Read(ObjectData[i].Radius);
+            reader.Read(ObjectData[i].JointType);
+            reader.Read(ObjectData[i].JointPivot);
+            reader.Read(ObjectData[i].JointAxisOrAnchor);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RegionData.RegionHandle);
+        writer.Write(RegionData.TimeDilation);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ID);
+            writer.Write(ObjectData[i].State);
+            writer.Write(ObjectData[i].FullID);
+            writer.Write(ObjectData[i].CRC);
+            writer.Write(ObjectData[i].PCode);
+            writer.Write(ObjectData[i].Material);
+            writer.Write(ObjectData[i].ClickAction);
+            writer.Write(ObjectData[i].Scale);
+            writer.WriteVariable1(ObjectData[i].ObjectData);
+            writer.Write(ObjectData[i].ParentID);
+            writer.Write(ObjectData[i].UpdateFlags);
+            writer.Write(ObjectData[i].PathCurve);
+            writer.Write(ObjectData[i].ProfileCurve);
+            writer.Write(ObjectData[i].PathBegin);
+            writer.Write(ObjectData[i].PathEnd);
+            writer.Write(ObjectData[i].PathScaleX);
+            writer.Write(ObjectData[i].PathScaleY);
+            writer.Write(ObjectData[i].PathShearX);
+            writer.Write(ObjectData[i].PathShearY);
+            writer.Write(ObjectData[i].PathTwist);
+            writer.Write(ObjectData[i].PathTwistBegin);
+            writer.Write(ObjectData[i].PathRadiusOffset);
+            writer.Write(ObjectData[i].PathTaperX);
+            writer.Write(ObjectData[i].PathTaperY);
+            writer.Write(ObjectData[i].PathRevolutions);
+            writer.Write(ObjectData[i].PathSkew);
+            writer.Write(ObjectData[i].ProfileBegin);
+            writer.Write(ObjectData[i].ProfileEnd);
+            writer.Write(ObjectData[i].ProfileHollow);
+            writer.WriteVariable2(ObjectData[i].TextureEntry);
+            writer.WriteVariable1(ObjectData[i].TextureAnim);
+            writer.WriteVariable2(ObjectData[i].NameValue);
+            writer.WriteVariable2(ObjectData[i].Data);
+            writer.WriteVariable1(ObjectData[i].Text);
+            writer.WriteFixed(ObjectData[i].TextColor, 4);
+            writer.WriteVariable1(ObjectData[i].MediaURL);
+            writer.WriteVariable1(ObjectData[i].PSBlock);
+            writer.WriteVariable1(ObjectData[i].ExtraParams);
+            writer.Write(ObjectData[i].Sound);
+            writer.Write(ObjectData[i].OwnerID);
+            writer.Write(ObjectData[i].Gain);
+            writer.Write(ObjectData[i].Flags);
+            writer.Write(ObjectData[i].Radius);
+            writer.Write(ObjectData[i].JointType);
+            writer.Write(ObjectData[i].JointPivot);
+            writer.Write(ObjectData[i].JointAxisOrAnchor);
+        }
+    }
+
+    bool ObjectUpdateCompressed::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RegionData.RegionHandle);
+        reader.Read(RegionData.TimeDilation);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].UpdateFlags);
+            reader.ReadVariable2(ObjectData[i].Data);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectUpdateCompressed::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RegionData.RegionHandle);
+        writer.Write(RegionData.TimeDilation);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].UpdateFlags);
+            writer.WriteVariable2(ObjectData[i].Data);
+        }
+    }
+
+    bool ObjectUpdateCached::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RegionData.RegionHandle);
+        reader.Read(RegionData.TimeDilation);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ID);
+            reader.Read(ObjectData[i].CRC);
+            reader.Read(ObjectData[i].UpdateFlags);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectUpdateCached::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RegionData.RegionHandle);
+        writer.Write(RegionData.TimeDilation);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ID);
+            writer.Write(ObjectData[i].CRC);
+            writer.Write(ObjectData[i].UpdateFlags);
+        }
+    }
+
+    bool ImprovedTerseObjectUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RegionData.RegionHandle);
+        reader.Read(RegionData.TimeDilation);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.ReadVariable1(ObjectData[i].Data);
+            reader.ReadVariable2(ObjectData[i].TextureEntry);
+        }
+        return reader.IsValid();
+    }
+
+    void ImprovedTerseObjectUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RegionData.RegionHandle);
+        writer.Write(RegionData.TimeDilation);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.WriteVariable1(ObjectData[i].Data);
+            writer.WriteVariable2(ObjectData[i].TextureEntry);
+        }
+    }
+
+    bool KillObject::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ID);
+        }
+        return reader.IsValid();
+    }
+
+    void KillObject::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ID);
+        }
+    }
+
+    bool TransferPacket::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TransferData.TransferID);
+        reader.Read(TransferData.ChannelType);
+        reader.Read(TransferData.Packet);
+        reader.Read(TransferData.Status);
+        reader.ReadVariable2(TransferData.Data);
+        return reader.IsValid();
+    }
+
+    void TransferPacket::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TransferData.TransferID);
+        writer.Write(TransferData.ChannelType);
+        writer.Write(TransferData.Packet);
+        writer.Write(TransferData.Status);
+        writer.WriteVariable2(TransferData.Data);
+    }
+
+    bool SendXferPacket::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(XferID.ID);
+        reader.Read(XferID.Packet);
+        reader.ReadVariable2(DataPacket.Data);
+        return reader.IsValid();
+    }
+
+    void SendXferPacket::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(XferID.ID);
+        writer.Write(XferID.Packet);
+        writer.WriteVariable2(DataPacket.Data);
+    }
+
+    bool ConfirmXferPacket::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(XferID.ID);
+        reader.Read(XferID.Packet);
+        return reader.IsValid();
+    }
+
+    void ConfirmXferPacket::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(XferID.ID);
+        writer.Write(XferID.Packet);
+    }
+
+    bool AvatarAnimation::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Sender.ID);
+        AnimationList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AnimationList.size(); ++i)
+        {
+            reader.Read(AnimationList[i].AnimID);
+            reader.Read(AnimationList[i].AnimSequenceID);
+        }
+        AnimationSourceList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AnimationSourceList.size(); ++i)
+        {
+            reader.Read(AnimationSourceList[i].ObjectID);
+        }
+        PhysicalAvatarEventList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < PhysicalAvatarEventList.size(); ++i)
+        {
+            reader.ReadVariable1(PhysicalAvatarEventList[i].TypeData);
+        }
+        return reader.IsValid();
+    }
+
+    void AvatarAnimation::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Sender.ID);
+        writer.WriteBlockCount(AnimationList.size());
+        for(size_t i = 0; i < AnimationList.size(); ++i)
+        {
+            writer.Write(AnimationList[i].AnimID);
+            writer.Write(AnimationList[i].AnimSequenceID);
+        }
+        writer.WriteBlockCount(AnimationSourceList.size());
+        for(size_t i = 0; i < AnimationSourceList.size(); ++i)
+        {
+            writer.Write(AnimationSourceList[i].ObjectID);
+        }
+        writer.WriteBlockCount(PhysicalAvatarEventList.size());
+        for(size_t i = 0; i < PhysicalAvatarEventList.size(); ++i)
+        {
+            writer.WriteVariable1(PhysicalAvatarEventList[i].TypeData);
+        }
+    }
+
+    bool AvatarSitResponse::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SitObject.ID);
+        reader.Read(SitTransform.AutoPilot);
+        reader.Read(SitTransform.SitPosition);
+        reader.Read(SitTransform.SitRotation);
+        reader.Read(SitTransform.CameraEyeOffset);
+        reader.Read(SitTransform.CameraAtOffset);
+        reader.Read(SitTransform.ForceMouselook);
+        return reader.IsValid();
+    }
+
+    void AvatarSitResponse::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SitObject.ID);
+        writer.Write(SitTransform.AutoPilot);
+        writer.Write(SitTransform.SitPosition);
+        writer.Write(SitTransform.SitRotation);
+        writer.Write(SitTransform.CameraEyeOffset);
+        writer.Write(SitTransform.CameraAtOffset);
+        writer.Write(SitTransform.ForceMouselook);
+    }
+
+    bool CameraConstraint::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(CameraCollidePlane.Plane);
+        return reader.IsValid();
+    }
+
+    void CameraConstraint::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(CameraCollidePlane.Plane);
+    }
+
+    bool ParcelProperties::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ParcelData.RequestResult);
+        reader.Read(ParcelData.SequenceID);
+        reader.Read(ParcelData.SnapSelection);
+        reader.Read(ParcelData.SelfCount);
+        reader.Read(ParcelData.OtherCount);
+        reader.Read(ParcelData.PublicCount);
+        reader.Read(ParcelData.LocalID);
+        reader.Read(ParcelData.OwnerID);
+        reader.Read(ParcelData.IsGroupOwned);
+        reader.Read(ParcelData.AuctionID);
+        reader.Read(ParcelData.ClaimDate);
+        reader.Read(ParcelData.ClaimPrice);
+        reader.Read(ParcelData.RentPrice);
+        reader.Read(ParcelData.AABBMin);
+        reader.Read(ParcelData.AABBMax);
+        reader.ReadVariable2(ParcelData.Bitmap);
+        reader.Read(ParcelData.Area);
+        reader.Read(ParcelData.Status);
+        reader.Read(ParcelData.SimWideMaxPrims);
+        reader.Read(ParcelData.SimWideTotalPrims);
+        reader.Read(ParcelData.MaxPrims);
+        reader.Read(ParcelData.TotalPrims);
+        reader.Read(ParcelData.OwnerPrims);
+        reader.Read(ParcelData.GroupPrims);
+        reader.Read(ParcelData.OtherPrims);
+        reader.Read(ParcelData.SelectedPrims);
+        reader.Read(ParcelData.ParcelPrimBonus);
+        reader.Read(ParcelData.OtherCleanTime);
+        reader.Read(ParcelData.ParcelFlags);
+        reader.Read(ParcelData.SalePrice);
+        reader.ReadVariable1(ParcelData.Name);
+        reader.ReadVariable1(ParcelData.Desc);
+        reader.ReadVariable1(ParcelData.MusicURL);
+        reader.ReadVariable1(ParcelData.MediaURL);
+        reader.Read(ParcelData.MediaID);
+        reader.Read(ParcelData.MediaAutoScale);
+        reader.Read(ParcelData.GroupID);
+        reader.Read(ParcelData.PassPrice);
+        reader.Read(ParcelData.PassHours);
+        reader.Read(ParcelData.Category);
+        reader.Read(ParcelData.AuthBuyerID);
+        reader.Read(ParcelData.SnapshotID);
+        reader.Read(ParcelData.UserLocation);
+        reader.Read(ParcelData.UserLookAt);
+        reader.Read(ParcelData.LandingType);
+        reader.Read(ParcelData.RegionPushOverride);
+        reader.Read(ParcelData.RegionDenyAnonymous);
+        reader.Read(ParcelData.RegionDenyIdentified);
+        reader.Read(ParcelData.RegionDenyTransacted);
+        reader.Read(AgeVerificationBlock.RegionDenyAgeUnverified);
+        return reader.IsValid();
+    }
+
+    void ParcelProperties::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ParcelData.RequestResult);
+        writer.Write(ParcelData.SequenceID);
+        writer.Write(ParcelData.SnapSelection);
+        writer.Write(ParcelData.SelfCount);
+        writer.Write(ParcelData.OtherCount);
+        writer.Write(ParcelData.PublicCount);
+        writer.Write(ParcelData.LocalID);
+        writer.Write(ParcelData.OwnerID);
+        writer.Write(ParcelData.IsGroupOwned);
+        writer.Write(ParcelData.AuctionID);
+        writer.Write(ParcelData.ClaimDate);
+        writer.Write(ParcelData.ClaimPrice);
+        writer.Write(ParcelData.RentPrice);
+        writer.Write(ParcelData.AABBMin);
+        writer.Write(ParcelData.AABBMax);
+        writer.WriteVariable2(ParcelData.Bitmap);
+        writer.Write(ParcelData.Area);
+        writer.Write(ParcelData.Status);
+        writer.Write(ParcelData.SimWideMaxPrims);
+        writer.Write(ParcelData.SimWideTotalPrims);
+        writer.Write(ParcelData.MaxPrims);
+        writer.Write(ParcelData.TotalPrims);
+        writer.Write(ParcelData.OwnerPrims);
+        writer.Write(ParcelData.GroupPrims);
+        writer.Write(ParcelData.OtherPrims);
+        writer.Write(ParcelData.SelectedPrims);
+        writer.Write(ParcelData.ParcelPrimBonus);
+        writer.Write(ParcelData.OtherCleanTime);
+        writer.Write(ParcelData.ParcelFlags);
+        writer.Write(ParcelData.SalePrice);
+        writer.WriteVariable1(ParcelData.Name);
+        writer.WriteVariable1(ParcelData.Desc);
+        writer.WriteVariable1(ParcelData.MusicURL);
+        writer.WriteVariable1(ParcelData.MediaURL);
+        writer.Write(ParcelData.MediaID);
+        writer.Write(ParcelData.MediaAutoScale);
+        writer.Write(ParcelData.GroupID);
+        writer.Write(ParcelData.PassPrice);
+        writer.Write(ParcelData.PassHours);
+        writer.Write(ParcelData.Category);
+        writer.Write(ParcelData.AuthBuyerID);
+        writer.Write(ParcelData.SnapshotID);
+        writer.Write(ParcelData.UserLocation);
+        writer.Write(ParcelData.UserLookAt);
+        writer.Write(ParcelData.LandingType);
+        writer.Write(ParcelData.RegionPushOverride);
+        writer.Write(ParcelData.RegionDenyAnonymous);
+        writer.Write(ParcelData.RegionDenyIdentified);
+        writer.Write(ParcelData.RegionDenyTransacted);
+        writer.Write(AgeVerificationBlock.RegionDenyAgeUnverified);
+    }
+
+    bool EdgeDataPacket::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(EdgeData.LayerType);
+        reader.Read(EdgeData.Direction);
+        reader.ReadVariable2(EdgeData.LayerData);
+        return reader.IsValid();
+    }
+
+    void EdgeDataPacket::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(EdgeData.LayerType);
+        writer.Write(EdgeData.Direction);
+        writer.WriteVariable2(EdgeData.LayerData);
+    }
+
+    bool ChildAgentUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.RegionHandle);
+        reader.Read(AgentData.ViewerCircuitCode);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.AgentPos);
+        reader.Read(AgentData.AgentVel);
+        reader.Read(AgentData.Center);
+        reader.Read(AgentData.Size);
+        reader.Read(AgentData.AtAxis);
+        reader.Read(AgentData.LeftAxis);
+        reader.Read(AgentData.UpAxis);
+        reader.Read(AgentData.ChangedGrid);
+        reader.Read(AgentData.Far);
+        reader.Read(AgentData.Aspect);
+        reader.ReadVariable1(AgentData.Throttles);
+        reader.Read(AgentData.LocomotionState);
+        reader.Read(AgentData.HeadRotation);
+        reader.Read(AgentData.BodyRotation);
+        reader.Read(AgentData.ControlFlags);
+        reader.Read(AgentData.EnergyLevel);
+        reader.Read(AgentData.GodLevel);
+        reader.Read(AgentData.AlwaysRun);
+        reader.Read(AgentData.PreyAgent);
+        reader.Read(AgentData.AgentAccess);
+        reader.ReadVariable2(AgentData.AgentTextures);
+        reader.Read(AgentData.ActiveGroupID);
+        GroupData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            reader.Read(GroupData[i].GroupID);
+            reader.Read(GroupData[i].GroupPowers);
+            reader.Read(GroupData[i].AcceptNotices);
+        }
+        AnimationData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AnimationData.size(); ++i)
+        {
+            reader.Read(AnimationData[i].Animation);
+            reader.Read(AnimationData[i].ObjectID);
+        }
+        GranterBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < GranterBlock.size(); ++i)
+        {
+            reader.Read(GranterBlock[i].GranterID);
+        }
+        NVPairData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < NVPairData.size(); ++i)
+        {
+            reader.ReadVariable2(NVPairData[i].NVPairs);
+        }
+        VisualParam.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < VisualParam.size(); ++i)
+        {
+            reader.Read(VisualParam[i].ParamValue);
+        }
+        return reader.IsValid();
+    }
+
+    void ChildAgentUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.RegionHandle);
+        writer.Write(AgentData.ViewerCircuitCode);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.AgentPos);
+        writer.Write(AgentData.AgentVel);
+        writer.Write(AgentData.Center);
+        writer.Write(AgentData.Size);
+        writer.Write(AgentData.AtAxis);
+        writer.Write(AgentData.LeftAxis);
+        writer.Write(AgentData.UpAxis);
+        writer.Write(AgentData.ChangedGrid);
+        writer.Write(AgentData.Far);
+        writer.Write(AgentData.Aspect);
+        writer.WriteVariable1(AgentData.Throttles);
+        writer.Write(AgentData.LocomotionState);
+        writer.Write(AgentData.HeadRotation);
+        writer.Write(AgentData.BodyRotation);
+        writer.Write(AgentData.ControlFlags);
+        writer.Write(AgentData.EnergyLevel);
+        writer.Write(AgentData.GodLevel);
+        writer.Write(AgentData.AlwaysRun);
+        writer.Write(AgentData.PreyAgent);
+        writer.Write(AgentData.AgentAccess);
+        writer.WriteVariable2(AgentData.AgentTextures);
+        writer.Write(AgentData.ActiveGroupID);
+        writer.WriteBlockCount(GroupData.size());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            writer.Write(GroupData[i].GroupID);
+            writer.Write(GroupData[i].GroupPowers);
+            writer.Write(GroupData[i].AcceptNotices);
+        }
+        writer.WriteBlockCount(AnimationData.size());
+        for(size_t i = 0; i < AnimationData.size(); ++i)
+        {
+            writer.Write(AnimationData[i].Animation);
+            writer.Write(AnimationData[i].ObjectID);
+        }
+        writer.WriteBlockCount(GranterBlock.size());
+        for(size_t i = 0; i < GranterBlock.size(); ++i)
+        {
+            writer.Write(GranterBlock[i].GranterID);
+        }
+        writer.WriteBlockCount(NVPairData.size());
+        for(size_t i = 0; i < NVPairData.size(); ++i)
+        {
+            writer.WriteVariable2(NVPairData[i].NVPairs);
+        }
+        writer.WriteBlockCount(VisualParam.size());
+        for(size_t i = 0; i < VisualParam.size(); ++i)
+        {
+            writer.Write(VisualParam[i].ParamValue);
+        }
+    }
+
+    bool ChildAgentAlive::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.RegionHandle);
+        reader.Read(AgentData.ViewerCircuitCode);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void ChildAgentAlive::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.RegionHandle);
+        writer.Write(AgentData.ViewerCircuitCode);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool ChildAgentPositionUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.RegionHandle);
+        reader.Read(AgentData.ViewerCircuitCode);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.AgentPos);
+        reader.Read(AgentData.AgentVel);
+        reader.Read(AgentData.Center);
+        reader.Read(AgentData.Size);
+        reader.Read(AgentData.AtAxis);
+        reader.Read(AgentData.LeftAxis);
+        reader.Read(AgentData.UpAxis);
+        reader.Read(AgentData.ChangedGrid);
+        return reader.IsValid();
+    }
+
+    void ChildAgentPositionUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.RegionHandle);
+        writer.Write(AgentData.ViewerCircuitCode);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.AgentPos);
+        writer.Write(AgentData.AgentVel);
+        writer.Write(AgentData.Center);
+        writer.Write(AgentData.Size);
+        writer.Write(AgentData.AtAxis);
+        writer.Write(AgentData.LeftAxis);
+        writer.Write(AgentData.UpAxis);
+        writer.Write(AgentData.ChangedGrid);
+    }
+
+    bool AtomicPassObject::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TaskData.TaskID);
+        reader.Read(TaskData.AttachmentNeedsSave);
+        return reader.IsValid();
+    }
+
+    void AtomicPassObject::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TaskData.TaskID);
+        writer.Write(TaskData.AttachmentNeedsSave);
+    }
+
+    bool SoundTrigger::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SoundData.SoundID);
+        reader.Read(SoundData.OwnerID);
+        reader.Read(SoundData.ObjectID);
+        reader.Read(SoundData.ParentID);
+        reader.Read(SoundData.Handle);
+        reader.Read(SoundData.Position);
+        reader.Read(SoundData.Gain);
+        return reader.IsValid();
+    }
+
+    void SoundTrigger::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SoundData.SoundID);
+        writer.Write(SoundData.OwnerID);
+        writer.Write(SoundData.ObjectID);
+        writer.Write(SoundData.ParentID);
+        writer.Write(SoundData.Handle);
+        writer.Write(SoundData.Position);
+        writer.Write(SoundData.Gain);
+    }
+
+    bool ObjectAdd::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(ObjectData.PCode);
+        reader.Read(ObjectData.Material);
+        reader.Read(ObjectData.AddFlags);
+        reader.Read(ObjectData.PathCurve);
+        reader.Read(ObjectData.ProfileCurve);
+        reader.Read(ObjectData.PathBegin);
+        reader.Read(ObjectData.PathEnd);
+        reader.Read(ObjectData.PathScaleX);
+        reader.Read(ObjectData.PathScaleY);
+        reader.Read(ObjectData.PathShearX);
+        reader.Read(ObjectData.PathShearY);
+        reader.Read(ObjectData.PathTwist);
+        reader.Read(ObjectData.PathTwistBegin);
+        reader.Read(ObjectData.PathRadiusOffset);
+        reader.Read(ObjectData.PathTaperX);
+        reader.Read(ObjectData.PathTaperY);
+        reader.Read(ObjectData.PathRevolutions);
+        reader.Read(ObjectData.PathSkew);
+        reader.Read(ObjectData.ProfileBegin);
+        reader.Read(ObjectData.ProfileEnd);
+        reader.Read(ObjectData.ProfileHollow);
+        reader.Read(ObjectData.BypassRaycast);
+        reader.Read(ObjectData.RayStart);
+        reader.Read(ObjectData.RayEnd);
+        reader.Read(ObjectData.RayTargetID);
+        reader.Read(ObjectData.RayEndIsIntersection);
+        reader.Read(ObjectData.Scale);
+        reader.Read(ObjectData.Rotation);
+        reader.Read(ObjectData.State);
+        return reader.IsValid();
+    }
+
+    void ObjectAdd::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(ObjectData.PCode);
+        writer.Write(ObjectData.Material);
+        writer.Write(ObjectData.AddFlags);
+        writer.Write(ObjectData.PathCurve);
+        writer.Write(ObjectData.ProfileCurve);
+        writer.Write(ObjectData.PathBegin);
+        writer.Write(ObjectData.PathEnd);
+        writer.Write(ObjectData.PathScaleX);
+        writer.Write(ObjectData.PathScaleY);
+        writer.Write(ObjectData.PathShearX);
+        writer.Write(ObjectData.PathShearY);
+        writer.Write(ObjectData.PathTwist);
+        writer.Write(ObjectData.PathTwistBegin);
+        writer.Write(ObjectData.PathRadiusOffset);
+        writer.Write(ObjectData.PathTaperX);
+        writer.Write(ObjectData.PathTaperY);
+        writer.Write(ObjectData.PathRevolutions);
+        writer.Write(ObjectData.PathSkew);
+        writer.Write(ObjectData.ProfileBegin);
+        writer.Write(ObjectData.ProfileEnd);
+        writer.Write(ObjectData.ProfileHollow);
+        writer.Write(ObjectData.BypassRaycast);
+        writer.Write(ObjectData.RayStart);
+        writer.Write(ObjectData.RayEnd);
+        writer.Write(ObjectData.RayTargetID);
+        writer.Write(ObjectData.RayEndIsIntersection);
+        writer.Write(ObjectData.Scale);
+        writer.Write(ObjectData.Rotation);
+        writer.Write(ObjectData.State);
+    }
+
+    bool MultipleObjectUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].Type);
+            reader.ReadVariable1(ObjectData[i].Data);
+        }
+        return reader.IsValid();
+    }
+
+    void MultipleObjectUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].Type);
+            writer.WriteVariable1(ObjectData[i].Data);
+        }
+    }
+
+    bool RequestMultipleObjects::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].CacheMissType);
+            reader.Read(ObjectData[i].ID);
+        }
+        return reader.IsValid();
+    }
+
+    void RequestMultipleObjects::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].CacheMissType);
+            writer.Write(ObjectData[i].ID);
+        }
+    }
+
+    bool ObjectPosition::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].Position);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectPosition::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].Position);
+        }
+    }
+
+    bool RequestObjectPropertiesFamily::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.RequestFlags);
+        reader.Read(ObjectData.ObjectID);
+        return reader.IsValid();
+    }
+
+    void RequestObjectPropertiesFamily::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.RequestFlags);
+        writer.Write(ObjectData.ObjectID);
+    }
+
+    bool CoarseLocationUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        Location.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Location.size(); ++i)
+        {
+            reader.Read(Location[i].X);
+            reader.Read(Location[i].Y);
+            reader.Read(Location[i].Z);
+        }
+        reader.Read(Index.You);
+        reader.Read(Index.Prey);
+        AgentData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AgentData.size(); ++i)
+        {
+            reader.Read(AgentData[i].AgentID);
+        }
+        return reader.IsValid();
+    }
+
+    void CoarseLocationUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(Location.size());
+        for(size_t i = 0; i < Location.size(); ++i)
+        {
+            writer.Write(Location[i].X);
+            writer.Write(Location[i].Y);
+            writer.Write(Location[i].Z);
+        }
+        writer.Write(Index.You);
+        writer.Write(Index.Prey);
+        writer.WriteBlockCount(AgentData.size());
+        for(size_t i = 0; i < AgentData.size(); ++i)
+        {
+            writer.Write(AgentData[i].AgentID);
+        }
+    }
+
+    bool CrossedRegion::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(RegionData.SimIP);
+        reader.Read(RegionData.SimPort);
+        reader.Read(RegionData.RegionHandle);
+        reader.ReadVariable2(RegionData.SeedCapability);
+        reader.Read(Info.Position);
+        reader.Read(Info.LookAt);
+        return reader.IsValid();
+    }
+
+    void CrossedRegion::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(RegionData.SimIP);
+        writer.Write(RegionData.SimPort);
+        writer.Write(RegionData.RegionHandle);
+        writer.WriteVariable2(RegionData.SeedCapability);
+        writer.Write(Info.Position);
+        writer.Write(Info.LookAt);
+    }
+
+    bool ConfirmEnableSimulator::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void ConfirmEnableSimulator::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool ObjectProperties::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectID);
+            reader.Read(ObjectData[i].CreatorID);
+            reader.Read(ObjectData[i].OwnerID);
+            reader.Read(ObjectData[i].GroupID);
+            reader.Read(ObjectData[i].CreationDate);
+            reader.Read(ObjectData[i].BaseMask);
+            reader.Read(ObjectData[i].OwnerMask);
+            reader.Read(ObjectData[i].GroupMask);
+            reader.Read(ObjectData[i].EveryoneMask);
+            reader.Read(ObjectData[i].NextOwnerMask);
+            reader.Read(ObjectData[i].OwnershipCost);
+            reader.Read(ObjectData[i].SaleType);
+            reader.Read(ObjectData[i].SalePrice);
+            reader.Read(ObjectData[i].AggregatePerms);
+            reader.Read(ObjectData[i].AggregatePermTextures);
+            reader.Read(ObjectData[i].AggregatePermTexturesOwner);
+            reader.Read(ObjectData[i].Category);
+            reader.Read(ObjectData[i].InventorySerial);
+            reader.Read(ObjectData[i].ItemID);
+            reader.Read(ObjectData[i].FolderID);
+            reader.Read(ObjectData[i].FromTaskID);
+            reader.Read(ObjectData[i].LastOwnerID);
+            reader.ReadVariable1(ObjectData[i].Name);
+            reader.ReadVariable1(ObjectData[i].Description);
+            reader.ReadVariable1(ObjectData[i].TouchName);
+            reader.ReadVariable1(ObjectData[i].SitName);
+            reader.ReadVariable1(ObjectData[i].TextureID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectProperties::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectID);
+            writer.Write(ObjectData[i].CreatorID);
+            writer.Write(ObjectData[i].OwnerID);
+            writer.Write(ObjectData[i].GroupID);
+            writer.Write(ObjectData[i].CreationDate);
+            writer.Write(ObjectData[i].BaseMask);
+            writer.Write(ObjectData[i].OwnerMask);
+            writer.Write(ObjectData[i].GroupMask);
+            writer.Write(ObjectData[i].EveryoneMask);
+            writer.Write(ObjectData[i].NextOwnerMask);
+            writer.Write(ObjectData[i].OwnershipCost);
+            writer.Write(ObjectData[i].SaleType);
+            writer.Write(ObjectData[i].SalePrice);
+            writer.Write(ObjectData[i].AggregatePerms);
+            writer.Write(ObjectData[i].AggregatePermTextures);
+            writer.Write(ObjectData[i].AggregatePermTexturesOwner);
+            writer.Write(ObjectData[i].Category);
+            writer.Write(ObjectData[i].InventorySerial);
+            writer.Write(ObjectData[i].ItemID);
+            writer.Write(ObjectData[i].FolderID);
+            writer.Write(ObjectData[i].FromTaskID);
+            writer.Write(ObjectData[i].LastOwnerID);
+            writer.WriteVariable1(ObjectData[i].Name);
+            writer.WriteVariable1(ObjectData[i].Description);
+            writer.WriteVariable1(ObjectData[i].TouchName);
+            writer.WriteVariable1(ObjectData[i].SitName);
+            writer.WriteVariable1(ObjectData[i].TextureID);
+        }
+    }
+
+    bool ObjectPropertiesFamily::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ObjectData.RequestFlags);
+        reader.Read(ObjectData.ObjectID);
+        reader.Read(ObjectData.OwnerID);
+        reader.Read(ObjectData.GroupID);
+        reader.Read(ObjectData.BaseMask);
+        reader.Read(ObjectData.OwnerMask);
+        reader.Read(ObjectData.GroupMask);
+        reader.Read(ObjectData.EveryoneMask);
+        reader.Read(ObjectData.NextOwnerMask);
+        reader.Read(ObjectData.OwnershipCost);
+        reader.Read(ObjectData.SaleType);
+        reader.Read(ObjectData.SalePrice);
+        reader.Read(ObjectData.Category);
+        reader.Read(ObjectData.LastOwnerID);
+        reader.ReadVariable1(ObjectData.Name);
+        reader.ReadVariable1(ObjectData.Description);
+        return reader.IsValid();
+    }
+
+    void ObjectPropertiesFamily::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ObjectData.RequestFlags);
+        writer.Write(ObjectData.ObjectID);
+        writer.Write(ObjectData.OwnerID);
+        writer.Write(ObjectData.GroupID);
+        writer.Write(ObjectData.BaseMask);
+        writer.Write(ObjectData.OwnerMask);
+        writer.Write(ObjectData.GroupMask);
+        writer.Write(ObjectData.EveryoneMask);
+        writer.Write(ObjectData.NextOwnerMask);
+        writer.Write(ObjectData.OwnershipCost);
+        writer.Write(ObjectData.SaleType);
+        writer.Write(ObjectData.SalePrice);
+        writer.Write(ObjectData.Category);
+        writer.Write(ObjectData.LastOwnerID);
+        writer.WriteVariable1(ObjectData.Name);
+        writer.WriteVariable1(ObjectData.Description);
+    }
+
+    bool ParcelPropertiesRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.SequenceID);
+        reader.Read(ParcelData.West);
+        reader.Read(ParcelData.South);
+        reader.Read(ParcelData.East);
+        reader.Read(ParcelData.North);
+        reader.Read(ParcelData.SnapSelection);
+        return reader.IsValid();
+    }
+
+    void ParcelPropertiesRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.SequenceID);
+        writer.Write(ParcelData.West);
+        writer.Write(ParcelData.South);
+        writer.Write(ParcelData.East);
+        writer.Write(ParcelData.North);
+        writer.Write(ParcelData.SnapSelection);
+    }
+
+    bool SimStatus::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SimStatus_.CanAcceptAgents);
+        reader.Read(SimStatus_.CanAcceptTasks);
+        return reader.IsValid();
+    }
+
+    void SimStatus::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SimStatus_.CanAcceptAgents);
+        writer.Write(SimStatus_.CanAcceptTasks);
+    }
+
+    bool AttachedSound::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.SoundID);
+        reader.Read(DataBlock.ObjectID);
+        reader.Read(DataBlock.OwnerID);
+        reader.Read(DataBlock.Gain);
+        reader.Read(DataBlock.Flags);
+        return reader.IsValid();
+    }
+
+    void AttachedSound::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.SoundID);
+        writer.Write(DataBlock.ObjectID);
+        writer.Write(DataBlock.OwnerID);
+        writer.Write(DataBlock.Gain);
+        writer.Write(DataBlock.Flags);
+    }
+
+    bool AttachedSoundGainChange::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.ObjectID);
+        reader.Read(DataBlock.Gain);
+        return reader.IsValid();
+    }
+
+    void AttachedSoundGainChange::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.ObjectID);
+        writer.Write(DataBlock.Gain);
+    }
+
+    bool PreloadSound::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        DataBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            reader.Read(DataBlock[i].ObjectID);
+            reader.Read(DataBlock[i].OwnerID);
+            reader.Read(DataBlock[i].SoundID);
+        }
+        return reader.IsValid();
+    }
+
+    void PreloadSound::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(DataBlock.size());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            writer.Write(DataBlock[i].ObjectID);
+            writer.Write(DataBlock[i].OwnerID);
+            writer.Write(DataBlock[i].SoundID);
+        }
+    }
+
+    bool InternalScriptMail::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(DataBlock.From);
+        reader.Read(DataBlock.To);
+        reader.ReadVariable1(DataBlock.Subject);
+        reader.ReadVariable2(DataBlock.Body);
+        return reader.IsValid();
+    }
+
+    void InternalScriptMail::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(DataBlock.From);
+        writer.Write(DataBlock.To);
+        writer.WriteVariable1(DataBlock.Subject);
+        writer.WriteVariable2(DataBlock.Body);
+    }
+
+    bool ViewerEffect::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        Effect.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Effect.size(); ++i)
+        {
+            reader.Read(Effect[i].ID);
+            reader.Read(Effect[i].AgentID);
+            reader.Read(Effect[i].Type);
+            reader.Read(Effect[i].Duration);
+            reader.ReadFixed(Effect[i].Color, 4);
+            reader.ReadVariable1(Effect[i].TypeData);
+        }
+        return reader.IsValid();
+    }
+
+    void ViewerEffect::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(Effect.size());
+        for(size_t i = 0; i < Effect.size(); ++i)
+        {
+            writer.Write(Effect[i].ID);
+            writer.Write(Effect[i].AgentID);
+            writer.Write(Effect[i].Type);
+            writer.Write(Effect[i].Duration);
+            writer.WriteFixed(Effect[i].Color, 4);
+            writer.WriteVariable1(Effect[i].TypeData);
+        }
+    }
+
+    bool TestMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TestBlock1.Test1);
+        for(size_t i = 0; i < 4; ++i)
+        {
+            reader.Read(NeighborBlock[i].Test0);
+            reader.Read(NeighborBlock[i].Test1);
+            reader.Read(NeighborBlock[i].Test2);
+        }
+        return reader.IsValid();
+    }
+
+    void TestMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TestBlock1.Test1);
+        for(size_t i = 0; i < 4; ++i)
+        {
+            writer.Write(NeighborBlock[i].Test0);
+            writer.Write(NeighborBlock[i].Test1);
+            writer.Write(NeighborBlock[i].Test2);
+        }
+    }
+
+    bool AddCircuitCode::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(CircuitCode.Code);
+        reader.Read(CircuitCode.SessionID);
+        reader.Read(CircuitCode.AgentID);
+        return reader.IsValid();
+    }
+
+    void AddCircuitCode::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(CircuitCode.Code);
+        writer.Write(CircuitCode.SessionID);
+        writer.Write(CircuitCode.AgentID);
+    }
+
+    bool UseCircuitCode::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(CircuitCode.Code);
+        reader.Read(CircuitCode.SessionID);
+        reader.Read(CircuitCode.ID);
+        return reader.IsValid();
+    }
+
+    void UseCircuitCode::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(CircuitCode.Code);
+        writer.Write(CircuitCode.SessionID);
+        writer.Write(CircuitCode.ID);
+    }
+
+    bool AvatarTextureUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.TexturesChanged);
+        WearableData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            reader.Read(WearableData[i].CacheID);
+            reader.Read(WearableData[i].TextureIndex);
+            reader.ReadVariable1(WearableData[i].HostName);
+        }
+        TextureData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < TextureData.size(); ++i)
+        {
+            reader.Read(TextureData[i].TextureID);
+        }
+        return reader.IsValid();
+    }
+
+    void AvatarTextureUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.TexturesChanged);
+        writer.WriteBlockCount(WearableData.size());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            writer.Write(WearableData[i].CacheID);
+            writer.Write(WearableData[i].TextureIndex);
+            writer.WriteVariable1(WearableData[i].HostName);
+        }
+        writer.WriteBlockCount(TextureData.size());
+        for(size_t i = 0; i < TextureData.size(); ++i)
+        {
+            writer.Write(TextureData[i].TextureID);
+        }
+    }
+
+    bool SimulatorMapUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(MapData.Flags);
+        return reader.IsValid();
+    }
+
+    void SimulatorMapUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(MapData.Flags);
+    }
+
+    bool SimulatorSetMap::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(MapData.RegionHandle);
+        reader.Read(MapData.Type);
+        reader.Read(MapData.MapImage);
+        return reader.IsValid();
+    }
+
+    void SimulatorSetMap::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(MapData.RegionHandle);
+        writer.Write(MapData.Type);
+        writer.Write(MapData.MapImage);
+    }
+
+    bool SubscribeLoad::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void SubscribeLoad::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+    bool UnsubscribeLoad::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void UnsubscribeLoad::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+    bool SimulatorReady::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(SimulatorBlock.SimName);
+        reader.Read(SimulatorBlock.SimAccess);
+        reader.Read(SimulatorBlock.RegionFlags);
+        reader.Read(SimulatorBlock.RegionID);
+        reader.Read(SimulatorBlock.EstateID);
+        reader.Read(SimulatorBlock.ParentEstateID);
+        reader.Read(TelehubBlock.HasTelehub);
+        reader.Read(TelehubBlock.TelehubPos);
+        return reader.IsValid();
+    }
+
+    void SimulatorReady::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(SimulatorBlock.SimName);
+        writer.Write(SimulatorBlock.SimAccess);
+        writer.Write(SimulatorBlock.RegionFlags);
+        writer.Write(SimulatorBlock.RegionID);
+        writer.Write(SimulatorBlock.EstateID);
+        writer.Write(SimulatorBlock.ParentEstateID);
+        writer.Write(TelehubBlock.HasTelehub);
+        writer.Write(TelehubBlock.TelehubPos);
+    }
+
+    bool TelehubInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TelehubBlock.ObjectID);
+        reader.ReadVariable1(TelehubBlock.ObjectName);
+        reader.Read(TelehubBlock.TelehubPos);
+        reader.Read(TelehubBlock.TelehubRot);
+        SpawnPointBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < SpawnPointBlock.size(); ++i)
+        {
+            reader.Read(SpawnPointBlock[i].SpawnPointPos);
+        }
+        return reader.IsValid();
+    }
+
+    void TelehubInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TelehubBlock.ObjectID);
+        writer.WriteVariable1(TelehubBlock.ObjectName);
+        writer.Write(TelehubBlock.TelehubPos);
+        writer.Write(TelehubBlock.TelehubRot);
+        writer.WriteBlockCount(SpawnPointBlock.size());
+        for(size_t i = 0; i < SpawnPointBlock.size(); ++i)
+        {
+            writer.Write(SpawnPointBlock[i].SpawnPointPos);
+        }
+    }
+
+    bool SimulatorPresentAtLocation::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SimulatorPublicHostBlock.Port);
+        reader.Read(SimulatorPublicHostBlock.SimulatorIP);
+        reader.Read(SimulatorPublicHostBlock.GridX);
+        reader.Read(SimulatorPublicHostBlock.GridY);
+        for(size_t i = 0; i < 4; ++i)
+        {
+            reader.Read(NeighborBlock[i].IP);
+            reader.Read(NeighborBlock[i].Port);
+        }
+        reader.ReadVariable1(SimulatorBlock.SimName);
+        reader.Read(SimulatorBlock.SimAccess);
+        reader.Read(SimulatorBlock.RegionFlags);
+        reader.Read(SimulatorBlock.RegionID);
+        reader.Read(SimulatorBlock.EstateID);
+        reader.Read(SimulatorBlock.ParentEstateID);
+        TelehubBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < TelehubBlock.size(); ++i)
+        {
+            reader.Read(TelehubBlock[i].HasTelehub);
+            reader.Read(TelehubBlock[i].TelehubPos);
+        }
+        return reader.IsValid();
+    }
+
+    void SimulatorPresentAtLocation::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SimulatorPublicHostBlock.Port);
+        writer.Write(SimulatorPublicHostBlock.SimulatorIP);
+        writer.Write(SimulatorPublicHostBlock.GridX);
+        writer.Write(SimulatorPublicHostBlock.GridY);
+        for(size_t i = 0; i < 4; ++i)
+        {
+            writer.Write(NeighborBlock[i].IP);
+            writer.Write(NeighborBlock[i].Port);
+        }
+        writer.WriteVariable1(SimulatorBlock.SimName);
+        writer.Write(SimulatorBlock.SimAccess);
+        writer.Write(SimulatorBlock.RegionFlags);
+        writer.Write(SimulatorBlock.RegionID);
+        writer.Write(SimulatorBlock.EstateID);
+        writer.Write(SimulatorBlock.ParentEstateID);
+        writer.WriteBlockCount(TelehubBlock.size());
+        for(size_t i = 0; i < TelehubBlock.size(); ++i)
+        {
+            writer.Write(TelehubBlock[i].HasTelehub);
+            writer.Write(TelehubBlock[i].TelehubPos);
+        }
+    }
+
+    bool SimulatorLoad::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SimulatorLoad_.TimeDilation);
+        reader.Read(SimulatorLoad_.AgentCount);
+        reader.Read(SimulatorLoad_.CanAcceptAgents);
+        AgentList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AgentList.size(); ++i)
+        {
+            reader.Read(AgentList[i].CircuitCode);
+            reader.Read(AgentList[i].X);
+            reader.Read(AgentList[i].Y);
+        }
+        return reader.IsValid();
+    }
+
+    void SimulatorLoad::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SimulatorLoad_.TimeDilation);
+        writer.Write(SimulatorLoad_.AgentCount);
+        writer.Write(SimulatorLoad_.CanAcceptAgents);
+        writer.WriteBlockCount(AgentList.size());
+        for(size_t i = 0; i < AgentList.size(); ++i)
+        {
+            writer.Write(AgentList[i].CircuitCode);
+            writer.Write(AgentList[i].X);
+            writer.Write(AgentList[i].Y);
+        }
+    }
+
+    bool SimulatorShutdownRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void SimulatorShutdownRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+    bool RegionPresenceRequestByRegionID::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        RegionData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            reader.Read(RegionData[i].RegionID);
+        }
+        return reader.IsValid();
+    }
+
+    void RegionPresenceRequestByRegionID::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(RegionData.size());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            writer.Write(RegionData[i].RegionID);
+        }
+    }
+
+    bool RegionPresenceRequestByHandle::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        RegionData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            reader.Read(RegionData[i].RegionHandle);
+        }
+        return reader.IsValid();
+    }
+
+    void RegionPresenceRequestByHandle::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(RegionData.size());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            writer.Write(RegionData[i].RegionHandle);
+        }
+    }
+
+    bool RegionPresenceResponse::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        RegionData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            reader.Read(RegionData[i].RegionID);
+            reader.Read(RegionData[i].RegionHandle);
+            reader.Read(RegionData[i].InternalRegionIP);
+            reader.Read(RegionData[i].ExternalRegionIP);
+            reader.Read(RegionData[i].RegionPort);
+            reader.Read(RegionData[i].ValidUntil);
+            reader.ReadVariable1(RegionData[i].Message);
+        }
+        return reader.IsValid();
+    }
+
+    void RegionPresenceResponse::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(RegionData.size());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            writer.Write(RegionData[i].RegionID);
+            writer.Write(RegionData[i].RegionHandle);
+            writer.Write(RegionData[i].InternalRegionIP);
+            writer.Write(RegionData[i].ExternalRegionIP);
+            writer.Write(RegionData[i].RegionPort);
+            writer.Write(RegionData[i].ValidUntil);
+            writer.WriteVariable1(RegionData[i].Message);
+        }
+    }
+
+    bool UpdateSimulator::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SimulatorInfo.RegionID);
+        reader.ReadVariable1(SimulatorInfo.SimName);
+        reader.Read(SimulatorInfo.EstateID);
+        reader.Read(SimulatorInfo.SimAccess);
+        return reader.IsValid();
+    }
+
+    void UpdateSimulator::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SimulatorInfo.RegionID);
+        writer.WriteVariable1(SimulatorInfo.SimName);
+        writer.Write(SimulatorInfo.EstateID);
+        writer.Write(SimulatorInfo.SimAccess);
+    }
+
+    bool LogDwellTime::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DwellInfo.AgentID);
+        reader.Read(DwellInfo.SessionID);
+        reader.Read(DwellInfo.Duration);
+        reader.ReadVariable1(DwellInfo.SimName);
+        reader.Read(DwellInfo.RegionX);
+        reader.Read(DwellInfo.RegionY);
+        reader.Read(DwellInfo.AvgAgentsInView);
+        reader.Read(DwellInfo.AvgViewerFPS);
+        return reader.IsValid();
+    }
+
+    void LogDwellTime::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DwellInfo.AgentID);
+        writer.Write(DwellInfo.SessionID);
+        writer.Write(DwellInfo.Duration);
+        writer.WriteVariable1(DwellInfo.SimName);
+        writer.Write(DwellInfo.RegionX);
+        writer.Write(DwellInfo.RegionY);
+        writer.Write(DwellInfo.AvgAgentsInView);
+        writer.Write(DwellInfo.AvgViewerFPS);
+    }
+
+    bool FeatureDisabled::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(FailureInfo.ErrorMessage);
+        reader.Read(FailureInfo.AgentID);
+        reader.Read(FailureInfo.TransactionID);
+        return reader.IsValid();
+    }
+
+    void FeatureDisabled::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(FailureInfo.ErrorMessage);
+        writer.Write(FailureInfo.AgentID);
+        writer.Write(FailureInfo.TransactionID);
+    }
+
+    bool LogFailedMoneyTransaction::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TransactionData.TransactionID);
+        reader.Read(TransactionData.TransactionTime);
+        reader.Read(TransactionData.TransactionType);
+        reader.Read(TransactionData.SourceID);
+        reader.Read(TransactionData.DestID);
+        reader.Read(TransactionData.Flags);
+        reader.Read(TransactionData.Amount);
+        reader.Read(TransactionData.SimulatorIP);
+        reader.Read(TransactionData.GridX);
+        reader.Read(TransactionData.GridY);
+        reader.Read(TransactionData.FailureType);
+        return reader.IsValid();
+    }
+
+    void LogFailedMoneyTransaction::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TransactionData.TransactionID);
+        writer.Write(TransactionData.TransactionTime);
+        writer.Write(TransactionData.TransactionType);
+        writer.Write(TransactionData.SourceID);
+        writer.Write(TransactionData.DestID);
+        writer.Write(TransactionData.Flags);
+        writer.Write(TransactionData.Amount);
+        writer.Write(TransactionData.SimulatorIP);
+        writer.Write(TransactionData.GridX);
+        writer.Write(TransactionData.GridY);
+        writer.Write(TransactionData.FailureType);
+    }
+
+    bool UserReportInternal::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ReportData.ReportType);
+        reader.Read(ReportData.Category);
+        reader.Read(ReportData.ReporterID);
+        reader.Read(ReportData.ViewerPosition);
+        reader.Read(ReportData.AgentPosition);
+        reader.Read(ReportData.ScreenshotID);
+        reader.Read(ReportData.ObjectID);
+        reader.Read(ReportData.OwnerID);
+        reader.Read(ReportData.LastOwnerID);
+        reader.Read(ReportData.CreatorID);
+        reader.Read(ReportData.RegionID);
+        reader.Read(ReportData.AbuserID);
+        reader.ReadVariable1(ReportData.AbuseRegionName);
+        reader.Read(ReportData.AbuseRegionID);
+        reader.ReadVariable1(ReportData.Summary);
+        reader.ReadVariable2(ReportData.Details);
+        reader.ReadVariable1(ReportData.VersionString);
+        return reader.IsValid();
+    }
+
+    void UserReportInternal::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ReportData.ReportType);
+        writer.Write(ReportData.Category);
+        writer.Write(ReportData.ReporterID);
+        writer.Write(ReportData.ViewerPosition);
+        writer.Write(ReportData.AgentPosition);
+        writer.Write(ReportData.ScreenshotID);
+        writer.Write(ReportData.ObjectID);
+        writer.Write(ReportData.OwnerID);
+        writer.Write(ReportData.LastOwnerID);
+        writer.Write(ReportData.CreatorID);
+        writer.Write(ReportData.RegionID);
+        writer.Write(ReportData.AbuserID);
+        writer.WriteVariable1(ReportData.AbuseRegionName);
+        writer.Write(ReportData.AbuseRegionID);
+        writer.WriteVariable1(ReportData.Summary);
+        writer.WriteVariable2(ReportData.Details);
+        writer.WriteVariable1(ReportData.VersionString);
+    }
+
+    bool SetSimStatusInDatabase::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.RegionID);
+        reader.ReadVariable1(Data.HostName);
+        reader.Read(Data.X);
+        reader.Read(Data.Y);
+        reader.Read(Data.PID);
+        reader.Read(Data.AgentCount);
+        reader.Read(Data.TimeToLive);
+        reader.ReadVariable1(Data.Status);
+        return reader.IsValid();
+    }
+
+    void SetSimStatusInDatabase::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.RegionID);
+        writer.WriteVariable1(Data.HostName);
+        writer.Write(Data.X);
+        writer.Write(Data.Y);
+        writer.Write(Data.PID);
+        writer.Write(Data.AgentCount);
+        writer.Write(Data.TimeToLive);
+        writer.WriteVariable1(Data.Status);
+    }
+
+    bool SetSimPresenceInDatabase::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SimData.RegionID);
+        reader.ReadVariable1(SimData.HostName);
+        reader.Read(SimData.GridX);
+        reader.Read(SimData.GridY);
+        reader.Read(SimData.PID);
+        reader.Read(SimData.AgentCount);
+        reader.Read(SimData.TimeToLive);
+        reader.ReadVariable1(SimData.Status);
+        return reader.IsValid();
+    }
+
+    void SetSimPresenceInDatabase::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SimData.RegionID);
+        writer.WriteVariable1(SimData.HostName);
+        writer.Write(SimData.GridX);
+        writer.Write(SimData.GridY);
+        writer.Write(SimData.PID);
+        writer.Write(SimData.AgentCount);
+        writer.Write(SimData.TimeToLive);
+        writer.WriteVariable1(SimData.Status);
+    }
+
+    bool EconomyDataRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void EconomyDataRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+    bool EconomyData::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.ObjectCapacity);
+        reader.Read(Info.ObjectCount);
+        reader.Read(Info.PriceEnergyUnit);
+        reader.Read(Info.PriceObjectClaim);
+        reader.Read(Info.PricePublicObjectDecay);
+        reader.Read(Info.PricePublicObjectDelete);
+        reader.Read(Info.PriceParcelClaim);
+        reader.Read(Info.PriceParcelClaimFactor);
+        reader.Read(Info.PriceUpload);
+        reader.Read(Info.PriceRentLight);
+        reader.Read(Info.TeleportMinPrice);
+        reader.Read(Info.TeleportPriceExponent);
+        reader.Read(Info.EnergyEfficiency);
+        reader.Read(Info.PriceObjectRent);
+        reader.Read(Info.PriceObjectScaleFactor);
+        reader.Read(Info.PriceParcelRent);
+        reader.Read(Info.PriceGroupCreate);
+        return reader.IsValid();
+    }
+
+    void EconomyData::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.ObjectCapacity);
+        writer.Write(Info.ObjectCount);
+        writer.Write(Info.PriceEnergyUnit);
+        writer.Write(Info.PriceObjectClaim);
+        writer.Write(Info.PricePublicObjectDecay);
+        writer.Write(Info.PricePublicObjectDelete);
+        writer.Write(Info.PriceParcelClaim);
+        writer.Write(Info.PriceParcelClaimFactor);
+        writer.Write(Info.PriceUpload);
+        writer.Write(Info.PriceRentLight);
+        writer.Write(Info.TeleportMinPrice);
+        writer.Write(Info.TeleportPriceExponent);
+        writer.Write(Info.EnergyEfficiency);
+        writer.Write(Info.PriceObjectRent);
+        writer.Write(Info.PriceObjectScaleFactor);
+        writer.Write(Info.PriceParcelRent);
+        writer.Write(Info.PriceGroupCreate);
+    }
+
+    bool AvatarPickerRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.QueryID);
+        reader.ReadVariable1(Data.Name);
+        return reader.IsValid();
+    }
+
+    void AvatarPickerRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.QueryID);
+        writer.WriteVariable1(Data.Name);
+    }
+
+    bool AvatarPickerRequestBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.QueryID);
+        reader.Read(AgentData.GodLevel);
+        reader.ReadVariable1(Data.Name);
+        return reader.IsValid();
+    }
+
+    void AvatarPickerRequestBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.QueryID);
+        writer.Write(AgentData.GodLevel);
+        writer.WriteVariable1(Data.Name);
+    }
+
+    bool AvatarPickerReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.QueryID);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].AvatarID);
+            reader.ReadVariable1(Data[i].FirstName);
+            reader.ReadVariable1(Data[i].LastName);
+        }
+        return reader.IsValid();
+    }
+
+    void AvatarPickerReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.QueryID);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].AvatarID);
+            writer.WriteVariable1(Data[i].FirstName);
+            writer.WriteVariable1(Data[i].LastName);
+        }
+    }
+
+    bool PlacesQuery::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.QueryID);
+        reader.Read(TransactionData.TransactionID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.Category);
+        reader.ReadVariable1(QueryData.SimName);
+        return reader.IsValid();
+    }
+
+    void PlacesQuery::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.QueryID);
+        writer.Write(TransactionData.TransactionID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.Category);
+        writer.WriteVariable1(QueryData.SimName);
+    }
+
+    bool PlacesReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.QueryID);
+        reader.Read(TransactionData.TransactionID);
+        QueryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryData.size(); ++i)
+        {
+            reader.Read(QueryData[i].OwnerID);
+            reader.ReadVariable1(QueryData[i].Name);
+            reader.ReadVariable1(QueryData[i].Desc);
+            reader.Read(QueryData[i].ActualArea);
+            reader.Read(QueryData[i].BillableArea);
+            reader.Read(QueryData[i].Flags);
+            reader.Read(QueryData[i].GlobalX);
+            reader.Read(QueryData[i].GlobalY);
+            reader.Read(QueryData[i].GlobalZ);
+            reader.ReadVariable1(QueryData[i].SimName);
+            reader.Read(QueryData[i].SnapshotID);
+            reader.Read(QueryData[i].Dwell);
+            reader.Read(QueryData[i].Price);
+        }
+        return reader.IsValid();
+    }
+
+    void PlacesReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.QueryID);
+        writer.Write(TransactionData.TransactionID);
+        writer.WriteBlockCount(QueryData.size());
+        for(size_t i = 0; i < QueryData.size(); ++i)
+        {
+            writer.Write(QueryData[i].OwnerID);
+            writer.WriteVariable1(QueryData[i].Name);
+            writer.WriteVariable1(QueryData[i].Desc);
+            writer.Write(QueryData[i].ActualArea);
+            writer.Write(QueryData[i].BillableArea);
+            writer.Write(QueryData[i].Flags);
+            writer.Write(QueryData[i].GlobalX);
+            writer.Write(QueryData[i].GlobalY);
+            writer.Write(QueryData[i].GlobalZ);
+            writer.WriteVariable1(QueryData[i].SimName);
+            writer.Write(QueryData[i].SnapshotID);
+            writer.Write(QueryData[i].Dwell);
+            writer.Write(QueryData[i].Price);
+        }
+    }
+
+    bool DirFindQuery::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(QueryData.QueryID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.QueryStart);
+        return reader.IsValid();
+    }
+
+    void DirFindQuery::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.QueryStart);
+    }
+
+    bool DirFindQueryBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.QueryStart);
+        reader.Read(QueryData.EstateID);
+        reader.Read(QueryData.Godlike);
+        return reader.IsValid();
+    }
+
+    void DirFindQueryBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.QueryStart);
+        writer.Write(QueryData.EstateID);
+        writer.Write(QueryData.Godlike);
+    }
+
+    bool DirPlacesQuery::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(QueryData.QueryID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.Category);
+        reader.ReadVariable1(QueryData.SimName);
+        reader.Read(QueryData.QueryStart);
+        return reader.IsValid();
+    }
+
+    void DirPlacesQuery::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.Category);
+        writer.WriteVariable1(QueryData.SimName);
+        writer.Write(QueryData.QueryStart);
+    }
+
+    bool DirPlacesQueryBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.Category);
+        reader.ReadVariable1(QueryData.SimName);
+        reader.Read(QueryData.EstateID);
+        reader.Read(QueryData.Godlike);
+        reader.Read(QueryData.QueryStart);
+        return reader.IsValid();
+    }
+
+    void DirPlacesQueryBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.Category);
+        writer.WriteVariable1(QueryData.SimName);
+        writer.Write(QueryData.EstateID);
+        writer.Write(QueryData.Godlike);
+        writer.Write(QueryData.QueryStart);
+    }
+
+    bool DirPlacesReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        QueryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryData.size(); ++i)
+        {
+            reader.Read(QueryData[i].QueryID);
+        }
+        QueryReplies.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            reader.Read(QueryReplies[i].ParcelID);
+            reader.ReadVariable1(QueryReplies[i].Name);
+            reader.Read(QueryReplies[i].ForSale);
+            reader.Read(QueryReplies[i].Auction);
+            reader.Read(QueryReplies[i].Dwell);
+        }
+        return reader.IsValid();
+    }
+
+    void DirPlacesReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.WriteBlockCount(QueryData.size());
+        for(size_t i = 0; i < QueryData.size(); ++i)
+        {
+            writer.Write(QueryData[i].QueryID);
+        }
+        writer.WriteBlockCount(QueryReplies.size());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            writer.Write(QueryReplies[i].ParcelID);
+            writer.WriteVariable1(QueryReplies[i].Name);
+            writer.Write(QueryReplies[i].ForSale);
+            writer.Write(QueryReplies[i].Auction);
+            writer.Write(QueryReplies[i].Dwell);
+        }
+    }
+
+    bool DirPeopleReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        QueryReplies.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            reader.Read(QueryReplies[i].AgentID);
+            reader.ReadVariable1(QueryReplies[i].FirstName);
+            reader.ReadVariable1(QueryReplies[i].LastName);
+            reader.ReadVariable1(QueryReplies[i].Group);
+            reader.Read(QueryReplies[i].Online);
+            reader.Read(QueryReplies[i].Reputation);
+        }
+        return reader.IsValid();
+    }
+
+    void DirPeopleReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteBlockCount(QueryReplies.size());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            writer.Write(QueryReplies[i].AgentID);
+            writer.WriteVariable1(QueryReplies[i].FirstName);
+            writer.WriteVariable1(QueryReplies[i].LastName);
+            writer.WriteVariable1(QueryReplies[i].Group);
+            writer.Write(QueryReplies[i].Online);
+            writer.Write(QueryReplies[i].Reputation);
+        }
+    }
+
+    bool DirEventsReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        QueryReplies.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            reader.Read(QueryReplies[i].OwnerID);
+            reader.ReadVariable1(QueryReplies[i].Name);
+            reader.Read(QueryReplies[i].EventID);
+            reader.ReadVariable1(QueryReplies[i].Date);
+            reader.Read(QueryReplies[i].UnixTime);
+            reader.Read(QueryReplies[i].EventFlags);
+        }
+        return reader.IsValid();
+    }
+
+    void DirEventsReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteBlockCount(QueryReplies.size());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            writer.Write(QueryReplies[i].OwnerID);
+            writer.WriteVariable1(QueryReplies[i].Name);
+            writer.Write(QueryReplies[i].EventID);
+            writer.WriteVariable1(QueryReplies[i].Date);
+            writer.Write(QueryReplies[i].UnixTime);
+            writer.Write(QueryReplies[i].EventFlags);
+        }
+    }
+
+    bool DirGroupsReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        QueryReplies.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            reader.Read(QueryReplies[i].GroupID);
+            reader.ReadVariable1(QueryReplies[i].GroupName);
+            reader.Read(QueryReplies[i].Members);
+            reader.Read(QueryReplies[i].SearchOrder);
+        }
+        return reader.IsValid();
+    }
+
+    void DirGroupsReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteBlockCount(QueryReplies.size());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            writer.Write(QueryReplies[i].GroupID);
+            writer.WriteVariable1(QueryReplies[i].GroupName);
+            writer.Write(QueryReplies[i].Members);
+            writer.Write(QueryReplies[i].SearchOrder);
+        }
+    }
+
+    bool DirClassifiedQuery::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(QueryData.QueryID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.Category);
+        reader.Read(QueryData.QueryStart);
+        return reader.IsValid();
+    }
+
+    void DirClassifiedQuery::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.Category);
+        writer.Write(QueryData.QueryStart);
+    }
+
+    bool DirClassifiedQueryBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.Category);
+        reader.Read(QueryData.EstateID);
+        reader.Read(QueryData.Godlike);
+        reader.Read(QueryData.QueryStart);
+        return reader.IsValid();
+    }
+
+    void DirClassifiedQueryBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.Category);
+        writer.Write(QueryData.EstateID);
+        writer.Write(QueryData.Godlike);
+        writer.Write(QueryData.QueryStart);
+    }
+
+    bool DirClassifiedReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        QueryReplies.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            reader.Read(QueryReplies[i].ClassifiedID);
+            reader.ReadVariable1(QueryReplies[i].Name);
+            reader.Read(QueryReplies[i].ClassifiedFlags);
+            reader.Read(QueryReplies[i].CreationDate);
+            reader.Read(QueryReplies[i].ExpirationDate);
+            reader.Read(QueryReplies[i].PriceForListing);
+        }
+        return reader.IsValid();
+    }
+
+    void DirClassifiedReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteBlockCount(QueryReplies.size());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            writer.Write(QueryReplies[i].ClassifiedID);
+            writer.WriteVariable1(QueryReplies[i].Name);
+            writer.Write(QueryReplies[i].ClassifiedFlags);
+            writer.Write(QueryReplies[i].CreationDate);
+            writer.Write(QueryReplies[i].ExpirationDate);
+            writer.Write(QueryReplies[i].PriceForListing);
+        }
+    }
+
+    bool AvatarClassifiedReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.TargetID);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].ClassifiedID);
+            reader.ReadVariable1(Data[i].Name);
+        }
+        return reader.IsValid();
+    }
+
+    void AvatarClassifiedReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.TargetID);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].ClassifiedID);
+            writer.WriteVariable1(Data[i].Name);
+        }
+    }
+
+    bool ClassifiedInfoRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ClassifiedID);
+        return reader.IsValid();
+    }
+
+    void ClassifiedInfoRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ClassifiedID);
+    }
+
+    bool ClassifiedInfoReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(Data.ClassifiedID);
+        reader.Read(Data.CreatorID);
+        reader.Read(Data.CreationDate);
+        reader.Read(Data.ExpirationDate);
+        reader.Read(Data.Category);
+        reader.ReadVariable1(Data.Name);
+        reader.ReadVariable2(Data.Desc);
+        reader.Read(Data.ParcelID);
+        reader.Read(Data.ParentEstate);
+        reader.Read(Data.SnapshotID);
+        reader.ReadVariable1(Data.SimName);
+        reader.Read(Data.PosGlobal);
+        reader.ReadVariable1(Data.ParcelName);
+        reader.Read(Data.ClassifiedFlags);
+        reader.Read(Data.PriceForListing);
+        return reader.IsValid();
+    }
+
+    void ClassifiedInfoReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(Data.ClassifiedID);
+        writer.Write(Data.CreatorID);
+        writer.Write(Data.CreationDate);
+        writer.Write(Data.ExpirationDate);
+        writer.Write(Data.Category);
+        writer.WriteVariable1(Data.Name);
+        writer.WriteVariable2(Data.Desc);
+        writer.Write(Data.ParcelID);
+        writer.Write(Data.ParentEstate);
+        writer.Write(Data.SnapshotID);
+        writer.WriteVariable1(Data.SimName);
+        writer.Write(Data.PosGlobal);
+        writer.WriteVariable1(Data.ParcelName);
+        writer.Write(Data.ClassifiedFlags);
+        writer.Write(Data.PriceForListing);
+    }
+
+    bool ClassifiedInfoUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ClassifiedID);
+        reader.Read(Data.Category);
+        reader.ReadVariable1(Data.Name);
+        reader.ReadVariable2(Data.Desc);
+        reader.Read(Data.ParcelID);
+        reader.Read(Data.ParentEstate);
+        reader.Read(Data.SnapshotID);
+        reader.Read(Data.PosGlobal);
+        reader.Read(Data.ClassifiedFlags);
+        reader.Read(Data.PriceForListing);
+        return reader.IsValid();
+    }
+
+    void ClassifiedInfoUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ClassifiedID);
+        writer.Write(Data.Category);
+        writer.WriteVariable1(Data.Name);
+        writer.WriteVariable2(Data.Desc);
+        writer.Write(Data.ParcelID);
+        writer.Write(Data.ParentEstate);
+        writer.Write(Data.SnapshotID);
+        writer.Write(Data.PosGlobal);
+        writer.Write(Data.ClassifiedFlags);
+        writer.Write(Data.PriceForListing);
+    }
+
+    bool ClassifiedDelete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ClassifiedID);
+        return reader.IsValid();
+    }
+
+    void ClassifiedDelete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ClassifiedID);
+    }
+
+    bool ClassifiedGodDelete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ClassifiedID);
+        reader.Read(Data.QueryID);
+        return reader.IsValid();
+    }
+
+    void ClassifiedGodDelete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ClassifiedID);
+        writer.Write(Data.QueryID);
+    }
+
+    bool DirLandQuery::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(QueryData.QueryID);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.SearchType);
+        reader.Read(QueryData.Price);
+        reader.Read(QueryData.Area);
+        reader.Read(QueryData.QueryStart);
+        return reader.IsValid();
+    }
+
+    void DirLandQuery::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(QueryData.QueryID);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.SearchType);
+        writer.Write(QueryData.Price);
+        writer.Write(QueryData.Area);
+        writer.Write(QueryData.QueryStart);
+    }
+
+    bool DirLandQueryBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.SearchType);
+        reader.Read(QueryData.Price);
+        reader.Read(QueryData.Area);
+        reader.Read(QueryData.QueryStart);
+        reader.Read(QueryData.EstateID);
+        reader.Read(QueryData.Godlike);
+        return reader.IsValid();
+    }
+
+    void DirLandQueryBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.SearchType);
+        writer.Write(QueryData.Price);
+        writer.Write(QueryData.Area);
+        writer.Write(QueryData.QueryStart);
+        writer.Write(QueryData.EstateID);
+        writer.Write(QueryData.Godlike);
+    }
+
+    bool DirLandReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        QueryReplies.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            reader.Read(QueryReplies[i].ParcelID);
+            reader.ReadVariable1(QueryReplies[i].Name);
+            reader.Read(QueryReplies[i].Auction);
+            reader.Read(QueryReplies[i].ForSale);
+            reader.Read(QueryReplies[i].SalePrice);
+            reader.Read(QueryReplies[i].ActualArea);
+        }
+        return reader.IsValid();
+    }
+
+    void DirLandReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteBlockCount(QueryReplies.size());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            writer.Write(QueryReplies[i].ParcelID);
+            writer.WriteVariable1(QueryReplies[i].Name);
+            writer.Write(QueryReplies[i].Auction);
+            writer.Write(QueryReplies[i].ForSale);
+            writer.Write(QueryReplies[i].SalePrice);
+            writer.Write(QueryReplies[i].ActualArea);
+        }
+    }
+
+    bool DirPopularQuery::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(QueryData.QueryID);
+        reader.Read(QueryData.QueryFlags);
+        return reader.IsValid();
+    }
+
+    void DirPopularQuery::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(QueryData.QueryID);
+        writer.Write(QueryData.QueryFlags);
+    }
+
+    bool DirPopularQueryBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.EstateID);
+        reader.Read(QueryData.Godlike);
+        return reader.IsValid();
+    }
+
+    void DirPopularQueryBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.EstateID);
+        writer.Write(QueryData.Godlike);
+    }
+
+    bool DirPopularReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(QueryData.QueryID);
+        QueryReplies.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            reader.Read(QueryReplies[i].ParcelID);
+            reader.ReadVariable1(QueryReplies[i].Name);
+            reader.Read(QueryReplies[i].Dwell);
+        }
+        return reader.IsValid();
+    }
+
+    void DirPopularReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteBlockCount(QueryReplies.size());
+        for(size_t i = 0; i < QueryReplies.size(); ++i)
+        {
+            writer.Write(QueryReplies[i].ParcelID);
+            writer.WriteVariable1(QueryReplies[i].Name);
+            writer.Write(QueryReplies[i].Dwell);
+        }
+    }
+
+    bool ParcelInfoRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ParcelID);
+        return reader.IsValid();
+    }
+
+    void ParcelInfoRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ParcelID);
+    }
+
+    bool ParcelInfoReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(Data.ParcelID);
+        reader.Read(Data.OwnerID);
+        reader.ReadVariable1(Data.Name);
+        reader.ReadVariable1(Data.Desc);
+        reader.Read(Data.ActualArea);
+        reader.Read(Data.BillableArea);
+        reader.Read(Data.Flags);
+        reader.Read(Data.GlobalX);
+        reader.Read(Data.GlobalY);
+        reader.Read(Data.GlobalZ);
+        reader.ReadVariable1(Data.SimName);
+        reader.Read(Data.SnapshotID);
+        reader.Read(Data.Dwell);
+        reader.Read(Data.SalePrice);
+        reader.Read(Data.AuctionID);
+        return reader.IsValid();
+    }
+
+    void ParcelInfoReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(Data.ParcelID);
+        writer.Write(Data.OwnerID);
+        writer.WriteVariable1(Data.Name);
+        writer.WriteVariable1(Data.Desc);
+        writer.Write(Data.ActualArea);
+        writer.Write(Data.BillableArea);
+        writer.Write(Data.Flags);
+        writer.Write(Data.GlobalX);
+        writer.Write(Data.GlobalY);
+        writer.Write(Data.GlobalZ);
+        writer.WriteVariable1(Data.SimName);
+        writer.Write(Data.SnapshotID);
+        writer.Write(Data.Dwell);
+        writer.Write(Data.SalePrice);
+        writer.Write(Data.AuctionID);
+    }
+
+    bool ParcelObjectOwnersRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelObjectOwnersRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+    }
+
+    bool ParcelObjectOwnersReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].OwnerID);
+            reader.Read(Data[i].IsGroupOwned);
+            reader.Read(Data[i].Count);
+            reader.Read(Data[i].OnlineStatus);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelObjectOwnersReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].OwnerID);
+            writer.Write(Data[i].IsGroupOwned);
+            writer.Write(Data[i].Count);
+            writer.Write(Data[i].OnlineStatus);
+        }
+    }
+
+    bool GroupNoticesListRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.GroupID);
+        return reader.IsValid();
+    }
+
+    void GroupNoticesListRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.GroupID);
+    }
+
+    bool GroupNoticesListReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].NoticeID);
+            reader.Read(Data[i].Timestamp);
+            reader.ReadVariable2(Data[i].FromName);
+            reader.ReadVariable2(Data[i].Subject);
+            reader.Read(Data[i].HasAttachment);
+            reader.Read(Data[i].AssetType);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupNoticesListReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].NoticeID);
+            writer.Write(Data[i].Timestamp);
+            writer.WriteVariable2(Data[i].FromName);
+            writer.WriteVariable2(Data[i].Subject);
+            writer.Write(Data[i].HasAttachment);
+            writer.Write(Data[i].AssetType);
+        }
+    }
+
+    bool GroupNoticeRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.GroupNoticeID);
+        return reader.IsValid();
+    }
+
+    void GroupNoticeRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.GroupNoticeID);
+    }
+
+    bool GroupNoticeAdd::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(MessageBlock.ToGroupID);
+        reader.Read(MessageBlock.ID);
+        reader.Read(MessageBlock.Dialog);
+        reader.ReadVariable1(MessageBlock.FromAgentName);
+        reader.ReadVariable2(MessageBlock.Message);
+        reader.ReadVariable2(MessageBlock.BinaryBucket);
+        return reader.IsValid();
+    }
+
+    void GroupNoticeAdd::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(MessageBlock.ToGroupID);
+        writer.Write(MessageBlock.ID);
+        writer.Write(MessageBlock.Dialog);
+        writer.WriteVariable1(MessageBlock.FromAgentName);
+        writer.WriteVariable2(MessageBlock.Message);
+        writer.WriteVariable2(MessageBlock.BinaryBucket);
+    }
+
+    bool TeleportRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Info.RegionID);
+        reader.Read(Info.Position);
+        reader.Read(Info.LookAt);
+        return reader.IsValid();
+    }
+
+    void TeleportRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Info.RegionID);
+        writer.Write(Info.Position);
+        writer.Write(Info.LookAt);
+    }
+
+    bool TeleportLocationRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Info.RegionHandle);
+        reader.Read(Info.Position);
+        reader.Read(Info.LookAt);
+        return reader.IsValid();
+    }
+
+    void TeleportLocationRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Info.RegionHandle);
+        writer.Write(Info.Position);
+        writer.Write(Info.LookAt);
+    }
+
+    bool TeleportLocal::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.Read(Info.LocationID);
+        reader.Read(Info.Position);
+        reader.Read(Info.LookAt);
+        reader.Read(Info.TeleportFlags);
+        return reader.IsValid();
+    }
+
+    void TeleportLocal::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.Write(Info.LocationID);
+        writer.Write(Info.Position);
+        writer.Write(Info.LookAt);
+        writer.Write(Info.TeleportFlags);
+    }
+
+    bool TeleportLandmarkRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.Read(Info.SessionID);
+        reader.Read(Info.LandmarkID);
+        return reader.IsValid();
+    }
+
+    void TeleportLandmarkRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.Write(Info.SessionID);
+        writer.Write(Info.LandmarkID);
+    }
+
+    bool TeleportProgress::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(Info.TeleportFlags);
+        reader.ReadVariable1(Info.Message);
+        return reader.IsValid();
+    }
+
+    void TeleportProgress::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(Info.TeleportFlags);
+        writer.WriteVariable1(Info.Message);
+    }
+
+    bool DataHomeLocationRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.Read(Info.KickedFromEstateID);
+        return reader.IsValid();
+    }
+
+    void DataHomeLocationRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.Write(Info.KickedFromEstateID);
+    }
+
+    bool DataHomeLocationReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.Read(Info.RegionHandle);
+        reader.Read(Info.Position);
+        reader.Read(Info.LookAt);
+        return reader.IsValid();
+    }
+
+    void DataHomeLocationReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.Write(Info.RegionHandle);
+        writer.Write(Info.Position);
+        writer.Write(Info.LookAt);
+    }
+
+    bool TeleportFinish::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.Read(Info.LocationID);
+        reader.Read(Info.SimIP);
+        reader.Read(Info.SimPort);
+        reader.Read(Info.RegionHandle);
+        reader.ReadVariable2(Info.SeedCapability);
+        reader.Read(Info.SimAccess);
+        reader.Read(Info.TeleportFlags);
+        return reader.IsValid();
+    }
+
+    void TeleportFinish::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.Write(Info.LocationID);
+        writer.Write(Info.SimIP);
+        writer.Write(Info.SimPort);
+        writer.Write(Info.RegionHandle);
+        writer.WriteVariable2(Info.SeedCapability);
+        writer.Write(Info.SimAccess);
+        writer.Write(Info.TeleportFlags);
+    }
+
+    bool StartLure::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Info.LureType);
+        reader.ReadVariable1(Info.Message);
+        TargetData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < TargetData.size(); ++i)
+        {
+            reader.Read(TargetData[i].TargetID);
+        }
+        return reader.IsValid();
+    }
+
+    void StartLure::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Info.LureType);
+        writer.WriteVariable1(Info.Message);
+        writer.WriteBlockCount(TargetData.size());
+        for(size_t i = 0; i < TargetData.size(); ++i)
+        {
+            writer.Write(TargetData[i].TargetID);
+        }
+    }
+
+    bool TeleportLureRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.Read(Info.SessionID);
+        reader.Read(Info.LureID);
+        reader.Read(Info.TeleportFlags);
+        return reader.IsValid();
+    }
+
+    void TeleportLureRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.Write(Info.SessionID);
+        writer.Write(Info.LureID);
+        writer.Write(Info.TeleportFlags);
+    }
+
+    bool TeleportCancel::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.Read(Info.SessionID);
+        return reader.IsValid();
+    }
+
+    void TeleportCancel::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.Write(Info.SessionID);
+    }
+
+    bool TeleportStart::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.TeleportFlags);
+        return reader.IsValid();
+    }
+
+    void TeleportStart::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.TeleportFlags);
+    }
+
+    bool TeleportFailed::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Info.AgentID);
+        reader.ReadVariable1(Info.Reason);
+        return reader.IsValid();
+    }
+
+    void TeleportFailed::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Info.AgentID);
+        writer.WriteVariable1(Info.Reason);
+    }
+
+    bool Undo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectID);
+        }
+        return reader.IsValid();
+    }
+
+    void Undo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectID);
+        }
+    }
+
+    bool Redo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectID);
+        }
+        return reader.IsValid();
+    }
+
+    void Redo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectID);
+        }
+    }
+
+    bool UndoLand::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void UndoLand::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool AgentPause::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.SerialNum);
+        return reader.IsValid();
+    }
+
+    void AgentPause::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.SerialNum);
+    }
+
+    bool AgentResume::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.SerialNum);
+        return reader.IsValid();
+    }
+
+    void AgentResume::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.SerialNum);
+    }
+
+    bool ChatFromViewer::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.ReadVariable2(ChatData.Message);
+        reader.Read(ChatData.Type);
+        reader.Read(ChatData.Channel);
+        return reader.IsValid();
+    }
+
+    void ChatFromViewer::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteVariable2(ChatData.Message);
+        writer.Write(ChatData.Type);
+        writer.Write(ChatData.Channel);
+    }
+
+    bool AgentThrottle::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.CircuitCode);
+        reader.Read(Throttle.GenCounter);
+        reader.ReadVariable1(Throttle.Throttles);
+        return reader.IsValid();
+    }
+
+    void AgentThrottle::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.CircuitCode);
+        writer.Write(Throttle.GenCounter);
+        writer.WriteVariable1(Throttle.Throttles);
+    }
+
+    bool AgentFOV::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.CircuitCode);
+        reader.Read(FOVBlock.GenCounter);
+        reader.Read(FOVBlock.VerticalAngle);
+        return reader.IsValid();
+    }
+
+    void AgentFOV::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.CircuitCode);
+        writer.Write(FOVBlock.GenCounter);
+        writer.Write(FOVBlock.VerticalAngle);
+    }
+
+    bool AgentHeightWidth::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.CircuitCode);
+        reader.Read(HeightWidthBlock.GenCounter);
+        reader.Read(HeightWidthBlock.Height);
+        reader.Read(HeightWidthBlock.Width);
+        return reader.IsValid();
+    }
+
+    void AgentHeightWidth::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.CircuitCode);
+        writer.Write(HeightWidthBlock.GenCounter);
+        writer.Write(HeightWidthBlock.Height);
+        writer.Write(HeightWidthBlock.Width);
+    }
+
+    bool AgentSetAppearance::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.SerialNum);
+        reader.Read(AgentData.Size);
+        WearableData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            reader.Read(WearableData[i].CacheID);
+            reader.Read(WearableData[i].TextureIndex);
+        }
+        reader.ReadVariable2(ObjectData.TextureEntry);
+        VisualParam.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < VisualParam.size(); ++i)
+        {
+            reader.Read(VisualParam[i].ParamValue);
+        }
+        return reader.IsValid();
+    }
+
+    void AgentSetAppearance::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.SerialNum);
+        writer.Write(AgentData.Size);
+        writer.WriteBlockCount(WearableData.size());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            writer.Write(WearableData[i].CacheID);
+            writer.Write(WearableData[i].TextureIndex);
+        }
+        writer.WriteVariable2(ObjectData.TextureEntry);
+        writer.WriteBlockCount(VisualParam.size());
+        for(size_t i = 0; i < VisualParam.size(); ++i)
+        {
+            writer.Write(VisualParam[i].ParamValue);
+        }
+    }
+
+    bool AgentQuitCopy::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(FuseBlock.ViewerCircuitCode);
+        return reader.IsValid();
+    }
+
+    void AgentQuitCopy::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(FuseBlock.ViewerCircuitCode);
+    }
+
+    bool ImageNotInDatabase::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ImageID.ID);
+        return reader.IsValid();
+    }
+
+    void ImageNotInDatabase::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ImageID.ID);
+    }
+
+    bool RebakeAvatarTextures::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TextureData.TextureID);
+        return reader.IsValid();
+    }
+
+    void RebakeAvatarTextures::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TextureData.TextureID);
+    }
+
+    bool SetAlwaysRun::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.AlwaysRun);
+        return reader.IsValid();
+    }
+
+    void SetAlwaysRun::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.AlwaysRun);
+    }
+
+    bool ObjectDelete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Force);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDelete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Force);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectDuplicate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(SharedData.Offset);
+        reader.Read(SharedData.DuplicateFlags);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDuplicate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(SharedData.Offset);
+        writer.Write(SharedData.DuplicateFlags);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectDuplicateOnRay::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(AgentData.RayStart);
+        reader.Read(AgentData.RayEnd);
+        reader.Read(AgentData.BypassRaycast);
+        reader.Read(AgentData.RayEndIsIntersection);
+        reader.Read(AgentData.CopyCenters);
+        reader.Read(AgentData.CopyRotates);
+        reader.Read(AgentData.RayTargetID);
+        reader.Read(AgentData.DuplicateFlags);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDuplicateOnRay::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(AgentData.RayStart);
+        writer.Write(AgentData.RayEnd);
+        writer.Write(AgentData.BypassRaycast);
+        writer.Write(AgentData.RayEndIsIntersection);
+        writer.Write(AgentData.CopyCenters);
+        writer.Write(AgentData.CopyRotates);
+        writer.Write(AgentData.RayTargetID);
+        writer.Write(AgentData.DuplicateFlags);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectScale::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].Scale);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectScale::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].Scale);
+        }
+    }
+
+    bool ObjectRotation::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].Rotation);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectRotation::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].Rotation);
+        }
+    }
+
+    bool ObjectFlagUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.ObjectLocalID);
+        reader.Read(AgentData.UsePhysics);
+        reader.Read(AgentData.IsTemporary);
+        reader.Read(AgentData.IsPhantom);
+        reader.Read(AgentData.CastsShadows);
+        return reader.IsValid();
+    }
+
+    void ObjectFlagUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.ObjectLocalID);
+        writer.Write(AgentData.UsePhysics);
+        writer.Write(AgentData.IsTemporary);
+        writer.Write(AgentData.IsPhantom);
+        writer.Write(AgentData.CastsShadows);
+    }
+
+    bool ObjectClickAction::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].ClickAction);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectClickAction::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].ClickAction);
+        }
+    }
+
+    bool ObjectImage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.ReadVariable1(ObjectData[i].MediaURL);
+            reader.ReadVariable2(ObjectData[i].TextureEntry);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectImage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.WriteVariable1(ObjectData[i].MediaURL);
+            writer.WriteVariable2(ObjectData[i].TextureEntry);
+        }
+    }
+
+    bool ObjectMaterial::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].Material);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectMaterial::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].Material);
+        }
+    }
+
+    bool ObjectShape::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].PathCurve);
+            reader.Read(ObjectData[i].ProfileCurve);
+            reader.Read(ObjectData[i].PathBegin);
+            reader.Read(ObjectData[i].PathEnd);
+            reader.Read(ObjectData[i].PathScaleX);
+            reader.Read(ObjectData[i].PathScaleY);
+            reader.Read(ObjectData[i].PathShearX);
+            reader.Read(ObjectData[i].PathShearY);
+            reader.Read(ObjectData[i].PathTwist);
+            reader.Read(ObjectData[i].PathTwistBegin);
+            reader.Read(ObjectData[i].PathRadiusOffset);
+            reader.Read(ObjectData[i].PathTaperX);
+            reader.Read(ObjectData[i].PathTaperY);
+            reader.Read(ObjectData[i].PathRevolutions);
+            reader.Read(ObjectData[i].PathSkew);
+            reader.Read(ObjectData[i].ProfileBegin);
+            reader.Read(ObjectData[i].ProfileEnd);
+            reader.Read(ObjectData[i].ProfileHollow);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectShape::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].PathCurve);
+            writer.Write(ObjectData[i].ProfileCurve);
+            writer.Write(ObjectData[i].PathBegin);
+            writer.Write(ObjectData[i].PathEnd);
+            writer.Write(ObjectData[i].PathScaleX);
+            writer.Write(ObjectData[i].PathScaleY);
+            writer.Write(ObjectData[i].PathShearX);
+            writer.Write(ObjectData[i].PathShearY);
+            writer.Write(ObjectData[i].PathTwist);
+            writer.Write(ObjectData[i].PathTwistBegin);
+            writer.Write(ObjectData[i].PathRadiusOffset);
+            writer.Write(ObjectData[i].PathTaperX);
+            writer.Write(ObjectData[i].PathTaperY);
+            writer.Write(ObjectData[i].PathRevolutions);
+            writer.Write(ObjectData[i].PathSkew);
+            writer.Write(ObjectData[i].ProfileBegin);
+            writer.Write(ObjectData[i].ProfileEnd);
+            writer.Write(ObjectData[i].ProfileHollow);
+        }
+    }
+
+    bool ObjectExtraParams::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].ParamType);
+            reader.Read(ObjectData[i].ParamInUse);
+            reader.Read(ObjectData[i].ParamSize);
+            reader.ReadVariable1(ObjectData[i].ParamData);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectExtraParams::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].ParamType);
+            writer.Write(ObjectData[i].ParamInUse);
+            writer.Write(ObjectData[i].ParamSize);
+            writer.WriteVariable1(ObjectData[i].ParamData);
+        }
+    }
+
+    bool ObjectOwner::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(HeaderData.Override);
+        reader.Read(HeaderData.OwnerID);
+        reader.Read(HeaderData.GroupID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectOwner::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(HeaderData.Override);
+        writer.Write(HeaderData.OwnerID);
+        writer.Write(HeaderData.GroupID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectGroup::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectGroup::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectBuy::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(AgentData.CategoryID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].SaleType);
+            reader.Read(ObjectData[i].SalePrice);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectBuy::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(AgentData.CategoryID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].SaleType);
+            writer.Write(ObjectData[i].SalePrice);
+        }
+    }
+
+    bool BuyObjectInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ObjectID);
+        reader.Read(Data.ItemID);
+        reader.Read(Data.FolderID);
+        return reader.IsValid();
+    }
+
+    void BuyObjectInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ObjectID);
+        writer.Write(Data.ItemID);
+        writer.Write(Data.FolderID);
+    }
+
+    bool DerezContainer::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.ObjectID);
+        reader.Read(Data.Delete);
+        return reader.IsValid();
+    }
+
+    void DerezContainer::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.ObjectID);
+        writer.Write(Data.Delete);
+    }
+
+    bool ObjectPermissions::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(HeaderData.Override);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].Field);
+            reader.Read(ObjectData[i].Set);
+            reader.Read(ObjectData[i].Mask);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectPermissions::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(HeaderData.Override);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].Field);
+            writer.Write(ObjectData[i].Set);
+            writer.Write(ObjectData[i].Mask);
+        }
+    }
+
+    bool ObjectSaleInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].LocalID);
+            reader.Read(ObjectData[i].SaleType);
+            reader.Read(ObjectData[i].SalePrice);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectSaleInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].LocalID);
+            writer.Write(ObjectData[i].SaleType);
+            writer.Write(ObjectData[i].SalePrice);
+        }
+    }
+
+    bool ObjectName::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].LocalID);
+            reader.ReadVariable1(ObjectData[i].Name);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectName::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].LocalID);
+            writer.WriteVariable1(ObjectData[i].Name);
+        }
+    }
+
+    bool ObjectDescription::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].LocalID);
+            reader.ReadVariable1(ObjectData[i].Description);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDescription::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].LocalID);
+            writer.WriteVariable1(ObjectData[i].Description);
+        }
+    }
+
+    bool ObjectCategory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].LocalID);
+            reader.Read(ObjectData[i].Category);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectCategory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].LocalID);
+            writer.Write(ObjectData[i].Category);
+        }
+    }
+
+    bool ObjectSelect::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectSelect::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectDeselect::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDeselect::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectAttach::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.AttachmentPoint);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].Rotation);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectAttach::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.AttachmentPoint);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].Rotation);
+        }
+    }
+
+    bool ObjectDetach::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDetach::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectDrop::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDrop::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectLink::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectLink::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectDelink::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectDelink::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool ObjectGrab::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.LocalID);
+        reader.Read(ObjectData.GrabOffset);
+        return reader.IsValid();
+    }
+
+    void ObjectGrab::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.LocalID);
+        writer.Write(ObjectData.GrabOffset);
+    }
+
+    bool ObjectGrabUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.ObjectID);
+        reader.Read(ObjectData.GrabOffsetInitial);
+        reader.Read(ObjectData.GrabPosition);
+        reader.Read(ObjectData.TimeSinceLast);
+        return reader.IsValid();
+    }
+
+    void ObjectGrabUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.ObjectID);
+        writer.Write(ObjectData.GrabOffsetInitial);
+        writer.Write(ObjectData.GrabPosition);
+        writer.Write(ObjectData.TimeSinceLast);
+    }
+
+    bool ObjectDeGrab::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.LocalID);
+        return reader.IsValid();
+    }
+
+    void ObjectDeGrab::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.LocalID);
+    }
+
+    bool ObjectSpinStart::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.ObjectID);
+        return reader.IsValid();
+    }
+
+    void ObjectSpinStart::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.ObjectID);
+    }
+
+    bool ObjectSpinUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.ObjectID);
+        reader.Read(ObjectData.Rotation);
+        return reader.IsValid();
+    }
+
+    void ObjectSpinUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.ObjectID);
+        writer.Write(ObjectData.Rotation);
+    }
+
+    bool ObjectSpinStop::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.ObjectID);
+        return reader.IsValid();
+    }
+
+    void ObjectSpinStop::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.ObjectID);
+    }
+
+    bool ObjectExportSelected::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.RequestID);
+        reader.Read(AgentData.VolumeDetail);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectID);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectExportSelected::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.RequestID);
+        writer.Write(AgentData.VolumeDetail);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectID);
+        }
+    }
+
+    bool ModifyLand::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ModifyBlock.Action);
+        reader.Read(ModifyBlock.BrushSize);
+        reader.Read(ModifyBlock.Seconds);
+        reader.Read(ModifyBlock.Height);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].LocalID);
+            reader.Read(ParcelData[i].West);
+            reader.Read(ParcelData[i].South);
+            reader.Read(ParcelData[i].East);
+            reader.Read(ParcelData[i].North);
+        }
+        return reader.IsValid();
+    }
+
+    void ModifyLand::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ModifyBlock.Action);
+        writer.Write(ModifyBlock.BrushSize);
+        writer.Write(ModifyBlock.Seconds);
+        writer.Write(ModifyBlock.Height);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].LocalID);
+            writer.Write(ParcelData[i].West);
+            writer.Write(ParcelData[i].South);
+            writer.Write(ParcelData[i].East);
+            writer.Write(ParcelData[i].North);
+        }
+    }
+
+    bool VelocityInterpolateOn::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void VelocityInterpolateOn::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool VelocityInterpolateOff::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void VelocityInterpolateOff::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool StateSave::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.ReadVariable1(DataBlock.Filename);
+        return reader.IsValid();
+    }
+
+    void StateSave::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteVariable1(DataBlock.Filename);
+    }
+
+    bool ReportAutosaveCrash::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AutosaveData.PID);
+        reader.Read(AutosaveData.Status);
+        return reader.IsValid();
+    }
+
+    void ReportAutosaveCrash::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AutosaveData.PID);
+        writer.Write(AutosaveData.Status);
+    }
+
+    bool SimWideDeletes::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(DataBlock.TargetID);
+        reader.Read(DataBlock.Flags);
+        return reader.IsValid();
+    }
+
+    void SimWideDeletes::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(DataBlock.TargetID);
+        writer.Write(DataBlock.Flags);
+    }
+
+    bool TrackAgent::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(TargetData.PreyID);
+        return reader.IsValid();
+    }
+
+    void TrackAgent::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(TargetData.PreyID);
+    }
+
+    bool ViewerStats::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.IP);
+        reader.Read(AgentData.StartTime);
+        reader.Read(AgentData.RunTime);
+        reader.Read(AgentData.SimFPS);
+        reader.Read(AgentData.FPS);
+        reader.Read(AgentData.AgentsInView);
+        reader.Read(AgentData.Ping);
+        reader.Read(AgentData.MetersTraveled);
+        reader.Read(AgentData.RegionsVisited);
+        reader.Read(AgentData.SysRAM);
+        reader.ReadVariable1(AgentData.SysOS);
+        reader.ReadVariable1(AgentData.SysCPU);
+        reader.ReadVariable1(AgentData.SysGPU);
+        reader.Read(DownloadTotals.World);
+        reader.Read(DownloadTotals.Objects);
+        reader.Read(DownloadTotals.Textures);
+        for(size_t i = 0; i < 2; ++i)
+        {
+            reader.Read(NetStats[i].Bytes);
+            reader.Read(NetStats[i].Packets);
+            reader.Read(NetStats[i].Compressed);
+            reader.Read(NetStats[i].Savings);
+        }
+        reader.Read(FailStats.SendPacket);
+        reader.Read(FailStats.Dropped);
+        reader.Read(FailStats.Resent);
+        reader.Read(FailStats.FailedResends);
+        reader.Read(FailStats.OffCircuit);
+        reader.Read(FailStats.Invalid);
+        MiscStats.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < MiscStats.size(); ++i)
+        {
+            reader.Read(MiscStats[i].Type);
+            reader.Read(MiscStats[i].Value);
+        }
+        return reader.IsValid();
+    }
+
+    void ViewerStats::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.IP);
+        writer.Write(AgentData.StartTime);
+        writer.Write(AgentData.RunTime);
+        writer.Write(AgentData.SimFPS);
+        writer.Write(AgentData.FPS);
+        writer.Write(AgentData.AgentsInView);
+        writer.Write(AgentData.Ping);
+        writer.Write(AgentData.MetersTraveled);
+        writer.Write(AgentData.RegionsVisited);
+        writer.Write(AgentData.SysRAM);
+        writer.WriteVariable1(AgentData.SysOS);
+        writer.WriteVariable1(AgentData.SysCPU);
+        writer.WriteVariable1(AgentData.SysGPU);
+        writer.Write(DownloadTotals.World);
+        writer.Write(DownloadTotals.Objects);
+        writer.Write(DownloadTotals.Textures);
+        for(size_t i = 0; i < 2; ++i)
+        {
+            writer.Write(NetStats[i].Bytes);
+            writer.Write(NetStats[i].Packets);
+            writer.Write(NetStats[i].Compressed);
+            writer.Write(NetStats[i].Savings);
+        }
+        writer.Write(FailStats.SendPacket);
+        writer.Write(FailStats.Dropped);
+        writer.Write(FailStats.Resent);
+        writer.Write(FailStats.FailedResends);
+        writer.Write(FailStats.OffCircuit);
+        writer.Write(FailStats.Invalid);
+        writer.WriteBlockCount(MiscStats.size());
+        for(size_t i = 0; i < MiscStats.size(); ++i)
+        {
+            writer.Write(MiscStats[i].Type);
+            writer.Write(MiscStats[i].Value);
+        }
+    }
+
+    bool ScriptAnswerYes::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.TaskID);
+        reader.Read(Data.ItemID);
+        reader.Read(Data.Questions);
+        return reader.IsValid();
+    }
+
+    void ScriptAnswerYes::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.TaskID);
+        writer.Write(Data.ItemID);
+        writer.Write(Data.Questions);
+    }
+
+    bool UserReport::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ReportData.ReportType);
+        reader.Read(ReportData.Category);
+        reader.Read(ReportData.Position);
+        reader.Read(ReportData.CheckFlags);
+        reader.Read(ReportData.ScreenshotID);
+        reader.Read(ReportData.ObjectID);
+        reader.Read(ReportData.AbuserID);
+        reader.ReadVariable1(ReportData.AbuseRegionName);
+        reader.Read(ReportData.AbuseRegionID);
+        reader.ReadVariable1(ReportData.Summary);
+        reader.ReadVariable2(ReportData.Details);
+        reader.ReadVariable1(ReportData.VersionString);
+        return reader.IsValid();
+    }
+
+    void UserReport::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ReportData.ReportType);
+        writer.Write(ReportData.Category);
+        writer.Write(ReportData.Position);
+        writer.Write(ReportData.CheckFlags);
+        writer.Write(ReportData.ScreenshotID);
+        writer.Write(ReportData.ObjectID);
+        writer.Write(ReportData.AbuserID);
+        writer.WriteVariable1(ReportData.AbuseRegionName);
+        writer.Write(ReportData.AbuseRegionID);
+        writer.WriteVariable1(ReportData.Summary);
+        writer.WriteVariable2(ReportData.Details);
+        writer.WriteVariable1(ReportData.VersionString);
+    }
+
+    bool AlertMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(AlertData.Message);
+        return reader.IsValid();
+    }
+
+    void AlertMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(AlertData.Message);
+    }
+
+    bool AgentAlertMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AlertData.Modal);
+        reader.ReadVariable1(AlertData.Message);
+        return reader.IsValid();
+    }
+
+    void AgentAlertMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AlertData.Modal);
+        writer.WriteVariable1(AlertData.Message);
+    }
+
+    bool MeanCollisionAlert::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        MeanCollision.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < MeanCollision.size(); ++i)
+        {
+            reader.Read(MeanCollision[i].Victim);
+            reader.Read(MeanCollision[i].Perp);
+            reader.Read(MeanCollision[i].Time);
+            reader.Read(MeanCollision[i].Mag);
+            reader.Read(MeanCollision[i].Type);
+        }
+        return reader.IsValid();
+    }
+
+    void MeanCollisionAlert::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(MeanCollision.size());
+        for(size_t i = 0; i < MeanCollision.size(); ++i)
+        {
+            writer.Write(MeanCollision[i].Victim);
+            writer.Write(MeanCollision[i].Perp);
+            writer.Write(MeanCollision[i].Time);
+            writer.Write(MeanCollision[i].Mag);
+            writer.Write(MeanCollision[i].Type);
+        }
+    }
+
+    bool ViewerFrozenMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(FrozenData.Data);
+        return reader.IsValid();
+    }
+
+    void ViewerFrozenMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(FrozenData.Data);
+    }
+
+    bool HealthMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(HealthData.Health);
+        return reader.IsValid();
+    }
+
+    void HealthMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(HealthData.Health);
+    }
+
+    bool ChatFromSimulator::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(ChatData.FromName);
+        reader.Read(ChatData.SourceID);
+        reader.Read(ChatData.OwnerID);
+        reader.Read(ChatData.SourceType);
+        reader.Read(ChatData.ChatType);
+        reader.Read(ChatData.Audible);
+        reader.Read(ChatData.Position);
+        reader.ReadVariable2(ChatData.Message);
+        return reader.IsValid();
+    }
+
+    void ChatFromSimulator::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(ChatData.FromName);
+        writer.Write(ChatData.SourceID);
+        writer.Write(ChatData.OwnerID);
+        writer.Write(ChatData.SourceType);
+        writer.Write(ChatData.ChatType);
+        writer.Write(ChatData.Audible);
+        writer.Write(ChatData.Position);
+        writer.WriteVariable2(ChatData.Message);
+    }
+
+    bool SimStats::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Region.RegionX);
+        reader.Read(Region.RegionY);
+        reader.Read(Region.RegionFlags);
+        reader.Read(Region.ObjectCapacity);
+        Stat.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Stat.size(); ++i)
+        {
+            reader.Read(Stat[i].StatID);
+            reader.Read(Stat[i].StatValue);
+        }
+        reader.Read(PidStat.PID);
+        return reader.IsValid();
+    }
+
+    void SimStats::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Region.RegionX);
+        writer.Write(Region.RegionY);
+        writer.Write(Region.RegionFlags);
+        writer.Write(Region.ObjectCapacity);
+        writer.WriteBlockCount(Stat.size());
+        for(size_t i = 0; i < Stat.size(); ++i)
+        {
+            writer.Write(Stat[i].StatID);
+            writer.Write(Stat[i].StatValue);
+        }
+        writer.Write(PidStat.PID);
+    }
+
+    bool RequestRegionInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void RequestRegionInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool RegionInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.ReadVariable1(RegionInfo_.SimName);
+        reader.Read(RegionInfo_.EstateID);
+        reader.Read(RegionInfo_.ParentEstateID);
+        reader.Read(RegionInfo_.RegionFlags);
+        reader.Read(RegionInfo_.SimAccess);
+        reader.Read(RegionInfo_.MaxAgents);
+        reader.Read(RegionInfo_.BillableFactor);
+        reader.Read(RegionInfo_.ObjectBonusFactor);
+        reader.Read(RegionInfo_.WaterHeight);
+        reader.Read(RegionInfo_.TerrainRaiseLimit);
+        reader.Read(RegionInfo_.TerrainLowerLimit);
+        reader.Read(RegionInfo_.PricePerMeter);
+        reader.Read(RegionInfo_.RedirectGridX);
+        reader.Read(RegionInfo_.RedirectGridY);
+        reader.Read(RegionInfo_.UseEstateSun);
+        reader.Read(RegionInfo_.SunHour);
+        return reader.IsValid();
+    }
+
+    void RegionInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteVariable1(RegionInfo_.SimName);
+        writer.Write(RegionInfo_.EstateID);
+        writer.Write(RegionInfo_.ParentEstateID);
+        writer.Write(RegionInfo_.RegionFlags);
+        writer.Write(RegionInfo_.SimAccess);
+        writer.Write(RegionInfo_.MaxAgents);
+        writer.Write(RegionInfo_.BillableFactor);
+        writer.Write(RegionInfo_.ObjectBonusFactor);
+        writer.Write(RegionInfo_.WaterHeight);
+        writer.Write(RegionInfo_.TerrainRaiseLimit);
+        writer.Write(RegionInfo_.TerrainLowerLimit);
+        writer.Write(RegionInfo_.PricePerMeter);
+        writer.Write(RegionInfo_.RedirectGridX);
+        writer.Write(RegionInfo_.RedirectGridY);
+        writer.Write(RegionInfo_.UseEstateSun);
+        writer.Write(RegionInfo_.SunHour);
+    }
+
+    bool GodUpdateRegionInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.ReadVariable1(RegionInfo.SimName);
+        reader.Read(RegionInfo.EstateID);
+        reader.Read(RegionInfo.ParentEstateID);
+        reader.Read(RegionInfo.RegionFlags);
+        reader.Read(RegionInfo.BillableFactor);
+        reader.Read(RegionInfo.PricePerMeter);
+        reader.Read(RegionInfo.RedirectGridX);
+        reader.Read(RegionInfo.RedirectGridY);
+        return reader.IsValid();
+    }
+
+    void GodUpdateRegionInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteVariable1(RegionInfo.SimName);
+        writer.Write(RegionInfo.EstateID);
+        writer.Write(RegionInfo.ParentEstateID);
+        writer.Write(RegionInfo.RegionFlags);
+        writer.Write(RegionInfo.BillableFactor);
+        writer.Write(RegionInfo.PricePerMeter);
+        writer.Write(RegionInfo.RedirectGridX);
+        writer.Write(RegionInfo.RedirectGridY);
+    }
+
+    bool NearestLandingRegionRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RequestingRegionData.RegionHandle);
+        return reader.IsValid();
+    }
+
+    void NearestLandingRegionRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RequestingRegionData.RegionHandle);
+    }
+
+    bool NearestLandingRegionReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(LandingRegionData.RegionHandle);
+        return reader.IsValid();
+    }
+
+    void NearestLandingRegionReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(LandingRegionData.RegionHandle);
+    }
+
+    bool NearestLandingRegionUpdated::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RegionData.RegionHandle);
+        return reader.IsValid();
+    }
+
+    void NearestLandingRegionUpdated::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RegionData.RegionHandle);
+    }
+
+    bool TeleportLandingStatusChanged::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RegionData.RegionHandle);
+        return reader.IsValid();
+    }
+
+    void TeleportLandingStatusChanged::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RegionData.RegionHandle);
+    }
+
+    bool RegionHandshake::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RegionInfo.RegionFlags);
+        reader.Read(RegionInfo.SimAccess);
+        reader.ReadVariable1(RegionInfo.SimName);
+        reader.Read(RegionInfo.SimOwner);
+        reader.Read(RegionInfo.IsEstateManager);
+        reader.Read(RegionInfo.WaterHeight);
+        reader.Read(RegionInfo.BillableFactor);
+        reader.Read(RegionInfo.CacheID);
+        reader.Read(RegionInfo.TerrainBase0);
+        reader.Read(RegionInfo.TerrainBase1);
+        reader.Read(RegionInfo.TerrainBase2);
+        reader.Read(RegionInfo.TerrainBase3);
+        reader.Read(RegionInfo.TerrainDetail0);
+        reader.Read(RegionInfo.TerrainDetail1);
+        reader.Read(RegionInfo.TerrainDetail2);
+        reader.Read(RegionInfo.TerrainDetail3);
+        reader.Read(RegionInfo.TerrainStartHeight00);
+        reader.Read(RegionInfo.TerrainStartHeight01);
+        reader.Read(RegionInfo.TerrainStartHeight10);
+        reader.Read(RegionInfo.TerrainStartHeight11);
+        reader.Read(RegionInfo.TerrainHeightRange00);
+        reader.Read(RegionInfo.TerrainHeightRange01);
+        reader.Read(RegionInfo.TerrainHeightRange10);
+        reader.Read(RegionInfo.TerrainHeightRange11);
+        reader.Read(RegionInfo2.RegionID);
+        return reader.IsValid();
+    }
+
+    void RegionHandshake::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RegionInfo.RegionFlags);
+        writer.Write(RegionInfo.SimAccess);
+        writer.WriteVariable1(RegionInfo.SimName);
+        writer.Write(RegionInfo.SimOwner);
+        writer.Write(RegionInfo.IsEstateManager);
+        writer.Write(RegionInfo.WaterHeight);
+        writer.Write(RegionInfo.BillableFactor);
+        writer.Write(RegionInfo.CacheID);
+        writer.Write(RegionInfo.TerrainBase0);
+        writer.Write(RegionInfo.TerrainBase1);
+        writer.Write(RegionInfo.TerrainBase2);
+        writer.Write(RegionInfo.TerrainBase3);
+        writer.Write(RegionInfo.TerrainDetail0);
+        writer.Write(RegionInfo.TerrainDetail1);
+        writer.Write(RegionInfo.TerrainDetail2);
+        writer.Write(RegionInfo.TerrainDetail3);
+        writer.Write(RegionInfo.TerrainStartHeight00);
+        writer.Write(RegionInfo.TerrainStartHeight01);
+        writer.Write(RegionInfo.TerrainStartHeight10);
+        writer.Write(RegionInfo.TerrainStartHeight11);
+        writer.Write(RegionInfo.TerrainHeightRange00);
+        writer.Write(RegionInfo.TerrainHeightRange01);
+        writer.Write(RegionInfo.TerrainHeightRange10);
+        writer.Write(RegionInfo.TerrainHeightRange11);
+        writer.Write(RegionInfo2.RegionID);
+    }
+
+    bool RegionHandshakeReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(RegionInfo.Flags);
+        return reader.IsValid();
+    }
+
+    void RegionHandshakeReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(RegionInfo.Flags);
+    }
+
+    bool SimulatorViewerTimeMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TimeInfo.UsecSinceStart);
+        reader.Read(TimeInfo.SecPerDay);
+        reader.Read(TimeInfo.SecPerYear);
+        reader.Read(TimeInfo.SunDirection);
+        reader.Read(TimeInfo.SunPhase);
+        reader.Read(TimeInfo.SunAngVelocity);
+        return reader.IsValid();
+    }
+
+    void SimulatorViewerTimeMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TimeInfo.UsecSinceStart);
+        writer.Write(TimeInfo.SecPerDay);
+        writer.Write(TimeInfo.SecPerYear);
+        writer.Write(TimeInfo.SunDirection);
+        writer.Write(TimeInfo.SunPhase);
+        writer.Write(TimeInfo.SunAngVelocity);
+    }
+
+    bool EnableSimulator::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(SimulatorInfo.Handle);
+        reader.Read(SimulatorInfo.IP);
+        reader.Read(SimulatorInfo.Port);
+        return reader.IsValid();
+    }
+
+    void EnableSimulator::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(SimulatorInfo.Handle);
+        writer.Write(SimulatorInfo.IP);
+        writer.Write(SimulatorInfo.Port);
+    }
+
+    bool DisableSimulator::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void DisableSimulator::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+    bool TransferRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TransferInfo.TransferID);
+        reader.Read(TransferInfo.ChannelType);
+        reader.Read(TransferInfo.SourceType);
+        reader.Read(TransferInfo.Priority);
+        reader.ReadVariable2(TransferInfo.Params);
+        return reader.IsValid();
+    }
+
+    void TransferRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TransferInfo.TransferID);
+        writer.Write(TransferInfo.ChannelType);
+        writer.Write(TransferInfo.SourceType);
+        writer.Write(TransferInfo.Priority);
+        writer.WriteVariable2(TransferInfo.Params);
+    }
+
+    bool TransferInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TransferInfo_.TransferID);
+        reader.Read(TransferInfo_.ChannelType);
+        reader.Read(TransferInfo_.TargetType);
+        reader.Read(TransferInfo_.Status);
+        reader.Read(TransferInfo_.Size);
+        reader.ReadVariable2(TransferInfo_.Params);
+        return reader.IsValid();
+    }
+
+    void TransferInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TransferInfo_.TransferID);
+        writer.Write(TransferInfo_.ChannelType);
+        writer.Write(TransferInfo_.TargetType);
+        writer.Write(TransferInfo_.Status);
+        writer.Write(TransferInfo_.Size);
+        writer.WriteVariable2(TransferInfo_.Params);
+    }
+
+    bool TransferAbort::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TransferInfo.TransferID);
+        reader.Read(TransferInfo.ChannelType);
+        return reader.IsValid();
+    }
+
+    void TransferAbort::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TransferInfo.TransferID);
+        writer.Write(TransferInfo.ChannelType);
+    }
+
+    bool RequestXfer::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(XferID.ID);
+        reader.ReadVariable1(XferID.Filename);
+        reader.Read(XferID.FilePath);
+        reader.Read(XferID.DeleteOnCompletion);
+        reader.Read(XferID.UseBigPackets);
+        reader.Read(XferID.VFileID);
+        reader.Read(XferID.VFileType);
+        return reader.IsValid();
+    }
+
+    void RequestXfer::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(XferID.ID);
+        writer.WriteVariable1(XferID.Filename);
+        writer.Write(XferID.FilePath);
+        writer.Write(XferID.DeleteOnCompletion);
+        writer.Write(XferID.UseBigPackets);
+        writer.Write(XferID.VFileID);
+        writer.Write(XferID.VFileType);
+    }
+
+    bool AbortXfer::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(XferID.ID);
+        reader.Read(XferID.Result);
+        return reader.IsValid();
+    }
+
+    void AbortXfer::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(XferID.ID);
+        writer.Write(XferID.Result);
+    }
+
+    bool AvatarAppearance::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Sender.ID);
+        reader.Read(Sender.IsTrial);
+        reader.ReadVariable2(ObjectData.TextureEntry);
+        VisualParam.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < VisualParam.size(); ++i)
+        {
+            reader.Read(VisualParam[i].ParamValue);
+        }
+        return reader.IsValid();
+    }
+
+    void AvatarAppearance::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Sender.ID);
+        writer.Write(Sender.IsTrial);
+        writer.WriteVariable2(ObjectData.TextureEntry);
+        writer.WriteBlockCount(VisualParam.size());
+        for(size_t i = 0; i < VisualParam.size(); ++i)
+        {
+            writer.Write(VisualParam[i].ParamValue);
+        }
+    }
+
+    bool SetFollowCamProperties::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ObjectData.ObjectID);
+        CameraProperty.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < CameraProperty.size(); ++i)
+        {
+            reader.Read(CameraProperty[i].Type);
+            reader.Read(CameraProperty[i].Value);
+        }
+        return reader.IsValid();
+    }
+
+    void SetFollowCamProperties::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ObjectData.ObjectID);
+        writer.WriteBlockCount(CameraProperty.size());
+        for(size_t i = 0; i < CameraProperty.size(); ++i)
+        {
+            writer.Write(CameraProperty[i].Type);
+            writer.Write(CameraProperty[i].Value);
+        }
+    }
+
+    bool ClearFollowCamProperties::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ObjectData.ObjectID);
+        return reader.IsValid();
+    }
+
+    void ClearFollowCamProperties::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ObjectData.ObjectID);
+    }
+
+    bool RequestPayPrice::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ObjectData.ObjectID);
+        return reader.IsValid();
+    }
+
+    void RequestPayPrice::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ObjectData.ObjectID);
+    }
+
+    bool PayPriceReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ObjectData.ObjectID);
+        reader.Read(ObjectData.DefaultPayPrice);
+        ButtonData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ButtonData.size(); ++i)
+        {
+            reader.Read(ButtonData[i].PayButton);
+        }
+        return reader.IsValid();
+    }
+
+    void PayPriceReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ObjectData.ObjectID);
+        writer.Write(ObjectData.DefaultPayPrice);
+        writer.WriteBlockCount(ButtonData.size());
+        for(size_t i = 0; i < ButtonData.size(); ++i)
+        {
+            writer.Write(ButtonData[i].PayButton);
+        }
+    }
+
+    bool KickUser::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TargetBlock.TargetIP);
+        reader.Read(TargetBlock.TargetPort);
+        reader.Read(UserInfo.AgentID);
+        reader.Read(UserInfo.SessionID);
+        reader.ReadVariable2(UserInfo.Reason);
+        return reader.IsValid();
+    }
+
+    void KickUser::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TargetBlock.TargetIP);
+        writer.Write(TargetBlock.TargetPort);
+        writer.Write(UserInfo.AgentID);
+        writer.Write(UserInfo.SessionID);
+        writer.WriteVariable2(UserInfo.Reason);
+    }
+
+    bool KickUserAck::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(UserInfo.SessionID);
+        reader.Read(UserInfo.Flags);
+        return reader.IsValid();
+    }
+
+    void KickUserAck::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(UserInfo.SessionID);
+        writer.Write(UserInfo.Flags);
+    }
+
+    bool GodKickUser::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(UserInfo.GodID);
+        reader.Read(UserInfo.GodSessionID);
+        reader.Read(UserInfo.AgentID);
+        reader.Read(UserInfo.KickFlags);
+        reader.ReadVariable2(UserInfo.Reason);
+        return reader.IsValid();
+    }
+
+    void GodKickUser::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(UserInfo.GodID);
+        writer.Write(UserInfo.GodSessionID);
+        writer.Write(UserInfo.AgentID);
+        writer.Write(UserInfo.KickFlags);
+        writer.WriteVariable2(UserInfo.Reason);
+    }
+
+    bool SystemKickUser::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        AgentInfo.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AgentInfo.size(); ++i)
+        {
+            reader.Read(AgentInfo[i].AgentID);
+        }
+        return reader.IsValid();
+    }
+
+    void SystemKickUser::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(AgentInfo.size());
+        for(size_t i = 0; i < AgentInfo.size(); ++i)
+        {
+            writer.Write(AgentInfo[i].AgentID);
+        }
+    }
+
+    bool EjectUser::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.TargetID);
+        reader.Read(Data.Flags);
+        return reader.IsValid();
+    }
+
+    void EjectUser::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.TargetID);
+        writer.Write(Data.Flags);
+    }
+
+    bool FreezeUser::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.TargetID);
+        reader.Read(Data.Flags);
+        return reader.IsValid();
+    }
+
+    void FreezeUser::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.TargetID);
+        writer.Write(Data.Flags);
+    }
+
+    bool AvatarPropertiesRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.AvatarID);
+        return reader.IsValid();
+    }
+
+    void AvatarPropertiesRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.AvatarID);
+    }
+
+    bool AvatarPropertiesRequestBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.AvatarID);
+        reader.Read(AgentData.GodLevel);
+        reader.Read(AgentData.WebProfilesDisabled);
+        return reader.IsValid();
+    }
+
+    void AvatarPropertiesRequestBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.AvatarID);
+        writer.Write(AgentData.GodLevel);
+        writer.Write(AgentData.WebProfilesDisabled);
+    }
+
+    bool AvatarPropertiesReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.AvatarID);
+        reader.Read(PropertiesData.ImageID);
+        reader.Read(PropertiesData.FLImageID);
+        reader.Read(PropertiesData.PartnerID);
+        reader.ReadVariable2(PropertiesData.AboutText);
+        reader.ReadVariable1(PropertiesData.FLAboutText);
+        reader.ReadVariable1(PropertiesData.BornOn);
+        reader.ReadVariable1(PropertiesData.ProfileURL);
+        reader.ReadVariable1(PropertiesData.CharterMember);
+        reader.Read(PropertiesData.Flags);
+        return reader.IsValid();
+    }
+
+    void AvatarPropertiesReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.AvatarID);
+        writer.Write(PropertiesData.ImageID);
+        writer.Write(PropertiesData.FLImageID);
+        writer.Write(PropertiesData.PartnerID);
+        writer.WriteVariable2(PropertiesData.AboutText);
+        writer.WriteVariable1(PropertiesData.FLAboutText);
+        writer.WriteVariable1(PropertiesData.BornOn);
+        writer.WriteVariable1(PropertiesData.ProfileURL);
+        writer.WriteVariable1(PropertiesData.CharterMember);
+        writer.Write(PropertiesData.Flags);
+    }
+
+    bool AvatarInterestsReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.AvatarID);
+        reader.Read(PropertiesData.WantToMask);
+        reader.ReadVariable1(PropertiesData.WantToText);
+        reader.Read(PropertiesData.SkillsMask);
+        reader.ReadVariable1(PropertiesData.SkillsText);
+        reader.ReadVariable1(PropertiesData.LanguagesText);
+        return reader.IsValid();
+    }
+
+    void AvatarInterestsReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.AvatarID);
+        writer.Write(PropertiesData.WantToMask);
+        writer.WriteVariable1(PropertiesData.WantToText);
+        writer.Write(PropertiesData.SkillsMask);
+        writer.WriteVariable1(PropertiesData.SkillsText);
+        writer.WriteVariable1(PropertiesData.LanguagesText);
+    }
+
+    bool AvatarGroupsReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.AvatarID);
+        GroupData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            reader.Read(GroupData[i].GroupPowers);
+            reader.Read(GroupData[i].AcceptNotices);
+            reader.ReadVariable1(GroupData[i].GroupTitle);
+            reader.Read(GroupData[i].GroupID);
+            reader.ReadVariable1(GroupData[i].GroupName);
+            reader.Read(GroupData[i].GroupInsigniaID);
+        }
+        reader.Read(NewGroupData.ListInProfile);
+        return reader.IsValid();
+    }
+
+    void AvatarGroupsReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.AvatarID);
+        writer.WriteBlockCount(GroupData.size());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            writer.Write(GroupData[i].GroupPowers);
+            writer.Write(GroupData[i].AcceptNotices);
+            writer.WriteVariable1(GroupData[i].GroupTitle);
+            writer.Write(GroupData[i].GroupID);
+            writer.WriteVariable1(GroupData[i].GroupName);
+            writer.Write(GroupData[i].GroupInsigniaID);
+        }
+        writer.Write(NewGroupData.ListInProfile);
+    }
+
+    bool AvatarPropertiesUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(PropertiesData.ImageID);
+        reader.Read(PropertiesData.FLImageID);
+        reader.ReadVariable2(PropertiesData.AboutText);
+        reader.ReadVariable1(PropertiesData.FLAboutText);
+        reader.Read(PropertiesData.AllowPublish);
+        reader.Read(PropertiesData.MaturePublish);
+        reader.ReadVariable1(PropertiesData.ProfileURL);
+        return reader.IsValid();
+    }
+
+    void AvatarPropertiesUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(PropertiesData.ImageID);
+        writer.Write(PropertiesData.FLImageID);
+        writer.WriteVariable2(PropertiesData.AboutText);
+        writer.WriteVariable1(PropertiesData.FLAboutText);
+        writer.Write(PropertiesData.AllowPublish);
+        writer.Write(PropertiesData.MaturePublish);
+        writer.WriteVariable1(PropertiesData.ProfileURL);
+    }
+
+    bool AvatarInterestsUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(PropertiesData.WantToMask);
+        reader.ReadVariable1(PropertiesData.WantToText);
+        reader.Read(PropertiesData.SkillsMask);
+        reader.ReadVariable1(PropertiesData.SkillsText);
+        reader.ReadVariable1(PropertiesData.LanguagesText);
+        return reader.IsValid();
+    }
+
+    void AvatarInterestsUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(PropertiesData.WantToMask);
+        writer.WriteVariable1(PropertiesData.WantToText);
+        writer.Write(PropertiesData.SkillsMask);
+        writer.WriteVariable1(PropertiesData.SkillsText);
+        writer.WriteVariable1(PropertiesData.LanguagesText);
+    }
+
+    bool AvatarNotesReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(Data.TargetID);
+        reader.ReadVariable2(Data.Notes);
+        return reader.IsValid();
+    }
+
+    void AvatarNotesReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(Data.TargetID);
+        writer.WriteVariable2(Data.Notes);
+    }
+
+    bool AvatarNotesUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.TargetID);
+        reader.ReadVariable2(Data.Notes);
+        return reader.IsValid();
+    }
+
+    void AvatarNotesUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.TargetID);
+        writer.WriteVariable2(Data.Notes);
+    }
+
+    bool AvatarPicksReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.TargetID);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].PickID);
+            reader.ReadVariable1(Data[i].PickName);
+        }
+        return reader.IsValid();
+    }
+
+    void AvatarPicksReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.TargetID);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].PickID);
+            writer.WriteVariable1(Data[i].PickName);
+        }
+    }
+
+    bool EventInfoRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(EventData.EventID);
+        return reader.IsValid();
+    }
+
+    void EventInfoRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(EventData.EventID);
+    }
+
+    bool EventInfoReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(EventData.EventID);
+        reader.ReadVariable1(EventData.Creator);
+        reader.ReadVariable1(EventData.Name);
+        reader.ReadVariable1(EventData.Category);
+        reader.ReadVariable2(EventData.Desc);
+        reader.ReadVariable1(EventData.Date);
+        reader.Read(EventData.DateUTC);
+        reader.Read(EventData.Duration);
+        reader.Read(EventData.Cover);
+        reader.Read(EventData.Amount);
+        reader.ReadVariable1(EventData.SimName);
+        reader.Read(EventData.GlobalPos);
+        reader.Read(EventData.EventFlags);
+        return reader.IsValid();
+    }
+
+    void EventInfoReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(EventData.EventID);
+        writer.WriteVariable1(EventData.Creator);
+        writer.WriteVariable1(EventData.Name);
+        writer.WriteVariable1(EventData.Category);
+        writer.WriteVariable2(EventData.Desc);
+        writer.WriteVariable1(EventData.Date);
+        writer.Write(EventData.DateUTC);
+        writer.Write(EventData.Duration);
+        writer.Write(EventData.Cover);
+        writer.Write(EventData.Amount);
+        writer.WriteVariable1(EventData.SimName);
+        writer.Write(EventData.GlobalPos);
+        writer.Write(EventData.EventFlags);
+    }
+
+    bool EventNotificationAddRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(EventData.EventID);
+        return reader.IsValid();
+    }
+
+    void EventNotificationAddRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(EventData.EventID);
+    }
+
+    bool EventNotificationRemoveRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(EventData.EventID);
+        return reader.IsValid();
+    }
+
+    void EventNotificationRemoveRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(EventData.EventID);
+    }
+
+    bool EventGodDelete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(EventData.EventID);
+        reader.Read(QueryData.QueryID);
+        reader.ReadVariable1(QueryData.QueryText);
+        reader.Read(QueryData.QueryFlags);
+        reader.Read(QueryData.QueryStart);
+        return reader.IsValid();
+    }
+
+    void EventGodDelete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(EventData.EventID);
+        writer.Write(QueryData.QueryID);
+        writer.WriteVariable1(QueryData.QueryText);
+        writer.Write(QueryData.QueryFlags);
+        writer.Write(QueryData.QueryStart);
+    }
+
+    bool PickInfoReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(Data.PickID);
+        reader.Read(Data.CreatorID);
+        reader.Read(Data.TopPick);
+        reader.Read(Data.ParcelID);
+        reader.ReadVariable1(Data.Name);
+        reader.ReadVariable2(Data.Desc);
+        reader.Read(Data.SnapshotID);
+        reader.ReadVariable1(Data.User);
+        reader.ReadVariable1(Data.OriginalName);
+        reader.ReadVariable1(Data.SimName);
+        reader.Read(Data.PosGlobal);
+        reader.Read(Data.SortOrder);
+        reader.Read(Data.Enabled);
+        return reader.IsValid();
+    }
+
+    void PickInfoReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(Data.PickID);
+        writer.Write(Data.CreatorID);
+        writer.Write(Data.TopPick);
+        writer.Write(Data.ParcelID);
+        writer.WriteVariable1(Data.Name);
+        writer.WriteVariable2(Data.Desc);
+        writer.Write(Data.SnapshotID);
+        writer.WriteVariable1(Data.User);
+        writer.WriteVariable1(Data.OriginalName);
+        writer.WriteVariable1(Data.SimName);
+        writer.Write(Data.PosGlobal);
+        writer.Write(Data.SortOrder);
+        writer.Write(Data.Enabled);
+    }
+
+    bool PickInfoUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.PickID);
+        reader.Read(Data.CreatorID);
+        reader.Read(Data.TopPick);
+        reader.Read(Data.ParcelID);
+        reader.ReadVariable1(Data.Name);
+        reader.ReadVariable2(Data.Desc);
+        reader.Read(Data.SnapshotID);
+        reader.Read(Data.PosGlobal);
+        reader.Read(Data.SortOrder);
+        reader.Read(Data.Enabled);
+        return reader.IsValid();
+    }
+
+    void PickInfoUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.PickID);
+        writer.Write(Data.CreatorID);
+        writer.Write(Data.TopPick);
+        writer.Write(Data.ParcelID);
+        writer.WriteVariable1(Data.Name);
+        writer.WriteVariable2(Data.Desc);
+        writer.Write(Data.SnapshotID);
+        writer.Write(Data.PosGlobal);
+        writer.Write(Data.SortOrder);
+        writer.Write(Data.Enabled);
+    }
+
+    bool PickDelete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.PickID);
+        return reader.IsValid();
+    }
+
+    void PickDelete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.PickID);
+    }
+
+    bool PickGodDelete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.PickID);
+        reader.Read(Data.QueryID);
+        return reader.IsValid();
+    }
+
+    void PickGodDelete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.PickID);
+        writer.Write(Data.QueryID);
+    }
+
+    bool ScriptQuestion::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.TaskID);
+        reader.Read(Data.ItemID);
+        reader.ReadVariable1(Data.ObjectName);
+        reader.ReadVariable1(Data.ObjectOwner);
+        reader.Read(Data.Questions);
+        return reader.IsValid();
+    }
+
+    void ScriptQuestion::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.TaskID);
+        writer.Write(Data.ItemID);
+        writer.WriteVariable1(Data.ObjectName);
+        writer.WriteVariable1(Data.ObjectOwner);
+        writer.Write(Data.Questions);
+    }
+
+    bool ScriptControlChange::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].TakeControls);
+            reader.Read(Data[i].Controls);
+            reader.Read(Data[i].PassToAgent);
+        }
+        return reader.IsValid();
+    }
+
+    void ScriptControlChange::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].TakeControls);
+            writer.Write(Data[i].Controls);
+            writer.Write(Data[i].PassToAgent);
+        }
+    }
+
+    bool ScriptDialog::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.ObjectID);
+        reader.ReadVariable1(Data.FirstName);
+        reader.ReadVariable1(Data.LastName);
+        reader.ReadVariable1(Data.ObjectName);
+        reader.ReadVariable2(Data.Message);
+        reader.Read(Data.ChatChannel);
+        reader.Read(Data.ImageID);
+        Buttons.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Buttons.size(); ++i)
+        {
+            reader.ReadVariable1(Buttons[i].ButtonLabel);
+        }
+        return reader.IsValid();
+    }
+
+    void ScriptDialog::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.ObjectID);
+        writer.WriteVariable1(Data.FirstName);
+        writer.WriteVariable1(Data.LastName);
+        writer.WriteVariable1(Data.ObjectName);
+        writer.WriteVariable2(Data.Message);
+        writer.Write(Data.ChatChannel);
+        writer.Write(Data.ImageID);
+        writer.WriteBlockCount(Buttons.size());
+        for(size_t i = 0; i < Buttons.size(); ++i)
+        {
+            writer.WriteVariable1(Buttons[i].ButtonLabel);
+        }
+    }
+
+    bool ScriptDialogReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ObjectID);
+        reader.Read(Data.ChatChannel);
+        reader.Read(Data.ButtonIndex);
+        reader.ReadVariable1(Data.ButtonLabel);
+        return reader.IsValid();
+    }
+
+    void ScriptDialogReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ObjectID);
+        writer.Write(Data.ChatChannel);
+        writer.Write(Data.ButtonIndex);
+        writer.WriteVariable1(Data.ButtonLabel);
+    }
+
+    bool ForceScriptControlRelease::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void ForceScriptControlRelease::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool RevokePermissions::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.ObjectID);
+        reader.Read(Data.ObjectPermissions);
+        return reader.IsValid();
+    }
+
+    void RevokePermissions::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.ObjectID);
+        writer.Write(Data.ObjectPermissions);
+    }
+
+    bool LoadURL::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(Data.ObjectName);
+        reader.Read(Data.ObjectID);
+        reader.Read(Data.OwnerID);
+        reader.Read(Data.OwnerIsGroup);
+        reader.ReadVariable1(Data.Message);
+        reader.ReadVariable1(Data.URL);
+        return reader.IsValid();
+    }
+
+    void LoadURL::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(Data.ObjectName);
+        writer.Write(Data.ObjectID);
+        writer.Write(Data.OwnerID);
+        writer.Write(Data.OwnerIsGroup);
+        writer.WriteVariable1(Data.Message);
+        writer.WriteVariable1(Data.URL);
+    }
+
+    bool ScriptTeleportRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(Data.ObjectName);
+        reader.ReadVariable1(Data.SimName);
+        reader.Read(Data.SimPosition);
+        reader.Read(Data.LookAt);
+        return reader.IsValid();
+    }
+
+    void ScriptTeleportRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(Data.ObjectName);
+        writer.WriteVariable1(Data.SimName);
+        writer.Write(Data.SimPosition);
+        writer.Write(Data.LookAt);
+    }
+
+    bool ParcelOverlay::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ParcelData.SequenceID);
+        reader.ReadVariable2(ParcelData.Data);
+        return reader.IsValid();
+    }
+
+    void ParcelOverlay::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ParcelData.SequenceID);
+        writer.WriteVariable2(ParcelData.Data);
+    }
+
+    bool ParcelPropertiesRequestByID::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.SequenceID);
+        reader.Read(ParcelData.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelPropertiesRequestByID::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.SequenceID);
+        writer.Write(ParcelData.LocalID);
+    }
+
+    bool ParcelPropertiesUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        reader.Read(ParcelData.Flags);
+        reader.Read(ParcelData.ParcelFlags);
+        reader.Read(ParcelData.SalePrice);
+        reader.ReadVariable1(ParcelData.Name);
+        reader.ReadVariable1(ParcelData.Desc);
+        reader.ReadVariable1(ParcelData.MusicURL);
+        reader.ReadVariable1(ParcelData.MediaURL);
+        reader.Read(ParcelData.MediaID);
+        reader.Read(ParcelData.MediaAutoScale);
+        reader.Read(ParcelData.GroupID);
+        reader.Read(ParcelData.PassPrice);
+        reader.Read(ParcelData.PassHours);
+        reader.Read(ParcelData.Category);
+        reader.Read(ParcelData.AuthBuyerID);
+        reader.Read(ParcelData.SnapshotID);
+        reader.Read(ParcelData.UserLocation);
+        reader.Read(ParcelData.UserLookAt);
+        reader.Read(ParcelData.LandingType);
+        return reader.IsValid();
+    }
+
+    void ParcelPropertiesUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+        writer.Write(ParcelData.Flags);
+        writer.Write(ParcelData.ParcelFlags);
+        writer.Write(ParcelData.SalePrice);
+        writer.WriteVariable1(ParcelData.Name);
+        writer.WriteVariable1(ParcelData.Desc);
+        writer.WriteVariable1(ParcelData.MusicURL);
+        writer.WriteVariable1(ParcelData.MediaURL);
+        writer.Write(ParcelData.MediaID);
+        writer.Write(ParcelData.MediaAutoScale);
+        writer.Write(ParcelData.GroupID);
+        writer.Write(ParcelData.PassPrice);
+        writer.Write(ParcelData.PassHours);
+        writer.Write(ParcelData.Category);
+        writer.Write(ParcelData.AuthBuyerID);
+        writer.Write(ParcelData.SnapshotID);
+        writer.Write(ParcelData.UserLocation);
+        writer.Write(ParcelData.UserLookAt);
+        writer.Write(ParcelData.LandingType);
+    }
+
+    bool ParcelReturnObjects::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        reader.Read(ParcelData.ReturnType);
+        TaskIDs.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < TaskIDs.size(); ++i)
+        {
+            reader.Read(TaskIDs[i].TaskID);
+        }
+        OwnerIDs.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < OwnerIDs.size(); ++i)
+        {
+            reader.Read(OwnerIDs[i].OwnerID);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelReturnObjects::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+        writer.Write(ParcelData.ReturnType);
+        writer.WriteBlockCount(TaskIDs.size());
+        for(size_t i = 0; i < TaskIDs.size(); ++i)
+        {
+            writer.Write(TaskIDs[i].TaskID);
+        }
+        writer.WriteBlockCount(OwnerIDs.size());
+        for(size_t i = 0; i < OwnerIDs.size(); ++i)
+        {
+            writer.Write(OwnerIDs[i].OwnerID);
+        }
+    }
+
+    bool ParcelSetOtherCleanTime::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        reader.Read(ParcelData.OtherCleanTime);
+        return reader.IsValid();
+    }
+
+    void ParcelSetOtherCleanTime::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+        writer.Write(ParcelData.OtherCleanTime);
+    }
+
+    bool ParcelDisableObjects::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        reader.Read(ParcelData.ReturnType);
+        TaskIDs.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < TaskIDs.size(); ++i)
+        {
+            reader.Read(TaskIDs[i].TaskID);
+        }
+        OwnerIDs.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < OwnerIDs.size(); ++i)
+        {
+            reader.Read(OwnerIDs[i].OwnerID);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelDisableObjects::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+        writer.Write(ParcelData.ReturnType);
+        writer.WriteBlockCount(TaskIDs.size());
+        for(size_t i = 0; i < TaskIDs.size(); ++i)
+        {
+            writer.Write(TaskIDs[i].TaskID);
+        }
+        writer.WriteBlockCount(OwnerIDs.size());
+        for(size_t i = 0; i < OwnerIDs.size(); ++i)
+        {
+            writer.Write(OwnerIDs[i].OwnerID);
+        }
+    }
+
+    bool ParcelSelectObjects::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        reader.Read(ParcelData.ReturnType);
+        ReturnIDs.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ReturnIDs.size(); ++i)
+        {
+            reader.Read(ReturnIDs[i].ReturnID);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelSelectObjects::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+        writer.Write(ParcelData.ReturnType);
+        writer.WriteBlockCount(ReturnIDs.size());
+        for(size_t i = 0; i < ReturnIDs.size(); ++i)
+        {
+            writer.Write(ReturnIDs[i].ReturnID);
+        }
+    }
+
+    bool EstateCovenantRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void EstateCovenantRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool EstateCovenantReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.CovenantID);
+        reader.Read(Data.CovenantTimestamp);
+        reader.ReadVariable1(Data.EstateName);
+        reader.Read(Data.EstateOwnerID);
+        return reader.IsValid();
+    }
+
+    void EstateCovenantReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.CovenantID);
+        writer.Write(Data.CovenantTimestamp);
+        writer.WriteVariable1(Data.EstateName);
+        writer.Write(Data.EstateOwnerID);
+    }
+
+    bool ForceObjectSelect::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Header.ResetList);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].LocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void ForceObjectSelect::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Header.ResetList);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].LocalID);
+        }
+    }
+
+    bool ParcelBuyPass::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelBuyPass::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+    }
+
+    bool ParcelDeedToGroup::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.GroupID);
+        reader.Read(Data.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelDeedToGroup::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.GroupID);
+        writer.Write(Data.LocalID);
+    }
+
+    bool ParcelReclaim::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelReclaim::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.LocalID);
+    }
+
+    bool ParcelClaim::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.GroupID);
+        reader.Read(Data.IsGroupOwned);
+        reader.Read(Data.Final);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].West);
+            reader.Read(ParcelData[i].South);
+            reader.Read(ParcelData[i].East);
+            reader.Read(ParcelData[i].North);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelClaim::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.GroupID);
+        writer.Write(Data.IsGroupOwned);
+        writer.Write(Data.Final);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].West);
+            writer.Write(ParcelData[i].South);
+            writer.Write(ParcelData[i].East);
+            writer.Write(ParcelData[i].North);
+        }
+    }
+
+    bool ParcelJoin::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.West);
+        reader.Read(ParcelData.South);
+        reader.Read(ParcelData.East);
+        reader.Read(ParcelData.North);
+        return reader.IsValid();
+    }
+
+    void ParcelJoin::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.West);
+        writer.Write(ParcelData.South);
+        writer.Write(ParcelData.East);
+        writer.Write(ParcelData.North);
+    }
+
+    bool ParcelDivide::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.West);
+        reader.Read(ParcelData.South);
+        reader.Read(ParcelData.East);
+        reader.Read(ParcelData.North);
+        return reader.IsValid();
+    }
+
+    void ParcelDivide::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.West);
+        writer.Write(ParcelData.South);
+        writer.Write(ParcelData.East);
+        writer.Write(ParcelData.North);
+    }
+
+    bool ParcelRelease::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelRelease::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.LocalID);
+    }
+
+    bool ParcelBuy::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.GroupID);
+        reader.Read(Data.IsGroupOwned);
+        reader.Read(Data.RemoveContribution);
+        reader.Read(Data.LocalID);
+        reader.Read(Data.Final);
+        reader.Read(ParcelData.Price);
+        reader.Read(ParcelData.Area);
+        return reader.IsValid();
+    }
+
+    void ParcelBuy::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.GroupID);
+        writer.Write(Data.IsGroupOwned);
+        writer.Write(Data.RemoveContribution);
+        writer.Write(Data.LocalID);
+        writer.Write(Data.Final);
+        writer.Write(ParcelData.Price);
+        writer.Write(ParcelData.Area);
+    }
+
+    bool ParcelGodForceOwner::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.OwnerID);
+        reader.Read(Data.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelGodForceOwner::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.OwnerID);
+        writer.Write(Data.LocalID);
+    }
+
+    bool ParcelAccessListRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.SequenceID);
+        reader.Read(Data.Flags);
+        reader.Read(Data.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelAccessListRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.SequenceID);
+        writer.Write(Data.Flags);
+        writer.Write(Data.LocalID);
+    }
+
+    bool ParcelAccessListReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.AgentID);
+        reader.Read(Data.SequenceID);
+        reader.Read(Data.Flags);
+        reader.Read(Data.LocalID);
+        List.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < List.size(); ++i)
+        {
+            reader.Read(List[i].ID);
+            reader.Read(List[i].Time);
+            reader.Read(List[i].Flags);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelAccessListReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.AgentID);
+        writer.Write(Data.SequenceID);
+        writer.Write(Data.Flags);
+        writer.Write(Data.LocalID);
+        writer.WriteBlockCount(List.size());
+        for(size_t i = 0; i < List.size(); ++i)
+        {
+            writer.Write(List[i].ID);
+            writer.Write(List[i].Time);
+            writer.Write(List[i].Flags);
+        }
+    }
+
+    bool ParcelAccessListUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.Flags);
+        reader.Read(Data.LocalID);
+        reader.Read(Data.TransactionID);
+        reader.Read(Data.SequenceID);
+        reader.Read(Data.Sections);
+        List.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < List.size(); ++i)
+        {
+            reader.Read(List[i].ID);
+            reader.Read(List[i].Time);
+            reader.Read(List[i].Flags);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelAccessListUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.Flags);
+        writer.Write(Data.LocalID);
+        writer.Write(Data.TransactionID);
+        writer.Write(Data.SequenceID);
+        writer.Write(Data.Sections);
+        writer.WriteBlockCount(List.size());
+        for(size_t i = 0; i < List.size(); ++i)
+        {
+            writer.Write(List[i].ID);
+            writer.Write(List[i].Time);
+            writer.Write(List[i].Flags);
+        }
+    }
+
+    bool ParcelDwellRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.LocalID);
+        reader.Read(Data.ParcelID);
+        return reader.IsValid();
+    }
+
+    void ParcelDwellRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.LocalID);
+        writer.Write(Data.ParcelID);
+    }
+
+    bool ParcelDwellReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(Data.LocalID);
+        reader.Read(Data.ParcelID);
+        reader.Read(Data.Dwell);
+        return reader.IsValid();
+    }
+
+    void ParcelDwellReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(Data.LocalID);
+        writer.Write(Data.ParcelID);
+        writer.Write(Data.Dwell);
+    }
+
+    bool RequestParcelTransfer::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.TransactionID);
+        reader.Read(Data.TransactionTime);
+        reader.Read(Data.SourceID);
+        reader.Read(Data.DestID);
+        reader.Read(Data.OwnerID);
+        reader.Read(Data.Flags);
+        reader.Read(Data.TransactionType);
+        reader.Read(Data.Amount);
+        reader.Read(Data.BillableArea);
+        reader.Read(Data.ActualArea);
+        reader.Read(Data.Final);
+        return reader.IsValid();
+    }
+
+    void RequestParcelTransfer::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.TransactionID);
+        writer.Write(Data.TransactionTime);
+        writer.Write(Data.SourceID);
+        writer.Write(Data.DestID);
+        writer.Write(Data.OwnerID);
+        writer.Write(Data.Flags);
+        writer.Write(Data.TransactionType);
+        writer.Write(Data.Amount);
+        writer.Write(Data.BillableArea);
+        writer.Write(Data.ActualArea);
+        writer.Write(Data.Final);
+    }
+
+    bool UpdateParcel::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ParcelData.ParcelID);
+        reader.Read(ParcelData.RegionHandle);
+        reader.Read(ParcelData.OwnerID);
+        reader.Read(ParcelData.GroupOwned);
+        reader.Read(ParcelData.Status);
+        reader.ReadVariable1(ParcelData.Name);
+        reader.ReadVariable1(ParcelData.Description);
+        reader.ReadVariable1(ParcelData.MusicURL);
+        reader.Read(ParcelData.RegionX);
+        reader.Read(ParcelData.RegionY);
+        reader.Read(ParcelData.ActualArea);
+        reader.Read(ParcelData.BillableArea);
+        reader.Read(ParcelData.ShowDir);
+        reader.Read(ParcelData.IsForSale);
+        reader.Read(ParcelData.Category);
+        reader.Read(ParcelData.SnapshotID);
+        reader.Read(ParcelData.UserLocation);
+        reader.Read(ParcelData.SalePrice);
+        reader.Read(ParcelData.AuthorizedBuyerID);
+        reader.Read(ParcelData.AllowPublish);
+        reader.Read(ParcelData.MaturePublish);
+        return reader.IsValid();
+    }
+
+    void UpdateParcel::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ParcelData.ParcelID);
+        writer.Write(ParcelData.RegionHandle);
+        writer.Write(ParcelData.OwnerID);
+        writer.Write(ParcelData.GroupOwned);
+        writer.Write(ParcelData.Status);
+        writer.WriteVariable1(ParcelData.Name);
+        writer.WriteVariable1(ParcelData.Description);
+        writer.WriteVariable1(ParcelData.MusicURL);
+        writer.Write(ParcelData.RegionX);
+        writer.Write(ParcelData.RegionY);
+        writer.Write(ParcelData.ActualArea);
+        writer.Write(ParcelData.BillableArea);
+        writer.Write(ParcelData.ShowDir);
+        writer.Write(ParcelData.IsForSale);
+        writer.Write(ParcelData.Category);
+        writer.Write(ParcelData.SnapshotID);
+        writer.Write(ParcelData.UserLocation);
+        writer.Write(ParcelData.SalePrice);
+        writer.Write(ParcelData.AuthorizedBuyerID);
+        writer.Write(ParcelData.AllowPublish);
+        writer.Write(ParcelData.MaturePublish);
+    }
+
+    bool RemoveParcel::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].ParcelID);
+        }
+        return reader.IsValid();
+    }
+
+    void RemoveParcel::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].ParcelID);
+        }
+    }
+
+    bool MergeParcel::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(MasterParcelData.MasterID);
+        SlaveParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < SlaveParcelData.size(); ++i)
+        {
+            reader.Read(SlaveParcelData[i].SlaveID);
+        }
+        return reader.IsValid();
+    }
+
+    void MergeParcel::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(MasterParcelData.MasterID);
+        writer.WriteBlockCount(SlaveParcelData.size());
+        for(size_t i = 0; i < SlaveParcelData.size(); ++i)
+        {
+            writer.Write(SlaveParcelData[i].SlaveID);
+        }
+    }
+
+    bool LogParcelChanges::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(RegionData.RegionHandle);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].ParcelID);
+            reader.Read(ParcelData[i].OwnerID);
+            reader.Read(ParcelData[i].IsOwnerGroup);
+            reader.Read(ParcelData[i].ActualArea);
+            reader.Read(ParcelData[i].Action);
+            reader.Read(ParcelData[i].TransactionID);
+        }
+        return reader.IsValid();
+    }
+
+    void LogParcelChanges::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(RegionData.RegionHandle);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].ParcelID);
+            writer.Write(ParcelData[i].OwnerID);
+            writer.Write(ParcelData[i].IsOwnerGroup);
+            writer.Write(ParcelData[i].ActualArea);
+            writer.Write(ParcelData[i].Action);
+            writer.Write(ParcelData[i].TransactionID);
+        }
+    }
+
+    bool CheckParcelSales::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        RegionData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            reader.Read(RegionData[i].RegionHandle);
+        }
+        return reader.IsValid();
+    }
+
+    void CheckParcelSales::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(RegionData.size());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            writer.Write(RegionData[i].RegionHandle);
+        }
+    }
+
+    bool ParcelSales::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].ParcelID);
+            reader.Read(ParcelData[i].BuyerID);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelSales::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].ParcelID);
+            writer.Write(ParcelData[i].BuyerID);
+        }
+    }
+
+    bool ParcelGodMarkAsContent::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        return reader.IsValid();
+    }
+
+    void ParcelGodMarkAsContent::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+    }
+
+    bool ViewerStartAuction::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ParcelData.LocalID);
+        reader.Read(ParcelData.SnapshotID);
+        return reader.IsValid();
+    }
+
+    void ViewerStartAuction::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ParcelData.LocalID);
+        writer.Write(ParcelData.SnapshotID);
+    }
+
+    bool StartAuction::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(ParcelData.ParcelID);
+        reader.Read(ParcelData.SnapshotID);
+        reader.ReadVariable1(ParcelData.Name);
+        return reader.IsValid();
+    }
+
+    void StartAuction::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(ParcelData.ParcelID);
+        writer.Write(ParcelData.SnapshotID);
+        writer.WriteVariable1(ParcelData.Name);
+    }
+
+    bool ConfirmAuctionStart::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AuctionData.ParcelID);
+        reader.Read(AuctionData.AuctionID);
+        return reader.IsValid();
+    }
+
+    void ConfirmAuctionStart::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AuctionData.ParcelID);
+        writer.Write(AuctionData.AuctionID);
+    }
+
+    bool CompleteAuction::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].ParcelID);
+        }
+        return reader.IsValid();
+    }
+
+    void CompleteAuction::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].ParcelID);
+        }
+    }
+
+    bool CancelAuction::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].ParcelID);
+        }
+        return reader.IsValid();
+    }
+
+    void CancelAuction::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].ParcelID);
+        }
+    }
+
+    bool CheckParcelAuctions::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        RegionData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            reader.Read(RegionData[i].RegionHandle);
+        }
+        return reader.IsValid();
+    }
+
+    void CheckParcelAuctions::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(RegionData.size());
+        for(size_t i = 0; i < RegionData.size(); ++i)
+        {
+            writer.Write(RegionData[i].RegionHandle);
+        }
+    }
+
+    bool ParcelAuctions::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].ParcelID);
+            reader.Read(ParcelData[i].WinnerID);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelAuctions::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].ParcelID);
+            writer.Write(ParcelData[i].WinnerID);
+        }
+    }
+
+    bool UUIDNameRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        UUIDNameBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            reader.Read(UUIDNameBlock[i].ID);
+        }
+        return reader.IsValid();
+    }
+
+    void UUIDNameRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(UUIDNameBlock.size());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            writer.Write(UUIDNameBlock[i].ID);
+        }
+    }
+
+    bool UUIDNameReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        UUIDNameBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            reader.Read(UUIDNameBlock[i].ID);
+            reader.ReadVariable1(UUIDNameBlock[i].FirstName);
+            reader.ReadVariable1(UUIDNameBlock[i].LastName);
+        }
+        return reader.IsValid();
+    }
+
+    void UUIDNameReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(UUIDNameBlock.size());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            writer.Write(UUIDNameBlock[i].ID);
+            writer.WriteVariable1(UUIDNameBlock[i].FirstName);
+            writer.WriteVariable1(UUIDNameBlock[i].LastName);
+        }
+    }
+
+    bool UUIDGroupNameRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        UUIDNameBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            reader.Read(UUIDNameBlock[i].ID);
+        }
+        return reader.IsValid();
+    }
+
+    void UUIDGroupNameRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(UUIDNameBlock.size());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            writer.Write(UUIDNameBlock[i].ID);
+        }
+    }
+
+    bool UUIDGroupNameReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        UUIDNameBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            reader.Read(UUIDNameBlock[i].ID);
+            reader.ReadVariable1(UUIDNameBlock[i].GroupName);
+        }
+        return reader.IsValid();
+    }
+
+    void UUIDGroupNameReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(UUIDNameBlock.size());
+        for(size_t i = 0; i < UUIDNameBlock.size(); ++i)
+        {
+            writer.Write(UUIDNameBlock[i].ID);
+            writer.WriteVariable1(UUIDNameBlock[i].GroupName);
+        }
+    }
+
+    bool ChatPass::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ChatData.Channel);
+        reader.Read(ChatData.Position);
+        reader.Read(ChatData.ID);
+        reader.Read(ChatData.OwnerID);
+        reader.ReadVariable1(ChatData.Name);
+        reader.Read(ChatData.SourceType);
+        reader.Read(ChatData.Type);
+        reader.Read(ChatData.Radius);
+        reader.Read(ChatData.SimAccess);
+        reader.ReadVariable2(ChatData.Message);
+        return reader.IsValid();
+    }
+
+    void ChatPass::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ChatData.Channel);
+        writer.Write(ChatData.Position);
+        writer.Write(ChatData.ID);
+        writer.Write(ChatData.OwnerID);
+        writer.WriteVariable1(ChatData.Name);
+        writer.Write(ChatData.SourceType);
+        writer.Write(ChatData.Type);
+        writer.Write(ChatData.Radius);
+        writer.Write(ChatData.SimAccess);
+        writer.WriteVariable2(ChatData.Message);
+    }
+
+    bool ChildAgentDying::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void ChildAgentDying::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool ChildAgentUnknown::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void ChildAgentUnknown::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool KillChildAgents::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(IDBlock.AgentID);
+        return reader.IsValid();
+    }
+
+    void KillChildAgents::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(IDBlock.AgentID);
+    }
+
+    bool GetScriptRunning::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Script.ObjectID);
+        reader.Read(Script.ItemID);
+        return reader.IsValid();
+    }
+
+    void GetScriptRunning::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Script.ObjectID);
+        writer.Write(Script.ItemID);
+    }
+
+    bool ScriptRunningReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Script.ObjectID);
+        reader.Read(Script.ItemID);
+        reader.Read(Script.Running);
+        return reader.IsValid();
+    }
+
+    void ScriptRunningReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Script.ObjectID);
+        writer.Write(Script.ItemID);
+        writer.Write(Script.Running);
+    }
+
+    bool SetScriptRunning::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Script.ObjectID);
+        reader.Read(Script.ItemID);
+        reader.Read(Script.Running);
+        return reader.IsValid();
+    }
+
+    void SetScriptRunning::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Script.ObjectID);
+        writer.Write(Script.ItemID);
+        writer.Write(Script.Running);
+    }
+
+    bool ScriptReset::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Script.ObjectID);
+        reader.Read(Script.ItemID);
+        return reader.IsValid();
+    }
+
+    void ScriptReset::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Script.ObjectID);
+        writer.Write(Script.ItemID);
+    }
+
+    bool ScriptSensorRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Requester.SourceID);
+        reader.Read(Requester.RequestID);
+        reader.Read(Requester.SearchID);
+        reader.Read(Requester.SearchPos);
+        reader.Read(Requester.SearchDir);
+        reader.ReadVariable1(Requester.SearchName);
+        reader.Read(Requester.Type);
+        reader.Read(Requester.Range);
+        reader.Read(Requester.Arc);
+        reader.Read(Requester.RegionHandle);
+        reader.Read(Requester.SearchRegions);
+        return reader.IsValid();
+    }
+
+    void ScriptSensorRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Requester.SourceID);
+        writer.Write(Requester.RequestID);
+        writer.Write(Requester.SearchID);
+        writer.Write(Requester.SearchPos);
+        writer.Write(Requester.SearchDir);
+        writer.WriteVariable1(Requester.SearchName);
+        writer.Write(Requester.Type);
+        writer.Write(Requester.Range);
+        writer.Write(Requester.Arc);
+        writer.Write(Requester.RegionHandle);
+        writer.Write(Requester.SearchRegions);
+    }
+
+    bool ScriptSensorReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Requester.SourceID);
+        SensedData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < SensedData.size(); ++i)
+        {
+            reader.Read(SensedData[i].ObjectID);
+            reader.Read(SensedData[i].OwnerID);
+            reader.Read(SensedData[i].GroupID);
+            reader.Read(SensedData[i].Position);
+            reader.Read(SensedData[i].Velocity);
+            reader.Read(SensedData[i].Rotation);
+            reader.ReadVariable1(SensedData[i].Name);
+            reader.Read(SensedData[i].Type);
+            reader.Read(SensedData[i].Range);
+        }
+        return reader.IsValid();
+    }
+
+    void ScriptSensorReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Requester.SourceID);
+        writer.WriteBlockCount(SensedData.size());
+        for(size_t i = 0; i < SensedData.size(); ++i)
+        {
+            writer.Write(SensedData[i].ObjectID);
+            writer.Write(SensedData[i].OwnerID);
+            writer.Write(SensedData[i].GroupID);
+            writer.Write(SensedData[i].Position);
+            writer.Write(SensedData[i].Velocity);
+            writer.Write(SensedData[i].Rotation);
+            writer.WriteVariable1(SensedData[i].Name);
+            writer.Write(SensedData[i].Type);
+            writer.Write(SensedData[i].Range);
+        }
+    }
+
+    bool CompleteAgentMovement::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.CircuitCode);
+        return reader.IsValid();
+    }
+
+    void CompleteAgentMovement::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.CircuitCode);
+    }
+
+    bool AgentMovementComplete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.Position);
+        reader.Read(Data.LookAt);
+        reader.Read(Data.RegionHandle);
+        reader.Read(Data.Timestamp);
+        reader.ReadVariable2(SimData.ChannelVersion);
+        return reader.IsValid();
+    }
+
+    void AgentMovementComplete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.Position);
+        writer.Write(Data.LookAt);
+        writer.Write(Data.RegionHandle);
+        writer.Write(Data.Timestamp);
+        writer.WriteVariable2(SimData.ChannelVersion);
+    }
+
+    bool DataServerLogout::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(UserData.AgentID);
+        reader.Read(UserData.ViewerIP);
+        reader.Read(UserData.Disconnect);
+        reader.Read(UserData.SessionID);
+        return reader.IsValid();
+    }
+
+    void DataServerLogout::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(UserData.AgentID);
+        writer.Write(UserData.ViewerIP);
+        writer.Write(UserData.Disconnect);
+        writer.Write(UserData.SessionID);
+    }
+
+    bool LogoutRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void LogoutRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool LogoutReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+        }
+        return reader.IsValid();
+    }
+
+    void LogoutReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+        }
+    }
+
+    bool ImprovedInstantMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(MessageBlock.FromGroup);
+        reader.Read(MessageBlock.ToAgentID);
+        reader.Read(MessageBlock.ParentEstateID);
+        reader.Read(MessageBlock.RegionID);
+        reader.Read(MessageBlock.Position);
+        reader.Read(MessageBlock.Offline);
+        reader.Read(MessageBlock.Dialog);
+        reader.Read(MessageBlock.ID);
+        reader.Read(MessageBlock.Timestamp);
+        reader.ReadVariable1(MessageBlock.FromAgentName);
+        reader.ReadVariable2(MessageBlock.Message);
+        reader.ReadVariable2(MessageBlock.BinaryBucket);
+        return reader.IsValid();
+    }
+
+    void ImprovedInstantMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(MessageBlock.FromGroup);
+        writer.Write(MessageBlock.ToAgentID);
+        writer.Write(MessageBlock.ParentEstateID);
+        writer.Write(MessageBlock.RegionID);
+        writer.Write(MessageBlock.Position);
+        writer.Write(MessageBlock.Offline);
+        writer.Write(MessageBlock.Dialog);
+        writer.Write(MessageBlock.ID);
+        writer.Write(MessageBlock.Timestamp);
+        writer.WriteVariable1(MessageBlock.FromAgentName);
+        writer.WriteVariable2(MessageBlock.Message);
+        writer.WriteVariable2(MessageBlock.BinaryBucket);
+    }
+
+    bool RetrieveInstantMessages::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void RetrieveInstantMessages::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool FindAgent::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentBlock.Hunter);
+        reader.Read(AgentBlock.Prey);
+        reader.Read(AgentBlock.SpaceIP);
+        LocationBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < LocationBlock.size(); ++i)
+        {
+            reader.Read(LocationBlock[i].GlobalX);
+            reader.Read(LocationBlock[i].GlobalY);
+        }
+        return reader.IsValid();
+    }
+
+    void FindAgent::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentBlock.Hunter);
+        writer.Write(AgentBlock.Prey);
+        writer.Write(AgentBlock.SpaceIP);
+        writer.WriteBlockCount(LocationBlock.size());
+        for(size_t i = 0; i < LocationBlock.size(); ++i)
+        {
+            writer.Write(LocationBlock[i].GlobalX);
+            writer.Write(LocationBlock[i].GlobalY);
+        }
+    }
+
+    bool RequestGodlikePowers::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(RequestBlock.Godlike);
+        reader.Read(RequestBlock.Token);
+        return reader.IsValid();
+    }
+
+    void RequestGodlikePowers::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(RequestBlock.Godlike);
+        writer.Write(RequestBlock.Token);
+    }
+
+    bool GrantGodlikePowers::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GrantData.GodLevel);
+        reader.Read(GrantData.Token);
+        return reader.IsValid();
+    }
+
+    void GrantGodlikePowers::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GrantData.GodLevel);
+        writer.Write(GrantData.Token);
+    }
+
+    bool GodlikeMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.TransactionID);
+        reader.ReadVariable1(MethodData.Method);
+        reader.Read(MethodData.Invoice);
+        ParamList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            reader.ReadVariable1(ParamList[i].Parameter);
+        }
+        return reader.IsValid();
+    }
+
+    void GodlikeMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.TransactionID);
+        writer.WriteVariable1(MethodData.Method);
+        writer.Write(MethodData.Invoice);
+        writer.WriteBlockCount(ParamList.size());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            writer.WriteVariable1(ParamList[i].Parameter);
+        }
+    }
+
+    bool EstateOwnerMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.TransactionID);
+        reader.ReadVariable1(MethodData.Method);
+        reader.Read(MethodData.Invoice);
+        ParamList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            reader.ReadVariable1(ParamList[i].Parameter);
+        }
+        return reader.IsValid();
+    }
+
+    void EstateOwnerMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.TransactionID);
+        writer.WriteVariable1(MethodData.Method);
+        writer.Write(MethodData.Invoice);
+        writer.WriteBlockCount(ParamList.size());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            writer.WriteVariable1(ParamList[i].Parameter);
+        }
+    }
+
+    bool GenericMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.TransactionID);
+        reader.ReadVariable1(MethodData.Method);
+        reader.Read(MethodData.Invoice);
+        ParamList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            reader.ReadVariable1(ParamList[i].Parameter);
+        }
+        return reader.IsValid();
+    }
+
+    void GenericMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.TransactionID);
+        writer.WriteVariable1(MethodData.Method);
+        writer.Write(MethodData.Invoice);
+        writer.WriteBlockCount(ParamList.size());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            writer.WriteVariable1(ParamList[i].Parameter);
+        }
+    }
+
+    bool MuteListRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(MuteData.MuteCRC);
+        return reader.IsValid();
+    }
+
+    void MuteListRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(MuteData.MuteCRC);
+    }
+
+    bool UpdateMuteListEntry::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(MuteData.MuteID);
+        reader.ReadVariable1(MuteData.MuteName);
+        reader.Read(MuteData.MuteType);
+        reader.Read(MuteData.MuteFlags);
+        return reader.IsValid();
+    }
+
+    void UpdateMuteListEntry::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(MuteData.MuteID);
+        writer.WriteVariable1(MuteData.MuteName);
+        writer.Write(MuteData.MuteType);
+        writer.Write(MuteData.MuteFlags);
+    }
+
+    bool RemoveMuteListEntry::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(MuteData.MuteID);
+        reader.ReadVariable1(MuteData.MuteName);
+        return reader.IsValid();
+    }
+
+    void RemoveMuteListEntry::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(MuteData.MuteID);
+        writer.WriteVariable1(MuteData.MuteName);
+    }
+
+    bool CopyInventoryFromNotecard::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(NotecardData.NotecardItemID);
+        reader.Read(NotecardData.ObjectID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+            reader.Read(InventoryData[i].FolderID);
+        }
+        return reader.IsValid();
+    }
+
+    void CopyInventoryFromNotecard::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(NotecardData.NotecardItemID);
+        writer.Write(NotecardData.ObjectID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+            writer.Write(InventoryData[i].FolderID);
+        }
+    }
+
+    bool UpdateInventoryItem::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.TransactionID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+            reader.Read(InventoryData[i].FolderID);
+            reader.Read(InventoryData[i].CallbackID);
+            reader.Read(InventoryData[i].CreatorID);
+            reader.Read(InventoryData[i].OwnerID);
+            reader.Read(InventoryData[i].GroupID);
+            reader.Read(InventoryData[i].BaseMask);
+            reader.Read(InventoryData[i].OwnerMask);
+            reader.Read(InventoryData[i].GroupMask);
+            reader.Read(InventoryData[i].EveryoneMask);
+            reader.Read(InventoryData[i].NextOwnerMask);
+            reader.Read(InventoryData[i].GroupOwned);
+            reader.Read(InventoryData[i].TransactionID);
+            reader.Read(InventoryData[i].Type);
+            reader.Read(InventoryData[i].InvType);
+            reader.Read(InventoryData[i].Flags);
+            reader.Read(InventoryData[i].SaleType);
+            reader.Read(InventoryData[i].SalePrice);
+            reader.ReadVariable1(InventoryData[i].Name);
+            reader.ReadVariable1(InventoryData[i].Description);
+            reader.Read(InventoryData[i].CreationDate);
+            reader.Read(InventoryData[i].CRC);
+        }
+        return reader.IsValid();
+    }
+
+    void UpdateInventoryItem::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.TransactionID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+            writer.Write(InventoryData[i].FolderID);
+            writer.Write(InventoryData[i].CallbackID);
+            writer.Write(InventoryData[i].CreatorID);
+            writer.Write(InventoryData[i].OwnerID);
+            writer.Write(InventoryData[i].GroupID);
+            writer.Write(InventoryData[i].BaseMask);
+            writer.Write(InventoryData[i].OwnerMask);
+            writer.Write(InventoryData[i].GroupMask);
+            writer.Write(InventoryData[i].EveryoneMask);
+            writer.Write(InventoryData[i].NextOwnerMask);
+            writer.Write(InventoryData[i].GroupOwned);
+            writer.Write(InventoryData[i].TransactionID);
+            writer.Write(InventoryData[i].Type);
+            writer.Write(InventoryData[i].InvType);
+            writer.Write(InventoryData[i].Flags);
+            writer.Write(InventoryData[i].SaleType);
+            writer.Write(InventoryData[i].SalePrice);
+            writer.WriteVariable1(InventoryData[i].Name);
+            writer.WriteVariable1(InventoryData[i].Description);
+            writer.Write(InventoryData[i].CreationDate);
+            writer.Write(InventoryData[i].CRC);
+        }
+    }
+
+    bool UpdateCreateInventoryItem::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SimApproved);
+        reader.Read(AgentData.TransactionID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+            reader.Read(InventoryData[i].FolderID);
+            reader.Read(InventoryData[i].CallbackID);
+            reader.Read(InventoryData[i].CreatorID);
+            reader.Read(InventoryData[i].OwnerID);
+            reader.Read(InventoryData[i].GroupID);
+            reader.Read(InventoryData[i].BaseMask);
+            reader.Read(InventoryData[i].OwnerMask);
+            reader.Read(InventoryData[i].GroupMask);
+            reader.Read(InventoryData[i].EveryoneMask);
+            reader.Read(InventoryData[i].NextOwnerMask);
+            reader.Read(InventoryData[i].GroupOwned);
+            reader.Read(InventoryData[i].AssetID);
+            reader.Read(InventoryData[i].Type);
+            reader.Read(InventoryData[i].InvType);
+            reader.Read(InventoryData[i].Flags);
+            reader.Read(InventoryData[i].SaleType);
+            reader.Read(InventoryData[i].SalePrice);
+            reader.ReadVariable1(InventoryData[i].Name);
+            reader.ReadVariable1(InventoryData[i].Description);
+            reader.Read(InventoryData[i].CreationDate);
+            reader.Read(InventoryData[i].CRC);
+        }
+        return reader.IsValid();
+    }
+
+    void UpdateCreateInventoryItem::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SimApproved);
+        writer.Write(AgentData.TransactionID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+            writer.Write(InventoryData[i].FolderID);
+            writer.Write(InventoryData[i].CallbackID);
+            writer.Write(InventoryData[i].CreatorID);
+            writer.Write(InventoryData[i].OwnerID);
+            writer.Write(InventoryData[i].GroupID);
+            writer.Write(InventoryData[i].BaseMask);
+            writer.Write(InventoryData[i].OwnerMask);
+            writer.Write(InventoryData[i].GroupMask);
+            writer.Write(InventoryData[i].EveryoneMask);
+            writer.Write(InventoryData[i].NextOwnerMask);
+            writer.Write(InventoryData[i].GroupOwned);
+            writer.Write(InventoryData[i].AssetID);
+            writer.Write(InventoryData[i].Type);
+            writer.Write(InventoryData[i].InvType);
+            writer.Write(InventoryData[i].Flags);
+            writer.Write(InventoryData[i].SaleType);
+            writer.Write(InventoryData[i].SalePrice);
+            writer.WriteVariable1(InventoryData[i].Name);
+            writer.WriteVariable1(InventoryData[i].Description);
+            writer.Write(InventoryData[i].CreationDate);
+            writer.Write(InventoryData[i].CRC);
+        }
+    }
+
+    bool MoveInventoryItem::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Stamp);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+            reader.Read(InventoryData[i].FolderID);
+            reader.ReadVariable1(InventoryData[i].NewName);
+        }
+        return reader.IsValid();
+    }
+
+    void MoveInventoryItem::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Stamp);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+            writer.Write(InventoryData[i].FolderID);
+            writer.WriteVariable1(InventoryData[i].NewName);
+        }
+    }
+
+    bool CopyInventoryItem::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].CallbackID);
+            reader.Read(InventoryData[i].OldAgentID);
+            reader.Read(InventoryData[i].OldItemID);
+            reader.Read(InventoryData[i].NewFolderID);
+            reader.ReadVariable1(InventoryData[i].NewName);
+        }
+        return reader.IsValid();
+    }
+
+    void CopyInventoryItem::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].CallbackID);
+            writer.Write(InventoryData[i].OldAgentID);
+            writer.Write(InventoryData[i].OldItemID);
+            writer.Write(InventoryData[i].NewFolderID);
+            writer.WriteVariable1(InventoryData[i].NewName);
+        }
+    }
+
+    bool RemoveInventoryItem::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+        }
+        return reader.IsValid();
+    }
+
+    void RemoveInventoryItem::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+        }
+    }
+
+    bool ChangeInventoryItemFlags::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+            reader.Read(InventoryData[i].Flags);
+        }
+        return reader.IsValid();
+    }
+
+    void ChangeInventoryItemFlags::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+            writer.Write(InventoryData[i].Flags);
+        }
+    }
+
+    bool SaveAssetIntoInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(InventoryData.ItemID);
+        reader.Read(InventoryData.NewAssetID);
+        return reader.IsValid();
+    }
+
+    void SaveAssetIntoInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(InventoryData.ItemID);
+        writer.Write(InventoryData.NewAssetID);
+    }
+
+    bool CreateInventoryFolder::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(FolderData.FolderID);
+        reader.Read(FolderData.ParentID);
+        reader.Read(FolderData.Type);
+        reader.ReadVariable1(FolderData.Name);
+        return reader.IsValid();
+    }
+
+    void CreateInventoryFolder::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(FolderData.FolderID);
+        writer.Write(FolderData.ParentID);
+        writer.Write(FolderData.Type);
+        writer.WriteVariable1(FolderData.Name);
+    }
+
+    bool UpdateInventoryFolder::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        FolderData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            reader.Read(FolderData[i].FolderID);
+            reader.Read(FolderData[i].ParentID);
+            reader.Read(FolderData[i].Type);
+            reader.ReadVariable1(FolderData[i].Name);
+        }
+        return reader.IsValid();
+    }
+
+    void UpdateInventoryFolder::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(FolderData.size());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            writer.Write(FolderData[i].FolderID);
+            writer.Write(FolderData[i].ParentID);
+            writer.Write(FolderData[i].Type);
+            writer.WriteVariable1(FolderData[i].Name);
+        }
+    }
+
+    bool MoveInventoryFolder::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Stamp);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].FolderID);
+            reader.Read(InventoryData[i].ParentID);
+        }
+        return reader.IsValid();
+    }
+
+    void MoveInventoryFolder::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Stamp);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].FolderID);
+            writer.Write(InventoryData[i].ParentID);
+        }
+    }
+
+    bool RemoveInventoryFolder::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        FolderData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            reader.Read(FolderData[i].FolderID);
+        }
+        return reader.IsValid();
+    }
+
+    void RemoveInventoryFolder::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(FolderData.size());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            writer.Write(FolderData[i].FolderID);
+        }
+    }
+
+    bool FetchInventoryDescendents::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(InventoryData.FolderID);
+        reader.Read(InventoryData.OwnerID);
+        reader.Read(InventoryData.SortOrder);
+        reader.Read(InventoryData.FetchFolders);
+        reader.Read(InventoryData.FetchItems);
+        return reader.IsValid();
+    }
+
+    void FetchInventoryDescendents::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(InventoryData.FolderID);
+        writer.Write(InventoryData.OwnerID);
+        writer.Write(InventoryData.SortOrder);
+        writer.Write(InventoryData.FetchFolders);
+        writer.Write(InventoryData.FetchItems);
+    }
+
+    bool InventoryDescendents::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.FolderID);
+        reader.Read(AgentData.OwnerID);
+        reader.Read(AgentData.Version);
+        reader.Read(AgentData.Descendents);
+        FolderData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            reader.Read(FolderData[i].FolderID);
+            reader.Read(FolderData[i].ParentID);
+            reader.Read(FolderData[i].Type);
+            reader.ReadVariable1(FolderData[i].Name);
+        }
+        ItemData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ItemData.size(); ++i)
+        {
+            reader.Read(ItemData[i].ItemID);
+            reader.Read(ItemData[i].FolderID);
+            reader.Read(ItemData[i].CreatorID);
+            reader.Read(ItemData[i].OwnerID);
+            reader.Read(ItemData[i].GroupID);
+            reader.Read(ItemData[i].BaseMask);
+            reader.Read(ItemData[i].OwnerMask);
+            reader.Read(ItemData[i].GroupMask);
+            reader.Read(ItemData[i].EveryoneMask);
+            reader.Read(ItemData[i].NextOwnerMask);
+            reader.Read(ItemData[i].GroupOwned);
+            reader.Read(ItemData[i].AssetID);
+            reader.Read(ItemData[i].Type);
+            reader.Read(ItemData[i].InvType);
+            reader.Read(ItemData[i].Flags);
+            reader.Read(ItemData[i].SaleType);
+            reader.Read(ItemData[i].SalePrice);
+            reader.ReadVariable1(ItemData[i].Name);
+            reader.ReadVariable1(ItemData[i].Description);
+            reader.Read(ItemData[i].CreationDate);
+            reader.Read(ItemData[i].CRC);
+        }
+        return reader.IsValid();
+    }
+
+    void InventoryDescendents::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.FolderID);
+        writer.Write(AgentData.OwnerID);
+        writer.Write(AgentData.Version);
+        writer.Write(AgentData.Descendents);
+        writer.WriteBlockCount(FolderData.size());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            writer.Write(FolderData[i].FolderID);
+            writer.Write(FolderData[i].ParentID);
+            writer.Write(FolderData[i].Type);
+            writer.WriteVariable1(FolderData[i].Name);
+        }
+        writer.WriteBlockCount(ItemData.size());
+        for(size_t i = 0; i < ItemData.size(); ++i)
+        {
+            writer.Write(ItemData[i].ItemID);
+            writer.Write(ItemData[i].FolderID);
+            writer.Write(ItemData[i].CreatorID);
+            writer.Write(ItemData[i].OwnerID);
+            writer.Write(ItemData[i].GroupID);
+            writer.Write(ItemData[i].BaseMask);
+            writer.Write(ItemData[i].OwnerMask);
+            writer.Write(ItemData[i].GroupMask);
+            writer.Write(ItemData[i].EveryoneMask);
+            writer.Write(ItemData[i].NextOwnerMask);
+            writer.Write(ItemData[i].GroupOwned);
+            writer.Write(ItemData[i].AssetID);
+            writer.Write(ItemData[i].Type);
+            writer.Write(ItemData[i].InvType);
+            writer.Write(ItemData[i].Flags);
+            writer.Write(ItemData[i].SaleType);
+            writer.Write(ItemData[i].SalePrice);
+            writer.WriteVariable1(ItemData[i].Name);
+            writer.WriteVariable1(ItemData[i].Description);
+            writer.Write(ItemData[i].CreationDate);
+            writer.Write(ItemData[i].CRC);
+        }
+    }
+
+    bool FetchInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].OwnerID);
+            reader.Read(InventoryData[i].ItemID);
+        }
+        return reader.IsValid();
+    }
+
+    void FetchInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].OwnerID);
+            writer.Write(InventoryData[i].ItemID);
+        }
+    }
+
+    bool FetchInventoryReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+            reader.Read(InventoryData[i].FolderID);
+            reader.Read(InventoryData[i].CreatorID);
+            reader.Read(InventoryData[i].OwnerID);
+            reader.Read(InventoryData[i].GroupID);
+            reader.Read(InventoryData[i].BaseMask);
+            reader.Read(InventoryData[i].OwnerMask);
+            reader.Read(InventoryData[i].GroupMask);
+            reader.Read(InventoryData[i].EveryoneMask);
+            reader.Read(InventoryData[i].NextOwnerMask);
+            reader.Read(InventoryData[i].GroupOwned);
+            reader.Read(InventoryData[i].AssetID);
+            reader.Read(InventoryData[i].Type);
+            reader.Read(InventoryData[i].InvType);
+            reader.Read(InventoryData[i].Flags);
+            reader.Read(InventoryData[i].SaleType);
+            reader.Read(InventoryData[i].SalePrice);
+            reader.ReadVariable1(InventoryData[i].Name);
+            reader.ReadVariable1(InventoryData[i].Description);
+            reader.Read(InventoryData[i].CreationDate);
+            reader.Read(InventoryData[i].CRC);
+        }
+        return reader.IsValid();
+    }
+
+    void FetchInventoryReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+            writer.Write(InventoryData[i].FolderID);
+            writer.Write(InventoryData[i].CreatorID);
+            writer.Write(InventoryData[i].OwnerID);
+            writer.Write(InventoryData[i].GroupID);
+            writer.Write(InventoryData[i].BaseMask);
+            writer.Write(InventoryData[i].OwnerMask);
+            writer.Write(InventoryData[i].GroupMask);
+            writer.Write(InventoryData[i].EveryoneMask);
+            writer.Write(InventoryData[i].NextOwnerMask);
+            writer.Write(InventoryData[i].GroupOwned);
+            writer.Write(InventoryData[i].AssetID);
+            writer.Write(InventoryData[i].Type);
+            writer.Write(InventoryData[i].InvType);
+            writer.Write(InventoryData[i].Flags);
+            writer.Write(InventoryData[i].SaleType);
+            writer.Write(InventoryData[i].SalePrice);
+            writer.WriteVariable1(InventoryData[i].Name);
+            writer.WriteVariable1(InventoryData[i].Description);
+            writer.Write(InventoryData[i].CreationDate);
+            writer.Write(InventoryData[i].CRC);
+        }
+    }
+
+    bool BulkUpdateInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.TransactionID);
+        FolderData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            reader.Read(FolderData[i].FolderID);
+            reader.Read(FolderData[i].ParentID);
+            reader.Read(FolderData[i].Type);
+            reader.ReadVariable1(FolderData[i].Name);
+        }
+        ItemData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ItemData.size(); ++i)
+        {
+            reader.Read(ItemData[i].ItemID);
+            reader.Read(ItemData[i].CallbackID);
+            reader.Read(ItemData[i].FolderID);
+            reader.Read(ItemData[i].CreatorID);
+            reader.Read(ItemData[i].OwnerID);
+            reader.Read(ItemData[i].GroupID);
+            reader.Read(ItemData[i].BaseMask);
+            reader.Read(ItemData[i].OwnerMask);
+            reader.Read(ItemData[i].GroupMask);
+            reader.Read(ItemData[i].EveryoneMask);
+            reader.Read(ItemData[i].NextOwnerMask);
+            reader.Read(ItemData[i].GroupOwned);
+            reader.Read(ItemData[i].AssetID);
+            reader.Read(ItemData[i].Type);
+            reader.Read(ItemData[i].InvType);
+            reader.Read(ItemData[i].Flags);
+            reader.Read(ItemData[i].SaleType);
+            reader.Read(ItemData[i].SalePrice);
+            reader.ReadVariable1(ItemData[i].Name);
+            reader.ReadVariable1(ItemData[i].Description);
+            reader.Read(ItemData[i].CreationDate);
+            reader.Read(ItemData[i].CRC);
+        }
+        return reader.IsValid();
+    }
+
+    void BulkUpdateInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.TransactionID);
+        writer.WriteBlockCount(FolderData.size());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            writer.Write(FolderData[i].FolderID);
+            writer.Write(FolderData[i].ParentID);
+            writer.Write(FolderData[i].Type);
+            writer.WriteVariable1(FolderData[i].Name);
+        }
+        writer.WriteBlockCount(ItemData.size());
+        for(size_t i = 0; i < ItemData.size(); ++i)
+        {
+            writer.Write(ItemData[i].ItemID);
+            writer.Write(ItemData[i].CallbackID);
+            writer.Write(ItemData[i].FolderID);
+            writer.Write(ItemData[i].CreatorID);
+            writer.Write(ItemData[i].OwnerID);
+            writer.Write(ItemData[i].GroupID);
+            writer.Write(ItemData[i].BaseMask);
+            writer.Write(ItemData[i].OwnerMask);
+            writer.Write(ItemData[i].GroupMask);
+            writer.Write(ItemData[i].EveryoneMask);
+            writer.Write(ItemData[i].NextOwnerMask);
+            writer.Write(ItemData[i].GroupOwned);
+            writer.Write(ItemData[i].AssetID);
+            writer.Write(ItemData[i].Type);
+            writer.Write(ItemData[i].InvType);
+            writer.Write(ItemData[i].Flags);
+            writer.Write(ItemData[i].SaleType);
+            writer.Write(ItemData[i].SalePrice);
+            writer.WriteVariable1(ItemData[i].Name);
+            writer.WriteVariable1(ItemData[i].Description);
+            writer.Write(ItemData[i].CreationDate);
+            writer.Write(ItemData[i].CRC);
+        }
+    }
+
+    bool RequestInventoryAsset::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(QueryData.QueryID);
+        reader.Read(QueryData.AgentID);
+        reader.Read(QueryData.OwnerID);
+        reader.Read(QueryData.ItemID);
+        return reader.IsValid();
+    }
+
+    void RequestInventoryAsset::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(QueryData.QueryID);
+        writer.Write(QueryData.AgentID);
+        writer.Write(QueryData.OwnerID);
+        writer.Write(QueryData.ItemID);
+    }
+
+    bool InventoryAssetResponse::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(QueryData.QueryID);
+        reader.Read(QueryData.AssetID);
+        reader.Read(QueryData.IsReadable);
+        return reader.IsValid();
+    }
+
+    void InventoryAssetResponse::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(QueryData.QueryID);
+        writer.Write(QueryData.AssetID);
+        writer.Write(QueryData.IsReadable);
+    }
+
+    bool RemoveInventoryObjects::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        FolderData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            reader.Read(FolderData[i].FolderID);
+        }
+        ItemData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ItemData.size(); ++i)
+        {
+            reader.Read(ItemData[i].ItemID);
+        }
+        return reader.IsValid();
+    }
+
+    void RemoveInventoryObjects::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(FolderData.size());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            writer.Write(FolderData[i].FolderID);
+        }
+        writer.WriteBlockCount(ItemData.size());
+        for(size_t i = 0; i < ItemData.size(); ++i)
+        {
+            writer.Write(ItemData[i].ItemID);
+        }
+    }
+
+    bool PurgeInventoryDescendents::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(InventoryData.FolderID);
+        return reader.IsValid();
+    }
+
+    void PurgeInventoryDescendents::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(InventoryData.FolderID);
+    }
+
+    bool UpdateTaskInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(UpdateData.LocalID);
+        reader.Read(UpdateData.Key);
+        reader.Read(InventoryData.ItemID);
+        reader.Read(InventoryData.FolderID);
+        reader.Read(InventoryData.CreatorID);
+        reader.Read(InventoryData.OwnerID);
+        reader.Read(InventoryData.GroupID);
+        reader.Read(InventoryData.BaseMask);
+        reader.Read(InventoryData.OwnerMask);
+        reader.Read(InventoryData.GroupMask);
+        reader.Read(InventoryData.EveryoneMask);
+        reader.Read(InventoryData.NextOwnerMask);
+        reader.Read(InventoryData.GroupOwned);
+        reader.Read(InventoryData.TransactionID);
+        reader.Read(InventoryData.Type);
+        reader.Read(InventoryData.InvType);
+        reader.Read(InventoryData.Flags);
+        reader.Read(InventoryData.SaleType);
+        reader.Read(InventoryData.SalePrice);
+        reader.ReadVariable1(InventoryData.Name);
+        reader.ReadVariable1(InventoryData.Description);
+        reader.Read(InventoryData.CreationDate);
+        reader.Read(InventoryData.CRC);
+        return reader.IsValid();
+    }
+
+    void UpdateTaskInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(UpdateData.LocalID);
+        writer.Write(UpdateData.Key);
+        writer.Write(InventoryData.ItemID);
+        writer.Write(InventoryData.FolderID);
+        writer.Write(InventoryData.CreatorID);
+        writer.Write(InventoryData.OwnerID);
+        writer.Write(InventoryData.GroupID);
+        writer.Write(InventoryData.BaseMask);
+        writer.Write(InventoryData.OwnerMask);
+        writer.Write(InventoryData.GroupMask);
+        writer.Write(InventoryData.EveryoneMask);
+        writer.Write(InventoryData.NextOwnerMask);
+        writer.Write(InventoryData.GroupOwned);
+        writer.Write(InventoryData.TransactionID);
+        writer.Write(InventoryData.Type);
+        writer.Write(InventoryData.InvType);
+        writer.Write(InventoryData.Flags);
+        writer.Write(InventoryData.SaleType);
+        writer.Write(InventoryData.SalePrice);
+        writer.WriteVariable1(InventoryData.Name);
+        writer.WriteVariable1(InventoryData.Description);
+        writer.Write(InventoryData.CreationDate);
+        writer.Write(InventoryData.CRC);
+    }
+
+    bool RemoveTaskInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(InventoryData.LocalID);
+        reader.Read(InventoryData.ItemID);
+        return reader.IsValid();
+    }
+
+    void RemoveTaskInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(InventoryData.LocalID);
+        writer.Write(InventoryData.ItemID);
+    }
+
+    bool MoveTaskInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.FolderID);
+        reader.Read(InventoryData.LocalID);
+        reader.Read(InventoryData.ItemID);
+        return reader.IsValid();
+    }
+
+    void MoveTaskInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.FolderID);
+        writer.Write(InventoryData.LocalID);
+        writer.Write(InventoryData.ItemID);
+    }
+
+    bool RequestTaskInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(InventoryData.LocalID);
+        return reader.IsValid();
+    }
+
+    void RequestTaskInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(InventoryData.LocalID);
+    }
+
+    bool ReplyTaskInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(InventoryData.TaskID);
+        reader.Read(InventoryData.Serial);
+        reader.ReadVariable1(InventoryData.Filename);
+        return reader.IsValid();
+    }
+
+    void ReplyTaskInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(InventoryData.TaskID);
+        writer.Write(InventoryData.Serial);
+        writer.WriteVariable1(InventoryData.Filename);
+    }
+
+    bool DeRezObject::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentBlock.GroupID);
+        reader.Read(AgentBlock.Destination);
+        reader.Read(AgentBlock.DestinationID);
+        reader.Read(AgentBlock.TransactionID);
+        reader.Read(AgentBlock.PacketCount);
+        reader.Read(AgentBlock.PacketNumber);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+        }
+        return reader.IsValid();
+    }
+
+    void DeRezObject::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentBlock.GroupID);
+        writer.Write(AgentBlock.Destination);
+        writer.Write(AgentBlock.DestinationID);
+        writer.Write(AgentBlock.TransactionID);
+        writer.Write(AgentBlock.PacketCount);
+        writer.Write(AgentBlock.PacketNumber);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+        }
+    }
+
+    bool DeRezAck::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TransactionData.TransactionID);
+        reader.Read(TransactionData.Success);
+        return reader.IsValid();
+    }
+
+    void DeRezAck::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TransactionData.TransactionID);
+        writer.Write(TransactionData.Success);
+    }
+
+    bool RezObject::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(RezData.FromTaskID);
+        reader.Read(RezData.BypassRaycast);
+        reader.Read(RezData.RayStart);
+        reader.Read(RezData.RayEnd);
+        reader.Read(RezData.RayTargetID);
+        reader.Read(RezData.RayEndIsIntersection);
+        reader.Read(RezData.RezSelected);
+        reader.Read(RezData.RemoveItem);
+        reader.Read(RezData.ItemFlags);
+        reader.Read(RezData.GroupMask);
+        reader.Read(RezData.EveryoneMask);
+        reader.Read(RezData.NextOwnerMask);
+        reader.Read(InventoryData.ItemID);
+        reader.Read(InventoryData.FolderID);
+        reader.Read(InventoryData.CreatorID);
+        reader.Read(InventoryData.OwnerID);
+        reader.Read(InventoryData.GroupID);
+        reader.Read(InventoryData.BaseMask);
+        reader.Read(InventoryData.OwnerMask);
+        reader.Read(InventoryData.GroupMask);
+        reader.Read(InventoryData.EveryoneMask);
+        reader.Read(InventoryData.NextOwnerMask);
+        reader.Read(InventoryData.GroupOwned);
+        reader.Read(InventoryData.TransactionID);
+        reader.Read(InventoryData.Type);
+        reader.Read(InventoryData.InvType);
+        reader.Read(InventoryData.Flags);
+        reader.Read(InventoryData.SaleType);
+        reader.Read(InventoryData.SalePrice);
+        reader.ReadVariable1(InventoryData.Name);
+        reader.ReadVariable1(InventoryData.Description);
+        reader.Read(InventoryData.CreationDate);
+        reader.Read(InventoryData.CRC);
+        return reader.IsValid();
+    }
+
+    void RezObject::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(RezData.FromTaskID);
+        writer.Write(RezData.BypassRaycast);
+        writer.Write(RezData.RayStart);
+        writer.Write(RezData.RayEnd);
+        writer.Write(RezData.RayTargetID);
+        writer.Write(RezData.RayEndIsIntersection);
+        writer.Write(RezData.RezSelected);
+        writer.Write(RezData.RemoveItem);
+        writer.Write(RezData.ItemFlags);
+        writer.Write(RezData.GroupMask);
+        writer.Write(RezData.EveryoneMask);
+        writer.Write(RezData.NextOwnerMask);
+        writer.Write(InventoryData.ItemID);
+        writer.Write(InventoryData.FolderID);
+        writer.Write(InventoryData.CreatorID);
+        writer.Write(InventoryData.OwnerID);
+        writer.Write(InventoryData.GroupID);
+        writer.Write(InventoryData.BaseMask);
+        writer.Write(InventoryData.OwnerMask);
+        writer.Write(InventoryData.GroupMask);
+        writer.Write(InventoryData.EveryoneMask);
+        writer.Write(InventoryData.NextOwnerMask);
+        writer.Write(InventoryData.GroupOwned);
+        writer.Write(InventoryData.TransactionID);
+        writer.Write(InventoryData.Type);
+        writer.Write(InventoryData.InvType);
+        writer.Write(InventoryData.Flags);
+        writer.Write(InventoryData.SaleType);
+        writer.Write(InventoryData.SalePrice);
+        writer.WriteVariable1(InventoryData.Name);
+        writer.WriteVariable1(InventoryData.Description);
+        writer.Write(InventoryData.CreationDate);
+        writer.Write(InventoryData.CRC);
+    }
+
+    bool RezObjectFromNotecard::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(RezData.FromTaskID);
+        reader.Read(RezData.BypassRaycast);
+        reader.Read(RezData.RayStart);
+        reader.Read(RezData.RayEnd);
+        reader.Read(RezData.RayTargetID);
+        reader.Read(RezData.RayEndIsIntersection);
+        reader.Read(RezData.RezSelected);
+        reader.Read(RezData.RemoveItem);
+        reader.Read(RezData.ItemFlags);
+        reader.Read(RezData.GroupMask);
+        reader.Read(RezData.EveryoneMask);
+        reader.Read(RezData.NextOwnerMask);
+        reader.Read(NotecardData.NotecardItemID);
+        reader.Read(NotecardData.ObjectID);
+        InventoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            reader.Read(InventoryData[i].ItemID);
+        }
+        return reader.IsValid();
+    }
+
+    void RezObjectFromNotecard::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(RezData.FromTaskID);
+        writer.Write(RezData.BypassRaycast);
+        writer.Write(RezData.RayStart);
+        writer.Write(RezData.RayEnd);
+        writer.Write(RezData.RayTargetID);
+        writer.Write(RezData.RayEndIsIntersection);
+        writer.Write(RezData.RezSelected);
+        writer.Write(RezData.RemoveItem);
+        writer.Write(RezData.ItemFlags);
+        writer.Write(RezData.GroupMask);
+        writer.Write(RezData.EveryoneMask);
+        writer.Write(RezData.NextOwnerMask);
+        writer.Write(NotecardData.NotecardItemID);
+        writer.Write(NotecardData.ObjectID);
+        writer.WriteBlockCount(InventoryData.size());
+        for(size_t i = 0; i < InventoryData.size(); ++i)
+        {
+            writer.Write(InventoryData[i].ItemID);
+        }
+    }
+
+    bool TransferInventory::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(InfoBlock.SourceID);
+        reader.Read(InfoBlock.DestID);
+        reader.Read(InfoBlock.TransactionID);
+        InventoryBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InventoryBlock.size(); ++i)
+        {
+            reader.Read(InventoryBlock[i].InventoryID);
+            reader.Read(InventoryBlock[i].Type);
+        }
+        return reader.IsValid();
+    }
+
+    void TransferInventory::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(InfoBlock.SourceID);
+        writer.Write(InfoBlock.DestID);
+        writer.Write(InfoBlock.TransactionID);
+        writer.WriteBlockCount(InventoryBlock.size());
+        for(size_t i = 0; i < InventoryBlock.size(); ++i)
+        {
+            writer.Write(InventoryBlock[i].InventoryID);
+            writer.Write(InventoryBlock[i].Type);
+        }
+    }
+
+    bool TransferInventoryAck::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(InfoBlock.TransactionID);
+        reader.Read(InfoBlock.InventoryID);
+        return reader.IsValid();
+    }
+
+    void TransferInventoryAck::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(InfoBlock.TransactionID);
+        writer.Write(InfoBlock.InventoryID);
+    }
+
+    bool AcceptFriendship::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(TransactionBlock.TransactionID);
+        FolderData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            reader.Read(FolderData[i].FolderID);
+        }
+        return reader.IsValid();
+    }
+
+    void AcceptFriendship::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(TransactionBlock.TransactionID);
+        writer.WriteBlockCount(FolderData.size());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            writer.Write(FolderData[i].FolderID);
+        }
+    }
+
+    bool DeclineFriendship::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(TransactionBlock.TransactionID);
+        return reader.IsValid();
+    }
+
+    void DeclineFriendship::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(TransactionBlock.TransactionID);
+    }
+
+    bool FormFriendship::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentBlock.SourceID);
+        reader.Read(AgentBlock.DestID);
+        return reader.IsValid();
+    }
+
+    void FormFriendship::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentBlock.SourceID);
+        writer.Write(AgentBlock.DestID);
+    }
+
+    bool TerminateFriendship::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ExBlock.OtherID);
+        return reader.IsValid();
+    }
+
+    void TerminateFriendship::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ExBlock.OtherID);
+    }
+
+    bool OfferCallingCard::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentBlock.DestID);
+        reader.Read(AgentBlock.TransactionID);
+        return reader.IsValid();
+    }
+
+    void OfferCallingCard::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentBlock.DestID);
+        writer.Write(AgentBlock.TransactionID);
+    }
+
+    bool AcceptCallingCard::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(TransactionBlock.TransactionID);
+        FolderData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            reader.Read(FolderData[i].FolderID);
+        }
+        return reader.IsValid();
+    }
+
+    void AcceptCallingCard::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(TransactionBlock.TransactionID);
+        writer.WriteBlockCount(FolderData.size());
+        for(size_t i = 0; i < FolderData.size(); ++i)
+        {
+            writer.Write(FolderData[i].FolderID);
+        }
+    }
+
+    bool DeclineCallingCard::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(TransactionBlock.TransactionID);
+        return reader.IsValid();
+    }
+
+    void DeclineCallingCard::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(TransactionBlock.TransactionID);
+    }
+
+    bool RezScript::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(UpdateBlock.ObjectLocalID);
+        reader.Read(UpdateBlock.Enabled);
+        reader.Read(InventoryBlock.ItemID);
+        reader.Read(InventoryBlock.FolderID);
+        reader.Read(InventoryBlock.CreatorID);
+        reader.Read(InventoryBlock.OwnerID);
+        reader.Read(InventoryBlock.GroupID);
+        reader.Read(InventoryBlock.BaseMask);
+        reader.Read(InventoryBlock.OwnerMask);
+        reader.Read(InventoryBlock.GroupMask);
+        reader.Read(InventoryBlock.EveryoneMask);
+        reader.Read(InventoryBlock.NextOwnerMask);
+        reader.Read(InventoryBlock.GroupOwned);
+        reader.Read(InventoryBlock.TransactionID);
+        reader.Read(InventoryBlock.Type);
+        reader.Read(InventoryBlock.InvType);
+        reader.Read(InventoryBlock.Flags);
+        reader.Read(InventoryBlock.SaleType);
+        reader.Read(InventoryBlock.SalePrice);
+        reader.ReadVariable1(InventoryBlock.Name);
+        reader.ReadVariable1(InventoryBlock.Description);
+        reader.Read(InventoryBlock.CreationDate);
+        reader.Read(InventoryBlock.CRC);
+        return reader.IsValid();
+    }
+
+    void RezScript::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(UpdateBlock.ObjectLocalID);
+        writer.Write(UpdateBlock.Enabled);
+        writer.Write(InventoryBlock.ItemID);
+        writer.Write(InventoryBlock.FolderID);
+        writer.Write(InventoryBlock.CreatorID);
+        writer.Write(InventoryBlock.OwnerID);
+        writer.Write(InventoryBlock.GroupID);
+        writer.Write(InventoryBlock.BaseMask);
+        writer.Write(InventoryBlock.OwnerMask);
+        writer.Write(InventoryBlock.GroupMask);
+        writer.Write(InventoryBlock.EveryoneMask);
+        writer.Write(InventoryBlock.NextOwnerMask);
+        writer.Write(InventoryBlock.GroupOwned);
+        writer.Write(InventoryBlock.TransactionID);
+        writer.Write(InventoryBlock.Type);
+        writer.Write(InventoryBlock.InvType);
+        writer.Write(InventoryBlock.Flags);
+        writer.Write(InventoryBlock.SaleType);
+        writer.Write(InventoryBlock.SalePrice);
+        writer.WriteVariable1(InventoryBlock.Name);
+        writer.WriteVariable1(InventoryBlock.Description);
+        writer.Write(InventoryBlock.CreationDate);
+        writer.Write(InventoryBlock.CRC);
+    }
+
+    bool CreateInventoryItem::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(InventoryBlock.CallbackID);
+        reader.Read(InventoryBlock.FolderID);
+        reader.Read(InventoryBlock.TransactionID);
+        reader.Read(InventoryBlock.NextOwnerMask);
+        reader.Read(InventoryBlock.Type);
+        reader.Read(InventoryBlock.InvType);
+        reader.Read(InventoryBlock.WearableType);
+        reader.ReadVariable1(InventoryBlock.Name);
+        reader.ReadVariable1(InventoryBlock.Description);
+        return reader.IsValid();
+    }
+
+    void CreateInventoryItem::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(InventoryBlock.CallbackID);
+        writer.Write(InventoryBlock.FolderID);
+        writer.Write(InventoryBlock.TransactionID);
+        writer.Write(InventoryBlock.NextOwnerMask);
+        writer.Write(InventoryBlock.Type);
+        writer.Write(InventoryBlock.InvType);
+        writer.Write(InventoryBlock.WearableType);
+        writer.WriteVariable1(InventoryBlock.Name);
+        writer.WriteVariable1(InventoryBlock.Description);
+    }
+
+    bool CreateLandmarkForEvent::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(EventData.EventID);
+        reader.Read(InventoryBlock.FolderID);
+        reader.ReadVariable1(InventoryBlock.Name);
+        return reader.IsValid();
+    }
+
+    void CreateLandmarkForEvent::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(EventData.EventID);
+        writer.Write(InventoryBlock.FolderID);
+        writer.WriteVariable1(InventoryBlock.Name);
+    }
+
+    bool EventLocationRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(QueryData.QueryID);
+        reader.Read(EventData.EventID);
+        return reader.IsValid();
+    }
+
+    void EventLocationRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(QueryData.QueryID);
+        writer.Write(EventData.EventID);
+    }
+
+    bool EventLocationReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(QueryData.QueryID);
+        reader.Read(EventData.Success);
+        reader.Read(EventData.RegionID);
+        reader.Read(EventData.RegionPos);
+        return reader.IsValid();
+    }
+
+    void EventLocationReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(QueryData.QueryID);
+        writer.Write(EventData.Success);
+        writer.Write(EventData.RegionID);
+        writer.Write(EventData.RegionPos);
+    }
+
+    bool RegionHandleRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RequestBlock.RegionID);
+        return reader.IsValid();
+    }
+
+    void RegionHandleRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RequestBlock.RegionID);
+    }
+
+    bool RegionIDAndHandleReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ReplyBlock.RegionID);
+        reader.Read(ReplyBlock.RegionHandle);
+        return reader.IsValid();
+    }
+
+    void RegionIDAndHandleReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ReplyBlock.RegionID);
+        writer.Write(ReplyBlock.RegionHandle);
+    }
+
+    bool MoneyTransferRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(MoneyData.SourceID);
+        reader.Read(MoneyData.DestID);
+        reader.Read(MoneyData.Flags);
+        reader.Read(MoneyData.Amount);
+        reader.Read(MoneyData.AggregatePermNextOwner);
+        reader.Read(MoneyData.AggregatePermInventory);
+        reader.Read(MoneyData.TransactionType);
+        reader.ReadVariable1(MoneyData.Description);
+        return reader.IsValid();
+    }
+
+    void MoneyTransferRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(MoneyData.SourceID);
+        writer.Write(MoneyData.DestID);
+        writer.Write(MoneyData.Flags);
+        writer.Write(MoneyData.Amount);
+        writer.Write(MoneyData.AggregatePermNextOwner);
+        writer.Write(MoneyData.AggregatePermInventory);
+        writer.Write(MoneyData.TransactionType);
+        writer.WriteVariable1(MoneyData.Description);
+    }
+
+    bool MoneyTransferBackend::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(MoneyData.TransactionID);
+        reader.Read(MoneyData.TransactionTime);
+        reader.Read(MoneyData.SourceID);
+        reader.Read(MoneyData.DestID);
+        reader.Read(MoneyData.Flags);
+        reader.Read(MoneyData.Amount);
+        reader.Read(MoneyData.AggregatePermNextOwner);
+        reader.Read(MoneyData.AggregatePermInventory);
+        reader.Read(MoneyData.TransactionType);
+        reader.Read(MoneyData.RegionID);
+        reader.Read(MoneyData.GridX);
+        reader.Read(MoneyData.GridY);
+        reader.ReadVariable1(MoneyData.Description);
+        return reader.IsValid();
+    }
+
+    void MoneyTransferBackend::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(MoneyData.TransactionID);
+        writer.Write(MoneyData.TransactionTime);
+        writer.Write(MoneyData.SourceID);
+        writer.Write(MoneyData.DestID);
+        writer.Write(MoneyData.Flags);
+        writer.Write(MoneyData.Amount);
+        writer.Write(MoneyData.AggregatePermNextOwner);
+        writer.Write(MoneyData.AggregatePermInventory);
+        writer.Write(MoneyData.TransactionType);
+        writer.Write(MoneyData.RegionID);
+        writer.Write(MoneyData.GridX);
+        writer.Write(MoneyData.GridY);
+        writer.WriteVariable1(MoneyData.Description);
+    }
+
+    bool MoneyBalanceRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(MoneyData.TransactionID);
+        return reader.IsValid();
+    }
+
+    void MoneyBalanceRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(MoneyData.TransactionID);
+    }
+
+    bool MoneyBalanceReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(MoneyData.AgentID);
+        reader.Read(MoneyData.TransactionID);
+        reader.Read(MoneyData.TransactionSuccess);
+        reader.Read(MoneyData.MoneyBalance);
+        reader.Read(MoneyData.SquareMetersCredit);
+        reader.Read(MoneyData.SquareMetersCommitted);
+        reader.ReadVariable1(MoneyData.Description);
+        return reader.IsValid();
+    }
+
+    void MoneyBalanceReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(MoneyData.AgentID);
+        writer.Write(MoneyData.TransactionID);
+        writer.Write(MoneyData.TransactionSuccess);
+        writer.Write(MoneyData.MoneyBalance);
+        writer.Write(MoneyData.SquareMetersCredit);
+        writer.Write(MoneyData.SquareMetersCommitted);
+        writer.WriteVariable1(MoneyData.Description);
+    }
+
+    bool RoutedMoneyBalanceReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TargetBlock.TargetIP);
+        reader.Read(TargetBlock.TargetPort);
+        reader.Read(MoneyData.AgentID);
+        reader.Read(MoneyData.TransactionID);
+        reader.Read(MoneyData.TransactionSuccess);
+        reader.Read(MoneyData.MoneyBalance);
+        reader.Read(MoneyData.SquareMetersCredit);
+        reader.Read(MoneyData.SquareMetersCommitted);
+        reader.ReadVariable1(MoneyData.Description);
+        return reader.IsValid();
+    }
+
+    void RoutedMoneyBalanceReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TargetBlock.TargetIP);
+        writer.Write(TargetBlock.TargetPort);
+        writer.Write(MoneyData.AgentID);
+        writer.Write(MoneyData.TransactionID);
+        writer.Write(MoneyData.TransactionSuccess);
+        writer.Write(MoneyData.MoneyBalance);
+        writer.Write(MoneyData.SquareMetersCredit);
+        writer.Write(MoneyData.SquareMetersCommitted);
+        writer.WriteVariable1(MoneyData.Description);
+    }
+
+    bool ActivateGestures::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Flags);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].ItemID);
+            reader.Read(Data[i].AssetID);
+            reader.Read(Data[i].GestureFlags);
+        }
+        return reader.IsValid();
+    }
+
+    void ActivateGestures::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Flags);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].ItemID);
+            writer.Write(Data[i].AssetID);
+            writer.Write(Data[i].GestureFlags);
+        }
+    }
+
+    bool DeactivateGestures::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Flags);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].ItemID);
+            reader.Read(Data[i].GestureFlags);
+        }
+        return reader.IsValid();
+    }
+
+    void DeactivateGestures::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Flags);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].ItemID);
+            writer.Write(Data[i].GestureFlags);
+        }
+    }
+
+    bool MuteListUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(MuteData.AgentID);
+        reader.ReadVariable1(MuteData.Filename);
+        return reader.IsValid();
+    }
+
+    void MuteListUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(MuteData.AgentID);
+        writer.WriteVariable1(MuteData.Filename);
+    }
+
+    bool UseCachedMuteList::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        return reader.IsValid();
+    }
+
+    void UseCachedMuteList::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+    }
+
+    bool GrantUserRights::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        Rights.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Rights.size(); ++i)
+        {
+            reader.Read(Rights[i].AgentRelated);
+            reader.Read(Rights[i].RelatedRights);
+        }
+        return reader.IsValid();
+    }
+
+    void GrantUserRights::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(Rights.size());
+        for(size_t i = 0; i < Rights.size(); ++i)
+        {
+            writer.Write(Rights[i].AgentRelated);
+            writer.Write(Rights[i].RelatedRights);
+        }
+    }
+
+    bool ChangeUserRights::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        Rights.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Rights.size(); ++i)
+        {
+            reader.Read(Rights[i].AgentRelated);
+            reader.Read(Rights[i].RelatedRights);
+        }
+        return reader.IsValid();
+    }
+
+    void ChangeUserRights::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.WriteBlockCount(Rights.size());
+        for(size_t i = 0; i < Rights.size(); ++i)
+        {
+            writer.Write(Rights[i].AgentRelated);
+            writer.Write(Rights[i].RelatedRights);
+        }
+    }
+
+    bool OnlineNotification::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        AgentBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AgentBlock.size(); ++i)
+        {
+            reader.Read(AgentBlock[i].AgentID);
+        }
+        return reader.IsValid();
+    }
+
+    void OnlineNotification::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(AgentBlock.size());
+        for(size_t i = 0; i < AgentBlock.size(); ++i)
+        {
+            writer.Write(AgentBlock[i].AgentID);
+        }
+    }
+
+    bool OfflineNotification::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        AgentBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AgentBlock.size(); ++i)
+        {
+            reader.Read(AgentBlock[i].AgentID);
+        }
+        return reader.IsValid();
+    }
+
+    void OfflineNotification::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(AgentBlock.size());
+        for(size_t i = 0; i < AgentBlock.size(); ++i)
+        {
+            writer.Write(AgentBlock[i].AgentID);
+        }
+    }
+
+    bool SetStartLocationRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.ReadVariable1(StartLocationData.SimName);
+        reader.Read(StartLocationData.LocationID);
+        reader.Read(StartLocationData.LocationPos);
+        reader.Read(StartLocationData.LocationLookAt);
+        return reader.IsValid();
+    }
+
+    void SetStartLocationRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteVariable1(StartLocationData.SimName);
+        writer.Write(StartLocationData.LocationID);
+        writer.Write(StartLocationData.LocationPos);
+        writer.Write(StartLocationData.LocationLookAt);
+    }
+
+    bool SetStartLocation::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(StartLocationData.AgentID);
+        reader.Read(StartLocationData.RegionID);
+        reader.Read(StartLocationData.LocationID);
+        reader.Read(StartLocationData.RegionHandle);
+        reader.Read(StartLocationData.LocationPos);
+        reader.Read(StartLocationData.LocationLookAt);
+        return reader.IsValid();
+    }
+
+    void SetStartLocation::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(StartLocationData.AgentID);
+        writer.Write(StartLocationData.RegionID);
+        writer.Write(StartLocationData.LocationID);
+        writer.Write(StartLocationData.RegionHandle);
+        writer.Write(StartLocationData.LocationPos);
+        writer.Write(StartLocationData.LocationLookAt);
+    }
+
+    bool NetTest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(NetBlock.Port);
+        return reader.IsValid();
+    }
+
+    void NetTest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(NetBlock.Port);
+    }
+
+    bool SetCPURatio::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.Ratio);
+        return reader.IsValid();
+    }
+
+    void SetCPURatio::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.Ratio);
+    }
+
+    bool SimCrashed::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Data.RegionX);
+        reader.Read(Data.RegionY);
+        Users.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Users.size(); ++i)
+        {
+            reader.Read(Users[i].AgentID);
+        }
+        return reader.IsValid();
+    }
+
+    void SimCrashed::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Data.RegionX);
+        writer.Write(Data.RegionY);
+        writer.WriteBlockCount(Users.size());
+        for(size_t i = 0; i < Users.size(); ++i)
+        {
+            writer.Write(Users[i].AgentID);
+        }
+    }
+
+    bool NameValuePair::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TaskData.ID);
+        NameValueData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < NameValueData.size(); ++i)
+        {
+            reader.ReadVariable2(NameValueData[i].NVPair);
+        }
+        return reader.IsValid();
+    }
+
+    void NameValuePair::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TaskData.ID);
+        writer.WriteBlockCount(NameValueData.size());
+        for(size_t i = 0; i < NameValueData.size(); ++i)
+        {
+            writer.WriteVariable2(NameValueData[i].NVPair);
+        }
+    }
+
+    bool RemoveNameValuePair::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TaskData.ID);
+        NameValueData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < NameValueData.size(); ++i)
+        {
+            reader.ReadVariable2(NameValueData[i].NVPair);
+        }
+        return reader.IsValid();
+    }
+
+    void RemoveNameValuePair::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TaskData.ID);
+        writer.WriteBlockCount(NameValueData.size());
+        for(size_t i = 0; i < NameValueData.size(); ++i)
+        {
+            writer.WriteVariable2(NameValueData[i].NVPair);
+        }
+    }
+
+    bool UpdateAttachment::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AttachmentBlock.AttachmentPoint);
+        reader.Read(OperationData.AddItem);
+        reader.Read(OperationData.UseExistingAsset);
+        reader.Read(InventoryData.ItemID);
+        reader.Read(InventoryData.FolderID);
+        reader.Read(InventoryData.CreatorID);
+        reader.Read(InventoryData.OwnerID);
+        reader.Read(InventoryData.GroupID);
+        reader.Read(InventoryData.BaseMask);
+        reader.Read(InventoryData.OwnerMask);
+        reader.Read(InventoryData.GroupMask);
+        reader.Read(InventoryData.EveryoneMask);
+        reader.Read(InventoryData.NextOwnerMask);
+        reader.Read(InventoryData.GroupOwned);
+        reader.Read(InventoryData.AssetID);
+        reader.Read(InventoryData.Type);
+        reader.Read(InventoryData.InvType);
+        reader.Read(InventoryData.Flags);
+        reader.Read(InventoryData.SaleType);
+        reader.Read(InventoryData.SalePrice);
+        reader.ReadVariable1(InventoryData.Name);
+        reader.ReadVariable1(InventoryData.Description);
+        reader.Read(InventoryData.CreationDate);
+        reader.Read(InventoryData.CRC);
+        return reader.IsValid();
+    }
+
+    void UpdateAttachment::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AttachmentBlock.AttachmentPoint);
+        writer.Write(OperationData.AddItem);
+        writer.Write(OperationData.UseExistingAsset);
+        writer.Write(InventoryData.ItemID);
+        writer.Write(InventoryData.FolderID);
+        writer.Write(InventoryData.CreatorID);
+        writer.Write(InventoryData.OwnerID);
+        writer.Write(InventoryData.GroupID);
+        writer.Write(InventoryData.BaseMask);
+        writer.Write(InventoryData.OwnerMask);
+        writer.Write(InventoryData.GroupMask);
+        writer.Write(InventoryData.EveryoneMask);
+        writer.Write(InventoryData.NextOwnerMask);
+        writer.Write(InventoryData.GroupOwned);
+        writer.Write(InventoryData.AssetID);
+        writer.Write(InventoryData.Type);
+        writer.Write(InventoryData.InvType);
+        writer.Write(InventoryData.Flags);
+        writer.Write(InventoryData.SaleType);
+        writer.Write(InventoryData.SalePrice);
+        writer.WriteVariable1(InventoryData.Name);
+        writer.WriteVariable1(InventoryData.Description);
+        writer.Write(InventoryData.CreationDate);
+        writer.Write(InventoryData.CRC);
+    }
+
+    bool RemoveAttachment::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AttachmentBlock.AttachmentPoint);
+        reader.Read(AttachmentBlock.ItemID);
+        return reader.IsValid();
+    }
+
+    void RemoveAttachment::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AttachmentBlock.AttachmentPoint);
+        writer.Write(AttachmentBlock.ItemID);
+    }
+
+    bool AssetUploadRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AssetBlock.TransactionID);
+        reader.Read(AssetBlock.Type);
+        reader.Read(AssetBlock.Tempfile);
+        reader.Read(AssetBlock.StoreLocal);
+        reader.ReadVariable2(AssetBlock.AssetData);
+        return reader.IsValid();
+    }
+
+    void AssetUploadRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AssetBlock.TransactionID);
+        writer.Write(AssetBlock.Type);
+        writer.Write(AssetBlock.Tempfile);
+        writer.Write(AssetBlock.StoreLocal);
+        writer.WriteVariable2(AssetBlock.AssetData);
+    }
+
+    bool AssetUploadComplete::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AssetBlock.UUID);
+        reader.Read(AssetBlock.Type);
+        reader.Read(AssetBlock.Success);
+        return reader.IsValid();
+    }
+
+    void AssetUploadComplete::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AssetBlock.UUID);
+        writer.Write(AssetBlock.Type);
+        writer.Write(AssetBlock.Success);
+    }
+
+    bool EmailMessageRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.ObjectID);
+        reader.ReadVariable1(DataBlock.FromAddress);
+        reader.ReadVariable1(DataBlock.Subject);
+        return reader.IsValid();
+    }
+
+    void EmailMessageRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.ObjectID);
+        writer.WriteVariable1(DataBlock.FromAddress);
+        writer.WriteVariable1(DataBlock.Subject);
+    }
+
+    bool EmailMessageReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.ObjectID);
+        reader.Read(DataBlock.More);
+        reader.Read(DataBlock.Time);
+        reader.ReadVariable1(DataBlock.FromAddress);
+        reader.ReadVariable1(DataBlock.Subject);
+        reader.ReadVariable2(DataBlock.Data);
+        reader.ReadVariable1(DataBlock.MailFilter);
+        return reader.IsValid();
+    }
+
+    void EmailMessageReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.ObjectID);
+        writer.Write(DataBlock.More);
+        writer.Write(DataBlock.Time);
+        writer.WriteVariable1(DataBlock.FromAddress);
+        writer.WriteVariable1(DataBlock.Subject);
+        writer.WriteVariable2(DataBlock.Data);
+        writer.WriteVariable1(DataBlock.MailFilter);
+    }
+
+    bool ScriptDataRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        DataBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            reader.Read(DataBlock[i].Hash);
+            reader.Read(DataBlock[i].RequestType);
+            reader.ReadVariable2(DataBlock[i].Request);
+        }
+        return reader.IsValid();
+    }
+
+    void ScriptDataRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(DataBlock.size());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            writer.Write(DataBlock[i].Hash);
+            writer.Write(DataBlock[i].RequestType);
+            writer.WriteVariable2(DataBlock[i].Request);
+        }
+    }
+
+    bool ScriptDataReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        DataBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            reader.Read(DataBlock[i].Hash);
+            reader.ReadVariable2(DataBlock[i].Reply);
+        }
+        return reader.IsValid();
+    }
+
+    void ScriptDataReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(DataBlock.size());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            writer.Write(DataBlock[i].Hash);
+            writer.WriteVariable2(DataBlock[i].Reply);
+        }
+    }
+
+    bool CreateGroupRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.ReadVariable1(GroupData.Name);
+        reader.ReadVariable2(GroupData.Charter);
+        reader.Read(GroupData.ShowInList);
+        reader.Read(GroupData.InsigniaID);
+        reader.Read(GroupData.MembershipFee);
+        reader.Read(GroupData.OpenEnrollment);
+        reader.Read(GroupData.AllowPublish);
+        reader.Read(GroupData.MaturePublish);
+        return reader.IsValid();
+    }
+
+    void CreateGroupRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteVariable1(GroupData.Name);
+        writer.WriteVariable2(GroupData.Charter);
+        writer.Write(GroupData.ShowInList);
+        writer.Write(GroupData.InsigniaID);
+        writer.Write(GroupData.MembershipFee);
+        writer.Write(GroupData.OpenEnrollment);
+        writer.Write(GroupData.AllowPublish);
+        writer.Write(GroupData.MaturePublish);
+    }
+
+    bool CreateGroupReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(ReplyData.GroupID);
+        reader.Read(ReplyData.Success);
+        reader.ReadVariable1(ReplyData.Message);
+        return reader.IsValid();
+    }
+
+    void CreateGroupReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(ReplyData.GroupID);
+        writer.Write(ReplyData.Success);
+        writer.WriteVariable1(ReplyData.Message);
+    }
+
+    bool UpdateGroupInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        reader.ReadVariable2(GroupData.Charter);
+        reader.Read(GroupData.ShowInList);
+        reader.Read(GroupData.InsigniaID);
+        reader.Read(GroupData.MembershipFee);
+        reader.Read(GroupData.OpenEnrollment);
+        reader.Read(GroupData.AllowPublish);
+        reader.Read(GroupData.MaturePublish);
+        return reader.IsValid();
+    }
+
+    void UpdateGroupInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.WriteVariable2(GroupData.Charter);
+        writer.Write(GroupData.ShowInList);
+        writer.Write(GroupData.InsigniaID);
+        writer.Write(GroupData.MembershipFee);
+        writer.Write(GroupData.OpenEnrollment);
+        writer.Write(GroupData.AllowPublish);
+        writer.Write(GroupData.MaturePublish);
+    }
+
+    bool GroupRoleChanges::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        RoleChange.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RoleChange.size(); ++i)
+        {
+            reader.Read(RoleChange[i].RoleID);
+            reader.Read(RoleChange[i].MemberID);
+            reader.Read(RoleChange[i].Change);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupRoleChanges::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.WriteBlockCount(RoleChange.size());
+        for(size_t i = 0; i < RoleChange.size(); ++i)
+        {
+            writer.Write(RoleChange[i].RoleID);
+            writer.Write(RoleChange[i].MemberID);
+            writer.Write(RoleChange[i].Change);
+        }
+    }
+
+    bool JoinGroupRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        return reader.IsValid();
+    }
+
+    void JoinGroupRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+    }
+
+    bool JoinGroupReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(GroupData.Success);
+        return reader.IsValid();
+    }
+
+    void JoinGroupReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(GroupData.Success);
+    }
+
+    bool EjectGroupMemberRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        EjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < EjectData.size(); ++i)
+        {
+            reader.Read(EjectData[i].EjecteeID);
+        }
+        return reader.IsValid();
+    }
+
+    void EjectGroupMemberRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.WriteBlockCount(EjectData.size());
+        for(size_t i = 0; i < EjectData.size(); ++i)
+        {
+            writer.Write(EjectData[i].EjecteeID);
+        }
+    }
+
+    bool EjectGroupMemberReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(EjectData.Success);
+        return reader.IsValid();
+    }
+
+    void EjectGroupMemberReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(EjectData.Success);
+    }
+
+    bool LeaveGroupRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        return reader.IsValid();
+    }
+
+    void LeaveGroupRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+    }
+
+    bool LeaveGroupReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(GroupData.Success);
+        return reader.IsValid();
+    }
+
+    void LeaveGroupReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(GroupData.Success);
+    }
+
+    bool InviteGroupRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        InviteData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < InviteData.size(); ++i)
+        {
+            reader.Read(InviteData[i].InviteeID);
+            reader.Read(InviteData[i].RoleID);
+        }
+        return reader.IsValid();
+    }
+
+    void InviteGroupRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.WriteBlockCount(InviteData.size());
+        for(size_t i = 0; i < InviteData.size(); ++i)
+        {
+            writer.Write(InviteData[i].InviteeID);
+            writer.Write(InviteData[i].RoleID);
+        }
+    }
+
+    bool InviteGroupResponse::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(InviteData.AgentID);
+        reader.Read(InviteData.InviteeID);
+        reader.Read(InviteData.GroupID);
+        reader.Read(InviteData.RoleID);
+        reader.Read(InviteData.MembershipFee);
+        return reader.IsValid();
+    }
+
+    void InviteGroupResponse::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(InviteData.AgentID);
+        writer.Write(InviteData.InviteeID);
+        writer.Write(InviteData.GroupID);
+        writer.Write(InviteData.RoleID);
+        writer.Write(InviteData.MembershipFee);
+    }
+
+    bool GroupProfileRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        return reader.IsValid();
+    }
+
+    void GroupProfileRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+    }
+
+    bool GroupProfileReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(GroupData.GroupID);
+        reader.ReadVariable1(GroupData.Name);
+        reader.ReadVariable2(GroupData.Charter);
+        reader.Read(GroupData.ShowInList);
+        reader.ReadVariable1(GroupData.MemberTitle);
+        reader.Read(GroupData.PowersMask);
+        reader.Read(GroupData.InsigniaID);
+        reader.Read(GroupData.FounderID);
+        reader.Read(GroupData.MembershipFee);
+        reader.Read(GroupData.OpenEnrollment);
+        reader.Read(GroupData.Money);
+        reader.Read(GroupData.GroupMembershipCount);
+        reader.Read(GroupData.GroupRolesCount);
+        reader.Read(GroupData.AllowPublish);
+        reader.Read(GroupData.MaturePublish);
+        reader.Read(GroupData.OwnerRole);
+        return reader.IsValid();
+    }
+
+    void GroupProfileReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(GroupData.GroupID);
+        writer.WriteVariable1(GroupData.Name);
+        writer.WriteVariable2(GroupData.Charter);
+        writer.Write(GroupData.ShowInList);
+        writer.WriteVariable1(GroupData.MemberTitle);
+        writer.Write(GroupData.PowersMask);
+        writer.Write(GroupData.InsigniaID);
+        writer.Write(GroupData.FounderID);
+        writer.Write(GroupData.MembershipFee);
+        writer.Write(GroupData.OpenEnrollment);
+        writer.Write(GroupData.Money);
+        writer.Write(GroupData.GroupMembershipCount);
+        writer.Write(GroupData.GroupRolesCount);
+        writer.Write(GroupData.AllowPublish);
+        writer.Write(GroupData.MaturePublish);
+        writer.Write(GroupData.OwnerRole);
+    }
+
+    bool GroupAccountSummaryRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(MoneyData.RequestID);
+        reader.Read(MoneyData.IntervalDays);
+        reader.Read(MoneyData.CurrentInterval);
+        return reader.IsValid();
+    }
+
+    void GroupAccountSummaryRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(MoneyData.RequestID);
+        writer.Write(MoneyData.IntervalDays);
+        writer.Write(MoneyData.CurrentInterval);
+    }
+
+    bool GroupAccountSummaryReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(MoneyData.RequestID);
+        reader.Read(MoneyData.IntervalDays);
+        reader.Read(MoneyData.CurrentInterval);
+        reader.ReadVariable1(MoneyData.StartDate);
+        reader.Read(MoneyData.Balance);
+        reader.Read(MoneyData.TotalCredits);
+        reader.Read(MoneyData.TotalDebits);
+        reader.Read(MoneyData.ObjectTaxCurrent);
+        reader.Read(MoneyData.LightTaxCurrent);
+        reader.Read(MoneyData.LandTaxCurrent);
+        reader.Read(MoneyData.GroupTaxCurrent);
+        reader.Read(MoneyData.ParcelDirFeeCurrent);
+        reader.Read(MoneyData.ObjectTaxEstimate);
+        reader.Read(MoneyData.LightTaxEstimate);
+        reader.Read(MoneyData.LandTaxEstimate);
+        reader.Read(MoneyData.GroupTaxEstimate);
+        reader.Read(MoneyData.ParcelDirFeeEstimate);
+        reader.Read(MoneyData.NonExemptMembers);
+        reader.ReadVariable1(MoneyData.LastTaxDate);
+        reader.ReadVariable1(MoneyData.TaxDate);
+        return reader.IsValid();
+    }
+
+    void GroupAccountSummaryReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(MoneyData.RequestID);
+        writer.Write(MoneyData.IntervalDays);
+        writer.Write(MoneyData.CurrentInterval);
+        writer.WriteVariable1(MoneyData.StartDate);
+        writer.Write(MoneyData.Balance);
+        writer.Write(MoneyData.TotalCredits);
+        writer.Write(MoneyData.TotalDebits);
+        writer.Write(MoneyData.ObjectTaxCurrent);
+        writer.Write(MoneyData.LightTaxCurrent);
+        writer.Write(MoneyData.LandTaxCurrent);
+        writer.Write(MoneyData.GroupTaxCurrent);
+        writer.Write(MoneyData.ParcelDirFeeCurrent);
+        writer.Write(MoneyData.ObjectTaxEstimate);
+        writer.Write(MoneyData.LightTaxEstimate);
+        writer.Write(MoneyData.LandTaxEstimate);
+        writer.Write(MoneyData.GroupTaxEstimate);
+        writer.Write(MoneyData.ParcelDirFeeEstimate);
+        writer.Write(MoneyData.NonExemptMembers);
+        writer.WriteVariable1(MoneyData.LastTaxDate);
+        writer.WriteVariable1(MoneyData.TaxDate);
+    }
+
+    bool GroupAccountDetailsRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(MoneyData.RequestID);
+        reader.Read(MoneyData.IntervalDays);
+        reader.Read(MoneyData.CurrentInterval);
+        return reader.IsValid();
+    }
+
+    void GroupAccountDetailsRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(MoneyData.RequestID);
+        writer.Write(MoneyData.IntervalDays);
+        writer.Write(MoneyData.CurrentInterval);
+    }
+
+    bool GroupAccountDetailsReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(MoneyData.RequestID);
+        reader.Read(MoneyData.IntervalDays);
+        reader.Read(MoneyData.CurrentInterval);
+        reader.ReadVariable1(MoneyData.StartDate);
+        HistoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < HistoryData.size(); ++i)
+        {
+            reader.ReadVariable1(HistoryData[i].Description);
+            reader.Read(HistoryData[i].Amount);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupAccountDetailsReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(MoneyData.RequestID);
+        writer.Write(MoneyData.IntervalDays);
+        writer.Write(MoneyData.CurrentInterval);
+        writer.WriteVariable1(MoneyData.StartDate);
+        writer.WriteBlockCount(HistoryData.size());
+        for(size_t i = 0; i < HistoryData.size(); ++i)
+        {
+            writer.WriteVariable1(HistoryData[i].Description);
+            writer.Write(HistoryData[i].Amount);
+        }
+    }
+
+    bool GroupAccountTransactionsRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(MoneyData.RequestID);
+        reader.Read(MoneyData.IntervalDays);
+        reader.Read(MoneyData.CurrentInterval);
+        return reader.IsValid();
+    }
+
+    void GroupAccountTransactionsRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(MoneyData.RequestID);
+        writer.Write(MoneyData.IntervalDays);
+        writer.Write(MoneyData.CurrentInterval);
+    }
+
+    bool GroupAccountTransactionsReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(MoneyData.RequestID);
+        reader.Read(MoneyData.IntervalDays);
+        reader.Read(MoneyData.CurrentInterval);
+        reader.ReadVariable1(MoneyData.StartDate);
+        HistoryData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < HistoryData.size(); ++i)
+        {
+            reader.ReadVariable1(HistoryData[i].Time);
+            reader.ReadVariable1(HistoryData[i].User);
+            reader.Read(HistoryData[i].Type);
+            reader.ReadVariable1(HistoryData[i].Item);
+            reader.Read(HistoryData[i].Amount);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupAccountTransactionsReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(MoneyData.RequestID);
+        writer.Write(MoneyData.IntervalDays);
+        writer.Write(MoneyData.CurrentInterval);
+        writer.WriteVariable1(MoneyData.StartDate);
+        writer.WriteBlockCount(HistoryData.size());
+        for(size_t i = 0; i < HistoryData.size(); ++i)
+        {
+            writer.WriteVariable1(HistoryData[i].Time);
+            writer.WriteVariable1(HistoryData[i].User);
+            writer.Write(HistoryData[i].Type);
+            writer.WriteVariable1(HistoryData[i].Item);
+            writer.Write(HistoryData[i].Amount);
+        }
+    }
+
+    bool GroupActiveProposalsRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(TransactionData.TransactionID);
+        return reader.IsValid();
+    }
+
+    void GroupActiveProposalsRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(TransactionData.TransactionID);
+    }
+
+    bool GroupActiveProposalItemReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(TransactionData.TransactionID);
+        reader.Read(TransactionData.TotalNumItems);
+        ProposalData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ProposalData.size(); ++i)
+        {
+            reader.Read(ProposalData[i].VoteID);
+            reader.Read(ProposalData[i].VoteInitiator);
+            reader.ReadVariable1(ProposalData[i].TerseDateID);
+            reader.ReadVariable1(ProposalData[i].StartDateTime);
+            reader.ReadVariable1(ProposalData[i].EndDateTime);
+            reader.Read(ProposalData[i].AlreadyVoted);
+            reader.ReadVariable1(ProposalData[i].VoteCast);
+            reader.Read(ProposalData[i].Majority);
+            reader.Read(ProposalData[i].Quorum);
+            reader.ReadVariable1(ProposalData[i].ProposalText);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupActiveProposalItemReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(TransactionData.TransactionID);
+        writer.Write(TransactionData.TotalNumItems);
+        writer.WriteBlockCount(ProposalData.size());
+        for(size_t i = 0; i < ProposalData.size(); ++i)
+        {
+            writer.Write(ProposalData[i].VoteID);
+            writer.Write(ProposalData[i].VoteInitiator);
+            writer.WriteVariable1(ProposalData[i].TerseDateID);
+            writer.WriteVariable1(ProposalData[i].StartDateTime);
+            writer.WriteVariable1(ProposalData[i].EndDateTime);
+            writer.Write(ProposalData[i].AlreadyVoted);
+            writer.WriteVariable1(ProposalData[i].VoteCast);
+            writer.Write(ProposalData[i].Majority);
+            writer.Write(ProposalData[i].Quorum);
+            writer.WriteVariable1(ProposalData[i].ProposalText);
+        }
+    }
+
+    bool GroupVoteHistoryRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(TransactionData.TransactionID);
+        return reader.IsValid();
+    }
+
+    void GroupVoteHistoryRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(TransactionData.TransactionID);
+    }
+
+    bool GroupVoteHistoryItemReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(TransactionData.TransactionID);
+        reader.Read(TransactionData.TotalNumItems);
+        reader.Read(HistoryItemData.VoteID);
+        reader.ReadVariable1(HistoryItemData.TerseDateID);
+        reader.ReadVariable1(HistoryItemData.StartDateTime);
+        reader.ReadVariable1(HistoryItemData.EndDateTime);
+        reader.Read(HistoryItemData.VoteInitiator);
+        reader.ReadVariable1(HistoryItemData.VoteType);
+        reader.ReadVariable1(HistoryItemData.VoteResult);
+        reader.Read(HistoryItemData.Majority);
+        reader.Read(HistoryItemData.Quorum);
+        reader.ReadVariable2(HistoryItemData.ProposalText);
+        VoteItem.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < VoteItem.size(); ++i)
+        {
+            reader.Read(VoteItem[i].CandidateID);
+            reader.ReadVariable1(VoteItem[i].VoteCast);
+            reader.Read(VoteItem[i].NumVotes);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupVoteHistoryItemReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(TransactionData.TransactionID);
+        writer.Write(TransactionData.TotalNumItems);
+        writer.Write(HistoryItemData.VoteID);
+        writer.WriteVariable1(HistoryItemData.TerseDateID);
+        writer.WriteVariable1(HistoryItemData.StartDateTime);
+        writer.WriteVariable1(HistoryItemData.EndDateTime);
+        writer.Write(HistoryItemData.VoteInitiator);
+        writer.WriteVariable1(HistoryItemData.VoteType);
+        writer.WriteVariable1(HistoryItemData.VoteResult);
+        writer.Write(HistoryItemData.Majority);
+        writer.Write(HistoryItemData.Quorum);
+        writer.WriteVariable2(HistoryItemData.ProposalText);
+        writer.WriteBlockCount(VoteItem.size());
+        for(size_t i = 0; i < VoteItem.size(); ++i)
+        {
+            writer.Write(VoteItem[i].CandidateID);
+            writer.WriteVariable1(VoteItem[i].VoteCast);
+            writer.Write(VoteItem[i].NumVotes);
+        }
+    }
+
+    bool StartGroupProposal::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ProposalData.GroupID);
+        reader.Read(ProposalData.Quorum);
+        reader.Read(ProposalData.Majority);
+        reader.Read(ProposalData.Duration);
+        reader.ReadVariable1(ProposalData.ProposalText);
+        return reader.IsValid();
+    }
+
+    void StartGroupProposal::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ProposalData.GroupID);
+        writer.Write(ProposalData.Quorum);
+        writer.Write(ProposalData.Majority);
+        writer.Write(ProposalData.Duration);
+        writer.WriteVariable1(ProposalData.ProposalText);
+    }
+
+    bool GroupProposalBallot::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ProposalData.ProposalID);
+        reader.Read(ProposalData.GroupID);
+        reader.ReadVariable1(ProposalData.VoteCast);
+        return reader.IsValid();
+    }
+
+    void GroupProposalBallot::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ProposalData.ProposalID);
+        writer.Write(ProposalData.GroupID);
+        writer.WriteVariable1(ProposalData.VoteCast);
+    }
+
+    bool TallyVotes::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void TallyVotes::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+    bool GroupMembersRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(GroupData.RequestID);
+        return reader.IsValid();
+    }
+
+    void GroupMembersRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(GroupData.RequestID);
+    }
+
+    bool GroupMembersReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(GroupData.RequestID);
+        reader.Read(GroupData.MemberCount);
+        MemberData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < MemberData.size(); ++i)
+        {
+            reader.Read(MemberData[i].AgentID);
+            reader.Read(MemberData[i].Contribution);
+            reader.ReadVariable1(MemberData[i].OnlineStatus);
+            reader.Read(MemberData[i].AgentPowers);
+            reader.ReadVariable1(MemberData[i].Title);
+            reader.Read(MemberData[i].IsOwner);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupMembersReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(GroupData.RequestID);
+        writer.Write(GroupData.MemberCount);
+        writer.WriteBlockCount(MemberData.size());
+        for(size_t i = 0; i < MemberData.size(); ++i)
+        {
+            writer.Write(MemberData[i].AgentID);
+            writer.Write(MemberData[i].Contribution);
+            writer.WriteVariable1(MemberData[i].OnlineStatus);
+            writer.Write(MemberData[i].AgentPowers);
+            writer.WriteVariable1(MemberData[i].Title);
+            writer.Write(MemberData[i].IsOwner);
+        }
+    }
+
+    bool ActivateGroup::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        return reader.IsValid();
+    }
+
+    void ActivateGroup::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+    }
+
+    bool SetGroupContribution::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.GroupID);
+        reader.Read(Data.Contribution);
+        return reader.IsValid();
+    }
+
+    void SetGroupContribution::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.GroupID);
+        writer.Write(Data.Contribution);
+    }
+
+    bool SetGroupAcceptNotices::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(Data.GroupID);
+        reader.Read(Data.AcceptNotices);
+        reader.Read(NewData.ListInProfile);
+        return reader.IsValid();
+    }
+
+    void SetGroupAcceptNotices::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(Data.GroupID);
+        writer.Write(Data.AcceptNotices);
+        writer.Write(NewData.ListInProfile);
+    }
+
+    bool GroupRoleDataRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(GroupData.RequestID);
+        return reader.IsValid();
+    }
+
+    void GroupRoleDataRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(GroupData.RequestID);
+    }
+
+    bool GroupRoleDataReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(GroupData.RequestID);
+        reader.Read(GroupData.RoleCount);
+        RoleData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RoleData.size(); ++i)
+        {
+            reader.Read(RoleData[i].RoleID);
+            reader.ReadVariable1(RoleData[i].Name);
+            reader.ReadVariable1(RoleData[i].Title);
+            reader.ReadVariable1(RoleData[i].Description);
+            reader.Read(RoleData[i].Powers);
+            reader.Read(RoleData[i].Members);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupRoleDataReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(GroupData.RequestID);
+        writer.Write(GroupData.RoleCount);
+        writer.WriteBlockCount(RoleData.size());
+        for(size_t i = 0; i < RoleData.size(); ++i)
+        {
+            writer.Write(RoleData[i].RoleID);
+            writer.WriteVariable1(RoleData[i].Name);
+            writer.WriteVariable1(RoleData[i].Title);
+            writer.WriteVariable1(RoleData[i].Description);
+            writer.Write(RoleData[i].Powers);
+            writer.Write(RoleData[i].Members);
+        }
+    }
+
+    bool GroupRoleMembersRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(GroupData.GroupID);
+        reader.Read(GroupData.RequestID);
+        return reader.IsValid();
+    }
+
+    void GroupRoleMembersRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(GroupData.GroupID);
+        writer.Write(GroupData.RequestID);
+    }
+
+    bool GroupRoleMembersReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(AgentData.RequestID);
+        reader.Read(AgentData.TotalPairs);
+        MemberData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < MemberData.size(); ++i)
+        {
+            reader.Read(MemberData[i].RoleID);
+            reader.Read(MemberData[i].MemberID);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupRoleMembersReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(AgentData.RequestID);
+        writer.Write(AgentData.TotalPairs);
+        writer.WriteBlockCount(MemberData.size());
+        for(size_t i = 0; i < MemberData.size(); ++i)
+        {
+            writer.Write(MemberData[i].RoleID);
+            writer.Write(MemberData[i].MemberID);
+        }
+    }
+
+    bool GroupTitlesRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(AgentData.RequestID);
+        return reader.IsValid();
+    }
+
+    void GroupTitlesRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(AgentData.RequestID);
+    }
+
+    bool GroupTitlesReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(AgentData.RequestID);
+        GroupData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            reader.ReadVariable1(GroupData[i].Title);
+            reader.Read(GroupData[i].RoleID);
+            reader.Read(GroupData[i].Selected);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupTitlesReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(AgentData.RequestID);
+        writer.WriteBlockCount(GroupData.size());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            writer.WriteVariable1(GroupData[i].Title);
+            writer.Write(GroupData[i].RoleID);
+            writer.Write(GroupData[i].Selected);
+        }
+    }
+
+    bool GroupTitleUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        reader.Read(AgentData.TitleRoleID);
+        return reader.IsValid();
+    }
+
+    void GroupTitleUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.Write(AgentData.TitleRoleID);
+    }
+
+    bool GroupRoleUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.GroupID);
+        RoleData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < RoleData.size(); ++i)
+        {
+            reader.Read(RoleData[i].RoleID);
+            reader.ReadVariable1(RoleData[i].Name);
+            reader.ReadVariable1(RoleData[i].Description);
+            reader.ReadVariable1(RoleData[i].Title);
+            reader.Read(RoleData[i].Powers);
+            reader.Read(RoleData[i].UpdateType);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupRoleUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.GroupID);
+        writer.WriteBlockCount(RoleData.size());
+        for(size_t i = 0; i < RoleData.size(); ++i)
+        {
+            writer.Write(RoleData[i].RoleID);
+            writer.WriteVariable1(RoleData[i].Name);
+            writer.WriteVariable1(RoleData[i].Description);
+            writer.WriteVariable1(RoleData[i].Title);
+            writer.Write(RoleData[i].Powers);
+            writer.Write(RoleData[i].UpdateType);
+        }
+    }
+
+    bool LiveHelpGroupRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RequestData.RequestID);
+        reader.Read(RequestData.AgentID);
+        return reader.IsValid();
+    }
+
+    void LiveHelpGroupRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RequestData.RequestID);
+        writer.Write(RequestData.AgentID);
+    }
+
+    bool LiveHelpGroupReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ReplyData.RequestID);
+        reader.Read(ReplyData.GroupID);
+        reader.ReadVariable1(ReplyData.Selection);
+        return reader.IsValid();
+    }
+
+    void LiveHelpGroupReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ReplyData.RequestID);
+        writer.Write(ReplyData.GroupID);
+        writer.WriteVariable1(ReplyData.Selection);
+    }
+
+    bool AgentWearablesRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void AgentWearablesRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool AgentWearablesUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.SerialNum);
+        WearableData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            reader.Read(WearableData[i].ItemID);
+            reader.Read(WearableData[i].AssetID);
+            reader.Read(WearableData[i].WearableType);
+        }
+        return reader.IsValid();
+    }
+
+    void AgentWearablesUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.SerialNum);
+        writer.WriteBlockCount(WearableData.size());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            writer.Write(WearableData[i].ItemID);
+            writer.Write(WearableData[i].AssetID);
+            writer.Write(WearableData[i].WearableType);
+        }
+    }
+
+    bool AgentIsNowWearing::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        WearableData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            reader.Read(WearableData[i].ItemID);
+            reader.Read(WearableData[i].WearableType);
+        }
+        return reader.IsValid();
+    }
+
+    void AgentIsNowWearing::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(WearableData.size());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            writer.Write(WearableData[i].ItemID);
+            writer.Write(WearableData[i].WearableType);
+        }
+    }
+
+    bool AgentCachedTexture::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.SerialNum);
+        WearableData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            reader.Read(WearableData[i].ID);
+            reader.Read(WearableData[i].TextureIndex);
+        }
+        return reader.IsValid();
+    }
+
+    void AgentCachedTexture::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.SerialNum);
+        writer.WriteBlockCount(WearableData.size());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            writer.Write(WearableData[i].ID);
+            writer.Write(WearableData[i].TextureIndex);
+        }
+    }
+
+    bool AgentCachedTextureResponse::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.SerialNum);
+        WearableData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            reader.Read(WearableData[i].TextureID);
+            reader.Read(WearableData[i].TextureIndex);
+            reader.ReadVariable1(WearableData[i].HostName);
+        }
+        return reader.IsValid();
+    }
+
+    void AgentCachedTextureResponse::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.SerialNum);
+        writer.WriteBlockCount(WearableData.size());
+        for(size_t i = 0; i < WearableData.size(); ++i)
+        {
+            writer.Write(WearableData[i].TextureID);
+            writer.Write(WearableData[i].TextureIndex);
+            writer.WriteVariable1(WearableData[i].HostName);
+        }
+    }
+
+    bool AgentDataUpdateRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void AgentDataUpdateRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool AgentDataUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.ReadVariable1(AgentData.FirstName);
+        reader.ReadVariable1(AgentData.LastName);
+        reader.ReadVariable1(AgentData.GroupTitle);
+        reader.Read(AgentData.ActiveGroupID);
+        reader.Read(AgentData.GroupPowers);
+        reader.ReadVariable1(AgentData.GroupName);
+        return reader.IsValid();
+    }
+
+    void AgentDataUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.WriteVariable1(AgentData.FirstName);
+        writer.WriteVariable1(AgentData.LastName);
+        writer.WriteVariable1(AgentData.GroupTitle);
+        writer.Write(AgentData.ActiveGroupID);
+        writer.Write(AgentData.GroupPowers);
+        writer.WriteVariable1(AgentData.GroupName);
+    }
+
+    bool GroupDataUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        AgentGroupData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < AgentGroupData.size(); ++i)
+        {
+            reader.Read(AgentGroupData[i].AgentID);
+            reader.Read(AgentGroupData[i].GroupID);
+            reader.Read(AgentGroupData[i].AgentPowers);
+            reader.ReadVariable1(AgentGroupData[i].GroupTitle);
+        }
+        return reader.IsValid();
+    }
+
+    void GroupDataUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(AgentGroupData.size());
+        for(size_t i = 0; i < AgentGroupData.size(); ++i)
+        {
+            writer.Write(AgentGroupData[i].AgentID);
+            writer.Write(AgentGroupData[i].GroupID);
+            writer.Write(AgentGroupData[i].AgentPowers);
+            writer.WriteVariable1(AgentGroupData[i].GroupTitle);
+        }
+    }
+
+    bool AgentGroupDataUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        GroupData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            reader.Read(GroupData[i].GroupID);
+            reader.Read(GroupData[i].GroupPowers);
+            reader.Read(GroupData[i].AcceptNotices);
+            reader.Read(GroupData[i].GroupInsigniaID);
+            reader.Read(GroupData[i].Contribution);
+            reader.ReadVariable1(GroupData[i].GroupName);
+        }
+        return reader.IsValid();
+    }
+
+    void AgentGroupDataUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.WriteBlockCount(GroupData.size());
+        for(size_t i = 0; i < GroupData.size(); ++i)
+        {
+            writer.Write(GroupData[i].GroupID);
+            writer.Write(GroupData[i].GroupPowers);
+            writer.Write(GroupData[i].AcceptNotices);
+            writer.Write(GroupData[i].GroupInsigniaID);
+            writer.Write(GroupData[i].Contribution);
+            writer.WriteVariable1(GroupData[i].GroupName);
+        }
+    }
+
+    bool AgentDropGroup::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.GroupID);
+        return reader.IsValid();
+    }
+
+    void AgentDropGroup::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.GroupID);
+    }
+
+    bool LogTextMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        DataBlock.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            reader.Read(DataBlock[i].FromAgentId);
+            reader.Read(DataBlock[i].ToAgentId);
+            reader.Read(DataBlock[i].GlobalX);
+            reader.Read(DataBlock[i].GlobalY);
+            reader.Read(DataBlock[i].Time);
+            reader.ReadVariable2(DataBlock[i].Message);
+        }
+        return reader.IsValid();
+    }
+
+    void LogTextMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(DataBlock.size());
+        for(size_t i = 0; i < DataBlock.size(); ++i)
+        {
+            writer.Write(DataBlock[i].FromAgentId);
+            writer.Write(DataBlock[i].ToAgentId);
+            writer.Write(DataBlock[i].GlobalX);
+            writer.Write(DataBlock[i].GlobalY);
+            writer.Write(DataBlock[i].Time);
+            writer.WriteVariable2(DataBlock[i].Message);
+        }
+    }
+
+    bool CreateTrustedCircuit::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.EndPointID);
+        reader.ReadFixed(DataBlock.Digest, 32);
+        return reader.IsValid();
+    }
+
+    void CreateTrustedCircuit::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.EndPointID);
+        writer.WriteFixed(DataBlock.Digest, 32);
+    }
+
+    bool DenyTrustedCircuit::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.EndPointID);
+        return reader.IsValid();
+    }
+
+    void DenyTrustedCircuit::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.EndPointID);
+    }
+
+    bool RequestTrustedCircuit::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void RequestTrustedCircuit::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+    bool RezSingleAttachmentFromInv::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(ObjectData.ItemID);
+        reader.Read(ObjectData.OwnerID);
+        reader.Read(ObjectData.AttachmentPt);
+        reader.Read(ObjectData.ItemFlags);
+        reader.Read(ObjectData.GroupMask);
+        reader.Read(ObjectData.EveryoneMask);
+        reader.Read(ObjectData.NextOwnerMask);
+        reader.ReadVariable1(ObjectData.Name);
+        reader.ReadVariable1(ObjectData.Description);
+        return reader.IsValid();
+    }
+
+    void RezSingleAttachmentFromInv::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(ObjectData.ItemID);
+        writer.Write(ObjectData.OwnerID);
+        writer.Write(ObjectData.AttachmentPt);
+        writer.Write(ObjectData.ItemFlags);
+        writer.Write(ObjectData.GroupMask);
+        writer.Write(ObjectData.EveryoneMask);
+        writer.Write(ObjectData.NextOwnerMask);
+        writer.WriteVariable1(ObjectData.Name);
+        writer.WriteVariable1(ObjectData.Description);
+    }
+
+    bool RezMultipleAttachmentsFromInv::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(HeaderData.CompoundMsgID);
+        reader.Read(HeaderData.TotalObjects);
+        reader.Read(HeaderData.FirstDetachAll);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ItemID);
+            reader.Read(ObjectData[i].OwnerID);
+            reader.Read(ObjectData[i].AttachmentPt);
+            reader.Read(ObjectData[i].ItemFlags);
+            reader.Read(ObjectData[i].GroupMask);
+            reader.Read(ObjectData[i].EveryoneMask);
+            reader.Read(ObjectData[i].NextOwnerMask);
+            reader.ReadVariable1(ObjectData[i].Name);
+            reader.ReadVariable1(ObjectData[i].Description);
+        }
+        return reader.IsValid();
+    }
+
+    void RezMultipleAttachmentsFromInv::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(HeaderData.CompoundMsgID);
+        writer.Write(HeaderData.TotalObjects);
+        writer.Write(HeaderData.FirstDetachAll);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ItemID);
+            writer.Write(ObjectData[i].OwnerID);
+            writer.Write(ObjectData[i].AttachmentPt);
+            writer.Write(ObjectData[i].ItemFlags);
+            writer.Write(ObjectData[i].GroupMask);
+            writer.Write(ObjectData[i].EveryoneMask);
+            writer.Write(ObjectData[i].NextOwnerMask);
+            writer.WriteVariable1(ObjectData[i].Name);
+            writer.WriteVariable1(ObjectData[i].Description);
+        }
+    }
+
+    bool DetachAttachmentIntoInv::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ObjectData.AgentID);
+        reader.Read(ObjectData.ItemID);
+        return reader.IsValid();
+    }
+
+    void DetachAttachmentIntoInv::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ObjectData.AgentID);
+        writer.Write(ObjectData.ItemID);
+    }
+
+    bool CreateNewOutfitAttachments::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(HeaderData.NewFolderID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].OldItemID);
+            reader.Read(ObjectData[i].OldFolderID);
+        }
+        return reader.IsValid();
+    }
+
+    void CreateNewOutfitAttachments::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(HeaderData.NewFolderID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].OldItemID);
+            writer.Write(ObjectData[i].OldFolderID);
+        }
+    }
+
+    bool UserInfoRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        return reader.IsValid();
+    }
+
+    void UserInfoRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+    }
+
+    bool UserInfoReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(UserData.IMViaEMail);
+        reader.ReadVariable1(UserData.DirectoryVisibility);
+        reader.ReadVariable2(UserData.EMail);
+        return reader.IsValid();
+    }
+
+    void UserInfoReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(UserData.IMViaEMail);
+        writer.WriteVariable1(UserData.DirectoryVisibility);
+        writer.WriteVariable2(UserData.EMail);
+    }
+
+    bool UpdateUserInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(UserData.IMViaEMail);
+        reader.ReadVariable1(UserData.DirectoryVisibility);
+        return reader.IsValid();
+    }
+
+    void UpdateUserInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(UserData.IMViaEMail);
+        writer.WriteVariable1(UserData.DirectoryVisibility);
+    }
+
+    bool ParcelRename::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        ParcelData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            reader.Read(ParcelData[i].ParcelID);
+            reader.ReadVariable1(ParcelData[i].NewName);
+        }
+        return reader.IsValid();
+    }
+
+    void ParcelRename::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(ParcelData.size());
+        for(size_t i = 0; i < ParcelData.size(); ++i)
+        {
+            writer.Write(ParcelData[i].ParcelID);
+            writer.WriteVariable1(ParcelData[i].NewName);
+        }
+    }
+
+    bool InitiateDownload::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.ReadVariable1(FileData.SimFilename);
+        reader.ReadVariable1(FileData.ViewerFilename);
+        return reader.IsValid();
+    }
+
+    void InitiateDownload::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.WriteVariable1(FileData.SimFilename);
+        writer.WriteVariable1(FileData.ViewerFilename);
+    }
+
+    bool SystemMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(MethodData.Method);
+        reader.Read(MethodData.Invoice);
+        reader.ReadFixed(MethodData.Digest, 32);
+        ParamList.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            reader.ReadVariable1(ParamList[i].Parameter);
+        }
+        return reader.IsValid();
+    }
+
+    void SystemMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(MethodData.Method);
+        writer.Write(MethodData.Invoice);
+        writer.WriteFixed(MethodData.Digest, 32);
+        writer.WriteBlockCount(ParamList.size());
+        for(size_t i = 0; i < ParamList.size(); ++i)
+        {
+            writer.WriteVariable1(ParamList[i].Parameter);
+        }
+    }
+
+    bool MapLayerRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Flags);
+        reader.Read(AgentData.EstateID);
+        reader.Read(AgentData.Godlike);
+        return reader.IsValid();
+    }
+
+    void MapLayerRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Flags);
+        writer.Write(AgentData.EstateID);
+        writer.Write(AgentData.Godlike);
+    }
+
+    bool MapLayerReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.Flags);
+        LayerData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < LayerData.size(); ++i)
+        {
+            reader.Read(LayerData[i].Left);
+            reader.Read(LayerData[i].Right);
+            reader.Read(LayerData[i].Top);
+            reader.Read(LayerData[i].Bottom);
+            reader.Read(LayerData[i].ImageID);
+        }
+        return reader.IsValid();
+    }
+
+    void MapLayerReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.Flags);
+        writer.WriteBlockCount(LayerData.size());
+        for(size_t i = 0; i < LayerData.size(); ++i)
+        {
+            writer.Write(LayerData[i].Left);
+            writer.Write(LayerData[i].Right);
+            writer.Write(LayerData[i].Top);
+            writer.Write(LayerData[i].Bottom);
+            writer.Write(LayerData[i].ImageID);
+        }
+    }
+
+    bool MapBlockRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Flags);
+        reader.Read(AgentData.EstateID);
+        reader.Read(AgentData.Godlike);
+        reader.Read(PositionData.MinX);
+        reader.Read(PositionData.MaxX);
+        reader.Read(PositionData.MinY);
+        reader.Read(PositionData.MaxY);
+        return reader.IsValid();
+    }
+
+    void MapBlockRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Flags);
+        writer.Write(AgentData.EstateID);
+        writer.Write(AgentData.Godlike);
+        writer.Write(PositionData.MinX);
+        writer.Write(PositionData.MaxX);
+        writer.Write(PositionData.MinY);
+        writer.Write(PositionData.MaxY);
+    }
+
+    bool MapNameRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Flags);
+        reader.Read(AgentData.EstateID);
+        reader.Read(AgentData.Godlike);
+        reader.ReadVariable1(NameData.Name);
+        return reader.IsValid();
+    }
+
+    void MapNameRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Flags);
+        writer.Write(AgentData.EstateID);
+        writer.Write(AgentData.Godlike);
+        writer.WriteVariable1(NameData.Name);
+    }
+
+    bool MapBlockReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.Flags);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].X);
+            reader.Read(Data[i].Y);
+            reader.ReadVariable1(Data[i].Name);
+            reader.Read(Data[i].Access);
+            reader.Read(Data[i].RegionFlags);
+            reader.Read(Data[i].WaterHeight);
+            reader.Read(Data[i].Agents);
+            reader.Read(Data[i].MapImageID);
+        }
+        return reader.IsValid();
+    }
+
+    void MapBlockReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.Flags);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].X);
+            writer.Write(Data[i].Y);
+            writer.WriteVariable1(Data[i].Name);
+            writer.Write(Data[i].Access);
+            writer.Write(Data[i].RegionFlags);
+            writer.Write(Data[i].WaterHeight);
+            writer.Write(Data[i].Agents);
+            writer.Write(Data[i].MapImageID);
+        }
+    }
+
+    bool MapItemRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.Flags);
+        reader.Read(AgentData.EstateID);
+        reader.Read(AgentData.Godlike);
+        reader.Read(RequestData.ItemType);
+        reader.Read(RequestData.RegionHandle);
+        return reader.IsValid();
+    }
+
+    void MapItemRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.Flags);
+        writer.Write(AgentData.EstateID);
+        writer.Write(AgentData.Godlike);
+        writer.Write(RequestData.ItemType);
+        writer.Write(RequestData.RegionHandle);
+    }
+
+    bool MapItemReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.Flags);
+        reader.Read(RequestData.ItemType);
+        Data.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            reader.Read(Data[i].X);
+            reader.Read(Data[i].Y);
+            reader.Read(Data[i].ID);
+            reader.Read(Data[i].Extra);
+            reader.Read(Data[i].Extra2);
+            reader.ReadVariable1(Data[i].Name);
+        }
+        return reader.IsValid();
+    }
+
+    void MapItemReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.Flags);
+        writer.Write(RequestData.ItemType);
+        writer.WriteBlockCount(Data.size());
+        for(size_t i = 0; i < Data.size(); ++i)
+        {
+            writer.Write(Data[i].X);
+            writer.Write(Data[i].Y);
+            writer.Write(Data[i].ID);
+            writer.Write(Data[i].Extra);
+            writer.Write(Data[i].Extra2);
+            writer.WriteVariable1(Data[i].Name);
+        }
+    }
+
+    bool SendPostcard::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(AgentData.AssetID);
+        reader.Read(AgentData.PosGlobal);
+        reader.ReadVariable1(AgentData.To);
+        reader.ReadVariable1(AgentData.From);
+        reader.ReadVariable1(AgentData.Name);
+        reader.ReadVariable1(AgentData.Subject);
+        reader.ReadVariable2(AgentData.Msg);
+        reader.Read(AgentData.AllowPublish);
+        reader.Read(AgentData.MaturePublish);
+        return reader.IsValid();
+    }
+
+    void SendPostcard::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(AgentData.AssetID);
+        writer.Write(AgentData.PosGlobal);
+        writer.WriteVariable1(AgentData.To);
+        writer.WriteVariable1(AgentData.From);
+        writer.WriteVariable1(AgentData.Name);
+        writer.WriteVariable1(AgentData.Subject);
+        writer.WriteVariable2(AgentData.Msg);
+        writer.Write(AgentData.AllowPublish);
+        writer.Write(AgentData.MaturePublish);
+    }
+
+    bool RpcChannelRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.GridX);
+        reader.Read(DataBlock.GridY);
+        reader.Read(DataBlock.TaskID);
+        reader.Read(DataBlock.ItemID);
+        return reader.IsValid();
+    }
+
+    void RpcChannelRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.GridX);
+        writer.Write(DataBlock.GridY);
+        writer.Write(DataBlock.TaskID);
+        writer.Write(DataBlock.ItemID);
+    }
+
+    bool RpcChannelReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.TaskID);
+        reader.Read(DataBlock.ItemID);
+        reader.Read(DataBlock.ChannelID);
+        return reader.IsValid();
+    }
+
+    void RpcChannelReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.TaskID);
+        writer.Write(DataBlock.ItemID);
+        writer.Write(DataBlock.ChannelID);
+    }
+
+    bool RpcScriptRequestInbound::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(TargetBlock.GridX);
+        reader.Read(TargetBlock.GridY);
+        reader.Read(DataBlock.TaskID);
+        reader.Read(DataBlock.ItemID);
+        reader.Read(DataBlock.ChannelID);
+        reader.Read(DataBlock.IntValue);
+        reader.ReadVariable2(DataBlock.StringValue);
+        return reader.IsValid();
+    }
+
+    void RpcScriptRequestInbound::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(TargetBlock.GridX);
+        writer.Write(TargetBlock.GridY);
+        writer.Write(DataBlock.TaskID);
+        writer.Write(DataBlock.ItemID);
+        writer.Write(DataBlock.ChannelID);
+        writer.Write(DataBlock.IntValue);
+        writer.WriteVariable2(DataBlock.StringValue);
+    }
+
+    bool RpcScriptRequestInboundForward::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.RPCServerIP);
+        reader.Read(DataBlock.RPCServerPort);
+        reader.Read(DataBlock.TaskID);
+        reader.Read(DataBlock.ItemID);
+        reader.Read(DataBlock.ChannelID);
+        reader.Read(DataBlock.IntValue);
+        reader.ReadVariable2(DataBlock.StringValue);
+        return reader.IsValid();
+    }
+
+    void RpcScriptRequestInboundForward::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.RPCServerIP);
+        writer.Write(DataBlock.RPCServerPort);
+        writer.Write(DataBlock.TaskID);
+        writer.Write(DataBlock.ItemID);
+        writer.Write(DataBlock.ChannelID);
+        writer.Write(DataBlock.IntValue);
+        writer.WriteVariable2(DataBlock.StringValue);
+    }
+
+    bool RpcScriptReplyInbound::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(DataBlock.TaskID);
+        reader.Read(DataBlock.ItemID);
+        reader.Read(DataBlock.ChannelID);
+        reader.Read(DataBlock.IntValue);
+        reader.ReadVariable2(DataBlock.StringValue);
+        return reader.IsValid();
+    }
+
+    void RpcScriptReplyInbound::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(DataBlock.TaskID);
+        writer.Write(DataBlock.ItemID);
+        writer.Write(DataBlock.ChannelID);
+        writer.Write(DataBlock.IntValue);
+        writer.WriteVariable2(DataBlock.StringValue);
+    }
+
+    bool ScriptMailRegistration::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(DataBlock.TargetIP);
+        reader.Read(DataBlock.TargetPort);
+        reader.Read(DataBlock.TaskID);
+        reader.Read(DataBlock.Flags);
+        return reader.IsValid();
+    }
+
+    void ScriptMailRegistration::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(DataBlock.TargetIP);
+        writer.Write(DataBlock.TargetPort);
+        writer.Write(DataBlock.TaskID);
+        writer.Write(DataBlock.Flags);
+    }
+
+    bool ParcelMediaCommandMessage::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(CommandBlock.Flags);
+        reader.Read(CommandBlock.Command);
+        reader.Read(CommandBlock.Time);
+        return reader.IsValid();
+    }
+
+    void ParcelMediaCommandMessage::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(CommandBlock.Flags);
+        writer.Write(CommandBlock.Command);
+        writer.Write(CommandBlock.Time);
+    }
+
+    bool ParcelMediaUpdate::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.ReadVariable1(DataBlock.MediaURL);
+        reader.Read(DataBlock.MediaID);
+        reader.Read(DataBlock.MediaAutoScale);
+        reader.ReadVariable1(DataBlockExtended.MediaType);
+        reader.ReadVariable1(DataBlockExtended.MediaDesc);
+        reader.Read(DataBlockExtended.MediaWidth);
+        reader.Read(DataBlockExtended.MediaHeight);
+        reader.Read(DataBlockExtended.MediaLoop);
+        return reader.IsValid();
+    }
+
+    void ParcelMediaUpdate::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteVariable1(DataBlock.MediaURL);
+        writer.Write(DataBlock.MediaID);
+        writer.Write(DataBlock.MediaAutoScale);
+        writer.WriteVariable1(DataBlockExtended.MediaType);
+        writer.WriteVariable1(DataBlockExtended.MediaDesc);
+        writer.Write(DataBlockExtended.MediaWidth);
+        writer.Write(DataBlockExtended.MediaHeight);
+        writer.Write(DataBlockExtended.MediaLoop);
+    }
+
+    bool LandStatRequest::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        reader.Read(RequestData.ReportType);
+        reader.Read(RequestData.RequestFlags);
+        reader.ReadVariable1(RequestData.Filter);
+        reader.Read(RequestData.ParcelLocalID);
+        return reader.IsValid();
+    }
+
+    void LandStatRequest::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.Write(RequestData.ReportType);
+        writer.Write(RequestData.RequestFlags);
+        writer.WriteVariable1(RequestData.Filter);
+        writer.Write(RequestData.ParcelLocalID);
+    }
+
+    bool LandStatReply::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(RequestData.ReportType);
+        reader.Read(RequestData.RequestFlags);
+        reader.Read(RequestData.TotalObjectCount);
+        ReportData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ReportData.size(); ++i)
+        {
+            reader.Read(ReportData[i].TaskLocalID);
+            reader.Read(ReportData[i].TaskID);
+            reader.Read(ReportData[i].LocationX);
+            reader.Read(ReportData[i].LocationY);
+            reader.Read(ReportData[i].LocationZ);
+            reader.Read(ReportData[i].Score);
+            reader.ReadVariable1(ReportData[i].TaskName);
+            reader.ReadVariable1(ReportData[i].OwnerName);
+        }
+        return reader.IsValid();
+    }
+
+    void LandStatReply::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(RequestData.ReportType);
+        writer.Write(RequestData.RequestFlags);
+        writer.Write(RequestData.TotalObjectCount);
+        writer.WriteBlockCount(ReportData.size());
+        for(size_t i = 0; i < ReportData.size(); ++i)
+        {
+            writer.Write(ReportData[i].TaskLocalID);
+            writer.Write(ReportData[i].TaskID);
+            writer.Write(ReportData[i].LocationX);
+            writer.Write(ReportData[i].LocationY);
+            writer.Write(ReportData[i].LocationZ);
+            writer.Write(ReportData[i].Score);
+            writer.WriteVariable1(ReportData[i].TaskName);
+            writer.WriteVariable1(ReportData[i].OwnerName);
+        }
+    }
+
+    bool Error::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(Data.Code);
+        reader.ReadVariable1(Data.Token);
+        reader.Read(Data.ID);
+        reader.ReadVariable1(Data.System);
+        reader.ReadVariable2(Data.Message);
+        reader.ReadVariable2(Data.Data);
+        return reader.IsValid();
+    }
+
+    void Error::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(Data.Code);
+        writer.WriteVariable1(Data.Token);
+        writer.Write(Data.ID);
+        writer.WriteVariable1(Data.System);
+        writer.WriteVariable2(Data.Message);
+        writer.WriteVariable2(Data.Data);
+    }
+
+    bool ObjectIncludeInSearch::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(AgentData.AgentID);
+        reader.Read(AgentData.SessionID);
+        ObjectData.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            reader.Read(ObjectData[i].ObjectLocalID);
+            reader.Read(ObjectData[i].IncludeInSearch);
+        }
+        return reader.IsValid();
+    }
+
+    void ObjectIncludeInSearch::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(AgentData.AgentID);
+        writer.Write(AgentData.SessionID);
+        writer.WriteBlockCount(ObjectData.size());
+        for(size_t i = 0; i < ObjectData.size(); ++i)
+        {
+            writer.Write(ObjectData[i].ObjectLocalID);
+            writer.Write(ObjectData[i].IncludeInSearch);
+        }
+    }
+
+    bool RexImageInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(ImageInfo.ImageID);
+        reader.ReadVariable1(ImageInfo.MediaURL);
+        return reader.IsValid();
+    }
+
+    void RexImageInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(ImageInfo.ImageID);
+        writer.WriteVariable1(ImageInfo.MediaURL);
+    }
+
+    bool RexSkyboxInfo::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(Textures.FrontTextureID);
+        reader.Read(Textures.BackTextureID);
+        reader.Read(Textures.LeftTextureID);
+        reader.Read(Textures.RightTextureID);
+        reader.Read(Textures.TopTextureID);
+        reader.Read(Textures.BottomTextureID);
+        return reader.IsValid();
+    }
+
+    void RexSkyboxInfo::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(Textures.FrontTextureID);
+        writer.Write(Textures.BackTextureID);
+        writer.Write(Textures.LeftTextureID);
+        writer.Write(Textures.RightTextureID);
+        writer.Write(Textures.TopTextureID);
+        writer.Write(Textures.BottomTextureID);
+    }
+
+    bool PacketAck::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        Packets.resize(reader.ReadBlockCount());
+        for(size_t i = 0; i < Packets.size(); ++i)
+        {
+            reader.Read(Packets[i].ID);
+        }
+        return reader.IsValid();
+    }
+
+    void PacketAck::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.WriteBlockCount(Packets.size());
+        for(size_t i = 0; i < Packets.size(); ++i)
+        {
+            writer.Write(Packets[i].ID);
+        }
+    }
+
+    bool OpenCircuit::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        reader.Read(CircuitInfo.IP);
+        reader.Read(CircuitInfo.Port);
+        return reader.IsValid();
+    }
+
+    void OpenCircuit::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+        writer.Write(CircuitInfo.IP);
+        writer.Write(CircuitInfo.Port);
+    }
+
+    bool CloseCircuit::Decode(const uint8_t *data, size_t numBytes)
+    {
+        MessageReader reader(data, numBytes);
+        return reader.IsValid();
+    }
+
+    void CloseCircuit::Encode(NetOutMessage &msg) const
+    {
+        assert(msg.GetMessageID() == cMessageID);
+        MessageWriter writer(msg);
+    }
+
+}
+}
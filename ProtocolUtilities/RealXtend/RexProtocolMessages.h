@@ -0,0 +1,11355 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+/* This file defines a struct for each message used in the protocol, with functions for decoding the
+message straight from the received bytes and encoding it into an outbound message:
+
+bool Decode(const uint8_t *data, size_t numBytes) decodes the message content after the message ID, i.e.
+NetInMessage::GetData(). Returns false if the message was shorter than its definition requires. Buffers are
+decoded as views into the data, so they are only valid as long as the data is. Reuse the struct to avoid
+reallocating the variable blocks.
+
+void Encode(NetOutMessage &msg) const encodes the message content to a message started with
+NetMessageManager::StartNewMessage().
+
+This file is automatically generated from the message template file by NetMessageList::GenerateCodecFiles,
+so no point modifying it here. */
+
+#ifndef incl_RexProtocolMessages_h
+#define incl_RexProtocolMessages_h
+
+#include <vector>
+
+#include "NetworkMessages/MessageCodec.h"
+
+namespace ProtocolUtilities
+{
+namespace Messages
+{
+
+    /// StartPingCheck, unencoded.
+    struct StartPingCheck
+    {
+        static const NetMsgID cMessageID = 0x1;
+
+        struct PingIDBlock
+        {
+            uint8_t PingID;
+            uint32_t OldestUnacked;
+        };
+        PingIDBlock PingID;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CompletePingCheck, unencoded.
+    struct CompletePingCheck
+    {
+        static const NetMsgID cMessageID = 0x2;
+
+        struct PingIDBlock
+        {
+            uint8_t PingID;
+        };
+        PingIDBlock PingID;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// NeighborList, unencoded.
+    struct NeighborList
+    {
+        static const NetMsgID cMessageID = 0x3;
+
+        struct NeighborBlockBlock
+        {
+            uint32_t IP;
+            uint16_t Port;
+            uint32_t PublicIP;
+            uint16_t PublicPort;
+            RexUUID RegionID;
+            BufferView Name;
+            uint8_t SimAccess;
+        };
+        NeighborBlockBlock NeighborBlock[4];
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentUpdate, zero-encoded.
+    struct AgentUpdate
+    {
+        static const NetMsgID cMessageID = 0x4;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            Quaternion BodyRotation;
+            Quaternion HeadRotation;
+            uint8_t State;
+            Vector3 CameraCenter;
+            Vector3 CameraAtAxis;
+            Vector3 CameraLeftAxis;
+            Vector3 CameraUpAxis;
+            float Far;
+            uint32_t ControlFlags;
+            uint8_t Flags;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentAnimation, unencoded.
+    struct AgentAnimation
+    {
+        static const NetMsgID cMessageID = 0x5;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct AnimationListBlock
+        {
+            RexUUID AnimID;
+            bool StartAnim;
+        };
+        std::vector<AnimationListBlock> AnimationList;
+
+        struct PhysicalAvatarEventListBlock
+        {
+            BufferView TypeData;
+        };
+        std::vector<PhysicalAvatarEventListBlock> PhysicalAvatarEventList;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentRequestSit, zero-encoded.
+    struct AgentRequestSit
+    {
+        static const NetMsgID cMessageID = 0x6;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TargetObjectBlock
+        {
+            RexUUID TargetID;
+            Vector3 Offset;
+        };
+        TargetObjectBlock TargetObject;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentSit, unencoded.
+    struct AgentSit
+    {
+        static const NetMsgID cMessageID = 0x7;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestImage, unencoded.
+    struct RequestImage
+    {
+        static const NetMsgID cMessageID = 0x8;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RequestImageBlock
+        {
+            RexUUID Image;
+            int8_t DiscardLevel;
+            float DownloadPriority;
+            uint32_t Packet;
+            uint8_t Type;
+        };
+        std::vector<RequestImageBlock> RequestImage_;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ImageData, unencoded.
+    struct ImageData
+    {
+        static const NetMsgID cMessageID = 0x9;
+
+        struct ImageIDBlock
+        {
+            RexUUID ID;
+            uint8_t Codec;
+            uint32_t Size;
+            uint16_t Packets;
+        };
+        ImageIDBlock ImageID;
+
+        struct ImageDataBlock
+        {
+            BufferView Data;
+        };
+        ImageDataBlock ImageData_;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ImagePacket, unencoded.
+    struct ImagePacket
+    {
+        static const NetMsgID cMessageID = 0xa;
+
+        struct ImageIDBlock
+        {
+            RexUUID ID;
+            uint16_t Packet;
+        };
+        ImageIDBlock ImageID;
+
+        struct ImageDataBlock
+        {
+            BufferView Data;
+        };
+        ImageDataBlock ImageData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LayerData, unencoded.
+    struct LayerData
+    {
+        static const NetMsgID cMessageID = 0xb;
+
+        struct LayerIDBlock
+        {
+            uint8_t Type;
+        };
+        LayerIDBlock LayerID;
+
+        struct LayerDataBlock
+        {
+            BufferView Data;
+        };
+        LayerDataBlock LayerData_;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectUpdate, zero-encoded.
+    struct ObjectUpdate
+    {
+        static const NetMsgID cMessageID = 0xc;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+            uint16_t TimeDilation;
+        };
+        RegionDataBlock RegionData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ID;
+            uint8_t State;
+            RexUUID FullID;
+            uint32_t CRC;
+            uint8_t PCode;
+            uint8_t Material;
+            uint8_t ClickAction;
+            Vector3 Scale;
+            BufferView ObjectData;
+            uint32_t ParentID;
+            uint32_t UpdateFlags;
+            uint8_t PathCurve;
+            uint8_t ProfileCurve;
+            uint16_t PathBegin;
+            uint16_t PathEnd;
+            uint8_t PathScaleX;
+            uint8_t PathScaleY;
+            uint8_t PathShearX;
+            uint8_t PathShearY;
+            int8_t PathTwist;
+            int8_t PathTwistBegin;
+            int8_t PathRadiusOffset;
+            int8_t PathTaperX;
+            int8_t PathTaperY;
+            uint8_t PathRevolutions;
+            int8_t PathSkew;
+            uint16_t ProfileBegin;
+            uint16_t ProfileEnd;
+            uint16_t ProfileHollow;
+            BufferView TextureEntry;
+            BufferView TextureAnim;
+            BufferView NameValue;
+            BufferView Data;
+            BufferView Text;
+            BufferView TextColor;
+            BufferView MediaURL;
+            BufferView PSBlock;
+            BufferView ExtraParams;
+            RexUUID Sound;
+            RexUUID OwnerID;
+            float Gain;
+            uint8_t Flags;
+            float Radius;
+            uint8_t JointType;
+            Vector3 JointPivot;
+            Vector3 JointAxisOrAnchor;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectUpdateCompressed, unencoded.
+    struct ObjectUpdateCompressed
+    {
+        static const NetMsgID cMessageID = 0xd;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+            uint16_t TimeDilation;
+        };
+        RegionDataBlock RegionData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t UpdateFlags;
+            BufferView Data;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectUpdateCached, unencoded.
+    struct ObjectUpdateCached
+    {
+        static const NetMsgID cMessageID = 0xe;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+            uint16_t TimeDilation;
+        };
+        RegionDataBlock RegionData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ID;
+            uint32_t CRC;
+            uint32_t UpdateFlags;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ImprovedTerseObjectUpdate, unencoded.
+    struct ImprovedTerseObjectUpdate
+    {
+        static const NetMsgID cMessageID = 0xf;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+            uint16_t TimeDilation;
+        };
+        RegionDataBlock RegionData;
+
+        struct ObjectDataBlock
+        {
+            BufferView Data;
+            BufferView TextureEntry;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// KillObject, unencoded.
+    struct KillObject
+    {
+        static const NetMsgID cMessageID = 0x10;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TransferPacket, unencoded.
+    struct TransferPacket
+    {
+        static const NetMsgID cMessageID = 0x11;
+
+        struct TransferDataBlock
+        {
+            RexUUID TransferID;
+            int32_t ChannelType;
+            int32_t Packet;
+            int32_t Status;
+            BufferView Data;
+        };
+        TransferDataBlock TransferData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SendXferPacket, unencoded.
+    struct SendXferPacket
+    {
+        static const NetMsgID cMessageID = 0x12;
+
+        struct XferIDBlock
+        {
+            uint64_t ID;
+            uint32_t Packet;
+        };
+        XferIDBlock XferID;
+
+        struct DataPacketBlock
+        {
+            BufferView Data;
+        };
+        DataPacketBlock DataPacket;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ConfirmXferPacket, unencoded.
+    struct ConfirmXferPacket
+    {
+        static const NetMsgID cMessageID = 0x13;
+
+        struct XferIDBlock
+        {
+            uint64_t ID;
+            uint32_t Packet;
+        };
+        XferIDBlock XferID;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarAnimation, unencoded.
+    struct AvatarAnimation
+    {
+        static const NetMsgID cMessageID = 0x14;
+
+        struct SenderBlock
+        {
+            RexUUID ID;
+        };
+        SenderBlock Sender;
+
+        struct AnimationListBlock
+        {
+            RexUUID AnimID;
+            int32_t AnimSequenceID;
+        };
+        std::vector<AnimationListBlock> AnimationList;
+
+        struct AnimationSourceListBlock
+        {
+            RexUUID ObjectID;
+        };
+        std::vector<AnimationSourceListBlock> AnimationSourceList;
+
+        struct PhysicalAvatarEventListBlock
+        {
+            BufferView TypeData;
+        };
+        std::vector<PhysicalAvatarEventListBlock> PhysicalAvatarEventList;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarSitResponse, zero-encoded.
+    struct AvatarSitResponse
+    {
+        static const NetMsgID cMessageID = 0x15;
+
+        struct SitObjectBlock
+        {
+            RexUUID ID;
+        };
+        SitObjectBlock SitObject;
+
+        struct SitTransformBlock
+        {
+            bool AutoPilot;
+            Vector3 SitPosition;
+            Quaternion SitRotation;
+            Vector3 CameraEyeOffset;
+            Vector3 CameraAtOffset;
+            bool ForceMouselook;
+        };
+        SitTransformBlock SitTransform;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CameraConstraint, zero-encoded.
+    struct CameraConstraint
+    {
+        static const NetMsgID cMessageID = 0x16;
+
+        struct CameraCollidePlaneBlock
+        {
+            Vector4 Plane;
+        };
+        CameraCollidePlaneBlock CameraCollidePlane;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelProperties, zero-encoded.
+    struct ParcelProperties
+    {
+        static const NetMsgID cMessageID = 0x17;
+
+        struct ParcelDataBlock
+        {
+            int32_t RequestResult;
+            int32_t SequenceID;
+            bool SnapSelection;
+            int32_t SelfCount;
+            int32_t OtherCount;
+            int32_t PublicCount;
+            int32_t LocalID;
+            RexUUID OwnerID;
+            bool IsGroupOwned;
+            uint32_t AuctionID;
+            int32_t ClaimDate;
+            int32_t ClaimPrice;
+            int32_t RentPrice;
+            Vector3 AABBMin;
+            Vector3 AABBMax;
+            BufferView Bitmap;
+            int32_t Area;
+            uint8_t Status;
+            int32_t SimWideMaxPrims;
+            int32_t SimWideTotalPrims;
+            int32_t MaxPrims;
+            int32_t TotalPrims;
+            int32_t OwnerPrims;
+            int32_t GroupPrims;
+            int32_t OtherPrims;
+            int32_t SelectedPrims;
+            float ParcelPrimBonus;
+            int32_t OtherCleanTime;
+            uint32_t ParcelFlags;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Desc;
+            BufferView MusicURL;
+            BufferView MediaURL;
+            RexUUID MediaID;
+            uint8_t MediaAutoScale;
+            RexUUID GroupID;
+            int32_t PassPrice;
+            float PassHours;
+            uint8_t Category;
+            RexUUID AuthBuyerID;
+            RexUUID SnapshotID;
+            Vector3 UserLocation;
+            Vector3 UserLookAt;
+            uint8_t LandingType;
+            bool RegionPushOverride;
+            bool RegionDenyAnonymous;
+            bool RegionDenyIdentified;
+            bool RegionDenyTransacted;
+        };
+        ParcelDataBlock ParcelData;
+
+        struct AgeVerificationBlockBlock
+        {
+            bool RegionDenyAgeUnverified;
+        };
+        AgeVerificationBlockBlock AgeVerificationBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EdgeDataPacket, zero-encoded.
+    struct EdgeDataPacket
+    {
+        static const NetMsgID cMessageID = 0x18;
+
+        struct EdgeDataBlock
+        {
+            uint8_t LayerType;
+            uint8_t Direction;
+            BufferView LayerData;
+        };
+        EdgeDataBlock EdgeData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChildAgentUpdate, zero-encoded.
+    struct ChildAgentUpdate
+    {
+        static const NetMsgID cMessageID = 0x19;
+
+        struct AgentDataBlock
+        {
+            uint64_t RegionHandle;
+            uint32_t ViewerCircuitCode;
+            RexUUID AgentID;
+            RexUUID SessionID;
+            Vector3 AgentPos;
+            Vector3 AgentVel;
+            Vector3 Center;
+            Vector3 Size;
+            Vector3 AtAxis;
+            Vector3 LeftAxis;
+            Vector3 UpAxis;
+            bool ChangedGrid;
+            float Far;
+            float Aspect;
+            BufferView Throttles;
+            uint32_t LocomotionState;
+            Quaternion HeadRotation;
+            Quaternion BodyRotation;
+            uint32_t ControlFlags;
+            float EnergyLevel;
+            uint8_t GodLevel;
+            bool AlwaysRun;
+            RexUUID PreyAgent;
+            uint8_t AgentAccess;
+            BufferView AgentTextures;
+            RexUUID ActiveGroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            uint64_t GroupPowers;
+            bool AcceptNotices;
+        };
+        std::vector<GroupDataBlock> GroupData;
+
+        struct AnimationDataBlock
+        {
+            RexUUID Animation;
+            RexUUID ObjectID;
+        };
+        std::vector<AnimationDataBlock> AnimationData;
+
+        struct GranterBlockBlock
+        {
+            RexUUID GranterID;
+        };
+        std::vector<GranterBlockBlock> GranterBlock;
+
+        struct NVPairDataBlock
+        {
+            BufferView NVPairs;
+        };
+        std::vector<NVPairDataBlock> NVPairData;
+
+        struct VisualParamBlock
+        {
+            uint8_t ParamValue;
+        };
+        std::vector<VisualParamBlock> VisualParam;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChildAgentAlive, unencoded.
+    struct ChildAgentAlive
+    {
+        static const NetMsgID cMessageID = 0x1a;
+
+        struct AgentDataBlock
+        {
+            uint64_t RegionHandle;
+            uint32_t ViewerCircuitCode;
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChildAgentPositionUpdate, unencoded.
+    struct ChildAgentPositionUpdate
+    {
+        static const NetMsgID cMessageID = 0x1b;
+
+        struct AgentDataBlock
+        {
+            uint64_t RegionHandle;
+            uint32_t ViewerCircuitCode;
+            RexUUID AgentID;
+            RexUUID SessionID;
+            Vector3 AgentPos;
+            Vector3 AgentVel;
+            Vector3 Center;
+            Vector3 Size;
+            Vector3 AtAxis;
+            Vector3 LeftAxis;
+            Vector3 UpAxis;
+            bool ChangedGrid;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AtomicPassObject, unencoded.
+    struct AtomicPassObject
+    {
+        static const NetMsgID cMessageID = 0x1c;
+
+        struct TaskDataBlock
+        {
+            RexUUID TaskID;
+            bool AttachmentNeedsSave;
+        };
+        TaskDataBlock TaskData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SoundTrigger, unencoded.
+    struct SoundTrigger
+    {
+        static const NetMsgID cMessageID = 0x1d;
+
+        struct SoundDataBlock
+        {
+            RexUUID SoundID;
+            RexUUID OwnerID;
+            RexUUID ObjectID;
+            RexUUID ParentID;
+            uint64_t Handle;
+            Vector3 Position;
+            float Gain;
+        };
+        SoundDataBlock SoundData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectAdd, zero-encoded.
+    struct ObjectAdd
+    {
+        static const NetMsgID cMessageID = 0xff01;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint8_t PCode;
+            uint8_t Material;
+            uint32_t AddFlags;
+            uint8_t PathCurve;
+            uint8_t ProfileCurve;
+            uint16_t PathBegin;
+            uint16_t PathEnd;
+            uint8_t PathScaleX;
+            uint8_t PathScaleY;
+            uint8_t PathShearX;
+            uint8_t PathShearY;
+            int8_t PathTwist;
+            int8_t PathTwistBegin;
+            int8_t PathRadiusOffset;
+            int8_t PathTaperX;
+            int8_t PathTaperY;
+            uint8_t PathRevolutions;
+            int8_t PathSkew;
+            uint16_t ProfileBegin;
+            uint16_t ProfileEnd;
+            uint16_t ProfileHollow;
+            uint8_t BypassRaycast;
+            Vector3 RayStart;
+            Vector3 RayEnd;
+            RexUUID RayTargetID;
+            uint8_t RayEndIsIntersection;
+            Vector3 Scale;
+            Quaternion Rotation;
+            uint8_t State;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MultipleObjectUpdate, zero-encoded.
+    struct MultipleObjectUpdate
+    {
+        static const NetMsgID cMessageID = 0xff02;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            uint8_t Type;
+            BufferView Data;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestMultipleObjects, zero-encoded.
+    struct RequestMultipleObjects
+    {
+        static const NetMsgID cMessageID = 0xff03;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint8_t CacheMissType;
+            uint32_t ID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectPosition, zero-encoded.
+    struct ObjectPosition
+    {
+        static const NetMsgID cMessageID = 0xff04;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            Vector3 Position;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestObjectPropertiesFamily, zero-encoded.
+    struct RequestObjectPropertiesFamily
+    {
+        static const NetMsgID cMessageID = 0xff05;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t RequestFlags;
+            RexUUID ObjectID;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CoarseLocationUpdate, unencoded.
+    struct CoarseLocationUpdate
+    {
+        static const NetMsgID cMessageID = 0xff06;
+
+        struct LocationBlock
+        {
+            uint8_t X;
+            uint8_t Y;
+            uint8_t Z;
+        };
+        std::vector<LocationBlock> Location;
+
+        struct IndexBlock
+        {
+            int16_t You;
+            int16_t Prey;
+        };
+        IndexBlock Index;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        std::vector<AgentDataBlock> AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CrossedRegion, unencoded.
+    struct CrossedRegion
+    {
+        static const NetMsgID cMessageID = 0xff07;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RegionDataBlock
+        {
+            uint32_t SimIP;
+            uint16_t SimPort;
+            uint64_t RegionHandle;
+            BufferView SeedCapability;
+        };
+        RegionDataBlock RegionData;
+
+        struct InfoBlock
+        {
+            Vector3 Position;
+            Vector3 LookAt;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ConfirmEnableSimulator, unencoded.
+    struct ConfirmEnableSimulator
+    {
+        static const NetMsgID cMessageID = 0xff08;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectProperties, zero-encoded.
+    struct ObjectProperties
+    {
+        static const NetMsgID cMessageID = 0xff09;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint64_t CreationDate;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            int32_t OwnershipCost;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            uint8_t AggregatePerms;
+            uint8_t AggregatePermTextures;
+            uint8_t AggregatePermTexturesOwner;
+            uint32_t Category;
+            int16_t InventorySerial;
+            RexUUID ItemID;
+            RexUUID FolderID;
+            RexUUID FromTaskID;
+            RexUUID LastOwnerID;
+            BufferView Name;
+            BufferView Description;
+            BufferView TouchName;
+            BufferView SitName;
+            BufferView TextureID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectPropertiesFamily, zero-encoded.
+    struct ObjectPropertiesFamily
+    {
+        static const NetMsgID cMessageID = 0xff0a;
+
+        struct ObjectDataBlock
+        {
+            uint32_t RequestFlags;
+            RexUUID ObjectID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            int32_t OwnershipCost;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            uint32_t Category;
+            RexUUID LastOwnerID;
+            BufferView Name;
+            BufferView Description;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelPropertiesRequest, zero-encoded.
+    struct ParcelPropertiesRequest
+    {
+        static const NetMsgID cMessageID = 0xff0b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t SequenceID;
+            float West;
+            float South;
+            float East;
+            float North;
+            bool SnapSelection;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimStatus, unencoded.
+    struct SimStatus
+    {
+        static const NetMsgID cMessageID = 0xff0c;
+
+        struct SimStatusBlock
+        {
+            bool CanAcceptAgents;
+            bool CanAcceptTasks;
+        };
+        SimStatusBlock SimStatus_;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AttachedSound, unencoded.
+    struct AttachedSound
+    {
+        static const NetMsgID cMessageID = 0xff0d;
+
+        struct DataBlockBlock
+        {
+            RexUUID SoundID;
+            RexUUID ObjectID;
+            RexUUID OwnerID;
+            float Gain;
+            uint8_t Flags;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AttachedSoundGainChange, unencoded.
+    struct AttachedSoundGainChange
+    {
+        static const NetMsgID cMessageID = 0xff0e;
+
+        struct DataBlockBlock
+        {
+            RexUUID ObjectID;
+            float Gain;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PreloadSound, unencoded.
+    struct PreloadSound
+    {
+        static const NetMsgID cMessageID = 0xff0f;
+
+        struct DataBlockBlock
+        {
+            RexUUID ObjectID;
+            RexUUID OwnerID;
+            RexUUID SoundID;
+        };
+        std::vector<DataBlockBlock> DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// InternalScriptMail, unencoded.
+    struct InternalScriptMail
+    {
+        static const NetMsgID cMessageID = 0xff10;
+
+        struct DataBlockBlock
+        {
+            BufferView From;
+            RexUUID To;
+            BufferView Subject;
+            BufferView Body;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ViewerEffect, zero-encoded.
+    struct ViewerEffect
+    {
+        static const NetMsgID cMessageID = 0xff11;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct EffectBlock
+        {
+            RexUUID ID;
+            RexUUID AgentID;
+            uint8_t Type;
+            float Duration;
+            BufferView Color;
+            BufferView TypeData;
+        };
+        std::vector<EffectBlock> Effect;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TestMessage, zero-encoded.
+    struct TestMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0001;
+
+        struct TestBlock1Block
+        {
+            uint32_t Test1;
+        };
+        TestBlock1Block TestBlock1;
+
+        struct NeighborBlockBlock
+        {
+            uint32_t Test0;
+            uint32_t Test1;
+            uint32_t Test2;
+        };
+        NeighborBlockBlock NeighborBlock[4];
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AddCircuitCode, unencoded.
+    struct AddCircuitCode
+    {
+        static const NetMsgID cMessageID = 0xffff0002;
+
+        struct CircuitCodeBlock
+        {
+            uint32_t Code;
+            RexUUID SessionID;
+            RexUUID AgentID;
+        };
+        CircuitCodeBlock CircuitCode;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UseCircuitCode, unencoded.
+    struct UseCircuitCode
+    {
+        static const NetMsgID cMessageID = 0xffff0003;
+
+        struct CircuitCodeBlock
+        {
+            uint32_t Code;
+            RexUUID SessionID;
+            RexUUID ID;
+        };
+        CircuitCodeBlock CircuitCode;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarTextureUpdate, zero-encoded.
+    struct AvatarTextureUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0004;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            bool TexturesChanged;
+        };
+        AgentDataBlock AgentData;
+
+        struct WearableDataBlock
+        {
+            RexUUID CacheID;
+            uint8_t TextureIndex;
+            BufferView HostName;
+        };
+        std::vector<WearableDataBlock> WearableData;
+
+        struct TextureDataBlock
+        {
+            RexUUID TextureID;
+        };
+        std::vector<TextureDataBlock> TextureData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimulatorMapUpdate, unencoded.
+    struct SimulatorMapUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0005;
+
+        struct MapDataBlock
+        {
+            uint32_t Flags;
+        };
+        MapDataBlock MapData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimulatorSetMap, unencoded.
+    struct SimulatorSetMap
+    {
+        static const NetMsgID cMessageID = 0xffff0006;
+
+        struct MapDataBlock
+        {
+            uint64_t RegionHandle;
+            int32_t Type;
+            RexUUID MapImage;
+        };
+        MapDataBlock MapData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SubscribeLoad, unencoded.
+    struct SubscribeLoad
+    {
+        static const NetMsgID cMessageID = 0xffff0007;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UnsubscribeLoad, unencoded.
+    struct UnsubscribeLoad
+    {
+        static const NetMsgID cMessageID = 0xffff0008;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimulatorReady, zero-encoded.
+    struct SimulatorReady
+    {
+        static const NetMsgID cMessageID = 0xffff0009;
+
+        struct SimulatorBlockBlock
+        {
+            BufferView SimName;
+            uint8_t SimAccess;
+            uint32_t RegionFlags;
+            RexUUID RegionID;
+            uint32_t EstateID;
+            uint32_t ParentEstateID;
+        };
+        SimulatorBlockBlock SimulatorBlock;
+
+        struct TelehubBlockBlock
+        {
+            bool HasTelehub;
+            Vector3 TelehubPos;
+        };
+        TelehubBlockBlock TelehubBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TelehubInfo, unencoded.
+    struct TelehubInfo
+    {
+        static const NetMsgID cMessageID = 0xffff000a;
+
+        struct TelehubBlockBlock
+        {
+            RexUUID ObjectID;
+            BufferView ObjectName;
+            Vector3 TelehubPos;
+            Quaternion TelehubRot;
+        };
+        TelehubBlockBlock TelehubBlock;
+
+        struct SpawnPointBlockBlock
+        {
+            Vector3 SpawnPointPos;
+        };
+        std::vector<SpawnPointBlockBlock> SpawnPointBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimulatorPresentAtLocation, unencoded.
+    struct SimulatorPresentAtLocation
+    {
+        static const NetMsgID cMessageID = 0xffff000b;
+
+        struct SimulatorPublicHostBlockBlock
+        {
+            uint16_t Port;
+            uint32_t SimulatorIP;
+            uint32_t GridX;
+            uint32_t GridY;
+        };
+        SimulatorPublicHostBlockBlock SimulatorPublicHostBlock;
+
+        struct NeighborBlockBlock
+        {
+            uint32_t IP;
+            uint16_t Port;
+        };
+        NeighborBlockBlock NeighborBlock[4];
+
+        struct SimulatorBlockBlock
+        {
+            BufferView SimName;
+            uint8_t SimAccess;
+            uint32_t RegionFlags;
+            RexUUID RegionID;
+            uint32_t EstateID;
+            uint32_t ParentEstateID;
+        };
+        SimulatorBlockBlock SimulatorBlock;
+
+        struct TelehubBlockBlock
+        {
+            bool HasTelehub;
+            Vector3 TelehubPos;
+        };
+        std::vector<TelehubBlockBlock> TelehubBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimulatorLoad, unencoded.
+    struct SimulatorLoad
+    {
+        static const NetMsgID cMessageID = 0xffff000c;
+
+        struct SimulatorLoadBlock
+        {
+            float TimeDilation;
+            int32_t AgentCount;
+            bool CanAcceptAgents;
+        };
+        SimulatorLoadBlock SimulatorLoad_;
+
+        struct AgentListBlock
+        {
+            uint32_t CircuitCode;
+            uint8_t X;
+            uint8_t Y;
+        };
+        std::vector<AgentListBlock> AgentList;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimulatorShutdownRequest, unencoded.
+    struct SimulatorShutdownRequest
+    {
+        static const NetMsgID cMessageID = 0xffff000d;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionPresenceRequestByRegionID, unencoded.
+    struct RegionPresenceRequestByRegionID
+    {
+        static const NetMsgID cMessageID = 0xffff000e;
+
+        struct RegionDataBlock
+        {
+            RexUUID RegionID;
+        };
+        std::vector<RegionDataBlock> RegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionPresenceRequestByHandle, unencoded.
+    struct RegionPresenceRequestByHandle
+    {
+        static const NetMsgID cMessageID = 0xffff000f;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        std::vector<RegionDataBlock> RegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionPresenceResponse, zero-encoded.
+    struct RegionPresenceResponse
+    {
+        static const NetMsgID cMessageID = 0xffff0010;
+
+        struct RegionDataBlock
+        {
+            RexUUID RegionID;
+            uint64_t RegionHandle;
+            uint32_t InternalRegionIP;
+            uint32_t ExternalRegionIP;
+            uint16_t RegionPort;
+            double ValidUntil;
+            BufferView Message;
+        };
+        std::vector<RegionDataBlock> RegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateSimulator, unencoded.
+    struct UpdateSimulator
+    {
+        static const NetMsgID cMessageID = 0xffff0011;
+
+        struct SimulatorInfoBlock
+        {
+            RexUUID RegionID;
+            BufferView SimName;
+            uint32_t EstateID;
+            uint8_t SimAccess;
+        };
+        SimulatorInfoBlock SimulatorInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LogDwellTime, unencoded.
+    struct LogDwellTime
+    {
+        static const NetMsgID cMessageID = 0xffff0012;
+
+        struct DwellInfoBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            float Duration;
+            BufferView SimName;
+            uint32_t RegionX;
+            uint32_t RegionY;
+            uint8_t AvgAgentsInView;
+            uint8_t AvgViewerFPS;
+        };
+        DwellInfoBlock DwellInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// FeatureDisabled, unencoded.
+    struct FeatureDisabled
+    {
+        static const NetMsgID cMessageID = 0xffff0013;
+
+        struct FailureInfoBlock
+        {
+            BufferView ErrorMessage;
+            RexUUID AgentID;
+            RexUUID TransactionID;
+        };
+        FailureInfoBlock FailureInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LogFailedMoneyTransaction, unencoded.
+    struct LogFailedMoneyTransaction
+    {
+        static const NetMsgID cMessageID = 0xffff0014;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+            uint32_t TransactionTime;
+            int32_t TransactionType;
+            RexUUID SourceID;
+            RexUUID DestID;
+            uint8_t Flags;
+            int32_t Amount;
+            uint32_t SimulatorIP;
+            uint32_t GridX;
+            uint32_t GridY;
+            uint8_t FailureType;
+        };
+        TransactionDataBlock TransactionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UserReportInternal, zero-encoded.
+    struct UserReportInternal
+    {
+        static const NetMsgID cMessageID = 0xffff0015;
+
+        struct ReportDataBlock
+        {
+            uint8_t ReportType;
+            uint8_t Category;
+            RexUUID ReporterID;
+            Vector3 ViewerPosition;
+            Vector3 AgentPosition;
+            RexUUID ScreenshotID;
+            RexUUID ObjectID;
+            RexUUID OwnerID;
+            RexUUID LastOwnerID;
+            RexUUID CreatorID;
+            RexUUID RegionID;
+            RexUUID AbuserID;
+            BufferView AbuseRegionName;
+            RexUUID AbuseRegionID;
+            BufferView Summary;
+            BufferView Details;
+            BufferView VersionString;
+        };
+        ReportDataBlock ReportData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetSimStatusInDatabase, unencoded.
+    struct SetSimStatusInDatabase
+    {
+        static const NetMsgID cMessageID = 0xffff0016;
+
+        struct DataBlock
+        {
+            RexUUID RegionID;
+            BufferView HostName;
+            int32_t X;
+            int32_t Y;
+            int32_t PID;
+            int32_t AgentCount;
+            int32_t TimeToLive;
+            BufferView Status;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetSimPresenceInDatabase, unencoded.
+    struct SetSimPresenceInDatabase
+    {
+        static const NetMsgID cMessageID = 0xffff0017;
+
+        struct SimDataBlock
+        {
+            RexUUID RegionID;
+            BufferView HostName;
+            uint32_t GridX;
+            uint32_t GridY;
+            int32_t PID;
+            int32_t AgentCount;
+            int32_t TimeToLive;
+            BufferView Status;
+        };
+        SimDataBlock SimData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EconomyDataRequest, unencoded.
+    struct EconomyDataRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0018;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EconomyData, zero-encoded.
+    struct EconomyData
+    {
+        static const NetMsgID cMessageID = 0xffff0019;
+
+        struct InfoBlock
+        {
+            int32_t ObjectCapacity;
+            int32_t ObjectCount;
+            int32_t PriceEnergyUnit;
+            int32_t PriceObjectClaim;
+            int32_t PricePublicObjectDecay;
+            int32_t PricePublicObjectDelete;
+            int32_t PriceParcelClaim;
+            float PriceParcelClaimFactor;
+            int32_t PriceUpload;
+            int32_t PriceRentLight;
+            int32_t TeleportMinPrice;
+            float TeleportPriceExponent;
+            float EnergyEfficiency;
+            float PriceObjectRent;
+            float PriceObjectScaleFactor;
+            int32_t PriceParcelRent;
+            int32_t PriceGroupCreate;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPickerRequest, unencoded.
+    struct AvatarPickerRequest
+    {
+        static const NetMsgID cMessageID = 0xffff001a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID QueryID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            BufferView Name;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPickerRequestBackend, unencoded.
+    struct AvatarPickerRequestBackend
+    {
+        static const NetMsgID cMessageID = 0xffff001b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID QueryID;
+            uint8_t GodLevel;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            BufferView Name;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPickerReply, unencoded.
+    struct AvatarPickerReply
+    {
+        static const NetMsgID cMessageID = 0xffff001c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID QueryID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID AvatarID;
+            BufferView FirstName;
+            BufferView LastName;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PlacesQuery, zero-encoded.
+    struct PlacesQuery
+    {
+        static const NetMsgID cMessageID = 0xffff001d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID QueryID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionDataBlock TransactionData;
+
+        struct QueryDataBlock
+        {
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            int8_t Category;
+            BufferView SimName;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PlacesReply, zero-encoded.
+    struct PlacesReply
+    {
+        static const NetMsgID cMessageID = 0xffff001e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID QueryID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionDataBlock TransactionData;
+
+        struct QueryDataBlock
+        {
+            RexUUID OwnerID;
+            BufferView Name;
+            BufferView Desc;
+            int32_t ActualArea;
+            int32_t BillableArea;
+            uint8_t Flags;
+            float GlobalX;
+            float GlobalY;
+            float GlobalZ;
+            BufferView SimName;
+            RexUUID SnapshotID;
+            float Dwell;
+            int32_t Price;
+        };
+        std::vector<QueryDataBlock> QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirFindQuery, zero-encoded.
+    struct DirFindQuery
+    {
+        static const NetMsgID cMessageID = 0xffff001f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            int32_t QueryStart;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirFindQueryBackend, zero-encoded.
+    struct DirFindQueryBackend
+    {
+        static const NetMsgID cMessageID = 0xffff0020;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            int32_t QueryStart;
+            uint32_t EstateID;
+            bool Godlike;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirPlacesQuery, zero-encoded.
+    struct DirPlacesQuery
+    {
+        static const NetMsgID cMessageID = 0xffff0021;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            int8_t Category;
+            BufferView SimName;
+            int32_t QueryStart;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirPlacesQueryBackend, zero-encoded.
+    struct DirPlacesQueryBackend
+    {
+        static const NetMsgID cMessageID = 0xffff0022;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            int8_t Category;
+            BufferView SimName;
+            uint32_t EstateID;
+            bool Godlike;
+            int32_t QueryStart;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirPlacesReply, zero-encoded.
+    struct DirPlacesReply
+    {
+        static const NetMsgID cMessageID = 0xffff0023;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        std::vector<QueryDataBlock> QueryData;
+
+        struct QueryRepliesBlock
+        {
+            RexUUID ParcelID;
+            BufferView Name;
+            bool ForSale;
+            bool Auction;
+            float Dwell;
+        };
+        std::vector<QueryRepliesBlock> QueryReplies;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirPeopleReply, zero-encoded.
+    struct DirPeopleReply
+    {
+        static const NetMsgID cMessageID = 0xffff0024;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct QueryRepliesBlock
+        {
+            RexUUID AgentID;
+            BufferView FirstName;
+            BufferView LastName;
+            BufferView Group;
+            bool Online;
+            int32_t Reputation;
+        };
+        std::vector<QueryRepliesBlock> QueryReplies;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirEventsReply, zero-encoded.
+    struct DirEventsReply
+    {
+        static const NetMsgID cMessageID = 0xffff0025;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct QueryRepliesBlock
+        {
+            RexUUID OwnerID;
+            BufferView Name;
+            uint32_t EventID;
+            BufferView Date;
+            uint32_t UnixTime;
+            uint32_t EventFlags;
+        };
+        std::vector<QueryRepliesBlock> QueryReplies;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirGroupsReply, zero-encoded.
+    struct DirGroupsReply
+    {
+        static const NetMsgID cMessageID = 0xffff0026;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct QueryRepliesBlock
+        {
+            RexUUID GroupID;
+            BufferView GroupName;
+            int32_t Members;
+            float SearchOrder;
+        };
+        std::vector<QueryRepliesBlock> QueryReplies;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirClassifiedQuery, zero-encoded.
+    struct DirClassifiedQuery
+    {
+        static const NetMsgID cMessageID = 0xffff0027;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            uint32_t Category;
+            int32_t QueryStart;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirClassifiedQueryBackend, zero-encoded.
+    struct DirClassifiedQueryBackend
+    {
+        static const NetMsgID cMessageID = 0xffff0028;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            uint32_t Category;
+            uint32_t EstateID;
+            bool Godlike;
+            int32_t QueryStart;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirClassifiedReply, zero-encoded.
+    struct DirClassifiedReply
+    {
+        static const NetMsgID cMessageID = 0xffff0029;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct QueryRepliesBlock
+        {
+            RexUUID ClassifiedID;
+            BufferView Name;
+            uint8_t ClassifiedFlags;
+            uint32_t CreationDate;
+            uint32_t ExpirationDate;
+            int32_t PriceForListing;
+        };
+        std::vector<QueryRepliesBlock> QueryReplies;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarClassifiedReply, unencoded.
+    struct AvatarClassifiedReply
+    {
+        static const NetMsgID cMessageID = 0xffff002a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID TargetID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ClassifiedID;
+            BufferView Name;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ClassifiedInfoRequest, zero-encoded.
+    struct ClassifiedInfoRequest
+    {
+        static const NetMsgID cMessageID = 0xffff002b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ClassifiedID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ClassifiedInfoReply, unencoded.
+    struct ClassifiedInfoReply
+    {
+        static const NetMsgID cMessageID = 0xffff002c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ClassifiedID;
+            RexUUID CreatorID;
+            uint32_t CreationDate;
+            uint32_t ExpirationDate;
+            uint32_t Category;
+            BufferView Name;
+            BufferView Desc;
+            RexUUID ParcelID;
+            uint32_t ParentEstate;
+            RexUUID SnapshotID;
+            BufferView SimName;
+            Vector3d PosGlobal;
+            BufferView ParcelName;
+            uint8_t ClassifiedFlags;
+            int32_t PriceForListing;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ClassifiedInfoUpdate, unencoded.
+    struct ClassifiedInfoUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff002d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ClassifiedID;
+            uint32_t Category;
+            BufferView Name;
+            BufferView Desc;
+            RexUUID ParcelID;
+            uint32_t ParentEstate;
+            RexUUID SnapshotID;
+            Vector3d PosGlobal;
+            uint8_t ClassifiedFlags;
+            int32_t PriceForListing;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ClassifiedDelete, unencoded.
+    struct ClassifiedDelete
+    {
+        static const NetMsgID cMessageID = 0xffff002e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ClassifiedID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ClassifiedGodDelete, unencoded.
+    struct ClassifiedGodDelete
+    {
+        static const NetMsgID cMessageID = 0xffff002f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ClassifiedID;
+            RexUUID QueryID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirLandQuery, zero-encoded.
+    struct DirLandQuery
+    {
+        static const NetMsgID cMessageID = 0xffff0030;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            uint32_t QueryFlags;
+            uint32_t SearchType;
+            int32_t Price;
+            int32_t Area;
+            int32_t QueryStart;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirLandQueryBackend, zero-encoded.
+    struct DirLandQueryBackend
+    {
+        static const NetMsgID cMessageID = 0xffff0031;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            uint32_t QueryFlags;
+            uint32_t SearchType;
+            int32_t Price;
+            int32_t Area;
+            int32_t QueryStart;
+            uint32_t EstateID;
+            bool Godlike;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirLandReply, zero-encoded.
+    struct DirLandReply
+    {
+        static const NetMsgID cMessageID = 0xffff0032;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct QueryRepliesBlock
+        {
+            RexUUID ParcelID;
+            BufferView Name;
+            bool Auction;
+            bool ForSale;
+            int32_t SalePrice;
+            int32_t ActualArea;
+        };
+        std::vector<QueryRepliesBlock> QueryReplies;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirPopularQuery, zero-encoded.
+    struct DirPopularQuery
+    {
+        static const NetMsgID cMessageID = 0xffff0033;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            uint32_t QueryFlags;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirPopularQueryBackend, zero-encoded.
+    struct DirPopularQueryBackend
+    {
+        static const NetMsgID cMessageID = 0xffff0034;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            uint32_t QueryFlags;
+            uint32_t EstateID;
+            bool Godlike;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DirPopularReply, zero-encoded.
+    struct DirPopularReply
+    {
+        static const NetMsgID cMessageID = 0xffff0035;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct QueryRepliesBlock
+        {
+            RexUUID ParcelID;
+            BufferView Name;
+            float Dwell;
+        };
+        std::vector<QueryRepliesBlock> QueryReplies;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelInfoRequest, unencoded.
+    struct ParcelInfoRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0036;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ParcelID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelInfoReply, zero-encoded.
+    struct ParcelInfoReply
+    {
+        static const NetMsgID cMessageID = 0xffff0037;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ParcelID;
+            RexUUID OwnerID;
+            BufferView Name;
+            BufferView Desc;
+            int32_t ActualArea;
+            int32_t BillableArea;
+            uint8_t Flags;
+            float GlobalX;
+            float GlobalY;
+            float GlobalZ;
+            BufferView SimName;
+            RexUUID SnapshotID;
+            float Dwell;
+            int32_t SalePrice;
+            int32_t AuctionID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelObjectOwnersRequest, unencoded.
+    struct ParcelObjectOwnersRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0038;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelObjectOwnersReply, zero-encoded.
+    struct ParcelObjectOwnersReply
+    {
+        static const NetMsgID cMessageID = 0xffff0039;
+
+        struct DataBlock
+        {
+            RexUUID OwnerID;
+            bool IsGroupOwned;
+            int32_t Count;
+            bool OnlineStatus;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupNoticesListRequest, unencoded.
+    struct GroupNoticesListRequest
+    {
+        static const NetMsgID cMessageID = 0xffff003a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID GroupID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupNoticesListReply, unencoded.
+    struct GroupNoticesListReply
+    {
+        static const NetMsgID cMessageID = 0xffff003b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID NoticeID;
+            uint32_t Timestamp;
+            BufferView FromName;
+            BufferView Subject;
+            bool HasAttachment;
+            uint8_t AssetType;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupNoticeRequest, unencoded.
+    struct GroupNoticeRequest
+    {
+        static const NetMsgID cMessageID = 0xffff003c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID GroupNoticeID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupNoticeAdd, unencoded.
+    struct GroupNoticeAdd
+    {
+        static const NetMsgID cMessageID = 0xffff003d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MessageBlockBlock
+        {
+            RexUUID ToGroupID;
+            RexUUID ID;
+            uint8_t Dialog;
+            BufferView FromAgentName;
+            BufferView Message;
+            BufferView BinaryBucket;
+        };
+        MessageBlockBlock MessageBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportRequest, unencoded.
+    struct TeleportRequest
+    {
+        static const NetMsgID cMessageID = 0xffff003e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InfoBlock
+        {
+            RexUUID RegionID;
+            Vector3 Position;
+            Vector3 LookAt;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportLocationRequest, unencoded.
+    struct TeleportLocationRequest
+    {
+        static const NetMsgID cMessageID = 0xffff003f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InfoBlock
+        {
+            uint64_t RegionHandle;
+            Vector3 Position;
+            Vector3 LookAt;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportLocal, unencoded.
+    struct TeleportLocal
+    {
+        static const NetMsgID cMessageID = 0xffff0040;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            uint32_t LocationID;
+            Vector3 Position;
+            Vector3 LookAt;
+            uint32_t TeleportFlags;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportLandmarkRequest, zero-encoded.
+    struct TeleportLandmarkRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0041;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID LandmarkID;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportProgress, unencoded.
+    struct TeleportProgress
+    {
+        static const NetMsgID cMessageID = 0xffff0042;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InfoBlock
+        {
+            uint32_t TeleportFlags;
+            BufferView Message;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DataHomeLocationRequest, zero-encoded.
+    struct DataHomeLocationRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0043;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            uint32_t KickedFromEstateID;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DataHomeLocationReply, unencoded.
+    struct DataHomeLocationReply
+    {
+        static const NetMsgID cMessageID = 0xffff0044;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            uint64_t RegionHandle;
+            Vector3 Position;
+            Vector3 LookAt;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportFinish, unencoded.
+    struct TeleportFinish
+    {
+        static const NetMsgID cMessageID = 0xffff0045;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            uint32_t LocationID;
+            uint32_t SimIP;
+            uint16_t SimPort;
+            uint64_t RegionHandle;
+            BufferView SeedCapability;
+            uint8_t SimAccess;
+            uint32_t TeleportFlags;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// StartLure, unencoded.
+    struct StartLure
+    {
+        static const NetMsgID cMessageID = 0xffff0046;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InfoBlock
+        {
+            uint8_t LureType;
+            BufferView Message;
+        };
+        InfoBlock Info;
+
+        struct TargetDataBlock
+        {
+            RexUUID TargetID;
+        };
+        std::vector<TargetDataBlock> TargetData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportLureRequest, unencoded.
+    struct TeleportLureRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0047;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID LureID;
+            uint32_t TeleportFlags;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportCancel, unencoded.
+    struct TeleportCancel
+    {
+        static const NetMsgID cMessageID = 0xffff0048;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportStart, unencoded.
+    struct TeleportStart
+    {
+        static const NetMsgID cMessageID = 0xffff0049;
+
+        struct InfoBlock
+        {
+            uint32_t TeleportFlags;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportFailed, unencoded.
+    struct TeleportFailed
+    {
+        static const NetMsgID cMessageID = 0xffff004a;
+
+        struct InfoBlock
+        {
+            RexUUID AgentID;
+            BufferView Reason;
+        };
+        InfoBlock Info;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// Undo, unencoded.
+    struct Undo
+    {
+        static const NetMsgID cMessageID = 0xffff004b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// Redo, unencoded.
+    struct Redo
+    {
+        static const NetMsgID cMessageID = 0xffff004c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UndoLand, unencoded.
+    struct UndoLand
+    {
+        static const NetMsgID cMessageID = 0xffff004d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentPause, unencoded.
+    struct AgentPause
+    {
+        static const NetMsgID cMessageID = 0xffff004e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t SerialNum;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentResume, unencoded.
+    struct AgentResume
+    {
+        static const NetMsgID cMessageID = 0xffff004f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t SerialNum;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChatFromViewer, zero-encoded.
+    struct ChatFromViewer
+    {
+        static const NetMsgID cMessageID = 0xffff0050;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ChatDataBlock
+        {
+            BufferView Message;
+            uint8_t Type;
+            int32_t Channel;
+        };
+        ChatDataBlock ChatData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentThrottle, zero-encoded.
+    struct AgentThrottle
+    {
+        static const NetMsgID cMessageID = 0xffff0051;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t CircuitCode;
+        };
+        AgentDataBlock AgentData;
+
+        struct ThrottleBlock
+        {
+            uint32_t GenCounter;
+            BufferView Throttles;
+        };
+        ThrottleBlock Throttle;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentFOV, unencoded.
+    struct AgentFOV
+    {
+        static const NetMsgID cMessageID = 0xffff0052;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t CircuitCode;
+        };
+        AgentDataBlock AgentData;
+
+        struct FOVBlockBlock
+        {
+            uint32_t GenCounter;
+            float VerticalAngle;
+        };
+        FOVBlockBlock FOVBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentHeightWidth, unencoded.
+    struct AgentHeightWidth
+    {
+        static const NetMsgID cMessageID = 0xffff0053;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t CircuitCode;
+        };
+        AgentDataBlock AgentData;
+
+        struct HeightWidthBlockBlock
+        {
+            uint32_t GenCounter;
+            uint16_t Height;
+            uint16_t Width;
+        };
+        HeightWidthBlockBlock HeightWidthBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentSetAppearance, zero-encoded.
+    struct AgentSetAppearance
+    {
+        static const NetMsgID cMessageID = 0xffff0054;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t SerialNum;
+            Vector3 Size;
+        };
+        AgentDataBlock AgentData;
+
+        struct WearableDataBlock
+        {
+            RexUUID CacheID;
+            uint8_t TextureIndex;
+        };
+        std::vector<WearableDataBlock> WearableData;
+
+        struct ObjectDataBlock
+        {
+            BufferView TextureEntry;
+        };
+        ObjectDataBlock ObjectData;
+
+        struct VisualParamBlock
+        {
+            uint8_t ParamValue;
+        };
+        std::vector<VisualParamBlock> VisualParam;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentQuitCopy, unencoded.
+    struct AgentQuitCopy
+    {
+        static const NetMsgID cMessageID = 0xffff0055;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct FuseBlockBlock
+        {
+            uint32_t ViewerCircuitCode;
+        };
+        FuseBlockBlock FuseBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ImageNotInDatabase, unencoded.
+    struct ImageNotInDatabase
+    {
+        static const NetMsgID cMessageID = 0xffff0056;
+
+        struct ImageIDBlock
+        {
+            RexUUID ID;
+        };
+        ImageIDBlock ImageID;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RebakeAvatarTextures, unencoded.
+    struct RebakeAvatarTextures
+    {
+        static const NetMsgID cMessageID = 0xffff0057;
+
+        struct TextureDataBlock
+        {
+            RexUUID TextureID;
+        };
+        TextureDataBlock TextureData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetAlwaysRun, unencoded.
+    struct SetAlwaysRun
+    {
+        static const NetMsgID cMessageID = 0xffff0058;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            bool AlwaysRun;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDelete, zero-encoded.
+    struct ObjectDelete
+    {
+        static const NetMsgID cMessageID = 0xffff0059;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            bool Force;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDuplicate, zero-encoded.
+    struct ObjectDuplicate
+    {
+        static const NetMsgID cMessageID = 0xffff005a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct SharedDataBlock
+        {
+            Vector3 Offset;
+            uint32_t DuplicateFlags;
+        };
+        SharedDataBlock SharedData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDuplicateOnRay, zero-encoded.
+    struct ObjectDuplicateOnRay
+    {
+        static const NetMsgID cMessageID = 0xffff005b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+            Vector3 RayStart;
+            Vector3 RayEnd;
+            bool BypassRaycast;
+            bool RayEndIsIntersection;
+            bool CopyCenters;
+            bool CopyRotates;
+            RexUUID RayTargetID;
+            uint32_t DuplicateFlags;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectScale, zero-encoded.
+    struct ObjectScale
+    {
+        static const NetMsgID cMessageID = 0xffff005c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            Vector3 Scale;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectRotation, zero-encoded.
+    struct ObjectRotation
+    {
+        static const NetMsgID cMessageID = 0xffff005d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            Quaternion Rotation;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectFlagUpdate, zero-encoded.
+    struct ObjectFlagUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff005e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t ObjectLocalID;
+            bool UsePhysics;
+            bool IsTemporary;
+            bool IsPhantom;
+            bool CastsShadows;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectClickAction, zero-encoded.
+    struct ObjectClickAction
+    {
+        static const NetMsgID cMessageID = 0xffff005f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            uint8_t ClickAction;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectImage, zero-encoded.
+    struct ObjectImage
+    {
+        static const NetMsgID cMessageID = 0xffff0060;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            BufferView MediaURL;
+            BufferView TextureEntry;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectMaterial, zero-encoded.
+    struct ObjectMaterial
+    {
+        static const NetMsgID cMessageID = 0xffff0061;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            uint8_t Material;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectShape, zero-encoded.
+    struct ObjectShape
+    {
+        static const NetMsgID cMessageID = 0xffff0062;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            uint8_t PathCurve;
+            uint8_t ProfileCurve;
+            uint16_t PathBegin;
+            uint16_t PathEnd;
+            uint8_t PathScaleX;
+            uint8_t PathScaleY;
+            uint8_t PathShearX;
+            uint8_t PathShearY;
+            int8_t PathTwist;
+            int8_t PathTwistBegin;
+            int8_t PathRadiusOffset;
+            int8_t PathTaperX;
+            int8_t PathTaperY;
+            uint8_t PathRevolutions;
+            int8_t PathSkew;
+            uint16_t ProfileBegin;
+            uint16_t ProfileEnd;
+            uint16_t ProfileHollow;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectExtraParams, zero-encoded.
+    struct ObjectExtraParams
+    {
+        static const NetMsgID cMessageID = 0xffff0063;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            uint16_t ParamType;
+            bool ParamInUse;
+            uint32_t ParamSize;
+            BufferView ParamData;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectOwner, zero-encoded.
+    struct ObjectOwner
+    {
+        static const NetMsgID cMessageID = 0xffff0064;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct HeaderDataBlock
+        {
+            bool Override;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+        };
+        HeaderDataBlock HeaderData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectGroup, zero-encoded.
+    struct ObjectGroup
+    {
+        static const NetMsgID cMessageID = 0xffff0065;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectBuy, zero-encoded.
+    struct ObjectBuy
+    {
+        static const NetMsgID cMessageID = 0xffff0066;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+            RexUUID CategoryID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            uint8_t SaleType;
+            int32_t SalePrice;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// BuyObjectInventory, zero-encoded.
+    struct BuyObjectInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0067;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ObjectID;
+            RexUUID ItemID;
+            RexUUID FolderID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DerezContainer, zero-encoded.
+    struct DerezContainer
+    {
+        static const NetMsgID cMessageID = 0xffff0068;
+
+        struct DataBlock
+        {
+            RexUUID ObjectID;
+            bool Delete;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectPermissions, zero-encoded.
+    struct ObjectPermissions
+    {
+        static const NetMsgID cMessageID = 0xffff0069;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct HeaderDataBlock
+        {
+            bool Override;
+        };
+        HeaderDataBlock HeaderData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            uint8_t Field;
+            uint8_t Set;
+            uint32_t Mask;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectSaleInfo, zero-encoded.
+    struct ObjectSaleInfo
+    {
+        static const NetMsgID cMessageID = 0xffff006a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t LocalID;
+            uint8_t SaleType;
+            int32_t SalePrice;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectName, zero-encoded.
+    struct ObjectName
+    {
+        static const NetMsgID cMessageID = 0xffff006b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t LocalID;
+            BufferView Name;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDescription, zero-encoded.
+    struct ObjectDescription
+    {
+        static const NetMsgID cMessageID = 0xffff006c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t LocalID;
+            BufferView Description;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectCategory, zero-encoded.
+    struct ObjectCategory
+    {
+        static const NetMsgID cMessageID = 0xffff006d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t LocalID;
+            uint32_t Category;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectSelect, zero-encoded.
+    struct ObjectSelect
+    {
+        static const NetMsgID cMessageID = 0xffff006e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDeselect, zero-encoded.
+    struct ObjectDeselect
+    {
+        static const NetMsgID cMessageID = 0xffff006f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectAttach, zero-encoded.
+    struct ObjectAttach
+    {
+        static const NetMsgID cMessageID = 0xffff0070;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint8_t AttachmentPoint;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            Quaternion Rotation;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDetach, unencoded.
+    struct ObjectDetach
+    {
+        static const NetMsgID cMessageID = 0xffff0071;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDrop, unencoded.
+    struct ObjectDrop
+    {
+        static const NetMsgID cMessageID = 0xffff0072;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectLink, unencoded.
+    struct ObjectLink
+    {
+        static const NetMsgID cMessageID = 0xffff0073;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDelink, unencoded.
+    struct ObjectDelink
+    {
+        static const NetMsgID cMessageID = 0xffff0074;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectGrab, zero-encoded.
+    struct ObjectGrab
+    {
+        static const NetMsgID cMessageID = 0xffff0075;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t LocalID;
+            Vector3 GrabOffset;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectGrabUpdate, zero-encoded.
+    struct ObjectGrabUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0076;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+            Vector3 GrabOffsetInitial;
+            Vector3 GrabPosition;
+            uint32_t TimeSinceLast;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectDeGrab, unencoded.
+    struct ObjectDeGrab
+    {
+        static const NetMsgID cMessageID = 0xffff0077;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t LocalID;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectSpinStart, zero-encoded.
+    struct ObjectSpinStart
+    {
+        static const NetMsgID cMessageID = 0xffff0078;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectSpinUpdate, zero-encoded.
+    struct ObjectSpinUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0079;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+            Quaternion Rotation;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectSpinStop, zero-encoded.
+    struct ObjectSpinStop
+    {
+        static const NetMsgID cMessageID = 0xffff007a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectExportSelected, zero-encoded.
+    struct ObjectExportSelected
+    {
+        static const NetMsgID cMessageID = 0xffff007b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID RequestID;
+            int16_t VolumeDetail;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ModifyLand, zero-encoded.
+    struct ModifyLand
+    {
+        static const NetMsgID cMessageID = 0xffff007c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ModifyBlockBlock
+        {
+            uint8_t Action;
+            uint8_t BrushSize;
+            float Seconds;
+            float Height;
+        };
+        ModifyBlockBlock ModifyBlock;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+            float West;
+            float South;
+            float East;
+            float North;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// VelocityInterpolateOn, unencoded.
+    struct VelocityInterpolateOn
+    {
+        static const NetMsgID cMessageID = 0xffff007d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// VelocityInterpolateOff, unencoded.
+    struct VelocityInterpolateOff
+    {
+        static const NetMsgID cMessageID = 0xffff007e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// StateSave, unencoded.
+    struct StateSave
+    {
+        static const NetMsgID cMessageID = 0xffff007f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlockBlock
+        {
+            BufferView Filename;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ReportAutosaveCrash, unencoded.
+    struct ReportAutosaveCrash
+    {
+        static const NetMsgID cMessageID = 0xffff0080;
+
+        struct AutosaveDataBlock
+        {
+            int32_t PID;
+            int32_t Status;
+        };
+        AutosaveDataBlock AutosaveData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimWideDeletes, unencoded.
+    struct SimWideDeletes
+    {
+        static const NetMsgID cMessageID = 0xffff0081;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlockBlock
+        {
+            RexUUID TargetID;
+            uint32_t Flags;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TrackAgent, unencoded.
+    struct TrackAgent
+    {
+        static const NetMsgID cMessageID = 0xffff0082;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TargetDataBlock
+        {
+            RexUUID PreyID;
+        };
+        TargetDataBlock TargetData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ViewerStats, zero-encoded.
+    struct ViewerStats
+    {
+        static const NetMsgID cMessageID = 0xffff0083;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t IP;
+            uint32_t StartTime;
+            float RunTime;
+            float SimFPS;
+            float FPS;
+            uint8_t AgentsInView;
+            float Ping;
+            double MetersTraveled;
+            int32_t RegionsVisited;
+            uint32_t SysRAM;
+            BufferView SysOS;
+            BufferView SysCPU;
+            BufferView SysGPU;
+        };
+        AgentDataBlock AgentData;
+
+        struct DownloadTotalsBlock
+        {
+            uint32_t World;
+            uint32_t Objects;
+            uint32_t Textures;
+        };
+        DownloadTotalsBlock DownloadTotals;
+
+        struct NetStatsBlock
+        {
+            uint32_t Bytes;
+            uint32_t Packets;
+            uint32_t Compressed;
+            uint32_t Savings;
+        };
+        NetStatsBlock NetStats[2];
+
+        struct FailStatsBlock
+        {
+            uint32_t SendPacket;
+            uint32_t Dropped;
+            uint32_t Resent;
+            uint32_t FailedResends;
+            uint32_t OffCircuit;
+            uint32_t Invalid;
+        };
+        FailStatsBlock FailStats;
+
+        struct MiscStatsBlock
+        {
+            uint32_t Type;
+            double Value;
+        };
+        std::vector<MiscStatsBlock> MiscStats;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptAnswerYes, unencoded.
+    struct ScriptAnswerYes
+    {
+        static const NetMsgID cMessageID = 0xffff0084;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID TaskID;
+            RexUUID ItemID;
+            int32_t Questions;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UserReport, zero-encoded.
+    struct UserReport
+    {
+        static const NetMsgID cMessageID = 0xffff0085;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ReportDataBlock
+        {
+            uint8_t ReportType;
+            uint8_t Category;
+            Vector3 Position;
+            uint8_t CheckFlags;
+            RexUUID ScreenshotID;
+            RexUUID ObjectID;
+            RexUUID AbuserID;
+            BufferView AbuseRegionName;
+            RexUUID AbuseRegionID;
+            BufferView Summary;
+            BufferView Details;
+            BufferView VersionString;
+        };
+        ReportDataBlock ReportData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AlertMessage, unencoded.
+    struct AlertMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0086;
+
+        struct AlertDataBlock
+        {
+            BufferView Message;
+        };
+        AlertDataBlock AlertData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentAlertMessage, unencoded.
+    struct AgentAlertMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0087;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct AlertDataBlock
+        {
+            bool Modal;
+            BufferView Message;
+        };
+        AlertDataBlock AlertData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MeanCollisionAlert, zero-encoded.
+    struct MeanCollisionAlert
+    {
+        static const NetMsgID cMessageID = 0xffff0088;
+
+        struct MeanCollisionBlock
+        {
+            RexUUID Victim;
+            RexUUID Perp;
+            uint32_t Time;
+            float Mag;
+            uint8_t Type;
+        };
+        std::vector<MeanCollisionBlock> MeanCollision;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ViewerFrozenMessage, unencoded.
+    struct ViewerFrozenMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0089;
+
+        struct FrozenDataBlock
+        {
+            bool Data;
+        };
+        FrozenDataBlock FrozenData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// HealthMessage, zero-encoded.
+    struct HealthMessage
+    {
+        static const NetMsgID cMessageID = 0xffff008a;
+
+        struct HealthDataBlock
+        {
+            float Health;
+        };
+        HealthDataBlock HealthData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChatFromSimulator, unencoded.
+    struct ChatFromSimulator
+    {
+        static const NetMsgID cMessageID = 0xffff008b;
+
+        struct ChatDataBlock
+        {
+            BufferView FromName;
+            RexUUID SourceID;
+            RexUUID OwnerID;
+            uint8_t SourceType;
+            uint8_t ChatType;
+            uint8_t Audible;
+            Vector3 Position;
+            BufferView Message;
+        };
+        ChatDataBlock ChatData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimStats, unencoded.
+    struct SimStats
+    {
+        static const NetMsgID cMessageID = 0xffff008c;
+
+        struct RegionBlock
+        {
+            uint32_t RegionX;
+            uint32_t RegionY;
+            uint32_t RegionFlags;
+            uint32_t ObjectCapacity;
+        };
+        RegionBlock Region;
+
+        struct StatBlock
+        {
+            uint32_t StatID;
+            float StatValue;
+        };
+        std::vector<StatBlock> Stat;
+
+        struct PidStatBlock
+        {
+            int32_t PID;
+        };
+        PidStatBlock PidStat;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestRegionInfo, unencoded.
+    struct RequestRegionInfo
+    {
+        static const NetMsgID cMessageID = 0xffff008d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionInfo, zero-encoded.
+    struct RegionInfo
+    {
+        static const NetMsgID cMessageID = 0xffff008e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RegionInfoBlock
+        {
+            BufferView SimName;
+            uint32_t EstateID;
+            uint32_t ParentEstateID;
+            uint32_t RegionFlags;
+            uint8_t SimAccess;
+            uint8_t MaxAgents;
+            float BillableFactor;
+            float ObjectBonusFactor;
+            float WaterHeight;
+            float TerrainRaiseLimit;
+            float TerrainLowerLimit;
+            int32_t PricePerMeter;
+            int32_t RedirectGridX;
+            int32_t RedirectGridY;
+            bool UseEstateSun;
+            float SunHour;
+        };
+        RegionInfoBlock RegionInfo_;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GodUpdateRegionInfo, zero-encoded.
+    struct GodUpdateRegionInfo
+    {
+        static const NetMsgID cMessageID = 0xffff008f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RegionInfoBlock
+        {
+            BufferView SimName;
+            uint32_t EstateID;
+            uint32_t ParentEstateID;
+            uint32_t RegionFlags;
+            float BillableFactor;
+            int32_t PricePerMeter;
+            int32_t RedirectGridX;
+            int32_t RedirectGridY;
+        };
+        RegionInfoBlock RegionInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// NearestLandingRegionRequest, unencoded.
+    struct NearestLandingRegionRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0090;
+
+        struct RequestingRegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        RequestingRegionDataBlock RequestingRegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// NearestLandingRegionReply, unencoded.
+    struct NearestLandingRegionReply
+    {
+        static const NetMsgID cMessageID = 0xffff0091;
+
+        struct LandingRegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        LandingRegionDataBlock LandingRegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// NearestLandingRegionUpdated, unencoded.
+    struct NearestLandingRegionUpdated
+    {
+        static const NetMsgID cMessageID = 0xffff0092;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        RegionDataBlock RegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TeleportLandingStatusChanged, unencoded.
+    struct TeleportLandingStatusChanged
+    {
+        static const NetMsgID cMessageID = 0xffff0093;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        RegionDataBlock RegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionHandshake, zero-encoded.
+    struct RegionHandshake
+    {
+        static const NetMsgID cMessageID = 0xffff0094;
+
+        struct RegionInfoBlock
+        {
+            uint32_t RegionFlags;
+            uint8_t SimAccess;
+            BufferView SimName;
+            RexUUID SimOwner;
+            bool IsEstateManager;
+            float WaterHeight;
+            float BillableFactor;
+            RexUUID CacheID;
+            RexUUID TerrainBase0;
+            RexUUID TerrainBase1;
+            RexUUID TerrainBase2;
+            RexUUID TerrainBase3;
+            RexUUID TerrainDetail0;
+            RexUUID TerrainDetail1;
+            RexUUID TerrainDetail2;
+            RexUUID TerrainDetail3;
+            float TerrainStartHeight00;
+            float TerrainStartHeight01;
+            float TerrainStartHeight10;
+            float TerrainStartHeight11;
+            float TerrainHeightRange00;
+            float TerrainHeightRange01;
+            float TerrainHeightRange10;
+            float TerrainHeightRange11;
+        };
+        RegionInfoBlock RegionInfo;
+
+        struct RegionInfo2Block
+        {
+            RexUUID RegionID;
+        };
+        RegionInfo2Block RegionInfo2;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionHandshakeReply, zero-encoded.
+    struct RegionHandshakeReply
+    {
+        static const NetMsgID cMessageID = 0xffff0095;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RegionInfoBlock
+        {
+            uint32_t Flags;
+        };
+        RegionInfoBlock RegionInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimulatorViewerTimeMessage, unencoded.
+    struct SimulatorViewerTimeMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0096;
+
+        struct TimeInfoBlock
+        {
+            uint64_t UsecSinceStart;
+            uint32_t SecPerDay;
+            uint32_t SecPerYear;
+            Vector3 SunDirection;
+            float SunPhase;
+            Vector3 SunAngVelocity;
+        };
+        TimeInfoBlock TimeInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EnableSimulator, unencoded.
+    struct EnableSimulator
+    {
+        static const NetMsgID cMessageID = 0xffff0097;
+
+        struct SimulatorInfoBlock
+        {
+            uint64_t Handle;
+            uint32_t IP;
+            uint16_t Port;
+        };
+        SimulatorInfoBlock SimulatorInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DisableSimulator, unencoded.
+    struct DisableSimulator
+    {
+        static const NetMsgID cMessageID = 0xffff0098;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TransferRequest, zero-encoded.
+    struct TransferRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0099;
+
+        struct TransferInfoBlock
+        {
+            RexUUID TransferID;
+            int32_t ChannelType;
+            int32_t SourceType;
+            float Priority;
+            BufferView Params;
+        };
+        TransferInfoBlock TransferInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TransferInfo, zero-encoded.
+    struct TransferInfo
+    {
+        static const NetMsgID cMessageID = 0xffff009a;
+
+        struct TransferInfoBlock
+        {
+            RexUUID TransferID;
+            int32_t ChannelType;
+            int32_t TargetType;
+            int32_t Status;
+            int32_t Size;
+            BufferView Params;
+        };
+        TransferInfoBlock TransferInfo_;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TransferAbort, zero-encoded.
+    struct TransferAbort
+    {
+        static const NetMsgID cMessageID = 0xffff009b;
+
+        struct TransferInfoBlock
+        {
+            RexUUID TransferID;
+            int32_t ChannelType;
+        };
+        TransferInfoBlock TransferInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestXfer, zero-encoded.
+    struct RequestXfer
+    {
+        static const NetMsgID cMessageID = 0xffff009c;
+
+        struct XferIDBlock
+        {
+            uint64_t ID;
+            BufferView Filename;
+            uint8_t FilePath;
+            bool DeleteOnCompletion;
+            bool UseBigPackets;
+            RexUUID VFileID;
+            int16_t VFileType;
+        };
+        XferIDBlock XferID;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AbortXfer, unencoded.
+    struct AbortXfer
+    {
+        static const NetMsgID cMessageID = 0xffff009d;
+
+        struct XferIDBlock
+        {
+            uint64_t ID;
+            int32_t Result;
+        };
+        XferIDBlock XferID;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarAppearance, zero-encoded.
+    struct AvatarAppearance
+    {
+        static const NetMsgID cMessageID = 0xffff009e;
+
+        struct SenderBlock
+        {
+            RexUUID ID;
+            bool IsTrial;
+        };
+        SenderBlock Sender;
+
+        struct ObjectDataBlock
+        {
+            BufferView TextureEntry;
+        };
+        ObjectDataBlock ObjectData;
+
+        struct VisualParamBlock
+        {
+            uint8_t ParamValue;
+        };
+        std::vector<VisualParamBlock> VisualParam;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetFollowCamProperties, unencoded.
+    struct SetFollowCamProperties
+    {
+        static const NetMsgID cMessageID = 0xffff009f;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        ObjectDataBlock ObjectData;
+
+        struct CameraPropertyBlock
+        {
+            int32_t Type;
+            float Value;
+        };
+        std::vector<CameraPropertyBlock> CameraProperty;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ClearFollowCamProperties, unencoded.
+    struct ClearFollowCamProperties
+    {
+        static const NetMsgID cMessageID = 0xffff00a0;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestPayPrice, unencoded.
+    struct RequestPayPrice
+    {
+        static const NetMsgID cMessageID = 0xffff00a1;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PayPriceReply, unencoded.
+    struct PayPriceReply
+    {
+        static const NetMsgID cMessageID = 0xffff00a2;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ObjectID;
+            int32_t DefaultPayPrice;
+        };
+        ObjectDataBlock ObjectData;
+
+        struct ButtonDataBlock
+        {
+            int32_t PayButton;
+        };
+        std::vector<ButtonDataBlock> ButtonData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// KickUser, unencoded.
+    struct KickUser
+    {
+        static const NetMsgID cMessageID = 0xffff00a3;
+
+        struct TargetBlockBlock
+        {
+            uint32_t TargetIP;
+            uint16_t TargetPort;
+        };
+        TargetBlockBlock TargetBlock;
+
+        struct UserInfoBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            BufferView Reason;
+        };
+        UserInfoBlock UserInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// KickUserAck, unencoded.
+    struct KickUserAck
+    {
+        static const NetMsgID cMessageID = 0xffff00a4;
+
+        struct UserInfoBlock
+        {
+            RexUUID SessionID;
+            uint32_t Flags;
+        };
+        UserInfoBlock UserInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GodKickUser, unencoded.
+    struct GodKickUser
+    {
+        static const NetMsgID cMessageID = 0xffff00a5;
+
+        struct UserInfoBlock
+        {
+            RexUUID GodID;
+            RexUUID GodSessionID;
+            RexUUID AgentID;
+            uint32_t KickFlags;
+            BufferView Reason;
+        };
+        UserInfoBlock UserInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SystemKickUser, unencoded.
+    struct SystemKickUser
+    {
+        static const NetMsgID cMessageID = 0xffff00a6;
+
+        struct AgentInfoBlock
+        {
+            RexUUID AgentID;
+        };
+        std::vector<AgentInfoBlock> AgentInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EjectUser, unencoded.
+    struct EjectUser
+    {
+        static const NetMsgID cMessageID = 0xffff00a7;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID TargetID;
+            uint32_t Flags;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// FreezeUser, unencoded.
+    struct FreezeUser
+    {
+        static const NetMsgID cMessageID = 0xffff00a8;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID TargetID;
+            uint32_t Flags;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPropertiesRequest, unencoded.
+    struct AvatarPropertiesRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00a9;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID AvatarID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPropertiesRequestBackend, unencoded.
+    struct AvatarPropertiesRequestBackend
+    {
+        static const NetMsgID cMessageID = 0xffff00aa;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID AvatarID;
+            uint8_t GodLevel;
+            bool WebProfilesDisabled;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPropertiesReply, zero-encoded.
+    struct AvatarPropertiesReply
+    {
+        static const NetMsgID cMessageID = 0xffff00ab;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID AvatarID;
+        };
+        AgentDataBlock AgentData;
+
+        struct PropertiesDataBlock
+        {
+            RexUUID ImageID;
+            RexUUID FLImageID;
+            RexUUID PartnerID;
+            BufferView AboutText;
+            BufferView FLAboutText;
+            BufferView BornOn;
+            BufferView ProfileURL;
+            BufferView CharterMember;
+            uint32_t Flags;
+        };
+        PropertiesDataBlock PropertiesData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarInterestsReply, zero-encoded.
+    struct AvatarInterestsReply
+    {
+        static const NetMsgID cMessageID = 0xffff00ac;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID AvatarID;
+        };
+        AgentDataBlock AgentData;
+
+        struct PropertiesDataBlock
+        {
+            uint32_t WantToMask;
+            BufferView WantToText;
+            uint32_t SkillsMask;
+            BufferView SkillsText;
+            BufferView LanguagesText;
+        };
+        PropertiesDataBlock PropertiesData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarGroupsReply, zero-encoded.
+    struct AvatarGroupsReply
+    {
+        static const NetMsgID cMessageID = 0xffff00ad;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID AvatarID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            uint64_t GroupPowers;
+            bool AcceptNotices;
+            BufferView GroupTitle;
+            RexUUID GroupID;
+            BufferView GroupName;
+            RexUUID GroupInsigniaID;
+        };
+        std::vector<GroupDataBlock> GroupData;
+
+        struct NewGroupDataBlock
+        {
+            bool ListInProfile;
+        };
+        NewGroupDataBlock NewGroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPropertiesUpdate, zero-encoded.
+    struct AvatarPropertiesUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff00ae;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct PropertiesDataBlock
+        {
+            RexUUID ImageID;
+            RexUUID FLImageID;
+            BufferView AboutText;
+            BufferView FLAboutText;
+            bool AllowPublish;
+            bool MaturePublish;
+            BufferView ProfileURL;
+        };
+        PropertiesDataBlock PropertiesData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarInterestsUpdate, zero-encoded.
+    struct AvatarInterestsUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff00af;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct PropertiesDataBlock
+        {
+            uint32_t WantToMask;
+            BufferView WantToText;
+            uint32_t SkillsMask;
+            BufferView SkillsText;
+            BufferView LanguagesText;
+        };
+        PropertiesDataBlock PropertiesData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarNotesReply, unencoded.
+    struct AvatarNotesReply
+    {
+        static const NetMsgID cMessageID = 0xffff00b0;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID TargetID;
+            BufferView Notes;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarNotesUpdate, unencoded.
+    struct AvatarNotesUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff00b1;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID TargetID;
+            BufferView Notes;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AvatarPicksReply, unencoded.
+    struct AvatarPicksReply
+    {
+        static const NetMsgID cMessageID = 0xffff00b2;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID TargetID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID PickID;
+            BufferView PickName;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EventInfoRequest, unencoded.
+    struct EventInfoRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00b3;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct EventDataBlock
+        {
+            uint32_t EventID;
+        };
+        EventDataBlock EventData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EventInfoReply, unencoded.
+    struct EventInfoReply
+    {
+        static const NetMsgID cMessageID = 0xffff00b4;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct EventDataBlock
+        {
+            uint32_t EventID;
+            BufferView Creator;
+            BufferView Name;
+            BufferView Category;
+            BufferView Desc;
+            BufferView Date;
+            uint32_t DateUTC;
+            uint32_t Duration;
+            uint32_t Cover;
+            uint32_t Amount;
+            BufferView SimName;
+            Vector3d GlobalPos;
+            uint32_t EventFlags;
+        };
+        EventDataBlock EventData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EventNotificationAddRequest, unencoded.
+    struct EventNotificationAddRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00b5;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct EventDataBlock
+        {
+            uint32_t EventID;
+        };
+        EventDataBlock EventData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EventNotificationRemoveRequest, unencoded.
+    struct EventNotificationRemoveRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00b6;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct EventDataBlock
+        {
+            uint32_t EventID;
+        };
+        EventDataBlock EventData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EventGodDelete, unencoded.
+    struct EventGodDelete
+    {
+        static const NetMsgID cMessageID = 0xffff00b7;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct EventDataBlock
+        {
+            uint32_t EventID;
+        };
+        EventDataBlock EventData;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            BufferView QueryText;
+            uint32_t QueryFlags;
+            int32_t QueryStart;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PickInfoReply, unencoded.
+    struct PickInfoReply
+    {
+        static const NetMsgID cMessageID = 0xffff00b8;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID PickID;
+            RexUUID CreatorID;
+            bool TopPick;
+            RexUUID ParcelID;
+            BufferView Name;
+            BufferView Desc;
+            RexUUID SnapshotID;
+            BufferView User;
+            BufferView OriginalName;
+            BufferView SimName;
+            Vector3d PosGlobal;
+            int32_t SortOrder;
+            bool Enabled;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PickInfoUpdate, unencoded.
+    struct PickInfoUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff00b9;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID PickID;
+            RexUUID CreatorID;
+            bool TopPick;
+            RexUUID ParcelID;
+            BufferView Name;
+            BufferView Desc;
+            RexUUID SnapshotID;
+            Vector3d PosGlobal;
+            int32_t SortOrder;
+            bool Enabled;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PickDelete, unencoded.
+    struct PickDelete
+    {
+        static const NetMsgID cMessageID = 0xffff00ba;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID PickID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PickGodDelete, unencoded.
+    struct PickGodDelete
+    {
+        static const NetMsgID cMessageID = 0xffff00bb;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID PickID;
+            RexUUID QueryID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptQuestion, unencoded.
+    struct ScriptQuestion
+    {
+        static const NetMsgID cMessageID = 0xffff00bc;
+
+        struct DataBlock
+        {
+            RexUUID TaskID;
+            RexUUID ItemID;
+            BufferView ObjectName;
+            BufferView ObjectOwner;
+            int32_t Questions;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptControlChange, unencoded.
+    struct ScriptControlChange
+    {
+        static const NetMsgID cMessageID = 0xffff00bd;
+
+        struct DataBlock
+        {
+            bool TakeControls;
+            uint32_t Controls;
+            bool PassToAgent;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptDialog, zero-encoded.
+    struct ScriptDialog
+    {
+        static const NetMsgID cMessageID = 0xffff00be;
+
+        struct DataBlock
+        {
+            RexUUID ObjectID;
+            BufferView FirstName;
+            BufferView LastName;
+            BufferView ObjectName;
+            BufferView Message;
+            int32_t ChatChannel;
+            RexUUID ImageID;
+        };
+        DataBlock Data;
+
+        struct ButtonsBlock
+        {
+            BufferView ButtonLabel;
+        };
+        std::vector<ButtonsBlock> Buttons;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptDialogReply, zero-encoded.
+    struct ScriptDialogReply
+    {
+        static const NetMsgID cMessageID = 0xffff00bf;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ObjectID;
+            int32_t ChatChannel;
+            int32_t ButtonIndex;
+            BufferView ButtonLabel;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ForceScriptControlRelease, unencoded.
+    struct ForceScriptControlRelease
+    {
+        static const NetMsgID cMessageID = 0xffff00c0;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RevokePermissions, unencoded.
+    struct RevokePermissions
+    {
+        static const NetMsgID cMessageID = 0xffff00c1;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ObjectID;
+            uint32_t ObjectPermissions;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LoadURL, unencoded.
+    struct LoadURL
+    {
+        static const NetMsgID cMessageID = 0xffff00c2;
+
+        struct DataBlock
+        {
+            BufferView ObjectName;
+            RexUUID ObjectID;
+            RexUUID OwnerID;
+            bool OwnerIsGroup;
+            BufferView Message;
+            BufferView URL;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptTeleportRequest, unencoded.
+    struct ScriptTeleportRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00c3;
+
+        struct DataBlock
+        {
+            BufferView ObjectName;
+            BufferView SimName;
+            Vector3 SimPosition;
+            Vector3 LookAt;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelOverlay, zero-encoded.
+    struct ParcelOverlay
+    {
+        static const NetMsgID cMessageID = 0xffff00c4;
+
+        struct ParcelDataBlock
+        {
+            int32_t SequenceID;
+            BufferView Data;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelPropertiesRequestByID, zero-encoded.
+    struct ParcelPropertiesRequestByID
+    {
+        static const NetMsgID cMessageID = 0xffff00c5;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t SequenceID;
+            int32_t LocalID;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelPropertiesUpdate, zero-encoded.
+    struct ParcelPropertiesUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff00c6;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+            uint32_t Flags;
+            uint32_t ParcelFlags;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Desc;
+            BufferView MusicURL;
+            BufferView MediaURL;
+            RexUUID MediaID;
+            uint8_t MediaAutoScale;
+            RexUUID GroupID;
+            int32_t PassPrice;
+            float PassHours;
+            uint8_t Category;
+            RexUUID AuthBuyerID;
+            RexUUID SnapshotID;
+            Vector3 UserLocation;
+            Vector3 UserLookAt;
+            uint8_t LandingType;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelReturnObjects, zero-encoded.
+    struct ParcelReturnObjects
+    {
+        static const NetMsgID cMessageID = 0xffff00c7;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+            uint32_t ReturnType;
+        };
+        ParcelDataBlock ParcelData;
+
+        struct TaskIDsBlock
+        {
+            RexUUID TaskID;
+        };
+        std::vector<TaskIDsBlock> TaskIDs;
+
+        struct OwnerIDsBlock
+        {
+            RexUUID OwnerID;
+        };
+        std::vector<OwnerIDsBlock> OwnerIDs;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelSetOtherCleanTime, zero-encoded.
+    struct ParcelSetOtherCleanTime
+    {
+        static const NetMsgID cMessageID = 0xffff00c8;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+            int32_t OtherCleanTime;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelDisableObjects, zero-encoded.
+    struct ParcelDisableObjects
+    {
+        static const NetMsgID cMessageID = 0xffff00c9;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+            uint32_t ReturnType;
+        };
+        ParcelDataBlock ParcelData;
+
+        struct TaskIDsBlock
+        {
+            RexUUID TaskID;
+        };
+        std::vector<TaskIDsBlock> TaskIDs;
+
+        struct OwnerIDsBlock
+        {
+            RexUUID OwnerID;
+        };
+        std::vector<OwnerIDsBlock> OwnerIDs;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelSelectObjects, zero-encoded.
+    struct ParcelSelectObjects
+    {
+        static const NetMsgID cMessageID = 0xffff00ca;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+            uint32_t ReturnType;
+        };
+        ParcelDataBlock ParcelData;
+
+        struct ReturnIDsBlock
+        {
+            RexUUID ReturnID;
+        };
+        std::vector<ReturnIDsBlock> ReturnIDs;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EstateCovenantRequest, unencoded.
+    struct EstateCovenantRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00cb;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EstateCovenantReply, unencoded.
+    struct EstateCovenantReply
+    {
+        static const NetMsgID cMessageID = 0xffff00cc;
+
+        struct DataBlock
+        {
+            RexUUID CovenantID;
+            uint32_t CovenantTimestamp;
+            BufferView EstateName;
+            RexUUID EstateOwnerID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ForceObjectSelect, unencoded.
+    struct ForceObjectSelect
+    {
+        static const NetMsgID cMessageID = 0xffff00cd;
+
+        struct HeaderBlock
+        {
+            bool ResetList;
+        };
+        HeaderBlock Header;
+
+        struct DataBlock
+        {
+            uint32_t LocalID;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelBuyPass, unencoded.
+    struct ParcelBuyPass
+    {
+        static const NetMsgID cMessageID = 0xffff00ce;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelDeedToGroup, unencoded.
+    struct ParcelDeedToGroup
+    {
+        static const NetMsgID cMessageID = 0xffff00cf;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID GroupID;
+            int32_t LocalID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelReclaim, unencoded.
+    struct ParcelReclaim
+    {
+        static const NetMsgID cMessageID = 0xffff00d0;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            int32_t LocalID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelClaim, zero-encoded.
+    struct ParcelClaim
+    {
+        static const NetMsgID cMessageID = 0xffff00d1;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID GroupID;
+            bool IsGroupOwned;
+            bool Final;
+        };
+        DataBlock Data;
+
+        struct ParcelDataBlock
+        {
+            float West;
+            float South;
+            float East;
+            float North;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelJoin, unencoded.
+    struct ParcelJoin
+    {
+        static const NetMsgID cMessageID = 0xffff00d2;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            float West;
+            float South;
+            float East;
+            float North;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelDivide, unencoded.
+    struct ParcelDivide
+    {
+        static const NetMsgID cMessageID = 0xffff00d3;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            float West;
+            float South;
+            float East;
+            float North;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelRelease, unencoded.
+    struct ParcelRelease
+    {
+        static const NetMsgID cMessageID = 0xffff00d4;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            int32_t LocalID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelBuy, zero-encoded.
+    struct ParcelBuy
+    {
+        static const NetMsgID cMessageID = 0xffff00d5;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID GroupID;
+            bool IsGroupOwned;
+            bool RemoveContribution;
+            int32_t LocalID;
+            bool Final;
+        };
+        DataBlock Data;
+
+        struct ParcelDataBlock
+        {
+            int32_t Price;
+            int32_t Area;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelGodForceOwner, zero-encoded.
+    struct ParcelGodForceOwner
+    {
+        static const NetMsgID cMessageID = 0xffff00d6;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID OwnerID;
+            int32_t LocalID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelAccessListRequest, zero-encoded.
+    struct ParcelAccessListRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00d7;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            int32_t SequenceID;
+            uint32_t Flags;
+            int32_t LocalID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelAccessListReply, zero-encoded.
+    struct ParcelAccessListReply
+    {
+        static const NetMsgID cMessageID = 0xffff00d8;
+
+        struct DataBlock
+        {
+            RexUUID AgentID;
+            int32_t SequenceID;
+            uint32_t Flags;
+            int32_t LocalID;
+        };
+        DataBlock Data;
+
+        struct ListBlock
+        {
+            RexUUID ID;
+            int32_t Time;
+            uint32_t Flags;
+        };
+        std::vector<ListBlock> List;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelAccessListUpdate, zero-encoded.
+    struct ParcelAccessListUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff00d9;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            uint32_t Flags;
+            int32_t LocalID;
+            RexUUID TransactionID;
+            int32_t SequenceID;
+            int32_t Sections;
+        };
+        DataBlock Data;
+
+        struct ListBlock
+        {
+            RexUUID ID;
+            int32_t Time;
+            uint32_t Flags;
+        };
+        std::vector<ListBlock> List;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelDwellRequest, unencoded.
+    struct ParcelDwellRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00da;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            int32_t LocalID;
+            RexUUID ParcelID;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelDwellReply, unencoded.
+    struct ParcelDwellReply
+    {
+        static const NetMsgID cMessageID = 0xffff00db;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            int32_t LocalID;
+            RexUUID ParcelID;
+            float Dwell;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestParcelTransfer, zero-encoded.
+    struct RequestParcelTransfer
+    {
+        static const NetMsgID cMessageID = 0xffff00dc;
+
+        struct DataBlock
+        {
+            RexUUID TransactionID;
+            uint32_t TransactionTime;
+            RexUUID SourceID;
+            RexUUID DestID;
+            RexUUID OwnerID;
+            uint8_t Flags;
+            int32_t TransactionType;
+            int32_t Amount;
+            int32_t BillableArea;
+            int32_t ActualArea;
+            bool Final;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateParcel, zero-encoded.
+    struct UpdateParcel
+    {
+        static const NetMsgID cMessageID = 0xffff00dd;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+            uint64_t RegionHandle;
+            RexUUID OwnerID;
+            bool GroupOwned;
+            uint8_t Status;
+            BufferView Name;
+            BufferView Description;
+            BufferView MusicURL;
+            float RegionX;
+            float RegionY;
+            int32_t ActualArea;
+            int32_t BillableArea;
+            bool ShowDir;
+            bool IsForSale;
+            uint8_t Category;
+            RexUUID SnapshotID;
+            Vector3 UserLocation;
+            int32_t SalePrice;
+            RexUUID AuthorizedBuyerID;
+            bool AllowPublish;
+            bool MaturePublish;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveParcel, unencoded.
+    struct RemoveParcel
+    {
+        static const NetMsgID cMessageID = 0xffff00de;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MergeParcel, unencoded.
+    struct MergeParcel
+    {
+        static const NetMsgID cMessageID = 0xffff00df;
+
+        struct MasterParcelDataBlock
+        {
+            RexUUID MasterID;
+        };
+        MasterParcelDataBlock MasterParcelData;
+
+        struct SlaveParcelDataBlock
+        {
+            RexUUID SlaveID;
+        };
+        std::vector<SlaveParcelDataBlock> SlaveParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LogParcelChanges, zero-encoded.
+    struct LogParcelChanges
+    {
+        static const NetMsgID cMessageID = 0xffff00e0;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        RegionDataBlock RegionData;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+            RexUUID OwnerID;
+            bool IsOwnerGroup;
+            int32_t ActualArea;
+            int8_t Action;
+            RexUUID TransactionID;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CheckParcelSales, unencoded.
+    struct CheckParcelSales
+    {
+        static const NetMsgID cMessageID = 0xffff00e1;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        std::vector<RegionDataBlock> RegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelSales, unencoded.
+    struct ParcelSales
+    {
+        static const NetMsgID cMessageID = 0xffff00e2;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+            RexUUID BuyerID;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelGodMarkAsContent, unencoded.
+    struct ParcelGodMarkAsContent
+    {
+        static const NetMsgID cMessageID = 0xffff00e3;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ViewerStartAuction, unencoded.
+    struct ViewerStartAuction
+    {
+        static const NetMsgID cMessageID = 0xffff00e4;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            int32_t LocalID;
+            RexUUID SnapshotID;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// StartAuction, unencoded.
+    struct StartAuction
+    {
+        static const NetMsgID cMessageID = 0xffff00e5;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+            RexUUID SnapshotID;
+            BufferView Name;
+        };
+        ParcelDataBlock ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ConfirmAuctionStart, unencoded.
+    struct ConfirmAuctionStart
+    {
+        static const NetMsgID cMessageID = 0xffff00e6;
+
+        struct AuctionDataBlock
+        {
+            RexUUID ParcelID;
+            uint32_t AuctionID;
+        };
+        AuctionDataBlock AuctionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CompleteAuction, unencoded.
+    struct CompleteAuction
+    {
+        static const NetMsgID cMessageID = 0xffff00e7;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CancelAuction, unencoded.
+    struct CancelAuction
+    {
+        static const NetMsgID cMessageID = 0xffff00e8;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CheckParcelAuctions, unencoded.
+    struct CheckParcelAuctions
+    {
+        static const NetMsgID cMessageID = 0xffff00e9;
+
+        struct RegionDataBlock
+        {
+            uint64_t RegionHandle;
+        };
+        std::vector<RegionDataBlock> RegionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelAuctions, unencoded.
+    struct ParcelAuctions
+    {
+        static const NetMsgID cMessageID = 0xffff00ea;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+            RexUUID WinnerID;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UUIDNameRequest, unencoded.
+    struct UUIDNameRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00eb;
+
+        struct UUIDNameBlockBlock
+        {
+            RexUUID ID;
+        };
+        std::vector<UUIDNameBlockBlock> UUIDNameBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UUIDNameReply, unencoded.
+    struct UUIDNameReply
+    {
+        static const NetMsgID cMessageID = 0xffff00ec;
+
+        struct UUIDNameBlockBlock
+        {
+            RexUUID ID;
+            BufferView FirstName;
+            BufferView LastName;
+        };
+        std::vector<UUIDNameBlockBlock> UUIDNameBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UUIDGroupNameRequest, unencoded.
+    struct UUIDGroupNameRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00ed;
+
+        struct UUIDNameBlockBlock
+        {
+            RexUUID ID;
+        };
+        std::vector<UUIDNameBlockBlock> UUIDNameBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UUIDGroupNameReply, unencoded.
+    struct UUIDGroupNameReply
+    {
+        static const NetMsgID cMessageID = 0xffff00ee;
+
+        struct UUIDNameBlockBlock
+        {
+            RexUUID ID;
+            BufferView GroupName;
+        };
+        std::vector<UUIDNameBlockBlock> UUIDNameBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChatPass, zero-encoded.
+    struct ChatPass
+    {
+        static const NetMsgID cMessageID = 0xffff00ef;
+
+        struct ChatDataBlock
+        {
+            int32_t Channel;
+            Vector3 Position;
+            RexUUID ID;
+            RexUUID OwnerID;
+            BufferView Name;
+            uint8_t SourceType;
+            uint8_t Type;
+            float Radius;
+            uint8_t SimAccess;
+            BufferView Message;
+        };
+        ChatDataBlock ChatData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChildAgentDying, zero-encoded.
+    struct ChildAgentDying
+    {
+        static const NetMsgID cMessageID = 0xffff00f0;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChildAgentUnknown, unencoded.
+    struct ChildAgentUnknown
+    {
+        static const NetMsgID cMessageID = 0xffff00f1;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// KillChildAgents, unencoded.
+    struct KillChildAgents
+    {
+        static const NetMsgID cMessageID = 0xffff00f2;
+
+        struct IDBlockBlock
+        {
+            RexUUID AgentID;
+        };
+        IDBlockBlock IDBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GetScriptRunning, unencoded.
+    struct GetScriptRunning
+    {
+        static const NetMsgID cMessageID = 0xffff00f3;
+
+        struct ScriptBlock
+        {
+            RexUUID ObjectID;
+            RexUUID ItemID;
+        };
+        ScriptBlock Script;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptRunningReply, unencoded.
+    struct ScriptRunningReply
+    {
+        static const NetMsgID cMessageID = 0xffff00f4;
+
+        struct ScriptBlock
+        {
+            RexUUID ObjectID;
+            RexUUID ItemID;
+            bool Running;
+        };
+        ScriptBlock Script;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetScriptRunning, unencoded.
+    struct SetScriptRunning
+    {
+        static const NetMsgID cMessageID = 0xffff00f5;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ScriptBlock
+        {
+            RexUUID ObjectID;
+            RexUUID ItemID;
+            bool Running;
+        };
+        ScriptBlock Script;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptReset, unencoded.
+    struct ScriptReset
+    {
+        static const NetMsgID cMessageID = 0xffff00f6;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ScriptBlock
+        {
+            RexUUID ObjectID;
+            RexUUID ItemID;
+        };
+        ScriptBlock Script;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptSensorRequest, zero-encoded.
+    struct ScriptSensorRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00f7;
+
+        struct RequesterBlock
+        {
+            RexUUID SourceID;
+            RexUUID RequestID;
+            RexUUID SearchID;
+            Vector3 SearchPos;
+            Quaternion SearchDir;
+            BufferView SearchName;
+            int32_t Type;
+            float Range;
+            float Arc;
+            uint64_t RegionHandle;
+            uint8_t SearchRegions;
+        };
+        RequesterBlock Requester;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptSensorReply, zero-encoded.
+    struct ScriptSensorReply
+    {
+        static const NetMsgID cMessageID = 0xffff00f8;
+
+        struct RequesterBlock
+        {
+            RexUUID SourceID;
+        };
+        RequesterBlock Requester;
+
+        struct SensedDataBlock
+        {
+            RexUUID ObjectID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            Vector3 Position;
+            Vector3 Velocity;
+            Quaternion Rotation;
+            BufferView Name;
+            int32_t Type;
+            float Range;
+        };
+        std::vector<SensedDataBlock> SensedData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CompleteAgentMovement, unencoded.
+    struct CompleteAgentMovement
+    {
+        static const NetMsgID cMessageID = 0xffff00f9;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t CircuitCode;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentMovementComplete, unencoded.
+    struct AgentMovementComplete
+    {
+        static const NetMsgID cMessageID = 0xffff00fa;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            Vector3 Position;
+            Vector3 LookAt;
+            uint64_t RegionHandle;
+            uint32_t Timestamp;
+        };
+        DataBlock Data;
+
+        struct SimDataBlock
+        {
+            BufferView ChannelVersion;
+        };
+        SimDataBlock SimData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DataServerLogout, unencoded.
+    struct DataServerLogout
+    {
+        static const NetMsgID cMessageID = 0xffff00fb;
+
+        struct UserDataBlock
+        {
+            RexUUID AgentID;
+            uint32_t ViewerIP;
+            bool Disconnect;
+            RexUUID SessionID;
+        };
+        UserDataBlock UserData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LogoutRequest, unencoded.
+    struct LogoutRequest
+    {
+        static const NetMsgID cMessageID = 0xffff00fc;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LogoutReply, zero-encoded.
+    struct LogoutReply
+    {
+        static const NetMsgID cMessageID = 0xffff00fd;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ImprovedInstantMessage, zero-encoded.
+    struct ImprovedInstantMessage
+    {
+        static const NetMsgID cMessageID = 0xffff00fe;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MessageBlockBlock
+        {
+            bool FromGroup;
+            RexUUID ToAgentID;
+            uint32_t ParentEstateID;
+            RexUUID RegionID;
+            Vector3 Position;
+            uint8_t Offline;
+            uint8_t Dialog;
+            RexUUID ID;
+            uint32_t Timestamp;
+            BufferView FromAgentName;
+            BufferView Message;
+            BufferView BinaryBucket;
+        };
+        MessageBlockBlock MessageBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RetrieveInstantMessages, unencoded.
+    struct RetrieveInstantMessages
+    {
+        static const NetMsgID cMessageID = 0xffff00ff;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// FindAgent, unencoded.
+    struct FindAgent
+    {
+        static const NetMsgID cMessageID = 0xffff0100;
+
+        struct AgentBlockBlock
+        {
+            RexUUID Hunter;
+            RexUUID Prey;
+            uint32_t SpaceIP;
+        };
+        AgentBlockBlock AgentBlock;
+
+        struct LocationBlockBlock
+        {
+            double GlobalX;
+            double GlobalY;
+        };
+        std::vector<LocationBlockBlock> LocationBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestGodlikePowers, unencoded.
+    struct RequestGodlikePowers
+    {
+        static const NetMsgID cMessageID = 0xffff0101;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RequestBlockBlock
+        {
+            bool Godlike;
+            RexUUID Token;
+        };
+        RequestBlockBlock RequestBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GrantGodlikePowers, unencoded.
+    struct GrantGodlikePowers
+    {
+        static const NetMsgID cMessageID = 0xffff0102;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GrantDataBlock
+        {
+            uint8_t GodLevel;
+            RexUUID Token;
+        };
+        GrantDataBlock GrantData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GodlikeMessage, zero-encoded.
+    struct GodlikeMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0103;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID TransactionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MethodDataBlock
+        {
+            BufferView Method;
+            RexUUID Invoice;
+        };
+        MethodDataBlock MethodData;
+
+        struct ParamListBlock
+        {
+            BufferView Parameter;
+        };
+        std::vector<ParamListBlock> ParamList;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EstateOwnerMessage, zero-encoded.
+    struct EstateOwnerMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0104;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID TransactionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MethodDataBlock
+        {
+            BufferView Method;
+            RexUUID Invoice;
+        };
+        MethodDataBlock MethodData;
+
+        struct ParamListBlock
+        {
+            BufferView Parameter;
+        };
+        std::vector<ParamListBlock> ParamList;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GenericMessage, zero-encoded.
+    struct GenericMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0105;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID TransactionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MethodDataBlock
+        {
+            BufferView Method;
+            RexUUID Invoice;
+        };
+        MethodDataBlock MethodData;
+
+        struct ParamListBlock
+        {
+            BufferView Parameter;
+        };
+        std::vector<ParamListBlock> ParamList;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MuteListRequest, unencoded.
+    struct MuteListRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0106;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MuteDataBlock
+        {
+            uint32_t MuteCRC;
+        };
+        MuteDataBlock MuteData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateMuteListEntry, unencoded.
+    struct UpdateMuteListEntry
+    {
+        static const NetMsgID cMessageID = 0xffff0107;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MuteDataBlock
+        {
+            RexUUID MuteID;
+            BufferView MuteName;
+            int32_t MuteType;
+            uint32_t MuteFlags;
+        };
+        MuteDataBlock MuteData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveMuteListEntry, unencoded.
+    struct RemoveMuteListEntry
+    {
+        static const NetMsgID cMessageID = 0xffff0108;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MuteDataBlock
+        {
+            RexUUID MuteID;
+            BufferView MuteName;
+        };
+        MuteDataBlock MuteData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CopyInventoryFromNotecard, zero-encoded.
+    struct CopyInventoryFromNotecard
+    {
+        static const NetMsgID cMessageID = 0xffff0109;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct NotecardDataBlock
+        {
+            RexUUID NotecardItemID;
+            RexUUID ObjectID;
+        };
+        NotecardDataBlock NotecardData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateInventoryItem, zero-encoded.
+    struct UpdateInventoryItem
+    {
+        static const NetMsgID cMessageID = 0xffff010a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID TransactionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            uint32_t CallbackID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID TransactionID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateCreateInventoryItem, zero-encoded.
+    struct UpdateCreateInventoryItem
+    {
+        static const NetMsgID cMessageID = 0xffff010b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            bool SimApproved;
+            RexUUID TransactionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            uint32_t CallbackID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID AssetID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MoveInventoryItem, zero-encoded.
+    struct MoveInventoryItem
+    {
+        static const NetMsgID cMessageID = 0xffff010c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            bool Stamp;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            BufferView NewName;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CopyInventoryItem, zero-encoded.
+    struct CopyInventoryItem
+    {
+        static const NetMsgID cMessageID = 0xffff010d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            uint32_t CallbackID;
+            RexUUID OldAgentID;
+            RexUUID OldItemID;
+            RexUUID NewFolderID;
+            BufferView NewName;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveInventoryItem, unencoded.
+    struct RemoveInventoryItem
+    {
+        static const NetMsgID cMessageID = 0xffff010e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChangeInventoryItemFlags, unencoded.
+    struct ChangeInventoryItemFlags
+    {
+        static const NetMsgID cMessageID = 0xffff010f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            uint32_t Flags;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SaveAssetIntoInventory, unencoded.
+    struct SaveAssetIntoInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0110;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID NewAssetID;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CreateInventoryFolder, unencoded.
+    struct CreateInventoryFolder
+    {
+        static const NetMsgID cMessageID = 0xffff0111;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+            RexUUID ParentID;
+            int8_t Type;
+            BufferView Name;
+        };
+        FolderDataBlock FolderData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateInventoryFolder, unencoded.
+    struct UpdateInventoryFolder
+    {
+        static const NetMsgID cMessageID = 0xffff0112;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+            RexUUID ParentID;
+            int8_t Type;
+            BufferView Name;
+        };
+        std::vector<FolderDataBlock> FolderData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MoveInventoryFolder, zero-encoded.
+    struct MoveInventoryFolder
+    {
+        static const NetMsgID cMessageID = 0xffff0113;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            bool Stamp;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID FolderID;
+            RexUUID ParentID;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveInventoryFolder, unencoded.
+    struct RemoveInventoryFolder
+    {
+        static const NetMsgID cMessageID = 0xffff0114;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+        };
+        std::vector<FolderDataBlock> FolderData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// FetchInventoryDescendents, zero-encoded.
+    struct FetchInventoryDescendents
+    {
+        static const NetMsgID cMessageID = 0xffff0115;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID FolderID;
+            RexUUID OwnerID;
+            int32_t SortOrder;
+            bool FetchFolders;
+            bool FetchItems;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// InventoryDescendents, zero-encoded.
+    struct InventoryDescendents
+    {
+        static const NetMsgID cMessageID = 0xffff0116;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID FolderID;
+            RexUUID OwnerID;
+            int32_t Version;
+            int32_t Descendents;
+        };
+        AgentDataBlock AgentData;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+            RexUUID ParentID;
+            int8_t Type;
+            BufferView Name;
+        };
+        std::vector<FolderDataBlock> FolderData;
+
+        struct ItemDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID AssetID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        std::vector<ItemDataBlock> ItemData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// FetchInventory, zero-encoded.
+    struct FetchInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0117;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID OwnerID;
+            RexUUID ItemID;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// FetchInventoryReply, zero-encoded.
+    struct FetchInventoryReply
+    {
+        static const NetMsgID cMessageID = 0xffff0118;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID AssetID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// BulkUpdateInventory, zero-encoded.
+    struct BulkUpdateInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0119;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID TransactionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+            RexUUID ParentID;
+            int8_t Type;
+            BufferView Name;
+        };
+        std::vector<FolderDataBlock> FolderData;
+
+        struct ItemDataBlock
+        {
+            RexUUID ItemID;
+            uint32_t CallbackID;
+            RexUUID FolderID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID AssetID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        std::vector<ItemDataBlock> ItemData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestInventoryAsset, unencoded.
+    struct RequestInventoryAsset
+    {
+        static const NetMsgID cMessageID = 0xffff011a;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            RexUUID AgentID;
+            RexUUID OwnerID;
+            RexUUID ItemID;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// InventoryAssetResponse, unencoded.
+    struct InventoryAssetResponse
+    {
+        static const NetMsgID cMessageID = 0xffff011b;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+            RexUUID AssetID;
+            bool IsReadable;
+        };
+        QueryDataBlock QueryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveInventoryObjects, unencoded.
+    struct RemoveInventoryObjects
+    {
+        static const NetMsgID cMessageID = 0xffff011c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+        };
+        std::vector<FolderDataBlock> FolderData;
+
+        struct ItemDataBlock
+        {
+            RexUUID ItemID;
+        };
+        std::vector<ItemDataBlock> ItemData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PurgeInventoryDescendents, zero-encoded.
+    struct PurgeInventoryDescendents
+    {
+        static const NetMsgID cMessageID = 0xffff011d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID FolderID;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateTaskInventory, zero-encoded.
+    struct UpdateTaskInventory
+    {
+        static const NetMsgID cMessageID = 0xffff011e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct UpdateDataBlock
+        {
+            uint32_t LocalID;
+            uint8_t Key;
+        };
+        UpdateDataBlock UpdateData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID TransactionID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveTaskInventory, zero-encoded.
+    struct RemoveTaskInventory
+    {
+        static const NetMsgID cMessageID = 0xffff011f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            uint32_t LocalID;
+            RexUUID ItemID;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MoveTaskInventory, unencoded.
+    struct MoveTaskInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0120;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID FolderID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            uint32_t LocalID;
+            RexUUID ItemID;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestTaskInventory, unencoded.
+    struct RequestTaskInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0121;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryDataBlock
+        {
+            uint32_t LocalID;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ReplyTaskInventory, zero-encoded.
+    struct ReplyTaskInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0122;
+
+        struct InventoryDataBlock
+        {
+            RexUUID TaskID;
+            int16_t Serial;
+            BufferView Filename;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DeRezObject, zero-encoded.
+    struct DeRezObject
+    {
+        static const NetMsgID cMessageID = 0xffff0123;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct AgentBlockBlock
+        {
+            RexUUID GroupID;
+            uint8_t Destination;
+            RexUUID DestinationID;
+            RexUUID TransactionID;
+            uint8_t PacketCount;
+            uint8_t PacketNumber;
+        };
+        AgentBlockBlock AgentBlock;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DeRezAck, unencoded.
+    struct DeRezAck
+    {
+        static const NetMsgID cMessageID = 0xffff0124;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+            bool Success;
+        };
+        TransactionDataBlock TransactionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RezObject, zero-encoded.
+    struct RezObject
+    {
+        static const NetMsgID cMessageID = 0xffff0125;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RezDataBlock
+        {
+            RexUUID FromTaskID;
+            uint8_t BypassRaycast;
+            Vector3 RayStart;
+            Vector3 RayEnd;
+            RexUUID RayTargetID;
+            bool RayEndIsIntersection;
+            bool RezSelected;
+            bool RemoveItem;
+            uint32_t ItemFlags;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+        };
+        RezDataBlock RezData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID TransactionID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RezObjectFromNotecard, zero-encoded.
+    struct RezObjectFromNotecard
+    {
+        static const NetMsgID cMessageID = 0xffff0126;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RezDataBlock
+        {
+            RexUUID FromTaskID;
+            uint8_t BypassRaycast;
+            Vector3 RayStart;
+            Vector3 RayEnd;
+            RexUUID RayTargetID;
+            bool RayEndIsIntersection;
+            bool RezSelected;
+            bool RemoveItem;
+            uint32_t ItemFlags;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+        };
+        RezDataBlock RezData;
+
+        struct NotecardDataBlock
+        {
+            RexUUID NotecardItemID;
+            RexUUID ObjectID;
+        };
+        NotecardDataBlock NotecardData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+        };
+        std::vector<InventoryDataBlock> InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TransferInventory, zero-encoded.
+    struct TransferInventory
+    {
+        static const NetMsgID cMessageID = 0xffff0127;
+
+        struct InfoBlockBlock
+        {
+            RexUUID SourceID;
+            RexUUID DestID;
+            RexUUID TransactionID;
+        };
+        InfoBlockBlock InfoBlock;
+
+        struct InventoryBlockBlock
+        {
+            RexUUID InventoryID;
+            int8_t Type;
+        };
+        std::vector<InventoryBlockBlock> InventoryBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TransferInventoryAck, zero-encoded.
+    struct TransferInventoryAck
+    {
+        static const NetMsgID cMessageID = 0xffff0128;
+
+        struct InfoBlockBlock
+        {
+            RexUUID TransactionID;
+            RexUUID InventoryID;
+        };
+        InfoBlockBlock InfoBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AcceptFriendship, unencoded.
+    struct AcceptFriendship
+    {
+        static const NetMsgID cMessageID = 0xffff0129;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionBlockBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionBlockBlock TransactionBlock;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+        };
+        std::vector<FolderDataBlock> FolderData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DeclineFriendship, unencoded.
+    struct DeclineFriendship
+    {
+        static const NetMsgID cMessageID = 0xffff012a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionBlockBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionBlockBlock TransactionBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// FormFriendship, unencoded.
+    struct FormFriendship
+    {
+        static const NetMsgID cMessageID = 0xffff012b;
+
+        struct AgentBlockBlock
+        {
+            RexUUID SourceID;
+            RexUUID DestID;
+        };
+        AgentBlockBlock AgentBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TerminateFriendship, unencoded.
+    struct TerminateFriendship
+    {
+        static const NetMsgID cMessageID = 0xffff012c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ExBlockBlock
+        {
+            RexUUID OtherID;
+        };
+        ExBlockBlock ExBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// OfferCallingCard, unencoded.
+    struct OfferCallingCard
+    {
+        static const NetMsgID cMessageID = 0xffff012d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct AgentBlockBlock
+        {
+            RexUUID DestID;
+            RexUUID TransactionID;
+        };
+        AgentBlockBlock AgentBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AcceptCallingCard, unencoded.
+    struct AcceptCallingCard
+    {
+        static const NetMsgID cMessageID = 0xffff012e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionBlockBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionBlockBlock TransactionBlock;
+
+        struct FolderDataBlock
+        {
+            RexUUID FolderID;
+        };
+        std::vector<FolderDataBlock> FolderData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DeclineCallingCard, unencoded.
+    struct DeclineCallingCard
+    {
+        static const NetMsgID cMessageID = 0xffff012f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionBlockBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionBlockBlock TransactionBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RezScript, zero-encoded.
+    struct RezScript
+    {
+        static const NetMsgID cMessageID = 0xffff0130;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct UpdateBlockBlock
+        {
+            uint32_t ObjectLocalID;
+            bool Enabled;
+        };
+        UpdateBlockBlock UpdateBlock;
+
+        struct InventoryBlockBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID TransactionID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        InventoryBlockBlock InventoryBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CreateInventoryItem, zero-encoded.
+    struct CreateInventoryItem
+    {
+        static const NetMsgID cMessageID = 0xffff0131;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct InventoryBlockBlock
+        {
+            uint32_t CallbackID;
+            RexUUID FolderID;
+            RexUUID TransactionID;
+            uint32_t NextOwnerMask;
+            int8_t Type;
+            int8_t InvType;
+            uint8_t WearableType;
+            BufferView Name;
+            BufferView Description;
+        };
+        InventoryBlockBlock InventoryBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CreateLandmarkForEvent, zero-encoded.
+    struct CreateLandmarkForEvent
+    {
+        static const NetMsgID cMessageID = 0xffff0132;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct EventDataBlock
+        {
+            uint32_t EventID;
+        };
+        EventDataBlock EventData;
+
+        struct InventoryBlockBlock
+        {
+            RexUUID FolderID;
+            BufferView Name;
+        };
+        InventoryBlockBlock InventoryBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EventLocationRequest, zero-encoded.
+    struct EventLocationRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0133;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct EventDataBlock
+        {
+            uint32_t EventID;
+        };
+        EventDataBlock EventData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EventLocationReply, zero-encoded.
+    struct EventLocationReply
+    {
+        static const NetMsgID cMessageID = 0xffff0134;
+
+        struct QueryDataBlock
+        {
+            RexUUID QueryID;
+        };
+        QueryDataBlock QueryData;
+
+        struct EventDataBlock
+        {
+            bool Success;
+            RexUUID RegionID;
+            Vector3 RegionPos;
+        };
+        EventDataBlock EventData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionHandleRequest, unencoded.
+    struct RegionHandleRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0135;
+
+        struct RequestBlockBlock
+        {
+            RexUUID RegionID;
+        };
+        RequestBlockBlock RequestBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RegionIDAndHandleReply, unencoded.
+    struct RegionIDAndHandleReply
+    {
+        static const NetMsgID cMessageID = 0xffff0136;
+
+        struct ReplyBlockBlock
+        {
+            RexUUID RegionID;
+            uint64_t RegionHandle;
+        };
+        ReplyBlockBlock ReplyBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MoneyTransferRequest, zero-encoded.
+    struct MoneyTransferRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0137;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID SourceID;
+            RexUUID DestID;
+            uint8_t Flags;
+            int32_t Amount;
+            uint8_t AggregatePermNextOwner;
+            uint8_t AggregatePermInventory;
+            int32_t TransactionType;
+            BufferView Description;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MoneyTransferBackend, zero-encoded.
+    struct MoneyTransferBackend
+    {
+        static const NetMsgID cMessageID = 0xffff0138;
+
+        struct MoneyDataBlock
+        {
+            RexUUID TransactionID;
+            uint32_t TransactionTime;
+            RexUUID SourceID;
+            RexUUID DestID;
+            uint8_t Flags;
+            int32_t Amount;
+            uint8_t AggregatePermNextOwner;
+            uint8_t AggregatePermInventory;
+            int32_t TransactionType;
+            RexUUID RegionID;
+            uint32_t GridX;
+            uint32_t GridY;
+            BufferView Description;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MoneyBalanceRequest, zero-encoded.
+    struct MoneyBalanceRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0139;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID TransactionID;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MoneyBalanceReply, zero-encoded.
+    struct MoneyBalanceReply
+    {
+        static const NetMsgID cMessageID = 0xffff013a;
+
+        struct MoneyDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID TransactionID;
+            bool TransactionSuccess;
+            int32_t MoneyBalance;
+            int32_t SquareMetersCredit;
+            int32_t SquareMetersCommitted;
+            BufferView Description;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RoutedMoneyBalanceReply, zero-encoded.
+    struct RoutedMoneyBalanceReply
+    {
+        static const NetMsgID cMessageID = 0xffff013b;
+
+        struct TargetBlockBlock
+        {
+            uint32_t TargetIP;
+            uint16_t TargetPort;
+        };
+        TargetBlockBlock TargetBlock;
+
+        struct MoneyDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID TransactionID;
+            bool TransactionSuccess;
+            int32_t MoneyBalance;
+            int32_t SquareMetersCredit;
+            int32_t SquareMetersCommitted;
+            BufferView Description;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ActivateGestures, unencoded.
+    struct ActivateGestures
+    {
+        static const NetMsgID cMessageID = 0xffff013c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t Flags;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ItemID;
+            RexUUID AssetID;
+            uint32_t GestureFlags;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DeactivateGestures, unencoded.
+    struct DeactivateGestures
+    {
+        static const NetMsgID cMessageID = 0xffff013d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t Flags;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID ItemID;
+            uint32_t GestureFlags;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MuteListUpdate, unencoded.
+    struct MuteListUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff013e;
+
+        struct MuteDataBlock
+        {
+            RexUUID AgentID;
+            BufferView Filename;
+        };
+        MuteDataBlock MuteData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UseCachedMuteList, unencoded.
+    struct UseCachedMuteList
+    {
+        static const NetMsgID cMessageID = 0xffff013f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GrantUserRights, unencoded.
+    struct GrantUserRights
+    {
+        static const NetMsgID cMessageID = 0xffff0140;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RightsBlock
+        {
+            RexUUID AgentRelated;
+            int32_t RelatedRights;
+        };
+        std::vector<RightsBlock> Rights;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ChangeUserRights, unencoded.
+    struct ChangeUserRights
+    {
+        static const NetMsgID cMessageID = 0xffff0141;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RightsBlock
+        {
+            RexUUID AgentRelated;
+            int32_t RelatedRights;
+        };
+        std::vector<RightsBlock> Rights;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// OnlineNotification, unencoded.
+    struct OnlineNotification
+    {
+        static const NetMsgID cMessageID = 0xffff0142;
+
+        struct AgentBlockBlock
+        {
+            RexUUID AgentID;
+        };
+        std::vector<AgentBlockBlock> AgentBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// OfflineNotification, unencoded.
+    struct OfflineNotification
+    {
+        static const NetMsgID cMessageID = 0xffff0143;
+
+        struct AgentBlockBlock
+        {
+            RexUUID AgentID;
+        };
+        std::vector<AgentBlockBlock> AgentBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetStartLocationRequest, zero-encoded.
+    struct SetStartLocationRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0144;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct StartLocationDataBlock
+        {
+            BufferView SimName;
+            uint32_t LocationID;
+            Vector3 LocationPos;
+            Vector3 LocationLookAt;
+        };
+        StartLocationDataBlock StartLocationData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetStartLocation, zero-encoded.
+    struct SetStartLocation
+    {
+        static const NetMsgID cMessageID = 0xffff0145;
+
+        struct StartLocationDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID RegionID;
+            uint32_t LocationID;
+            uint64_t RegionHandle;
+            Vector3 LocationPos;
+            Vector3 LocationLookAt;
+        };
+        StartLocationDataBlock StartLocationData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// NetTest, unencoded.
+    struct NetTest
+    {
+        static const NetMsgID cMessageID = 0xffff0146;
+
+        struct NetBlockBlock
+        {
+            uint16_t Port;
+        };
+        NetBlockBlock NetBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetCPURatio, unencoded.
+    struct SetCPURatio
+    {
+        static const NetMsgID cMessageID = 0xffff0147;
+
+        struct DataBlock
+        {
+            uint8_t Ratio;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SimCrashed, unencoded.
+    struct SimCrashed
+    {
+        static const NetMsgID cMessageID = 0xffff0148;
+
+        struct DataBlock
+        {
+            uint32_t RegionX;
+            uint32_t RegionY;
+        };
+        DataBlock Data;
+
+        struct UsersBlock
+        {
+            RexUUID AgentID;
+        };
+        std::vector<UsersBlock> Users;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// NameValuePair, unencoded.
+    struct NameValuePair
+    {
+        static const NetMsgID cMessageID = 0xffff0149;
+
+        struct TaskDataBlock
+        {
+            RexUUID ID;
+        };
+        TaskDataBlock TaskData;
+
+        struct NameValueDataBlock
+        {
+            BufferView NVPair;
+        };
+        std::vector<NameValueDataBlock> NameValueData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveNameValuePair, unencoded.
+    struct RemoveNameValuePair
+    {
+        static const NetMsgID cMessageID = 0xffff014a;
+
+        struct TaskDataBlock
+        {
+            RexUUID ID;
+        };
+        TaskDataBlock TaskData;
+
+        struct NameValueDataBlock
+        {
+            BufferView NVPair;
+        };
+        std::vector<NameValueDataBlock> NameValueData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateAttachment, zero-encoded.
+    struct UpdateAttachment
+    {
+        static const NetMsgID cMessageID = 0xffff014b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct AttachmentBlockBlock
+        {
+            uint8_t AttachmentPoint;
+        };
+        AttachmentBlockBlock AttachmentBlock;
+
+        struct OperationDataBlock
+        {
+            bool AddItem;
+            bool UseExistingAsset;
+        };
+        OperationDataBlock OperationData;
+
+        struct InventoryDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID FolderID;
+            RexUUID CreatorID;
+            RexUUID OwnerID;
+            RexUUID GroupID;
+            uint32_t BaseMask;
+            uint32_t OwnerMask;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            bool GroupOwned;
+            RexUUID AssetID;
+            int8_t Type;
+            int8_t InvType;
+            uint32_t Flags;
+            uint8_t SaleType;
+            int32_t SalePrice;
+            BufferView Name;
+            BufferView Description;
+            int32_t CreationDate;
+            uint32_t CRC;
+        };
+        InventoryDataBlock InventoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RemoveAttachment, unencoded.
+    struct RemoveAttachment
+    {
+        static const NetMsgID cMessageID = 0xffff014c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct AttachmentBlockBlock
+        {
+            uint8_t AttachmentPoint;
+            RexUUID ItemID;
+        };
+        AttachmentBlockBlock AttachmentBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AssetUploadRequest, unencoded.
+    struct AssetUploadRequest
+    {
+        static const NetMsgID cMessageID = 0xffff014d;
+
+        struct AssetBlockBlock
+        {
+            RexUUID TransactionID;
+            int8_t Type;
+            bool Tempfile;
+            bool StoreLocal;
+            BufferView AssetData;
+        };
+        AssetBlockBlock AssetBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AssetUploadComplete, unencoded.
+    struct AssetUploadComplete
+    {
+        static const NetMsgID cMessageID = 0xffff014e;
+
+        struct AssetBlockBlock
+        {
+            RexUUID UUID;
+            int8_t Type;
+            bool Success;
+        };
+        AssetBlockBlock AssetBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EmailMessageRequest, unencoded.
+    struct EmailMessageRequest
+    {
+        static const NetMsgID cMessageID = 0xffff014f;
+
+        struct DataBlockBlock
+        {
+            RexUUID ObjectID;
+            BufferView FromAddress;
+            BufferView Subject;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EmailMessageReply, unencoded.
+    struct EmailMessageReply
+    {
+        static const NetMsgID cMessageID = 0xffff0150;
+
+        struct DataBlockBlock
+        {
+            RexUUID ObjectID;
+            uint32_t More;
+            uint32_t Time;
+            BufferView FromAddress;
+            BufferView Subject;
+            BufferView Data;
+            BufferView MailFilter;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptDataRequest, unencoded.
+    struct ScriptDataRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0151;
+
+        struct DataBlockBlock
+        {
+            uint64_t Hash;
+            int8_t RequestType;
+            BufferView Request;
+        };
+        std::vector<DataBlockBlock> DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptDataReply, unencoded.
+    struct ScriptDataReply
+    {
+        static const NetMsgID cMessageID = 0xffff0152;
+
+        struct DataBlockBlock
+        {
+            uint64_t Hash;
+            BufferView Reply;
+        };
+        std::vector<DataBlockBlock> DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CreateGroupRequest, zero-encoded.
+    struct CreateGroupRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0153;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            BufferView Name;
+            BufferView Charter;
+            bool ShowInList;
+            RexUUID InsigniaID;
+            int32_t MembershipFee;
+            bool OpenEnrollment;
+            bool AllowPublish;
+            bool MaturePublish;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CreateGroupReply, unencoded.
+    struct CreateGroupReply
+    {
+        static const NetMsgID cMessageID = 0xffff0154;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ReplyDataBlock
+        {
+            RexUUID GroupID;
+            bool Success;
+            BufferView Message;
+        };
+        ReplyDataBlock ReplyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateGroupInfo, zero-encoded.
+    struct UpdateGroupInfo
+    {
+        static const NetMsgID cMessageID = 0xffff0155;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            BufferView Charter;
+            bool ShowInList;
+            RexUUID InsigniaID;
+            int32_t MembershipFee;
+            bool OpenEnrollment;
+            bool AllowPublish;
+            bool MaturePublish;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupRoleChanges, unencoded.
+    struct GroupRoleChanges
+    {
+        static const NetMsgID cMessageID = 0xffff0156;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RoleChangeBlock
+        {
+            RexUUID RoleID;
+            RexUUID MemberID;
+            uint32_t Change;
+        };
+        std::vector<RoleChangeBlock> RoleChange;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// JoinGroupRequest, zero-encoded.
+    struct JoinGroupRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0157;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// JoinGroupReply, unencoded.
+    struct JoinGroupReply
+    {
+        static const NetMsgID cMessageID = 0xffff0158;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            bool Success;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EjectGroupMemberRequest, unencoded.
+    struct EjectGroupMemberRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0159;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        struct EjectDataBlock
+        {
+            RexUUID EjecteeID;
+        };
+        std::vector<EjectDataBlock> EjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// EjectGroupMemberReply, unencoded.
+    struct EjectGroupMemberReply
+    {
+        static const NetMsgID cMessageID = 0xffff015a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        struct EjectDataBlock
+        {
+            bool Success;
+        };
+        EjectDataBlock EjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LeaveGroupRequest, unencoded.
+    struct LeaveGroupRequest
+    {
+        static const NetMsgID cMessageID = 0xffff015b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LeaveGroupReply, unencoded.
+    struct LeaveGroupReply
+    {
+        static const NetMsgID cMessageID = 0xffff015c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            bool Success;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// InviteGroupRequest, unencoded.
+    struct InviteGroupRequest
+    {
+        static const NetMsgID cMessageID = 0xffff015d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        struct InviteDataBlock
+        {
+            RexUUID InviteeID;
+            RexUUID RoleID;
+        };
+        std::vector<InviteDataBlock> InviteData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// InviteGroupResponse, unencoded.
+    struct InviteGroupResponse
+    {
+        static const NetMsgID cMessageID = 0xffff015e;
+
+        struct InviteDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID InviteeID;
+            RexUUID GroupID;
+            RexUUID RoleID;
+            int32_t MembershipFee;
+        };
+        InviteDataBlock InviteData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupProfileRequest, unencoded.
+    struct GroupProfileRequest
+    {
+        static const NetMsgID cMessageID = 0xffff015f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupProfileReply, zero-encoded.
+    struct GroupProfileReply
+    {
+        static const NetMsgID cMessageID = 0xffff0160;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            BufferView Name;
+            BufferView Charter;
+            bool ShowInList;
+            BufferView MemberTitle;
+            uint64_t PowersMask;
+            RexUUID InsigniaID;
+            RexUUID FounderID;
+            int32_t MembershipFee;
+            bool OpenEnrollment;
+            int32_t Money;
+            int32_t GroupMembershipCount;
+            int32_t GroupRolesCount;
+            bool AllowPublish;
+            bool MaturePublish;
+            RexUUID OwnerRole;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupAccountSummaryRequest, zero-encoded.
+    struct GroupAccountSummaryRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0161;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID RequestID;
+            int32_t IntervalDays;
+            int32_t CurrentInterval;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupAccountSummaryReply, zero-encoded.
+    struct GroupAccountSummaryReply
+    {
+        static const NetMsgID cMessageID = 0xffff0162;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID RequestID;
+            int32_t IntervalDays;
+            int32_t CurrentInterval;
+            BufferView StartDate;
+            int32_t Balance;
+            int32_t TotalCredits;
+            int32_t TotalDebits;
+            int32_t ObjectTaxCurrent;
+            int32_t LightTaxCurrent;
+            int32_t LandTaxCurrent;
+            int32_t GroupTaxCurrent;
+            int32_t ParcelDirFeeCurrent;
+            int32_t ObjectTaxEstimate;
+            int32_t LightTaxEstimate;
+            int32_t LandTaxEstimate;
+            int32_t GroupTaxEstimate;
+            int32_t ParcelDirFeeEstimate;
+            int32_t NonExemptMembers;
+            BufferView LastTaxDate;
+            BufferView TaxDate;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupAccountDetailsRequest, zero-encoded.
+    struct GroupAccountDetailsRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0163;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID RequestID;
+            int32_t IntervalDays;
+            int32_t CurrentInterval;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupAccountDetailsReply, zero-encoded.
+    struct GroupAccountDetailsReply
+    {
+        static const NetMsgID cMessageID = 0xffff0164;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID RequestID;
+            int32_t IntervalDays;
+            int32_t CurrentInterval;
+            BufferView StartDate;
+        };
+        MoneyDataBlock MoneyData;
+
+        struct HistoryDataBlock
+        {
+            BufferView Description;
+            int32_t Amount;
+        };
+        std::vector<HistoryDataBlock> HistoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupAccountTransactionsRequest, zero-encoded.
+    struct GroupAccountTransactionsRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0165;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID RequestID;
+            int32_t IntervalDays;
+            int32_t CurrentInterval;
+        };
+        MoneyDataBlock MoneyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupAccountTransactionsReply, zero-encoded.
+    struct GroupAccountTransactionsReply
+    {
+        static const NetMsgID cMessageID = 0xffff0166;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct MoneyDataBlock
+        {
+            RexUUID RequestID;
+            int32_t IntervalDays;
+            int32_t CurrentInterval;
+            BufferView StartDate;
+        };
+        MoneyDataBlock MoneyData;
+
+        struct HistoryDataBlock
+        {
+            BufferView Time;
+            BufferView User;
+            int32_t Type;
+            BufferView Item;
+            int32_t Amount;
+        };
+        std::vector<HistoryDataBlock> HistoryData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupActiveProposalsRequest, unencoded.
+    struct GroupActiveProposalsRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0167;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionDataBlock TransactionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupActiveProposalItemReply, zero-encoded.
+    struct GroupActiveProposalItemReply
+    {
+        static const NetMsgID cMessageID = 0xffff0168;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+            uint32_t TotalNumItems;
+        };
+        TransactionDataBlock TransactionData;
+
+        struct ProposalDataBlock
+        {
+            RexUUID VoteID;
+            RexUUID VoteInitiator;
+            BufferView TerseDateID;
+            BufferView StartDateTime;
+            BufferView EndDateTime;
+            bool AlreadyVoted;
+            BufferView VoteCast;
+            float Majority;
+            int32_t Quorum;
+            BufferView ProposalText;
+        };
+        std::vector<ProposalDataBlock> ProposalData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupVoteHistoryRequest, unencoded.
+    struct GroupVoteHistoryRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0169;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+        };
+        GroupDataBlock GroupData;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+        };
+        TransactionDataBlock TransactionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupVoteHistoryItemReply, zero-encoded.
+    struct GroupVoteHistoryItemReply
+    {
+        static const NetMsgID cMessageID = 0xffff016a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct TransactionDataBlock
+        {
+            RexUUID TransactionID;
+            uint32_t TotalNumItems;
+        };
+        TransactionDataBlock TransactionData;
+
+        struct HistoryItemDataBlock
+        {
+            RexUUID VoteID;
+            BufferView TerseDateID;
+            BufferView StartDateTime;
+            BufferView EndDateTime;
+            RexUUID VoteInitiator;
+            BufferView VoteType;
+            BufferView VoteResult;
+            float Majority;
+            int32_t Quorum;
+            BufferView ProposalText;
+        };
+        HistoryItemDataBlock HistoryItemData;
+
+        struct VoteItemBlock
+        {
+            RexUUID CandidateID;
+            BufferView VoteCast;
+            int32_t NumVotes;
+        };
+        std::vector<VoteItemBlock> VoteItem;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// StartGroupProposal, zero-encoded.
+    struct StartGroupProposal
+    {
+        static const NetMsgID cMessageID = 0xffff016b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ProposalDataBlock
+        {
+            RexUUID GroupID;
+            int32_t Quorum;
+            float Majority;
+            int32_t Duration;
+            BufferView ProposalText;
+        };
+        ProposalDataBlock ProposalData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupProposalBallot, unencoded.
+    struct GroupProposalBallot
+    {
+        static const NetMsgID cMessageID = 0xffff016c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ProposalDataBlock
+        {
+            RexUUID ProposalID;
+            RexUUID GroupID;
+            BufferView VoteCast;
+        };
+        ProposalDataBlock ProposalData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// TallyVotes, unencoded.
+    struct TallyVotes
+    {
+        static const NetMsgID cMessageID = 0xffff016d;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupMembersRequest, unencoded.
+    struct GroupMembersRequest
+    {
+        static const NetMsgID cMessageID = 0xffff016e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            RexUUID RequestID;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupMembersReply, zero-encoded.
+    struct GroupMembersReply
+    {
+        static const NetMsgID cMessageID = 0xffff016f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            RexUUID RequestID;
+            int32_t MemberCount;
+        };
+        GroupDataBlock GroupData;
+
+        struct MemberDataBlock
+        {
+            RexUUID AgentID;
+            int32_t Contribution;
+            BufferView OnlineStatus;
+            uint64_t AgentPowers;
+            BufferView Title;
+            bool IsOwner;
+        };
+        std::vector<MemberDataBlock> MemberData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ActivateGroup, zero-encoded.
+    struct ActivateGroup
+    {
+        static const NetMsgID cMessageID = 0xffff0170;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetGroupContribution, unencoded.
+    struct SetGroupContribution
+    {
+        static const NetMsgID cMessageID = 0xffff0171;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID GroupID;
+            int32_t Contribution;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SetGroupAcceptNotices, unencoded.
+    struct SetGroupAcceptNotices
+    {
+        static const NetMsgID cMessageID = 0xffff0172;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            RexUUID GroupID;
+            bool AcceptNotices;
+        };
+        DataBlock Data;
+
+        struct NewDataBlock
+        {
+            bool ListInProfile;
+        };
+        NewDataBlock NewData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupRoleDataRequest, unencoded.
+    struct GroupRoleDataRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0173;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            RexUUID RequestID;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupRoleDataReply, unencoded.
+    struct GroupRoleDataReply
+    {
+        static const NetMsgID cMessageID = 0xffff0174;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            RexUUID RequestID;
+            int32_t RoleCount;
+        };
+        GroupDataBlock GroupData;
+
+        struct RoleDataBlock
+        {
+            RexUUID RoleID;
+            BufferView Name;
+            BufferView Title;
+            BufferView Description;
+            uint64_t Powers;
+            uint32_t Members;
+        };
+        std::vector<RoleDataBlock> RoleData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupRoleMembersRequest, unencoded.
+    struct GroupRoleMembersRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0175;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            RexUUID RequestID;
+        };
+        GroupDataBlock GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupRoleMembersReply, unencoded.
+    struct GroupRoleMembersReply
+    {
+        static const NetMsgID cMessageID = 0xffff0176;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+            RexUUID RequestID;
+            uint32_t TotalPairs;
+        };
+        AgentDataBlock AgentData;
+
+        struct MemberDataBlock
+        {
+            RexUUID RoleID;
+            RexUUID MemberID;
+        };
+        std::vector<MemberDataBlock> MemberData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupTitlesRequest, unencoded.
+    struct GroupTitlesRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0177;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+            RexUUID RequestID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupTitlesReply, zero-encoded.
+    struct GroupTitlesReply
+    {
+        static const NetMsgID cMessageID = 0xffff0178;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+            RexUUID RequestID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            BufferView Title;
+            RexUUID RoleID;
+            bool Selected;
+        };
+        std::vector<GroupDataBlock> GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupTitleUpdate, unencoded.
+    struct GroupTitleUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0179;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+            RexUUID TitleRoleID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupRoleUpdate, unencoded.
+    struct GroupRoleUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff017a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RoleDataBlock
+        {
+            RexUUID RoleID;
+            BufferView Name;
+            BufferView Description;
+            BufferView Title;
+            uint64_t Powers;
+            uint8_t UpdateType;
+        };
+        std::vector<RoleDataBlock> RoleData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LiveHelpGroupRequest, unencoded.
+    struct LiveHelpGroupRequest
+    {
+        static const NetMsgID cMessageID = 0xffff017b;
+
+        struct RequestDataBlock
+        {
+            RexUUID RequestID;
+            RexUUID AgentID;
+        };
+        RequestDataBlock RequestData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LiveHelpGroupReply, unencoded.
+    struct LiveHelpGroupReply
+    {
+        static const NetMsgID cMessageID = 0xffff017c;
+
+        struct ReplyDataBlock
+        {
+            RexUUID RequestID;
+            RexUUID GroupID;
+            BufferView Selection;
+        };
+        ReplyDataBlock ReplyData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentWearablesRequest, unencoded.
+    struct AgentWearablesRequest
+    {
+        static const NetMsgID cMessageID = 0xffff017d;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentWearablesUpdate, zero-encoded.
+    struct AgentWearablesUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff017e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t SerialNum;
+        };
+        AgentDataBlock AgentData;
+
+        struct WearableDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID AssetID;
+            uint8_t WearableType;
+        };
+        std::vector<WearableDataBlock> WearableData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentIsNowWearing, zero-encoded.
+    struct AgentIsNowWearing
+    {
+        static const NetMsgID cMessageID = 0xffff017f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct WearableDataBlock
+        {
+            RexUUID ItemID;
+            uint8_t WearableType;
+        };
+        std::vector<WearableDataBlock> WearableData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentCachedTexture, unencoded.
+    struct AgentCachedTexture
+    {
+        static const NetMsgID cMessageID = 0xffff0180;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            int32_t SerialNum;
+        };
+        AgentDataBlock AgentData;
+
+        struct WearableDataBlock
+        {
+            RexUUID ID;
+            uint8_t TextureIndex;
+        };
+        std::vector<WearableDataBlock> WearableData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentCachedTextureResponse, unencoded.
+    struct AgentCachedTextureResponse
+    {
+        static const NetMsgID cMessageID = 0xffff0181;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            int32_t SerialNum;
+        };
+        AgentDataBlock AgentData;
+
+        struct WearableDataBlock
+        {
+            RexUUID TextureID;
+            uint8_t TextureIndex;
+            BufferView HostName;
+        };
+        std::vector<WearableDataBlock> WearableData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentDataUpdateRequest, unencoded.
+    struct AgentDataUpdateRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0182;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentDataUpdate, zero-encoded.
+    struct AgentDataUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0183;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            BufferView FirstName;
+            BufferView LastName;
+            BufferView GroupTitle;
+            RexUUID ActiveGroupID;
+            uint64_t GroupPowers;
+            BufferView GroupName;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// GroupDataUpdate, zero-encoded.
+    struct GroupDataUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0184;
+
+        struct AgentGroupDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+            uint64_t AgentPowers;
+            BufferView GroupTitle;
+        };
+        std::vector<AgentGroupDataBlock> AgentGroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentGroupDataUpdate, zero-encoded.
+    struct AgentGroupDataUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff0185;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct GroupDataBlock
+        {
+            RexUUID GroupID;
+            uint64_t GroupPowers;
+            bool AcceptNotices;
+            RexUUID GroupInsigniaID;
+            int32_t Contribution;
+            BufferView GroupName;
+        };
+        std::vector<GroupDataBlock> GroupData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// AgentDropGroup, zero-encoded.
+    struct AgentDropGroup
+    {
+        static const NetMsgID cMessageID = 0xffff0186;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID GroupID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LogTextMessage, zero-encoded.
+    struct LogTextMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0187;
+
+        struct DataBlockBlock
+        {
+            RexUUID FromAgentId;
+            RexUUID ToAgentId;
+            double GlobalX;
+            double GlobalY;
+            uint32_t Time;
+            BufferView Message;
+        };
+        std::vector<DataBlockBlock> DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CreateTrustedCircuit, unencoded.
+    struct CreateTrustedCircuit
+    {
+        static const NetMsgID cMessageID = 0xffff0188;
+
+        struct DataBlockBlock
+        {
+            RexUUID EndPointID;
+            BufferView Digest;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DenyTrustedCircuit, unencoded.
+    struct DenyTrustedCircuit
+    {
+        static const NetMsgID cMessageID = 0xffff0189;
+
+        struct DataBlockBlock
+        {
+            RexUUID EndPointID;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RequestTrustedCircuit, unencoded.
+    struct RequestTrustedCircuit
+    {
+        static const NetMsgID cMessageID = 0xffff018a;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RezSingleAttachmentFromInv, zero-encoded.
+    struct RezSingleAttachmentFromInv
+    {
+        static const NetMsgID cMessageID = 0xffff018b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID OwnerID;
+            uint8_t AttachmentPt;
+            uint32_t ItemFlags;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            BufferView Name;
+            BufferView Description;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RezMultipleAttachmentsFromInv, zero-encoded.
+    struct RezMultipleAttachmentsFromInv
+    {
+        static const NetMsgID cMessageID = 0xffff018c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct HeaderDataBlock
+        {
+            RexUUID CompoundMsgID;
+            uint8_t TotalObjects;
+            bool FirstDetachAll;
+        };
+        HeaderDataBlock HeaderData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID ItemID;
+            RexUUID OwnerID;
+            uint8_t AttachmentPt;
+            uint32_t ItemFlags;
+            uint32_t GroupMask;
+            uint32_t EveryoneMask;
+            uint32_t NextOwnerMask;
+            BufferView Name;
+            BufferView Description;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// DetachAttachmentIntoInv, unencoded.
+    struct DetachAttachmentIntoInv
+    {
+        static const NetMsgID cMessageID = 0xffff018d;
+
+        struct ObjectDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID ItemID;
+        };
+        ObjectDataBlock ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CreateNewOutfitAttachments, unencoded.
+    struct CreateNewOutfitAttachments
+    {
+        static const NetMsgID cMessageID = 0xffff018e;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct HeaderDataBlock
+        {
+            RexUUID NewFolderID;
+        };
+        HeaderDataBlock HeaderData;
+
+        struct ObjectDataBlock
+        {
+            RexUUID OldItemID;
+            RexUUID OldFolderID;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UserInfoRequest, unencoded.
+    struct UserInfoRequest
+    {
+        static const NetMsgID cMessageID = 0xffff018f;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UserInfoReply, unencoded.
+    struct UserInfoReply
+    {
+        static const NetMsgID cMessageID = 0xffff0190;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct UserDataBlock
+        {
+            bool IMViaEMail;
+            BufferView DirectoryVisibility;
+            BufferView EMail;
+        };
+        UserDataBlock UserData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// UpdateUserInfo, unencoded.
+    struct UpdateUserInfo
+    {
+        static const NetMsgID cMessageID = 0xffff0191;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct UserDataBlock
+        {
+            bool IMViaEMail;
+            BufferView DirectoryVisibility;
+        };
+        UserDataBlock UserData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelRename, unencoded.
+    struct ParcelRename
+    {
+        static const NetMsgID cMessageID = 0xffff0192;
+
+        struct ParcelDataBlock
+        {
+            RexUUID ParcelID;
+            BufferView NewName;
+        };
+        std::vector<ParcelDataBlock> ParcelData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// InitiateDownload, unencoded.
+    struct InitiateDownload
+    {
+        static const NetMsgID cMessageID = 0xffff0193;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct FileDataBlock
+        {
+            BufferView SimFilename;
+            BufferView ViewerFilename;
+        };
+        FileDataBlock FileData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SystemMessage, zero-encoded.
+    struct SystemMessage
+    {
+        static const NetMsgID cMessageID = 0xffff0194;
+
+        struct MethodDataBlock
+        {
+            BufferView Method;
+            RexUUID Invoice;
+            BufferView Digest;
+        };
+        MethodDataBlock MethodData;
+
+        struct ParamListBlock
+        {
+            BufferView Parameter;
+        };
+        std::vector<ParamListBlock> ParamList;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MapLayerRequest, unencoded.
+    struct MapLayerRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0195;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t Flags;
+            uint32_t EstateID;
+            bool Godlike;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MapLayerReply, unencoded.
+    struct MapLayerReply
+    {
+        static const NetMsgID cMessageID = 0xffff0196;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            uint32_t Flags;
+        };
+        AgentDataBlock AgentData;
+
+        struct LayerDataBlock
+        {
+            uint32_t Left;
+            uint32_t Right;
+            uint32_t Top;
+            uint32_t Bottom;
+            RexUUID ImageID;
+        };
+        std::vector<LayerDataBlock> LayerData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MapBlockRequest, unencoded.
+    struct MapBlockRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0197;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t Flags;
+            uint32_t EstateID;
+            bool Godlike;
+        };
+        AgentDataBlock AgentData;
+
+        struct PositionDataBlock
+        {
+            uint16_t MinX;
+            uint16_t MaxX;
+            uint16_t MinY;
+            uint16_t MaxY;
+        };
+        PositionDataBlock PositionData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MapNameRequest, unencoded.
+    struct MapNameRequest
+    {
+        static const NetMsgID cMessageID = 0xffff0198;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t Flags;
+            uint32_t EstateID;
+            bool Godlike;
+        };
+        AgentDataBlock AgentData;
+
+        struct NameDataBlock
+        {
+            BufferView Name;
+        };
+        NameDataBlock NameData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MapBlockReply, unencoded.
+    struct MapBlockReply
+    {
+        static const NetMsgID cMessageID = 0xffff0199;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            uint32_t Flags;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            uint16_t X;
+            uint16_t Y;
+            BufferView Name;
+            uint8_t Access;
+            uint32_t RegionFlags;
+            uint8_t WaterHeight;
+            uint8_t Agents;
+            RexUUID MapImageID;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MapItemRequest, unencoded.
+    struct MapItemRequest
+    {
+        static const NetMsgID cMessageID = 0xffff019a;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            uint32_t Flags;
+            uint32_t EstateID;
+            bool Godlike;
+        };
+        AgentDataBlock AgentData;
+
+        struct RequestDataBlock
+        {
+            uint32_t ItemType;
+            uint64_t RegionHandle;
+        };
+        RequestDataBlock RequestData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// MapItemReply, unencoded.
+    struct MapItemReply
+    {
+        static const NetMsgID cMessageID = 0xffff019b;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            uint32_t Flags;
+        };
+        AgentDataBlock AgentData;
+
+        struct RequestDataBlock
+        {
+            uint32_t ItemType;
+        };
+        RequestDataBlock RequestData;
+
+        struct DataBlock
+        {
+            uint32_t X;
+            uint32_t Y;
+            RexUUID ID;
+            int32_t Extra;
+            int32_t Extra2;
+            BufferView Name;
+        };
+        std::vector<DataBlock> Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// SendPostcard, unencoded.
+    struct SendPostcard
+    {
+        static const NetMsgID cMessageID = 0xffff019c;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+            RexUUID AssetID;
+            Vector3d PosGlobal;
+            BufferView To;
+            BufferView From;
+            BufferView Name;
+            BufferView Subject;
+            BufferView Msg;
+            bool AllowPublish;
+            bool MaturePublish;
+        };
+        AgentDataBlock AgentData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RpcChannelRequest, unencoded.
+    struct RpcChannelRequest
+    {
+        static const NetMsgID cMessageID = 0xffff019d;
+
+        struct DataBlockBlock
+        {
+            uint32_t GridX;
+            uint32_t GridY;
+            RexUUID TaskID;
+            RexUUID ItemID;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RpcChannelReply, unencoded.
+    struct RpcChannelReply
+    {
+        static const NetMsgID cMessageID = 0xffff019e;
+
+        struct DataBlockBlock
+        {
+            RexUUID TaskID;
+            RexUUID ItemID;
+            RexUUID ChannelID;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RpcScriptRequestInbound, unencoded.
+    struct RpcScriptRequestInbound
+    {
+        static const NetMsgID cMessageID = 0xffff019f;
+
+        struct TargetBlockBlock
+        {
+            uint32_t GridX;
+            uint32_t GridY;
+        };
+        TargetBlockBlock TargetBlock;
+
+        struct DataBlockBlock
+        {
+            RexUUID TaskID;
+            RexUUID ItemID;
+            RexUUID ChannelID;
+            uint32_t IntValue;
+            BufferView StringValue;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RpcScriptRequestInboundForward, unencoded.
+    struct RpcScriptRequestInboundForward
+    {
+        static const NetMsgID cMessageID = 0xffff01a0;
+
+        struct DataBlockBlock
+        {
+            uint32_t RPCServerIP;
+            uint16_t RPCServerPort;
+            RexUUID TaskID;
+            RexUUID ItemID;
+            RexUUID ChannelID;
+            uint32_t IntValue;
+            BufferView StringValue;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RpcScriptReplyInbound, unencoded.
+    struct RpcScriptReplyInbound
+    {
+        static const NetMsgID cMessageID = 0xffff01a1;
+
+        struct DataBlockBlock
+        {
+            RexUUID TaskID;
+            RexUUID ItemID;
+            RexUUID ChannelID;
+            uint32_t IntValue;
+            BufferView StringValue;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ScriptMailRegistration, unencoded.
+    struct ScriptMailRegistration
+    {
+        static const NetMsgID cMessageID = 0xffff01a2;
+
+        struct DataBlockBlock
+        {
+            BufferView TargetIP;
+            uint16_t TargetPort;
+            RexUUID TaskID;
+            uint32_t Flags;
+        };
+        DataBlockBlock DataBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelMediaCommandMessage, unencoded.
+    struct ParcelMediaCommandMessage
+    {
+        static const NetMsgID cMessageID = 0xffff01a3;
+
+        struct CommandBlockBlock
+        {
+            uint32_t Flags;
+            uint32_t Command;
+            float Time;
+        };
+        CommandBlockBlock CommandBlock;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ParcelMediaUpdate, unencoded.
+    struct ParcelMediaUpdate
+    {
+        static const NetMsgID cMessageID = 0xffff01a4;
+
+        struct DataBlockBlock
+        {
+            BufferView MediaURL;
+            RexUUID MediaID;
+            uint8_t MediaAutoScale;
+        };
+        DataBlockBlock DataBlock;
+
+        struct DataBlockExtendedBlock
+        {
+            BufferView MediaType;
+            BufferView MediaDesc;
+            int32_t MediaWidth;
+            int32_t MediaHeight;
+            uint8_t MediaLoop;
+        };
+        DataBlockExtendedBlock DataBlockExtended;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LandStatRequest, unencoded.
+    struct LandStatRequest
+    {
+        static const NetMsgID cMessageID = 0xffff01a5;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct RequestDataBlock
+        {
+            uint32_t ReportType;
+            uint32_t RequestFlags;
+            BufferView Filter;
+            int32_t ParcelLocalID;
+        };
+        RequestDataBlock RequestData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// LandStatReply, unencoded.
+    struct LandStatReply
+    {
+        static const NetMsgID cMessageID = 0xffff01a6;
+
+        struct RequestDataBlock
+        {
+            uint32_t ReportType;
+            uint32_t RequestFlags;
+            uint32_t TotalObjectCount;
+        };
+        RequestDataBlock RequestData;
+
+        struct ReportDataBlock
+        {
+            uint32_t TaskLocalID;
+            RexUUID TaskID;
+            float LocationX;
+            float LocationY;
+            float LocationZ;
+            float Score;
+            BufferView TaskName;
+            BufferView OwnerName;
+        };
+        std::vector<ReportDataBlock> ReportData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// Error, zero-encoded.
+    struct Error
+    {
+        static const NetMsgID cMessageID = 0xffff01a7;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+        };
+        AgentDataBlock AgentData;
+
+        struct DataBlock
+        {
+            int32_t Code;
+            BufferView Token;
+            RexUUID ID;
+            BufferView System;
+            BufferView Message;
+            BufferView Data;
+        };
+        DataBlock Data;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// ObjectIncludeInSearch, unencoded.
+    struct ObjectIncludeInSearch
+    {
+        static const NetMsgID cMessageID = 0xffff01a8;
+
+        struct AgentDataBlock
+        {
+            RexUUID AgentID;
+            RexUUID SessionID;
+        };
+        AgentDataBlock AgentData;
+
+        struct ObjectDataBlock
+        {
+            uint32_t ObjectLocalID;
+            bool IncludeInSearch;
+        };
+        std::vector<ObjectDataBlock> ObjectData;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RexImageInfo, unencoded.
+    struct RexImageInfo
+    {
+        static const NetMsgID cMessageID = 0xffff2710;
+
+        struct ImageInfoBlock
+        {
+            RexUUID ImageID;
+            BufferView MediaURL;
+        };
+        ImageInfoBlock ImageInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// RexSkyboxInfo, unencoded.
+    struct RexSkyboxInfo
+    {
+        static const NetMsgID cMessageID = 0xffff2711;
+
+        struct TexturesBlock
+        {
+            RexUUID FrontTextureID;
+            RexUUID BackTextureID;
+            RexUUID LeftTextureID;
+            RexUUID RightTextureID;
+            RexUUID TopTextureID;
+            RexUUID BottomTextureID;
+        };
+        TexturesBlock Textures;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// PacketAck, unencoded.
+    struct PacketAck
+    {
+        static const NetMsgID cMessageID = 0xfffffffb;
+
+        struct PacketsBlock
+        {
+            uint32_t ID;
+        };
+        std::vector<PacketsBlock> Packets;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// OpenCircuit, unencoded.
+    struct OpenCircuit
+    {
+        static const NetMsgID cMessageID = 0xfffffffc;
+
+        struct CircuitInfoBlock
+        {
+            uint32_t IP;
+            uint16_t Port;
+        };
+        CircuitInfoBlock CircuitInfo;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+    /// CloseCircuit, unencoded.
+    struct CloseCircuit
+    {
+        static const NetMsgID cMessageID = 0xfffffffd;
+
+        bool Decode(const uint8_t *data, size_t numBytes);
+        void Encode(NetOutMessage &msg) const;
+    };
+
+}
+}
+
+#endif
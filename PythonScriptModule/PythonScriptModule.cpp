@@ -864,6 +864,80 @@ PyObject* GetEntityByUUID(PyObject *self, PyObject *args)
     }
 }
 
+//! Returns a list of entity ids
+static PyObject* EntityIdList(const std::vector<entity_id_t> &ids)
+{
+    PyObject* py_ids = PyList_New(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i)
+        PyList_SET_ITEM(py_ids, i, Py_BuildValue("I", ids[i]));
+    return py_ids;
+}
+
+PyObject* GetEntitiesInRadius(PyObject *self, PyObject *args)
+{
+    float x, y, z, radius;
+    if(!PyArg_ParseTuple(args, "ffff", &x, &y, &z, &radius))
+    {
+        PyErr_SetString(PyExc_ValueError, "Getting entities in radius failed, params should be x, y, z and radius.");
+        return NULL;
+    }
+
+    Scene::ScenePtr scene = PythonScriptModule::GetInstance()->GetScene();
+    if (scene == 0)
+    {
+        PyErr_SetString(PyExc_ValueError, "Scene is none.");
+        return NULL;   
+    }
+
+    std::vector<entity_id_t> ids;
+    scene->GetSpatialIndex().QueryRadius(Vector3df(x, y, z), radius, ids);
+    return EntityIdList(ids);
+}
+
+PyObject* GetEntitiesInBox(PyObject *self, PyObject *args)
+{
+    float min_x, min_y, min_z, max_x, max_y, max_z;
+    if(!PyArg_ParseTuple(args, "ffffff", &min_x, &min_y, &min_z, &max_x, &max_y, &max_z))
+    {
+        PyErr_SetString(PyExc_ValueError, "Getting entities in box failed, params should be the minimum and maximum corners x, y, z.");
+        return NULL;
+    }
+
+    Scene::ScenePtr scene = PythonScriptModule::GetInstance()->GetScene();
+    if (scene == 0)
+    {
+        PyErr_SetString(PyExc_ValueError, "Scene is none.");
+        return NULL;   
+    }
+
+    std::vector<entity_id_t> ids;
+    scene->GetSpatialIndex().QueryBox(Vector3df(min_x, min_y, min_z), Vector3df(max_x, max_y, max_z), ids);
+    return EntityIdList(ids);
+}
+
+PyObject* GetNearestEntities(PyObject *self, PyObject *args)
+{
+    float x, y, z;
+    unsigned int count;
+    float max_distance = -1.0f;
+    if(!PyArg_ParseTuple(args, "fffI|f", &x, &y, &z, &count, &max_distance))
+    {
+        PyErr_SetString(PyExc_ValueError, "Getting nearest entities failed, params should be x, y, z, count and optionally max distance.");
+        return NULL;
+    }
+
+    Scene::ScenePtr scene = PythonScriptModule::GetInstance()->GetScene();
+    if (scene == 0)
+    {
+        PyErr_SetString(PyExc_ValueError, "Scene is none.");
+        return NULL;   
+    }
+
+    std::vector<entity_id_t> ids;
+    scene->GetSpatialIndex().QueryNearest(Vector3df(x, y, z), count, ids, max_distance);
+    return EntityIdList(ids);
+}
+
 //PyObject* GetEntityMatindicesWithTexture(PyObject* self, PyObject* args)
 //qt module is gone, this waits for uimodule to bring ec_canvases back
 //PyObject* ApplyUICanvasToSubmeshesWithTexture(PyObject* self, PyObject* args)
@@ -1797,6 +1871,15 @@ static PyMethodDef EmbMethods[] = {
     {"getEntityByUUID", (PyCFunction)GetEntityByUUID, METH_VARARGS,
     "Gets the entity with the given UUID."},
 
+    {"getEntitiesInRadius", (PyCFunction)GetEntitiesInRadius, METH_VARARGS,
+    "Returns the ids of the entities within the radius of the point x, y, z."},
+
+    {"getEntitiesInBox", (PyCFunction)GetEntitiesInBox, METH_VARARGS,
+    "Returns the ids of the entities in the box with the minimum corner x, y, z and the maximum corner x, y, z."},
+
+    {"getNearestEntities", (PyCFunction)GetNearestEntities, METH_VARARGS,
+    "Returns the ids of the count entities nearest to the point x, y, z, nearest first. Optionally limited to a max distance."},
+
     {"createEntity", (PyCFunction)CreateEntity, METH_VARARGS,
     "Creates a new entity with the given ID, and returns it."},
 
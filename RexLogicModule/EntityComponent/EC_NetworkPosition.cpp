@@ -3,18 +3,27 @@
 #include "StableHeaders.h"
 #include "ModuleInterface.h"
 #include "EntityComponent/EC_NetworkPosition.h"
+#include "RexLogicModule.h"
+#include "MotionSystem.h"
 
 namespace RexLogic
 {
     EC_NetworkPosition::EC_NetworkPosition(Foundation::ModuleInterface* module) : Foundation::ComponentInterface(module->GetFramework()),
         time_since_update_(0.0),
         time_since_prev_update_(0.001),
-        first_update(true)
+        first_update(true),
+        motion_slot_(cNoMotionSlot)
     {        
+        RexLogicModule *rexlogic = dynamic_cast<RexLogicModule*>(module);
+        if (rexlogic)
+            motion_system_ = rexlogic->GetMotionSystem();
     }
 
     EC_NetworkPosition::~EC_NetworkPosition()
     {
+        boost::shared_ptr<MotionSystem> motion_system = motion_system_.lock();
+        if (motion_system)
+            motion_system->Deactivate(this);
     }
 
     void EC_NetworkPosition::Updated()
@@ -32,6 +41,8 @@ namespace RexLogic
             NoPositionDamping();
             NoOrientationDamping();
         }
+
+        ActivateMotion();
     }
     
     void EC_NetworkPosition::SetPosition(const Vector3df& position)
@@ -39,6 +50,7 @@ namespace RexLogic
         position_ = position;
         NoPositionDamping();
         NoVelocity();
+        ActivateMotion();
     }
     
     void EC_NetworkPosition::SetOrientation(const Quaternion& orientation)
@@ -46,7 +58,15 @@ namespace RexLogic
         orientation_ = orientation;
         NoOrientationDamping();
         NoRotationVelocity();
+        ActivateMotion();
     }    
+
+    void EC_NetworkPosition::ActivateMotion()
+    {
+        boost::shared_ptr<MotionSystem> motion_system = motion_system_.lock();
+        if (motion_system)
+            motion_system->Activate(this);
+    }
     
     void EC_NetworkPosition::NoPositionDamping()
     {
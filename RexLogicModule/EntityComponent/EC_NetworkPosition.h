@@ -14,10 +14,17 @@
 #include <QtGui/qquaternion.h>
 #include <QtGui/qvector3d.h>
 
+#include <boost/weak_ptr.hpp>
+
 namespace RexLogic
 {
+    class MotionSystem;
+
     //! Represents object position/rotation/velocity data received from network, for clientside inter/extrapolation
     /*! Note that currently values are stored in Ogre format axes.
+
+        The inter/extrapolation is done by MotionSystem, which takes over the motion state for the dead reckoning time
+        after each update. Call Updated() after modifying the values, otherwise the change is overwritten.
      */ 
     class REXLOGIC_MODULE_API EC_NetworkPosition : public Foundation::ComponentInterface
     {
@@ -61,7 +68,7 @@ namespace RexLogic
         //! Whether update is first
         bool first_update;        
                 
-        //! Finished an update
+        //! Finished an update. Starts dead reckoning from the new values.
         void Updated();
         
         //! Set position forcibly, for example in editing tools
@@ -78,8 +85,13 @@ namespace RexLogic
         void SetQOrientation(const QQuaternion newort);
 
     private:
+        friend class MotionSystem;
+
         EC_NetworkPosition(Foundation::ModuleInterface* module);        
 
+        //! Hands the current values to the motion system
+        void ActivateMotion();
+
         //! Disable position damping, called after setting position forcibly
         void NoPositionDamping();
 
@@ -91,6 +103,15 @@ namespace RexLogic
 
         //! Disable rotational , called after setting orientation forcibly
         void NoRotationVelocity();
+
+        //! Motion system of the module that created this component
+        boost::weak_ptr<MotionSystem> motion_system_;
+
+        //! Value of motion_slot_ when not tracked by the motion system
+        static const size_t cNoMotionSlot = (size_t)-1;
+
+        //! Index of this component in the motion system's arrays
+        size_t motion_slot_;
     };
 }
 
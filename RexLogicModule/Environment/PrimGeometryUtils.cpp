@@ -50,6 +50,9 @@
 
 #include <Ogre.h>
 
+#include <climits>
+#include <set>
+
 namespace RexLogic
 {
     void TransformUV(Ogre::Vector2& uv, float repeat_u, float repeat_v, float offset_u, float offset_v, float rot_sin, float rot_cos)
@@ -80,228 +83,401 @@ namespace RexLogic
         return true;
     }
 
-    void CreatePrimGeometry(Foundation::Framework* framework, Ogre::ManualObject* object, EC_OpenSimPrim& primitive)
+    namespace
     {
-        PROFILE(Primitive_CreateGeometry)
-        
-        if (!primitive.HasPrimShapeData)
-            return;
-            
-        std::string mat_override;
-        if ((primitive.Materials[0].Type == RexTypes::RexAT_MaterialScript) && (!RexTypes::IsNull(primitive.Materials[0].asset_id)))
+        //! Indices of the shape parameters in PrimShapeKey
+        enum ShapeValue
+        {
+            SV_PathCurve = 0,
+            SV_ProfileCurve,
+            SV_ProfileBegin,
+            SV_ProfileEnd,
+            SV_ProfileHollow,
+            SV_PathBegin,
+            SV_PathEnd,
+            SV_PathShearX,
+            SV_PathShearY,
+            SV_PathTwistBegin,
+            SV_PathTwist,
+            SV_PathScaleX,
+            SV_PathScaleY,
+            SV_PathRadiusOffset,
+            SV_PathRevolutions,
+            SV_PathSkew,
+            SV_PathTaperX,
+            SV_PathTaperY
+        };
+
+        //! Marks a parameter that is NaN or infinite
+        const int cIllegalValue = INT_MIN;
+
+        //! Quantizes a shape parameter to units of 1e-5, finer than the network encoding of any of them
+        int Quantize(float value)
         {
-            mat_override = primitive.Materials[0].asset_id;
+            if (_isnan(value) || !_finite(value) || fabs(value) > 10000.0f)
+                return cIllegalValue;
+            return (int)floor(value * 100000.0f + 0.5f);
+        }
 
-            // If cannot find the override material, use default
-            // We will probably get resource ready event later for the material & redo this prim
-            boost::shared_ptr<OgreRenderer::Renderer> renderer = framework->GetServiceManager()->
-                GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer).lock();
-            if (!renderer->GetResource(mat_override, OgreRenderer::OgreMaterialResource::GetTypeStatic()))
+        float Dequantize(int value)
+        {
+            return value * 0.00001f;
+        }
+
+        //! Material, color and texture mapping of one prim face
+        struct FaceAppearance
+        {
+            std::string texture_id_;
+            Color color_;
+            float repeat_u_;
+            float repeat_v_;
+            float offset_u_;
+            float offset_v_;
+            float rot_;
+        };
+
+        //! Returns the material script overriding the face materials, or empty if none
+        std::string GetMaterialOverride(Foundation::Framework* framework, EC_OpenSimPrim& primitive)
+        {
+            std::string mat_override;
+            if ((primitive.Materials[0].Type == RexTypes::RexAT_MaterialScript) && (!RexTypes::IsNull(primitive.Materials[0].asset_id)))
             {
-                mat_override = "LitTextured";
+                mat_override = primitive.Materials[0].asset_id;
+
+                // If cannot find the override material, use default
+                // We will probably get resource ready event later for the material & redo this prim
+                boost::shared_ptr<OgreRenderer::Renderer> renderer = framework->GetServiceManager()->
+                    GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer).lock();
+                if (!renderer->GetResource(mat_override, OgreRenderer::OgreMaterialResource::GetTypeStatic()))
+                {
+                    mat_override = "LitTextured";
+                }
             }
+            return mat_override;
         }
-            
-        try
+
+        void GetFaceAppearance(EC_OpenSimPrim& primitive, int facenum, const std::string& mat_override, FaceAppearance& appearance)
         {
-            float profileBegin = primitive.ProfileBegin;
-            float profileEnd = 1.0f - primitive.ProfileEnd;
-            float profileHollow = primitive.ProfileHollow;
-
-            int sides = 4;
-            if ((primitive.ProfileCurve & 0x07) == RexTypes::SHAPE_EQUILATERAL_TRIANGLE)
-                sides = 3;
-            else if ((primitive.ProfileCurve & 0x07) == RexTypes::SHAPE_CIRCLE)
-                sides = 24;
-            else if ((primitive.ProfileCurve & 0x07) == RexTypes::SHAPE_HALF_CIRCLE)
+            appearance.color_ = primitive.PrimDefaultColor;
+            ColorMap::const_iterator c = primitive.PrimColors.find(facenum);
+            if (c != primitive.PrimColors.end())
+                appearance.color_ = c->second;
+
+            if (!mat_override.empty())
+                appearance.texture_id_ = mat_override;
+            else
             {
-                // half circle, prim is a sphere
-                sides = 24;
+                unsigned variation = OgreRenderer::LEGACYMAT_VERTEXCOL;
+
+                // Check for transparency
+                if (appearance.color_.a < 1.0f)
+                    variation = OgreRenderer::LEGACYMAT_VERTEXCOLALPHA;
+
+                // Check for fullbright
+                bool fullbright = (primitive.PrimDefaultMaterialType & RexTypes::MATERIALTYPE_FULLBRIGHT) != 0;
+                MaterialTypeMap::const_iterator mt = primitive.PrimMaterialTypes.find(facenum);
+                if (mt != primitive.PrimMaterialTypes.end())
+                    fullbright = (mt->second & RexTypes::MATERIALTYPE_FULLBRIGHT) != 0;
+                if (fullbright)
+                    variation |= OgreRenderer::LEGACYMAT_FULLBRIGHT;
+
+                std::string suffix = OgreRenderer::GetMaterialSuffix(variation);
 
-                profileBegin = 0.5f * profileBegin + 0.5f;
-                profileEnd = 0.5f * profileEnd + 0.5f;
+                // Try to find face's texture in texturemap, use default if not found
+                appearance.texture_id_ = primitive.PrimDefaultTextureID + suffix;
+                TextureMap::const_iterator t = primitive.PrimTextures.find(facenum);
+                if (t != primitive.PrimTextures.end())
+                    appearance.texture_id_ = t->second + suffix;
             }
 
-            int hollowSides = sides;
-            if ((primitive.ProfileCurve & 0xf0) == RexTypes::HOLLOW_CIRCLE)
-                hollowSides = 24;
-            else if ((primitive.ProfileCurve & 0xf0) == RexTypes::HOLLOW_SQUARE)
-                hollowSides = 4;
-            else if ((primitive.ProfileCurve & 0xf0) == RexTypes::HOLLOW_TRIANGLE)
-                hollowSides = 3;
-            
-            PrimMesher::PrimMesh primMesh(sides, profileBegin, profileEnd, profileHollow, hollowSides);
-            primMesh.topShearX = primitive.PathShearX;
-            primMesh.topShearY = primitive.PathShearY;
-            primMesh.pathCutBegin = primitive.PathBegin;
-            primMesh.pathCutEnd = 1.0f - primitive.PathEnd;
-
-            if (primitive.PathCurve == RexTypes::EXTRUSION_STRAIGHT)
+            // Get texture mapping parameters
+            appearance.repeat_u_ = primitive.PrimDefaultRepeatU;
+            appearance.repeat_v_ = primitive.PrimDefaultRepeatV;
+            appearance.offset_u_ = primitive.PrimDefaultOffsetU;
+            appearance.offset_v_ = primitive.PrimDefaultOffsetV;
+            appearance.rot_ = primitive.PrimDefaultUVRotation;
+            if (primitive.PrimRepeatU.find(facenum) != primitive.PrimRepeatU.end())
+                appearance.repeat_u_ = primitive.PrimRepeatU[facenum];
+            if (primitive.PrimRepeatV.find(facenum) != primitive.PrimRepeatV.end())
+                appearance.repeat_v_ = primitive.PrimRepeatV[facenum];
+            if (primitive.PrimOffsetU.find(facenum) != primitive.PrimOffsetU.end())
+                appearance.offset_u_ = primitive.PrimOffsetU[facenum];
+            if (primitive.PrimOffsetV.find(facenum) != primitive.PrimOffsetV.end())
+                appearance.offset_v_ = primitive.PrimOffsetV[facenum];
+            if (primitive.PrimUVRotation.find(facenum) != primitive.PrimUVRotation.end())
+                appearance.rot_ = primitive.PrimUVRotation[facenum];
+        }
+    }
+
+    bool PrimShapeKey::operator <(const PrimShapeKey& rhs) const
+    {
+        return std::lexicographical_compare(values_, values_ + cNumValues, rhs.values_, rhs.values_ + cNumValues);
+    }
+
+    bool PrimShapeKey::operator ==(const PrimShapeKey& rhs) const
+    {
+        return std::equal(values_, values_ + cNumValues, rhs.values_);
+    }
+
+    std::string PrimShapeKey::ToString() const
+    {
+        std::ostringstream key;
+        for (int i = 0; i < cNumValues; ++i)
+            key << values_[i] << ' ';
+        return key.str();
+    }
+
+    PrimShapeKey GetPrimShapeKey(const EC_OpenSimPrim& primitive)
+    {
+        PrimShapeKey key;
+        int* values = key.values_;
+        std::fill(values, values + PrimShapeKey::cNumValues, 0);
+
+        values[SV_PathCurve] = primitive.PathCurve;
+        values[SV_ProfileCurve] = primitive.ProfileCurve;
+        values[SV_ProfileBegin] = Quantize(primitive.ProfileBegin);
+        values[SV_ProfileEnd] = Quantize(primitive.ProfileEnd);
+        values[SV_ProfileHollow] = Quantize(primitive.ProfileHollow);
+        values[SV_PathBegin] = Quantize(primitive.PathBegin);
+        values[SV_PathEnd] = Quantize(primitive.PathEnd);
+        values[SV_PathShearX] = Quantize(primitive.PathShearX);
+        values[SV_PathShearY] = Quantize(primitive.PathShearY);
+        values[SV_PathTwistBegin] = Quantize(primitive.PathTwistBegin);
+        values[SV_PathTwist] = Quantize(primitive.PathTwist);
+        values[SV_PathScaleX] = Quantize(primitive.PathScaleX);
+        values[SV_PathScaleY] = Quantize(primitive.PathScaleY);
+
+        // A straight extrusion uses none of the circular path parameters
+        if (primitive.PathCurve != RexTypes::EXTRUSION_STRAIGHT)
+        {
+            values[SV_PathRadiusOffset] = Quantize(primitive.PathRadiusOffset);
+            values[SV_PathRevolutions] = Quantize(primitive.PathRevolutions);
+            values[SV_PathSkew] = Quantize(primitive.PathSkew);
+            values[SV_PathTaperX] = Quantize(primitive.PathTaperX);
+            values[SV_PathTaperY] = Quantize(primitive.PathTaperY);
+        }
+
+        return key;
+    }
+
+    PrimShapeGeometryPtr BuildPrimShapeGeometry(const PrimShapeKey& key)
+    {
+        PROFILE(Primitive_BuildShapeGeometry)
+
+        PrimShapeGeometryPtr shape(new PrimShapeGeometry());
+
+        const int* values = key.values_;
+        for (int i = SV_ProfileBegin; i < PrimShapeKey::cNumValues; ++i)
+        {
+            if (values[i] == cIllegalValue)
             {
-                primMesh.twistBegin = primitive.PathTwistBegin * 180;
-                primMesh.twistEnd = primitive.PathTwist * 180;
-                primMesh.taperX = primitive.PathScaleX - 1.0f;
-                primMesh.taperY = primitive.PathScaleY - 1.0f;
-                primMesh.ExtrudeLinear();
+                shape->valid_ = false;
+                return shape;
             }
-            else
+        }
+
+        const int path_curve = values[SV_PathCurve];
+        const int profile_curve = values[SV_ProfileCurve];
+
+        float profileBegin = Dequantize(values[SV_ProfileBegin]);
+        float profileEnd = 1.0f - Dequantize(values[SV_ProfileEnd]);
+        float profileHollow = Dequantize(values[SV_ProfileHollow]);
+
+        int sides = 4;
+        if ((profile_curve & 0x07) == RexTypes::SHAPE_EQUILATERAL_TRIANGLE)
+            sides = 3;
+        else if ((profile_curve & 0x07) == RexTypes::SHAPE_CIRCLE)
+            sides = 24;
+        else if ((profile_curve & 0x07) == RexTypes::SHAPE_HALF_CIRCLE)
+        {
+            // half circle, prim is a sphere
+            sides = 24;
+
+            profileBegin = 0.5f * profileBegin + 0.5f;
+            profileEnd = 0.5f * profileEnd + 0.5f;
+        }
+
+        int hollowSides = sides;
+        if ((profile_curve & 0xf0) == RexTypes::HOLLOW_CIRCLE)
+            hollowSides = 24;
+        else if ((profile_curve & 0xf0) == RexTypes::HOLLOW_SQUARE)
+            hollowSides = 4;
+        else if ((profile_curve & 0xf0) == RexTypes::HOLLOW_TRIANGLE)
+            hollowSides = 3;
+
+        PrimMesher::PrimMesh primMesh(sides, profileBegin, profileEnd, profileHollow, hollowSides);
+        primMesh.topShearX = Dequantize(values[SV_PathShearX]);
+        primMesh.topShearY = Dequantize(values[SV_PathShearY]);
+        primMesh.pathCutBegin = Dequantize(values[SV_PathBegin]);
+        primMesh.pathCutEnd = 1.0f - Dequantize(values[SV_PathEnd]);
+
+        if (path_curve == RexTypes::EXTRUSION_STRAIGHT)
+        {
+            primMesh.twistBegin = Dequantize(values[SV_PathTwistBegin]) * 180;
+            primMesh.twistEnd = Dequantize(values[SV_PathTwist]) * 180;
+            primMesh.taperX = Dequantize(values[SV_PathScaleX]) - 1.0f;
+            primMesh.taperY = Dequantize(values[SV_PathScaleY]) - 1.0f;
+            primMesh.ExtrudeLinear();
+        }
+        else
+        {
+            primMesh.holeSizeX = (2.0f - Dequantize(values[SV_PathScaleX]));
+            primMesh.holeSizeY = (2.0f - Dequantize(values[SV_PathScaleY]));
+            primMesh.radius = Dequantize(values[SV_PathRadiusOffset]);
+            primMesh.revolutions = Dequantize(values[SV_PathRevolutions]);
+            primMesh.skew = Dequantize(values[SV_PathSkew]);
+            primMesh.twistBegin = Dequantize(values[SV_PathTwistBegin]) * 360;
+            primMesh.twistEnd = Dequantize(values[SV_PathTwist]) * 360;
+            primMesh.taperX = Dequantize(values[SV_PathTaperX]);
+            primMesh.taperY = Dequantize(values[SV_PathTaperY]);
+            primMesh.ExtrudeCircular();
+        }
+
+        // Check for highly illegal coordinates in any of the faces
+        const std::vector<PrimMesher::ViewerFace>& faces = primMesh.viewerFaces;
+        for (size_t i = 0; i < faces.size(); ++i)
+        {
+            if (!(CheckCoord(faces[i].v1) && CheckCoord(faces[i].v2) && CheckCoord(faces[i].v3)))
             {
-                primMesh.holeSizeX = (2.0f - primitive.PathScaleX);
-                primMesh.holeSizeY = (2.0f - primitive.PathScaleY);
-                primMesh.radius = primitive.PathRadiusOffset;
-                primMesh.revolutions = primitive.PathRevolutions;
-                primMesh.skew = primitive.PathSkew;
-                primMesh.twistBegin = primitive.PathTwistBegin * 360;
-                primMesh.twistEnd = primitive.PathTwist * 360;
-                primMesh.taperX = primitive.PathTaperX;
-                primMesh.taperY = primitive.PathTaperY;
-                primMesh.ExtrudeCircular();
+                shape->valid_ = false;
+                return shape;
             }
-            
-            if (object)
+        }
+
+        shape->positions_.reserve(faces.size() * 9);
+        shape->normals_.reserve(faces.size() * 9);
+        shape->uvs_.reserve(faces.size() * 6);
+        shape->face_numbers_.reserve(faces.size());
+
+        for (size_t i = 0; i < faces.size(); ++i)
+        {
+            const PrimMesher::ViewerFace& face = faces[i];
+            const PrimMesher::Coord* positions[3] = { &face.v1, &face.v2, &face.v3 };
+            const PrimMesher::Coord* normals[3] = { &face.n1, &face.n2, &face.n3 };
+            const PrimMesher::UVCoord* uvs[3] = { &face.uv1, &face.uv2, &face.uv3 };
+
+            for (int j = 0; j < 3; ++j)
+            {
+                shape->positions_.push_back(positions[j]->X);
+                shape->positions_.push_back(positions[j]->Y);
+                shape->positions_.push_back(positions[j]->Z);
+                shape->normals_.push_back(normals[j]->X);
+                shape->normals_.push_back(normals[j]->Y);
+                shape->normals_.push_back(normals[j]->Z);
+                shape->uvs_.push_back(uvs[j]->U);
+                shape->uvs_.push_back(uvs[j]->V);
+            }
+            shape->face_numbers_.push_back(face.primFaceNumber);
+        }
+
+        return shape;
+    }
+
+    std::string GetPrimAppearanceKey(Foundation::Framework* framework, EC_OpenSimPrim& primitive, const PrimShapeGeometry& shape)
+    {
+        const std::string mat_override = GetMaterialOverride(framework, primitive);
+        std::set<int> facenums(shape.face_numbers_.begin(), shape.face_numbers_.end());
+
+        std::ostringstream key;
+        FaceAppearance appearance;
+        for (std::set<int>::const_iterator i = facenums.begin(); i != facenums.end(); ++i)
+        {
+            GetFaceAppearance(primitive, *i, mat_override, appearance);
+            const Color& color = appearance.color_;
+            key << *i << ' ' << appearance.texture_id_ << ' ' << color.r << ' ' << color.g << ' ' << color.b << ' ' << color.a << ' '
+                << appearance.repeat_u_ << ' ' << appearance.repeat_v_ << ' ' << appearance.offset_u_ << ' ' << appearance.offset_v_ << ' '
+                << appearance.rot_ << ' ';
+        }
+        return key.str();
+    }
+
+    void CreatePrimGeometry(Foundation::Framework* framework, Ogre::ManualObject* object, EC_OpenSimPrim& primitive, const PrimShapeGeometry& shape)
+    {
+        PROFILE(Primitive_CreateManualObject)
+
+        if (!object)
+        {
+            RexLogicModule::LogError(std::string("Null manualobject passed to CreatePrimGeometry"));
+            return;
+        }
+
+        object->clear();
+        object->setBoundingBox(Ogre::AxisAlignedBox());
+
+        if (!shape.valid_)
+        {
+            RexLogicModule::LogError("NaN or infinite number encountered in prim face coordinates, or meshing failed. Skipping geometry creation.");
+            return;
+        }
+
+        const std::string mat_override = GetMaterialOverride(framework, primitive);
+
+        RexTypes::RexAssetID prev_texture_id;
+        FaceAppearance appearance;
+
+        // Face appearances are looked up once per face number, not once per triangle
+        int prev_facenum = -1;
+        float rot_sin = 0.0f;
+        float rot_cos = 1.0f;
+
+        uint indices = 0;
+        bool first_face = true;
+
+        for (size_t i = 0; i < shape.GetNumTriangles(); ++i)
+        {
+            int facenum = shape.face_numbers_[i];
+            if (facenum != prev_facenum)
+            {
+                GetFaceAppearance(primitive, facenum, mat_override, appearance);
+                // Actually create the material here if texture yet missing, the material will be
+                // updated later
+                if (mat_override.empty())
+                    OgreRenderer::CreateLegacyMaterials(appearance.texture_id_);
+                rot_sin = sin(-appearance.rot_);
+                rot_cos = cos(-appearance.rot_);
+                prev_facenum = facenum;
+            }
+
+            const Color& color = appearance.color_;
+
+            // Skip face if very transparent
+            if (color.a <= 0.11f)
+                continue;
+
+            if ((first_face) || (appearance.texture_id_ != prev_texture_id))
             {
-                PROFILE(Primitive_CreateManualObject)
-                object->clear();
-                object->setBoundingBox(Ogre::AxisAlignedBox());
-                
-                // Check for highly illegal coordinates in any of the faces
-                for (int i = 0; i < primMesh.viewerFaces.size(); ++i)
-                {
-                    if (!(CheckCoord(primMesh.viewerFaces[i].v1) && CheckCoord(primMesh.viewerFaces[i].v2) && CheckCoord(primMesh.viewerFaces[i].v3)))
-                    {
-                        RexLogicModule::LogError("NaN or infinite number encountered in prim face coordinates. Skipping geometry creation.");
-                        return;
-                    }
-                }
-                
-                RexTypes::RexAssetID texture_id; 
-                RexTypes::RexAssetID prev_texture_id;
-                
-                uint indices = 0;
-                bool first_face = true;
-                
-                for (int i = 0; i < primMesh.viewerFaces.size(); ++i)
-                {
-                    int facenum = primMesh.viewerFaces[i].primFaceNumber;
-                    
-                    Color color = primitive.PrimDefaultColor;
-                    ColorMap::const_iterator c = primitive.PrimColors.find(facenum);
-                    if (c != primitive.PrimColors.end())
-                        color = c->second;
-                    
-                    // Skip face if very transparent
-                    if (color.a <= 0.11f)
-                        continue;
-                    
-                    if (!mat_override.empty())
-                        texture_id = mat_override;
-                    else
-                    {
-                        unsigned variation = OgreRenderer::LEGACYMAT_VERTEXCOL;
-                        
-                        // Check for transparency
-                        if (color.a < 1.0f)
-                            variation = OgreRenderer::LEGACYMAT_VERTEXCOLALPHA;
-                        
-                        // Check for fullbright
-                        bool fullbright = (primitive.PrimDefaultMaterialType & RexTypes::MATERIALTYPE_FULLBRIGHT) != 0;
-                        MaterialTypeMap::const_iterator mt = primitive.PrimMaterialTypes.find(facenum);
-                        if (mt != primitive.PrimMaterialTypes.end())
-                            fullbright = (mt->second & RexTypes::MATERIALTYPE_FULLBRIGHT) != 0;
-                        if (fullbright)
-                            variation |= OgreRenderer::LEGACYMAT_FULLBRIGHT;
-                        
-                        std::string suffix = OgreRenderer::GetMaterialSuffix(variation);
-                        
-                        // Try to find face's texture in texturemap, use default if not found
-                        texture_id = primitive.PrimDefaultTextureID + suffix;
-                        TextureMap::const_iterator t = primitive.PrimTextures.find(facenum);
-                        if (t != primitive.PrimTextures.end())
-                            texture_id = t->second + suffix;
-                        // Actually create the material here if texture yet missing, the material will be
-                        // updated later
-                        OgreRenderer::CreateLegacyMaterials(texture_id);
-                    }
-     
-                    // Get texture mapping parameters
-                    float repeat_u = primitive.PrimDefaultRepeatU;
-                    float repeat_v = primitive.PrimDefaultRepeatV;
-                    float offset_u = primitive.PrimDefaultOffsetU;
-                    float offset_v = primitive.PrimDefaultOffsetV;
-                    float rot = primitive.PrimDefaultUVRotation;
-                    if (primitive.PrimRepeatU.find(facenum) != primitive.PrimRepeatU.end())
-                        repeat_u = primitive.PrimRepeatU[facenum];
-                    if (primitive.PrimRepeatV.find(facenum) != primitive.PrimRepeatV.end())
-                        repeat_v = primitive.PrimRepeatV[facenum];                    
-                    if (primitive.PrimOffsetU.find(facenum) != primitive.PrimOffsetU.end())
-                        offset_u = primitive.PrimOffsetU[facenum];
-                    if (primitive.PrimOffsetV.find(facenum) != primitive.PrimOffsetV.end())
-                        offset_v = primitive.PrimOffsetV[facenum];  
-                    if (primitive.PrimUVRotation.find(facenum) != primitive.PrimUVRotation.end())
-                        rot = primitive.PrimUVRotation[facenum];     
-                    float rot_sin = sin(-rot);
-                    float rot_cos = cos(-rot);     
-                    
-                    if ((first_face) || (texture_id != prev_texture_id))
-                    {
-                        if (indices)
-                            object->end();
-
-                        indices = 0;
-                        
-                        object->begin(texture_id, Ogre::RenderOperation::OT_TRIANGLE_LIST);
-                        prev_texture_id = texture_id;
-                        first_face = false;
-                    }
-                    
-                    Ogre::Vector3 pos1(primMesh.viewerFaces[i].v1.X, primMesh.viewerFaces[i].v1.Y, primMesh.viewerFaces[i].v1.Z);
-                    Ogre::Vector3 pos2(primMesh.viewerFaces[i].v2.X, primMesh.viewerFaces[i].v2.Y, primMesh.viewerFaces[i].v2.Z);
-                    Ogre::Vector3 pos3(primMesh.viewerFaces[i].v3.X, primMesh.viewerFaces[i].v3.Y, primMesh.viewerFaces[i].v3.Z);
-
-                    Ogre::Vector3 n1(primMesh.viewerFaces[i].n1.X, primMesh.viewerFaces[i].n1.Y, primMesh.viewerFaces[i].n1.Z);
-                    Ogre::Vector3 n2(primMesh.viewerFaces[i].n2.X, primMesh.viewerFaces[i].n2.Y, primMesh.viewerFaces[i].n2.Z);
-                    Ogre::Vector3 n3(primMesh.viewerFaces[i].n3.X, primMesh.viewerFaces[i].n3.Y, primMesh.viewerFaces[i].n3.Z);
-                    
-                    Ogre::Vector2 uv1(primMesh.viewerFaces[i].uv1.U, primMesh.viewerFaces[i].uv1.V);
-                    Ogre::Vector2 uv2(primMesh.viewerFaces[i].uv2.U, primMesh.viewerFaces[i].uv2.V);
-                    Ogre::Vector2 uv3(primMesh.viewerFaces[i].uv3.U, primMesh.viewerFaces[i].uv3.V);
-
-                    TransformUV(uv1, repeat_u, repeat_v, offset_u, offset_v, rot_sin, rot_cos);
-                    TransformUV(uv2, repeat_u, repeat_v, offset_u, offset_v, rot_sin, rot_cos);
-                    TransformUV(uv3, repeat_u, repeat_v, offset_u, offset_v, rot_sin, rot_cos);
-
-                    object->position(pos1);
-                    object->normal(n1);
-                    object->textureCoord(uv1);
-                    object->colour(color.r, color.g, color.b, color.a);
-                    
-                    object->position(pos2);
-                    object->normal(n2);
-                    object->textureCoord(uv2);
-                    object->colour(color.r, color.g, color.b, color.a);
-                    
-                    object->position(pos3);
-                    object->normal(n3);
-                    object->textureCoord(uv3);
-                    object->colour(color.r, color.g, color.b, color.a);
-                    
-                    object->index(indices++);
-                    object->index(indices++);
-                    object->index(indices++);
-                }
-                
-                // End last subsection
                 if (indices)
                     object->end();
+
+                indices = 0;
+
+                object->begin(appearance.texture_id_, Ogre::RenderOperation::OT_TRIANGLE_LIST);
+                prev_texture_id = appearance.texture_id_;
+                first_face = false;
             }
-            else
+
+            for (int j = 0; j < 3; ++j)
             {
-                RexLogicModule::LogError(std::string("Null manualobject passed to CreatePrimGeometry"));
+                const float* pos = &shape.positions_[(i * 3 + j) * 3];
+                const float* normal = &shape.normals_[(i * 3 + j) * 3];
+                const float* uv = &shape.uvs_[(i * 3 + j) * 2];
+
+                Ogre::Vector2 texcoord(uv[0], uv[1]);
+                TransformUV(texcoord, appearance.repeat_u_, appearance.repeat_v_, appearance.offset_u_, appearance.offset_v_, rot_sin, rot_cos);
+
+                object->position(pos[0], pos[1], pos[2]);
+                object->normal(normal[0], normal[1], normal[2]);
+                object->textureCoord(texcoord);
+                object->colour(color.r, color.g, color.b, color.a);
             }
+
+            object->index(indices++);
+            object->index(indices++);
+            object->index(indices++);
         }
-        catch (Exception& e)
-        {
-            RexLogicModule::LogError(std::string("Exception while creating primitive geometry: ") + e.what());
-        }
+
+        // End last subsection
+        if (indices)
+            object->end();
     }
-}
\ No newline at end of file
+}
@@ -1,5 +1,8 @@
 // For conditions of distribution and use, see copyright notice in license.txt
 
+#ifndef incl_RexLogicModule_PrimGeometryUtils_h
+#define incl_RexLogicModule_PrimGeometryUtils_h
+
 namespace Ogre
 {
     class ManualObject;
@@ -8,7 +11,62 @@ namespace Ogre
 namespace RexLogic
 {
     class EC_OpenSimPrim;
-    
-    void CreatePrimGeometry(Foundation::Framework* framework, Ogre::ManualObject* object, EC_OpenSimPrim& primitive);
+
+    //! Shape parameters of a prim, quantized so that prims with the same shape get equal keys
+    /*! Parameters that the path type does not use are zeroed.
+     */
+    struct PrimShapeKey
+    {
+        //! Path and profile curve, followed by the shape parameters in units of 1e-5
+        static const int cNumValues = 18;
+        int values_[cNumValues];
+
+        bool operator <(const PrimShapeKey& rhs) const;
+        bool operator ==(const PrimShapeKey& rhs) const;
+
+        //! Returns the key as a string, for building other keys from it
+        std::string ToString() const;
+    };
+
+    //! Triangles of an extruded prim shape, as plain arrays. Three vertices per triangle, not shared.
+    struct PrimShapeGeometry
+    {
+        //! Vertex positions, 3 floats per vertex
+        std::vector<float> positions_;
+        //! Vertex normals, 3 floats per vertex
+        std::vector<float> normals_;
+        //! Texture coordinates before the face's texture mapping, 2 floats per vertex
+        std::vector<float> uvs_;
+        //! Prim face number of each triangle
+        std::vector<int> face_numbers_;
+        //! False if meshing failed or produced NaN or infinite coordinates, in which case the arrays are empty
+        bool valid_;
+
+        PrimShapeGeometry() : valid_(true) {}
+
+        //! Returns number of triangles
+        size_t GetNumTriangles() const { return face_numbers_.size(); }
+    };
+
+    typedef boost::shared_ptr<PrimShapeGeometry> PrimShapeGeometryPtr;
+
+    //! Returns the shape key of a prim
+    PrimShapeKey GetPrimShapeKey(const EC_OpenSimPrim& primitive);
+
+    //! Extrudes the shape of a key with PrimMesher
+    /*! Threadsafe, so that it can be run as a task pool job.
+        \return Shape geometry, not valid if the shape produced illegal coordinates
+        \throw Exception if PrimMesher fails
+     */
+    PrimShapeGeometryPtr BuildPrimShapeGeometry(const PrimShapeKey& key);
+
+    //! Returns a string identifying the materials, colors and texture mapping of the prim faces the shape has
+    /*! Prims with the same shape key and appearance key get identical geometry from CreatePrimGeometry().
+     */
+    std::string GetPrimAppearanceKey(Foundation::Framework* framework, EC_OpenSimPrim& primitive, const PrimShapeGeometry& shape);
+
+    //! Fills a manual object with the triangles of a shape, colored and textured as the prim's faces
+    void CreatePrimGeometry(Foundation::Framework* framework, Ogre::ManualObject* object, EC_OpenSimPrim& primitive, const PrimShapeGeometry& shape);
 }
 
+#endif
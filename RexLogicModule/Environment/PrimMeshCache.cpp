@@ -0,0 +1,228 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "Environment/PrimMeshCache.h"
+#include "RexLogicModule.h"
+#include "Renderer.h"
+#include "ServiceManager.h"
+#include "ThreadTaskManager.h"
+#include "ConfigurationManager.h"
+
+#include <Ogre.h>
+
+namespace RexLogic
+{
+    namespace
+    {
+        //! Returns the geometry cached for a shape that could not be meshed, so that it is not built again
+        PrimShapeGeometryPtr GetFailedShape()
+        {
+            PrimShapeGeometryPtr shape(new PrimShapeGeometry());
+            shape->valid_ = false;
+            return shape;
+        }
+    }
+
+    PrimMeshCache::PrimMeshCache(Foundation::Framework* framework) :
+        framework_(framework)
+    {
+        max_shapes_ = framework_->GetDefaultConfig().DeclareSetting("RexLogicModule", "prim_shape_cache_size", 512);
+        max_meshes_ = framework_->GetDefaultConfig().DeclareSetting("RexLogicModule", "prim_mesh_cache_size", 2048);
+    }
+
+    PrimMeshCache::~PrimMeshCache()
+    {
+        Clear();
+    }
+
+    PrimShapeGeometryPtr PrimMeshCache::GetShapeGeometry(const PrimShapeKey& key)
+    {
+        PrimShapeGeometryPtr shape = FindShapeGeometry(key);
+        if (shape)
+        {
+            ++stats_.shape_hits_;
+            return shape;
+        }
+
+        ++stats_.shape_misses_;
+        if (IsBuildingShape(key))
+            return PrimShapeGeometryPtr();
+
+        Foundation::TaskPool* pool = framework_->GetThreadTaskManager()->GetTaskPool();
+        if (pool)
+        {
+            pending_shapes_[key] = pool->Submit<PrimShapeGeometryPtr>(boost::bind(&BuildPrimShapeGeometry, key));
+            return PrimShapeGeometryPtr();
+        }
+
+        try
+        {
+            shape = BuildPrimShapeGeometry(key);
+        }
+        catch (Exception& e)
+        {
+            RexLogicModule::LogError(std::string("Exception while creating primitive geometry: ") + e.what());
+            shape = GetFailedShape();
+        }
+        StoreShape(key, shape);
+        return shape;
+    }
+
+    PrimShapeGeometryPtr PrimMeshCache::FindShapeGeometry(const PrimShapeKey& key)
+    {
+        ShapeMap::iterator i = shapes_.find(key);
+        if (i == shapes_.end())
+            return PrimShapeGeometryPtr();
+
+        // Mark as most recently used
+        shapes_lru_.splice(shapes_lru_.end(), shapes_lru_, i->second.lru_);
+        return i->second.shape_;
+    }
+
+    bool PrimMeshCache::Update()
+    {
+        bool finished = false;
+
+        PendingShapeMap::iterator i = pending_shapes_.begin();
+        while (i != pending_shapes_.end())
+        {
+            if (!i->second.IsReady())
+            {
+                ++i;
+                continue;
+            }
+
+            PrimShapeGeometryPtr shape;
+            try
+            {
+                shape = i->second.Get();
+            }
+            catch (Exception& e)
+            {
+                RexLogicModule::LogError(std::string("Exception while creating primitive geometry: ") + e.what());
+                shape = GetFailedShape();
+            }
+            StoreShape(i->first, shape);
+
+            pending_shapes_.erase(i++);
+            finished = true;
+        }
+
+        return finished;
+    }
+
+    std::string PrimMeshCache::GetMesh(const std::string& mesh_key)
+    {
+        MeshMap::const_iterator i = meshes_.find(mesh_key);
+        if (i == meshes_.end())
+        {
+            ++stats_.mesh_misses_;
+            return std::string();
+        }
+
+        ++stats_.mesh_hits_;
+        return i->second.mesh_->getName();
+    }
+
+    std::string PrimMeshCache::AddMesh(const std::string& mesh_key, Ogre::ManualObject* object)
+    {
+        boost::shared_ptr<OgreRenderer::Renderer> renderer = framework_->GetServiceManager()->
+            GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer).lock();
+        if (!renderer || !object || !object->getNumSections())
+            return std::string();
+
+        if (meshes_.size() >= max_meshes_)
+            RemoveUnusedMeshes();
+
+        MeshEntry entry;
+        try
+        {
+            entry.mesh_ = object->convertToMesh(renderer->GetUniqueObjectName());
+            object->clear();
+        }
+        catch (Ogre::Exception& e)
+        {
+            RexLogicModule::LogError("Could not convert manualobject to mesh: " + std::string(e.what()));
+            return std::string();
+        }
+
+        // Only this entry, the mesh manager and the resource group hold the mesh now. Counting them out leaves the
+        // references of the Ogre entities that EC_OgreCustomObject::SetMesh creates from the mesh.
+        entry.base_use_count_ = entry.mesh_.useCount();
+
+        // If the key was cached already, the old mesh stays with the entities that use it
+        MeshMap::iterator i = meshes_.find(mesh_key);
+        if (i != meshes_.end())
+            RemoveMesh(i->second);
+        meshes_[mesh_key] = entry;
+
+        return entry.mesh_->getName();
+    }
+
+    void PrimMeshCache::RemoveUnusedMeshes()
+    {
+        MeshMap::iterator i = meshes_.begin();
+        while (i != meshes_.end())
+        {
+            if (i->second.mesh_.useCount() <= i->second.base_use_count_)
+            {
+                RemoveMesh(i->second);
+                meshes_.erase(i++);
+            }
+            else
+                ++i;
+        }
+    }
+
+    void PrimMeshCache::Clear()
+    {
+        shapes_.clear();
+        shapes_lru_.clear();
+        pending_shapes_.clear();
+
+        // Removing a mesh from the mesh manager does not free it while entities still hold it
+        for (MeshMap::iterator i = meshes_.begin(); i != meshes_.end(); ++i)
+            RemoveMesh(i->second);
+        meshes_.clear();
+    }
+
+    void PrimMeshCache::StoreShape(const PrimShapeKey& key, PrimShapeGeometryPtr shape)
+    {
+        if (!shape)
+            return;
+
+        ShapeMap::iterator i = shapes_.find(key);
+        if (i != shapes_.end())
+        {
+            i->second.shape_ = shape;
+            shapes_lru_.splice(shapes_lru_.end(), shapes_lru_, i->second.lru_);
+            return;
+        }
+
+        while (shapes_.size() >= max_shapes_ && !shapes_lru_.empty())
+        {
+            shapes_.erase(shapes_lru_.front());
+            shapes_lru_.pop_front();
+        }
+
+        ShapeEntry& entry = shapes_[key];
+        entry.shape_ = shape;
+        entry.lru_ = shapes_lru_.insert(shapes_lru_.end(), key);
+    }
+
+    void PrimMeshCache::RemoveMesh(MeshEntry& entry)
+    {
+        if (entry.mesh_.isNull() || !Ogre::MeshManager::getSingletonPtr())
+            return;
+
+        try
+        {
+            Ogre::MeshManager::getSingleton().remove(entry.mesh_->getHandle());
+        }
+        catch (Ogre::Exception& e)
+        {
+            RexLogicModule::LogError("Could not remove mesh " + entry.mesh_->getName() + ": " + std::string(e.what()));
+        }
+        entry.mesh_.setNull();
+    }
+}
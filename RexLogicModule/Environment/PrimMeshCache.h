@@ -0,0 +1,158 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_RexLogicModule_PrimMeshCache_h
+#define incl_RexLogicModule_PrimMeshCache_h
+
+#include "Environment/PrimGeometryUtils.h"
+#include "TaskPool.h"
+
+#include <OgreMesh.h>
+
+namespace Ogre
+{
+    class ManualObject;
+}
+
+namespace RexLogic
+{
+    //! Caches prim geometry so that prims with identical parameters are meshed once
+    /*! There are two levels. Shape geometry, extruded by PrimMesher in the framework's task pool, is cached by the quantized
+        shape parameters, and is reused when only the textures or colors of a prim change. Ogre meshes built from the shape
+        geometry are cached by shape and appearance, so that identical prims share one mesh.
+
+        The shape cache holds a bounded number of least recently used shapes. Meshes are kept as long as entities use them;
+        unused meshes are removed when the mesh cache grows past its size.
+     */
+    class PrimMeshCache
+    {
+    public:
+        //! Lookup statistics
+        struct Stats
+        {
+            uint shape_hits_;
+            uint shape_misses_;
+            uint mesh_hits_;
+            uint mesh_misses_;
+
+            Stats() : shape_hits_(0), shape_misses_(0), mesh_hits_(0), mesh_misses_(0) {}
+        };
+
+        //! Constructor
+        /*! \param framework Framework
+         */
+        PrimMeshCache(Foundation::Framework* framework);
+
+        //! Destructor. Removes the cached meshes from the Ogre mesh manager.
+        ~PrimMeshCache();
+
+        //! Returns shape geometry from the cache, or starts building it
+        /*! If the shape is not cached, it is built in the task pool, unless already being built. Without a task pool it is built
+            right away. Counts a hit or a miss.
+            \param key Shape key
+            \return Shape geometry, or null if it is being built
+         */
+        PrimShapeGeometryPtr GetShapeGeometry(const PrimShapeKey& key);
+
+        //! Returns shape geometry from the cache without building it or counting the lookup
+        PrimShapeGeometryPtr FindShapeGeometry(const PrimShapeKey& key);
+
+        //! Returns whether a shape is being built
+        bool IsBuildingShape(const PrimShapeKey& key) const { return pending_shapes_.find(key) != pending_shapes_.end(); }
+
+        //! Moves the shapes that have finished building to the cache
+        /*! \return true if any shapes finished
+         */
+        bool Update();
+
+        //! Returns the mesh built for a shape & appearance key, or empty if none. Counts a hit or a miss.
+        std::string GetMesh(const std::string& mesh_key);
+
+        //! Converts a filled manual object to a cached mesh and clears the object
+        /*! \param mesh_key Shape & appearance key
+            \param object Manual object
+            \return Mesh name, or empty if the conversion failed
+         */
+        std::string AddMesh(const std::string& mesh_key, Ogre::ManualObject* object);
+
+        //! Removes the cached meshes that no entity uses
+        void RemoveUnusedMeshes();
+
+        //! Empties the cache. Meshes still in use are freed when their last entity is destroyed.
+        void Clear();
+
+        //! Returns lookup statistics
+        const Stats& GetStats() const { return stats_; }
+
+        //! Returns number of cached shapes
+        size_t GetNumShapes() const { return shapes_.size(); }
+
+        //! Returns number of shapes being built
+        size_t GetNumPendingShapes() const { return pending_shapes_.size(); }
+
+        //! Returns number of cached meshes
+        size_t GetNumMeshes() const { return meshes_.size(); }
+
+    private:
+        //! Least recently used order of cached shapes, oldest first
+        typedef std::list<PrimShapeKey> ShapeLruList;
+
+        //! Shape cache entry
+        struct ShapeEntry
+        {
+            //! The shape geometry
+            PrimShapeGeometryPtr shape_;
+            //! Position in the LRU list
+            ShapeLruList::iterator lru_;
+        };
+
+        typedef std::map<PrimShapeKey, ShapeEntry> ShapeMap;
+        typedef std::map<PrimShapeKey, Foundation::TaskFuture<PrimShapeGeometryPtr> > PendingShapeMap;
+
+        //! Mesh cache entry
+        struct MeshEntry
+        {
+            //! The mesh
+            Ogre::MeshPtr mesh_;
+            //! Use count of the mesh right after it was created, when no entity used it
+            /*! Counts the reference of mesh_ and those the mesh manager and resource group keep while the mesh is
+                registered to them. Each Ogre entity created from the mesh holds one more, so the mesh is in use while
+                its use count is above this. The cache takes no other references to its meshes.
+             */
+            unsigned int base_use_count_;
+        };
+
+        typedef std::map<std::string, MeshEntry> MeshMap;
+
+        //! Stores a shape as most recently used, and evicts least recently used shapes if needed
+        void StoreShape(const PrimShapeKey& key, PrimShapeGeometryPtr shape);
+
+        //! Removes a mesh from the Ogre mesh manager
+        void RemoveMesh(MeshEntry& entry);
+
+        //! Framework
+        Foundation::Framework* framework_;
+
+        //! Cached shapes
+        ShapeMap shapes_;
+
+        //! Least recently used order of cached shapes
+        ShapeLruList shapes_lru_;
+
+        //! Shapes being built in the task pool
+        PendingShapeMap pending_shapes_;
+
+        //! Cached meshes by shape & appearance key
+        MeshMap meshes_;
+
+        //! Maximum number of cached shapes
+        uint max_shapes_;
+
+        //! Number of cached meshes above which unused meshes are removed
+        uint max_meshes_;
+
+        //! Lookup statistics
+        Stats stats_;
+    };
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include "SceneEvents.h"
 #include "ResourceInterface.h"
 #include "Environment/PrimGeometryUtils.h"
+#include "Environment/PrimMeshCache.h"
 #include "SceneManager.h"
 #include "AssetServiceInterface.h"
 #include "SoundServiceInterface.h"
@@ -39,8 +40,10 @@
 #include "ServiceManager.h"
 #include "WorldStream.h"
 #include "EC_HoveringText.h"
+#include "TextureServiceInterface.h"
 
 #include <OgreSceneNode.h>
+#include <OgreCamera.h>
 
 #include <QUrl>
 #include <QColor>
@@ -49,8 +52,20 @@
 namespace RexLogic
 {
 
-Primitive::Primitive(RexLogicModule *rexlogicmodule) : rexlogicmodule_(rexlogicmodule)
+//! Seconds between texture decode priority updates
+static const double TEXTURE_PRIORITY_INTERVAL = 0.5;
+
+//! Camera distance that lowers the decode priority of a texture as much as one quality level
+static const float TEXTURE_PRIORITY_DISTANCE = 32.0f;
+
+//! Decode priority penalty of a texture whose prims are all out of view, in quality levels
+static const float TEXTURE_PRIORITY_OUT_OF_VIEW = 2.0f;
+
+Primitive::Primitive(RexLogicModule *rexlogicmodule) :
+    rexlogicmodule_(rexlogicmodule),
+    last_texture_priority_update_(0)
 {
+    mesh_cache_ = boost::shared_ptr<PrimMeshCache>(new PrimMeshCache(rexlogicmodule_->GetFramework()));
 }
 
 Primitive::~Primitive()
@@ -850,6 +865,8 @@ bool Primitive::HandleOSNE_KillObject(uint32_t objectid)
         fullid = prim->FullId;
 
     //need to remove children aswell... is there a better way of doing this?
+    // Collect the children first, as removing entities while iterating the scene skips entities.
+    std::vector<std::pair<entity_id_t, RexUUID> > children;
     for(Scene::SceneManager::iterator iter = scene->begin(); iter != scene->end(); ++iter)
     {
         Scene::Entity &entity = **iter;
@@ -861,11 +878,14 @@ bool Primitive::HandleOSNE_KillObject(uint32_t objectid)
         RexLogic::EC_OpenSimPrim *prim = entity.GetComponent<RexLogic::EC_OpenSimPrim>().get();
         assert(prim);
         if (prim && prim->ParentId == objectid)
-        {
-            childfullid = prim->FullId;
-            scene->RemoveEntity(prim->LocalId);
-            rexlogicmodule_->UnregisterFullId(childfullid);
-        }
+            children.push_back(std::make_pair(prim->LocalId, prim->FullId));
+    }
+
+    for(size_t i = 0; i < children.size(); ++i)
+    {
+        childfullid = children[i].second;
+        scene->RemoveEntity(children[i].first);
+        rexlogicmodule_->UnregisterFullId(childfullid);
     }
 
     scene->RemoveEntity(objectid);
@@ -1018,15 +1038,7 @@ void Primitive::HandleDrawType(entity_id_t entityid)
 
         // Create/update geometry
         if (prim.HasPrimShapeData)
-        {
-            CreatePrimGeometry(rexlogicmodule_->GetFramework(), custom.GetObject(), prim);
-            custom.CommitChanges();
-            
-            Scene::Events::EntityEventData event_data;
-            event_data.entity = entity;
-            Foundation::EventManagerPtr event_manager = rexlogicmodule_->GetFramework()->GetEventManager();
-            event_manager->SendEvent(event_manager->QueryEventCategory("Scene"), Scene::Events::EVENT_ENTITY_VISUALS_MODIFIED, &event_data);
-        }
+            UpdatePrimGeometry(entity);
     }
 
     if (!RexTypes::IsNull(prim.ParticleScriptID))
@@ -1069,6 +1081,94 @@ void Primitive::HandleDrawType(entity_id_t entityid)
     }
 }
 
+void Primitive::UpdatePrimGeometry(Scene::EntityPtr entity)
+{
+    EC_OpenSimPrim *prim = entity->GetComponent<EC_OpenSimPrim>().get();
+    if (!prim || !prim->HasPrimShapeData)
+        return;
+
+    // The current geometry stays visible until the new shape has been built
+    PrimShapeKey key = GetPrimShapeKey(*prim);
+    PrimShapeGeometryPtr shape = mesh_cache_->GetShapeGeometry(key);
+    if (shape)
+    {
+        pending_prim_geometry_.erase(entity->GetId());
+        ApplyPrimGeometry(entity, key, *shape);
+    }
+    else
+        pending_prim_geometry_[entity->GetId()] = key;
+}
+
+void Primitive::ApplyPrimGeometry(Scene::EntityPtr entity, const PrimShapeKey& key, const PrimShapeGeometry& shape)
+{
+    EC_OpenSimPrim *prim = entity->GetComponent<EC_OpenSimPrim>().get();
+    OgreRenderer::EC_OgreCustomObject *custom = entity->GetComponent<OgreRenderer::EC_OgreCustomObject>().get();
+    if (!prim || !custom)
+        return;
+
+    Foundation::Framework *framework = rexlogicmodule_->GetFramework();
+
+    // Identical prims share the mesh built for the first of them
+    const std::string mesh_key = key.ToString() + GetPrimAppearanceKey(framework, *prim, shape);
+    std::string mesh_name = mesh_cache_->GetMesh(mesh_key);
+    if (mesh_name.empty())
+    {
+        CreatePrimGeometry(framework, custom->GetObject(), *prim, shape);
+        mesh_name = mesh_cache_->AddMesh(mesh_key, custom->GetObject());
+    }
+
+    // Without a mesh, commit the empty manual object to remove the old geometry
+    if (!mesh_name.empty())
+        custom->SetMesh(mesh_name);
+    else
+        custom->CommitChanges();
+
+    Scene::Events::EntityEventData event_data;
+    event_data.entity = entity;
+    Foundation::EventManagerPtr event_manager = framework->GetEventManager();
+    event_manager->SendEvent(event_manager->QueryEventCategory("Scene"), Scene::Events::EVENT_ENTITY_VISUALS_MODIFIED, &event_data);
+}
+
+void Primitive::Update()
+{
+    Core::tick_t now = Core::GetCurrentClockTime();
+    if ((double)(now - last_texture_priority_update_) / Core::GetCurrentClockFreq() >= TEXTURE_PRIORITY_INTERVAL)
+    {
+        last_texture_priority_update_ = now;
+        UpdateTexturePriorities();
+    }
+
+    if (!mesh_cache_->Update() || pending_prim_geometry_.empty())
+        return;
+
+    PendingPrimGeometryMap::iterator i = pending_prim_geometry_.begin();
+    while (i != pending_prim_geometry_.end())
+    {
+        Scene::EntityPtr entity = rexlogicmodule_->GetPrimEntity(i->first);
+        if (!entity)
+        {
+            pending_prim_geometry_.erase(i++);
+            continue;
+        }
+
+        PrimShapeGeometryPtr shape = mesh_cache_->FindShapeGeometry(i->second);
+        if (!shape && !mesh_cache_->IsBuildingShape(i->second))
+        {
+            // Evicted by other shapes finishing at the same time, build again
+            shape = mesh_cache_->GetShapeGeometry(i->second);
+        }
+
+        if (shape)
+        {
+            PrimShapeKey key = i->second;
+            pending_prim_geometry_.erase(i++);
+            ApplyPrimGeometry(entity, key, *shape);
+        }
+        else
+            ++i;
+    }
+}
+
 void Primitive::HandlePrimTexturesAndMaterial(entity_id_t entityid)
 {
     Scene::EntityPtr entity = rexlogicmodule_->GetPrimEntity(entityid);
@@ -1119,16 +1219,92 @@ void Primitive::HandlePrimTexturesAndMaterial(entity_id_t entityid)
             
             // Request texture if don't have it yet
             if (!renderer->GetResource(texname, OgreRenderer::OgreTextureResource::GetTypeStatic()))
+                RequestPrimTexture(entityid, texname, renderer.get());
+            
+            ++j;
+        }
+    }
+}
+
+void Primitive::RequestPrimTexture(entity_id_t entityid, const std::string& texture_id, OgreRenderer::Renderer* renderer)
+{
+    request_tag_t tag = renderer->RequestResource(texture_id, OgreRenderer::OgreTextureResource::GetTypeStatic());
+
+    // Remember that we are going to get a resource event for this entity
+    if (tag)
+    {
+        prim_resource_request_tags_[std::make_pair(tag, RexTypes::RexAT_Texture)] = entityid;
+        pending_textures_[texture_id].insert(entityid);
+    }
+}
+
+void Primitive::UpdateTexturePriorities()
+{
+    if (pending_textures_.empty())
+        return;
+
+    Foundation::Framework* framework = rexlogicmodule_->GetFramework();
+    boost::shared_ptr<OgreRenderer::Renderer> renderer = framework->GetServiceManager()->
+        GetService<OgreRenderer::Renderer>(Foundation::Service::ST_Renderer).lock();
+    boost::shared_ptr<Foundation::TextureServiceInterface> texture_service = framework->GetServiceManager()->
+        GetService<Foundation::TextureServiceInterface>(Foundation::Service::ST_Texture).lock();
+    Scene::ScenePtr scene = rexlogicmodule_->GetCurrentActiveScene();
+    if (!renderer || !texture_service || !scene)
+        return;
+
+    Ogre::Camera* camera = renderer->GetCurrentCamera();
+    Vector3df camera_pos = rexlogicmodule_->GetCameraPosition();
+
+    PendingTextureMap::iterator i = pending_textures_.begin();
+    while (i != pending_textures_.end())
+    {
+        // Forget textures that have been decoded at full quality
+        Foundation::ResourcePtr res = renderer->GetResource(i->first, OgreRenderer::OgreTextureResource::GetTypeStatic());
+        if (res && checked_static_cast<OgreRenderer::OgreTextureResource*>(res.get())->GetLevel() == 0)
+        {
+            pending_textures_.erase(i++);
+            continue;
+        }
+
+        // The texture is as urgent as the nearest visible prim that uses it
+        bool found = false;
+        float priority = 0.0f;
+        std::set<entity_id_t>::iterator j = i->second.begin();
+        while (j != i->second.end())
+        {
+            Scene::EntityPtr entity = rexlogicmodule_->GetPrimEntity(*j);
+            OgreRenderer::EC_OgrePlaceable* placeable = entity ? entity->GetComponent<OgreRenderer::EC_OgrePlaceable>().get() : 0;
+            if (!placeable)
             {
-                request_tag_t tag = renderer->RequestResource(texname, OgreRenderer::OgreTextureResource::GetTypeStatic());
-             
-                // Remember that we are going to get a resource event for this entity
-                if (tag)
-                    prim_resource_request_tags_[std::make_pair(tag, RexTypes::RexAT_Texture)] = entityid;
+                i->second.erase(j++);
+                continue;
             }
-            
+            // Prims that have not been positioned yet do not affect the priority
+            Vector3df pos;
+            if (!scene->GetSpatialIndex().GetPosition(*j, pos))
+            {
+                ++j;
+                continue;
+            }
+
+            float prim_priority = -pos.getDistanceFrom(camera_pos) / TEXTURE_PRIORITY_DISTANCE;
+            if (camera && !camera->isVisible(Ogre::Sphere(Ogre::Vector3(pos.x, pos.y, pos.z), placeable->GetScale().getLength() * 0.5f)))
+                prim_priority -= TEXTURE_PRIORITY_OUT_OF_VIEW;
+            if (!found || prim_priority > priority)
+                priority = prim_priority;
+            found = true;
             ++j;
         }
+
+        if (i->second.empty())
+        {
+            pending_textures_.erase(i++);
+            continue;
+        }
+
+        if (found)
+            texture_service->SetTexturePriority(i->first, priority);
+        ++i;
     }
 }
 
@@ -1176,13 +1352,7 @@ void Primitive::HandleMeshMaterials(entity_id_t entityid)
                 if (res)
                     HandleTextureReady(entityid, res);
                 else
-                {
-                    request_tag_t tag = renderer->RequestResource(mat_name, OgreRenderer::OgreTextureResource::GetTypeStatic());
-
-                    // Remember that we are going to get a resource event for this entity
-                    if (tag)
-                        prim_resource_request_tags_[std::make_pair(tag, RexTypes::RexAT_Texture)] = entityid;   
-                } 
+                    RequestPrimTexture(entityid, mat_name, renderer.get());
             }
             break;
             case RexTypes::RexAT_MaterialScript:
@@ -1532,15 +1702,7 @@ void Primitive::HandleMaterialResourceReady(entity_id_t entityid, Foundation::Re
         {
             // Update geometry now that the material exists
             if (prim->HasPrimShapeData)
-            {
-                CreatePrimGeometry(rexlogicmodule_->GetFramework(), custom->GetObject(), *prim);
-                custom->CommitChanges();
-
-                Scene::Events::EntityEventData event_data;
-                event_data.entity = entity;
-                Foundation::EventManagerPtr event_manager = rexlogicmodule_->GetFramework()->GetEventManager();
-                event_manager->SendEvent(event_manager->QueryEventCategory("Scene"), Scene::Events::EVENT_ENTITY_VISUALS_MODIFIED, &event_data);
-            }
+                UpdatePrimGeometry(entity);
         }
     }
     
@@ -1955,6 +2117,9 @@ void Primitive::HandleLogout()
     prim_resource_request_tags_.clear();
     pending_rexprimdata_.clear();
     pending_rexfreedata_.clear();
+    pending_prim_geometry_.clear();
+    pending_textures_.clear();
+    mesh_cache_->Clear();
 }
 
 
@@ -11,6 +11,8 @@
 #include "ResourceInterface.h"
 #include "RexTypes.h"
 #include "RexUUID.h"
+#include "HighPerfClock.h"
+#include "Environment/PrimGeometryUtils.h"
 
 class QColor;
 class QDomDocument;
@@ -20,11 +22,17 @@ namespace ProtocolUtilities
     class NetworkEventInboundData;
 }
 
+namespace OgreRenderer
+{
+    class Renderer;
+}
+
 namespace RexLogic
 {
     class RexLogicModule;
     class EC_OpenSimPrim;
     class EC_AttachedSound;
+    class PrimMeshCache;
 
     class Primitive
     {
@@ -51,6 +59,13 @@ namespace RexLogic
 
         void HandleLogout();
 
+        //! Applies the prim geometry that has finished building in the task pool, and updates the decode priorities of
+        //! the textures prims are waiting for. Called each frame.
+        void Update();
+
+        //! Returns the prim geometry cache
+        const PrimMeshCache& GetMeshCache() const { return *mesh_cache_; }
+
         typedef std::map<std::pair<request_tag_t, asset_type_t>, entity_id_t> EntityResourceRequestMap;
 
         // Send RexPrimData of a prim entity to server
@@ -109,6 +124,12 @@ namespace RexLogic
         //! Handles starting of looping mesh animation as specified in RexPrimData
         void HandleMeshAnimation(entity_id_t entityid);
 
+        //! Looks up the prim's geometry from the mesh cache, or starts building it. The geometry is applied when ready.
+        void UpdatePrimGeometry(Scene::EntityPtr entity);
+
+        //! Shows prim geometry built from a shape, sharing the mesh with identical prims
+        void ApplyPrimGeometry(Scene::EntityPtr entity, const PrimShapeKey& key, const PrimShapeGeometry& shape);
+
         //! handles prim texture/material requests
         //! @param entityid Entity id.
         void HandlePrimTexturesAndMaterial(entity_id_t entityid);
@@ -148,6 +169,12 @@ namespace RexLogic
         //! handles mesh or prim texture resource being ready
         void HandleTextureReady(entity_id_t entity, Foundation::ResourcePtr res);
 
+        //! requests a texture for a prim, and remembers the prim for the decode priority of the texture
+        void RequestPrimTexture(entity_id_t entityid, const std::string& texture_id, OgreRenderer::Renderer* renderer);
+
+        //! passes the camera distance & visibility of the prims waiting for textures to the texture service as decode priorities
+        void UpdateTexturePriorities();
+
         void HandleMaterialResourceReady(entity_id_t entityid, Foundation::ResourcePtr res);
 
         //! handles prim size and visibility
@@ -178,6 +205,20 @@ namespace RexLogic
         //! pending rexfreedatas
         typedef std::map<RexUUID, std::string > RexFreeDataMap;
         RexFreeDataMap pending_rexfreedata_;
+
+        //! prim geometry cache
+        boost::shared_ptr<PrimMeshCache> mesh_cache_;
+
+        //! prims waiting for their shape to finish building, with the shape key
+        typedef std::map<entity_id_t, PrimShapeKey> PendingPrimGeometryMap;
+        PendingPrimGeometryMap pending_prim_geometry_;
+
+        //! prims waiting for each texture to be decoded at full quality
+        typedef std::map<std::string, std::set<entity_id_t> > PendingTextureMap;
+        PendingTextureMap pending_textures_;
+
+        //! time of the last texture priority update
+        Core::tick_t last_texture_priority_update_;
     };
 }
 #endif
@@ -295,24 +295,19 @@ bool NetworkEventHandler::HandleOSNE_AgentMovementComplete(ProtocolUtilities::Ne
 
 bool NetworkEventHandler::HandleOSNE_ImprovedTerseObjectUpdate(ProtocolUtilities::NetworkEventInboundData* data)
 {
-    ProtocolUtilities::NetInMessage &msg = *data->message;
-    msg.ResetReading();
-
-    uint64_t regionhandle = msg.ReadU64();
-    msg.SkipToNextVariable(); // TimeDilation U16 ///\todo Unhandled inbound variable 'TimeDilation'.
-
-    if (msg.GetCurrentBlock() >= msg.GetBlockCount())
+    // This is the most frequent message, so decode it with the generated codec instead of reading it variable by variable.
+    const std::vector<uint8_t> &content = data->message->GetData();
+    if (content.empty() || !terse_update_.Decode(&content[0], content.size()))
     {
-        RexLogicModule::LogDebug("Empty ImprovedTerseObjectUpdate packet received, ignoring.");
+        RexLogicModule::LogDebug("Malformed ImprovedTerseObjectUpdate packet received, ignoring.");
         return false;
     }
 
-    // Variable block
-    size_t instance_count = msg.ReadCurrentBlockInstanceCount();
-    for(size_t i = 0; i < instance_count; i++)
+    ///\todo Unhandled inbound variables 'TimeDilation' and 'TextureEntry'.
+    for(size_t i = 0; i < terse_update_.ObjectData.size(); i++)
     {
-        size_t bytes_read = 0;
-        const uint8_t *bytes = msg.ReadBuffer(&bytes_read);
+        const uint8_t *bytes = terse_update_.ObjectData[i].Data.data;
+        const size_t bytes_read = terse_update_.ObjectData[i].Data.size;
 
         uint32_t localid = 0;
         switch(bytes_read)
@@ -339,8 +334,6 @@ bool NetworkEventHandler::HandleOSNE_ImprovedTerseObjectUpdate(ProtocolUtilities
             RexLogicModule::LogInfo(ss.str());
             break;
         }
-
-        msg.SkipToNextVariable(); ///\todo Unhandled inbound variable 'TextureEntry'.
     }
     return false;
 }
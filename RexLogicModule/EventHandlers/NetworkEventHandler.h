@@ -5,6 +5,7 @@
 
 #include "ComponentInterface.h"
 #include "NetworkEvents.h"
+#include "RealXtend/RexProtocolMessages.h"
 
 namespace ProtocolUtilities
 {
@@ -53,6 +54,9 @@ namespace RexLogic
         RexLogicModule *rexlogicmodule_;
 
         ScriptDialogHandlerPtr script_dialog_handler_;
+
+        //! Decoded ImprovedTerseObjectUpdate, kept to reuse its block storage
+        ProtocolUtilities::Messages::ImprovedTerseObjectUpdate terse_update_;
     };
 }
 
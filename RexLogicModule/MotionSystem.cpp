@@ -0,0 +1,243 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "DebugOperatorNew.h"
+
+#include "MotionSystem.h"
+#include "EntityComponent/EC_NetworkPosition.h"
+#include "EC_OgrePlaceable.h"
+#include "Entity.h"
+
+#include <algorithm>
+
+#include "MemoryLeakCheck.h"
+
+namespace RexLogic
+{
+
+MotionSystem::MotionSystem()
+{
+}
+
+MotionSystem::~MotionSystem()
+{
+    Clear();
+}
+
+void MotionSystem::Activate(EC_NetworkPosition *netpos)
+{
+    assert(netpos);
+    if (netpos->motion_slot_ == EC_NetworkPosition::cNoMotionSlot)
+    {
+        netpos->motion_slot_ = netpos_.size();
+        netpos_.push_back(netpos);
+        placeables_.push_back(Foundation::ComponentWeakPtr());
+        age_.push_back(0.0);
+        pos_x_.push_back(0.f); pos_y_.push_back(0.f); pos_z_.push_back(0.f);
+        vel_x_.push_back(0.f); vel_y_.push_back(0.f); vel_z_.push_back(0.f);
+        damped_x_.push_back(0.f); damped_y_.push_back(0.f); damped_z_.push_back(0.f);
+        orientation_.push_back(Quaternion());
+        rotvel_.push_back(Vector3df());
+        damped_orientation_.push_back(Quaternion());
+    }
+
+    Load(netpos->motion_slot_);
+}
+
+void MotionSystem::Deactivate(EC_NetworkPosition *netpos)
+{
+    assert(netpos);
+    if (netpos->motion_slot_ != EC_NetworkPosition::cNoMotionSlot)
+        RemoveSlot(netpos->motion_slot_);
+}
+
+void MotionSystem::Clear()
+{
+    for(size_t i = 0; i < netpos_.size(); ++i)
+        netpos_[i]->motion_slot_ = EC_NetworkPosition::cNoMotionSlot;
+
+    netpos_.clear();
+    placeables_.clear();
+    age_.clear();
+    pos_x_.clear(); pos_y_.clear(); pos_z_.clear();
+    vel_x_.clear(); vel_y_.clear(); vel_z_.clear();
+    damped_x_.clear(); damped_y_.clear(); damped_z_.clear();
+    orientation_.clear();
+    rotvel_.clear();
+    damped_orientation_.clear();
+}
+
+void MotionSystem::Update(f64 frametime, Real damping_constant, f64 dead_reckoning_time)
+{
+    const size_t count = netpos_.size();
+    if (!count)
+        return;
+
+    // Damping interpolation factor, dependent on frame time
+    Real factor = pow(2.0, -frametime * damping_constant);
+    if (factor < 0.0) factor = 0.0;
+    if (factor > 1.0) factor = 1.0;
+    const float rev_factor = 1.0f - factor;
+    const float dt = (float)frametime;
+
+    // Sort out the slots that are still within the dead reckoning time. The others were activated by a forced
+    // position set after their last network update, and are only dropped.
+    updated_.clear();
+    expired_.clear();
+    step_.resize(count);
+    blend_.resize(count);
+    for(size_t i = 0; i < count; ++i)
+    {
+        const bool active = age_[i] <= dead_reckoning_time;
+        step_[i] = active ? dt : 0.f;
+        blend_[i] = active ? rev_factor : 0.f;
+        if (active)
+            updated_.push_back(i);
+        else
+            expired_.push_back(i);
+    }
+
+    // Interpolate motion and dampen (smooth) movement. Branchless over the packed arrays, so that the compiler can
+    // vectorize the loops. A step and blend of zero leave an inactive slot unchanged.
+    // Acceleration disabled until figured out what goes wrong. possibly mostly irrelevant with OpenSim server
+    for(size_t i = 0; i < count; ++i)
+    {
+        pos_x_[i] += vel_x_[i] * step_[i];
+        pos_y_[i] += vel_y_[i] * step_[i];
+        pos_z_[i] += vel_z_[i] * step_[i];
+    }
+    for(size_t i = 0; i < count; ++i)
+    {
+        damped_x_[i] = pos_x_[i] * blend_[i] + damped_x_[i] * (1.0f - blend_[i]);
+        damped_y_[i] = pos_y_[i] * blend_[i] + damped_y_[i] * (1.0f - blend_[i]);
+        damped_z_[i] = pos_z_[i] * blend_[i] + damped_z_[i] * (1.0f - blend_[i]);
+    }
+
+    // Interpolate rotation. Only a few of the moving entities rotate, so this is done per slot.
+    for(size_t n = 0; n < updated_.size(); ++n)
+    {
+        const size_t i = updated_[n];
+        age_[i] += frametime;
+
+        const Vector3df &rotvel = rotvel_[i];
+        if (rotvel.getLengthSQ() > 0.001)
+        {
+            Quaternion rot_quat1;
+            Quaternion rot_quat2;
+            Quaternion rot_quat3;
+
+            rot_quat1.fromAngleAxis(rotvel.x * 0.5 * frametime, Vector3df(1,0,0));
+            rot_quat2.fromAngleAxis(rotvel.y * 0.5 * frametime, Vector3df(0,1,0));
+            rot_quat3.fromAngleAxis(rotvel.z * 0.5 * frametime, Vector3df(0,0,1));
+
+            orientation_[i] *= rot_quat1;
+            orientation_[i] *= rot_quat2;
+            orientation_[i] *= rot_quat3;
+        }
+
+        if (damped_orientation_[i] != orientation_[i])
+            damped_orientation_[i].slerp(orientation_[i], damped_orientation_[i], factor);
+    }
+
+    // Push the results to the scene nodes in one go, and hand the state back to the components.
+    for(size_t n = 0; n < updated_.size(); ++n)
+    {
+        const size_t i = updated_[n];
+        OgreRenderer::EC_OgrePlaceable *placeable = GetPlaceable(i);
+        if (placeable)
+        {
+            placeable->SetPosition(Vector3df(damped_x_[i], damped_y_[i], damped_z_[i]));
+            placeable->SetOrientation(damped_orientation_[i]);
+        }
+        Store(i);
+
+        if (age_[i] > dead_reckoning_time)
+            expired_.push_back(i);
+    }
+
+    // Stop tracking the slots whose dead reckoning time has ended. Removing from the highest slot down keeps the
+    // remaining indices valid, as a slot is only ever replaced by the last one.
+    std::sort(expired_.begin(), expired_.end());
+    for(size_t n = expired_.size(); n > 0; --n)
+        RemoveSlot(expired_[n-1]);
+}
+
+void MotionSystem::Load(size_t slot)
+{
+    const EC_NetworkPosition &netpos = *netpos_[slot];
+    age_[slot] = netpos.time_since_update_;
+    pos_x_[slot] = netpos.position_.x;
+    pos_y_[slot] = netpos.position_.y;
+    pos_z_[slot] = netpos.position_.z;
+    vel_x_[slot] = netpos.velocity_.x;
+    vel_y_[slot] = netpos.velocity_.y;
+    vel_z_[slot] = netpos.velocity_.z;
+    damped_x_[slot] = netpos.damped_position_.x;
+    damped_y_[slot] = netpos.damped_position_.y;
+    damped_z_[slot] = netpos.damped_position_.z;
+    orientation_[slot] = netpos.orientation_;
+    rotvel_[slot] = netpos.rotvel_;
+    damped_orientation_[slot] = netpos.damped_orientation_;
+}
+
+void MotionSystem::Store(size_t slot)
+{
+    EC_NetworkPosition &netpos = *netpos_[slot];
+    netpos.time_since_update_ = age_[slot];
+    netpos.position_ = Vector3df(pos_x_[slot], pos_y_[slot], pos_z_[slot]);
+    netpos.damped_position_ = Vector3df(damped_x_[slot], damped_y_[slot], damped_z_[slot]);
+    netpos.orientation_ = orientation_[slot];
+    netpos.damped_orientation_ = damped_orientation_[slot];
+}
+
+void MotionSystem::RemoveSlot(size_t slot)
+{
+    assert(slot < netpos_.size());
+    const size_t last = netpos_.size() - 1;
+    netpos_[slot]->motion_slot_ = EC_NetworkPosition::cNoMotionSlot;
+
+    if (slot != last)
+    {
+        netpos_[slot] = netpos_[last];
+        netpos_[slot]->motion_slot_ = slot;
+        placeables_[slot] = placeables_[last];
+        age_[slot] = age_[last];
+        pos_x_[slot] = pos_x_[last]; pos_y_[slot] = pos_y_[last]; pos_z_[slot] = pos_z_[last];
+        vel_x_[slot] = vel_x_[last]; vel_y_[slot] = vel_y_[last]; vel_z_[slot] = vel_z_[last];
+        damped_x_[slot] = damped_x_[last]; damped_y_[slot] = damped_y_[last]; damped_z_[slot] = damped_z_[last];
+        orientation_[slot] = orientation_[last];
+        rotvel_[slot] = rotvel_[last];
+        damped_orientation_[slot] = damped_orientation_[last];
+    }
+
+    netpos_.pop_back();
+    placeables_.pop_back();
+    age_.pop_back();
+    pos_x_.pop_back(); pos_y_.pop_back(); pos_z_.pop_back();
+    vel_x_.pop_back(); vel_y_.pop_back(); vel_z_.pop_back();
+    damped_x_.pop_back(); damped_y_.pop_back(); damped_z_.pop_back();
+    orientation_.pop_back();
+    rotvel_.pop_back();
+    damped_orientation_.pop_back();
+}
+
+OgreRenderer::EC_OgrePlaceable *MotionSystem::GetPlaceable(size_t slot)
+{
+    Foundation::ComponentPtr placeable = placeables_[slot].lock();
+    if (!placeable)
+    {
+        // The entity may not have been fully created when its first network update arrived, so look the placeable
+        // up until it is found.
+        Scene::Entity *entity = netpos_[slot]->GetParentEntity();
+        if (!entity)
+            return 0;
+        placeable = entity->GetComponent<OgreRenderer::EC_OgrePlaceable>();
+        if (!placeable)
+            return 0;
+        placeables_[slot] = placeable;
+    }
+
+    return checked_static_cast<OgreRenderer::EC_OgrePlaceable*>(placeable.get());
+}
+
+}
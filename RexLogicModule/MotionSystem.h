@@ -0,0 +1,104 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_RexLogicModule_MotionSystem_h
+#define incl_RexLogicModule_MotionSystem_h
+
+#include "ForwardDefines.h"
+#include "Vector3D.h"
+#include "Quaternion.h"
+#include "CoreTypes.h"
+
+#include <vector>
+
+namespace OgreRenderer
+{
+    class EC_OgrePlaceable;
+}
+
+namespace RexLogic
+{
+    class EC_NetworkPosition;
+
+    //! Performs dead-reckoning and damped motion for entities that have received network motion updates recently.
+    /*! Only the entities whose EC_NetworkPosition has been updated within the dead reckoning time are tracked, so
+        idle entities cost nothing per frame. The motion state of the tracked entities is kept in packed arrays that
+        the interpolation loops run through linearly, and the results are pushed to the Ogre scene nodes in one batch
+        at the end of the update.
+
+        While an entity is tracked, the motion system owns its motion state and writes it back to the EC_NetworkPosition
+        every frame. Code that modifies the EC_NetworkPosition must call Updated(), SetPosition() or SetOrientation()
+        afterwards, which reload the state to the motion system.
+     */
+    class MotionSystem
+    {
+    public:
+        MotionSystem();
+        ~MotionSystem();
+
+        //! Starts tracking an entity, or reloads its motion state if it is already tracked.
+        void Activate(EC_NetworkPosition *netpos);
+
+        //! Stops tracking an entity. Called when the component is destroyed.
+        void Deactivate(EC_NetworkPosition *netpos);
+
+        //! Interpolates the tracked entities and sets their scene node transforms.
+        /*! \param frametime Time since the last update, in seconds.
+            \param damping_constant Movement damping constant, larger values damp less.
+            \param dead_reckoning_time How long entities are extrapolated after their latest network update, in seconds.
+         */
+        void Update(f64 frametime, Real damping_constant, f64 dead_reckoning_time);
+
+        //! Stops tracking all entities.
+        void Clear();
+
+        //! @return The number of currently tracked entities.
+        size_t GetActiveCount() const { return netpos_.size(); }
+
+    private:
+        MotionSystem(const MotionSystem &);
+        void operator=(const MotionSystem &);
+
+        //! Copies the motion state of a component to a slot.
+        void Load(size_t slot);
+
+        //! Copies the motion state of a slot back to its component.
+        void Store(size_t slot);
+
+        //! Removes a slot by moving the last slot in its place.
+        void RemoveSlot(size_t slot);
+
+        //! Looks up the placeable of a slot's entity, if it has not been found yet.
+        OgreRenderer::EC_OgrePlaceable *GetPlaceable(size_t slot);
+
+        //! The tracked components. The index of a component in this vector is its slot.
+        std::vector<EC_NetworkPosition*> netpos_;
+
+        //! The placeables of the tracked entities, or expired if not yet found.
+        std::vector<Foundation::ComponentWeakPtr> placeables_;
+
+        //! Age of the current network update of each slot.
+        std::vector<f64> age_;
+
+        //! Position, velocity and damped position, one array per axis.
+        std::vector<float> pos_x_, pos_y_, pos_z_;
+        std::vector<float> vel_x_, vel_y_, vel_z_;
+        std::vector<float> damped_x_, damped_y_, damped_z_;
+
+        //! Orientation, rotational velocity and damped orientation.
+        std::vector<Quaternion> orientation_;
+        std::vector<Vector3df> rotvel_;
+        std::vector<Quaternion> damped_orientation_;
+
+        //! Per-slot time step and damping blend of the current frame, zero for slots that are not updated.
+        std::vector<float> step_;
+        std::vector<float> blend_;
+
+        //! Slots that were updated this frame and need their scene node transform set. Kept to avoid reallocation.
+        std::vector<size_t> updated_;
+
+        //! Slots whose dead reckoning time has ended. Kept to avoid reallocation.
+        std::vector<size_t> expired_;
+    };
+}
+
+#endif
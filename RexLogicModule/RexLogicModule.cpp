@@ -22,7 +22,9 @@
 #include "Avatar/AvatarEditor.h"
 #include "Avatar/AvatarControllable.h"
 #include "Environment/Primitive.h"
+#include "Environment/PrimMeshCache.h"
 #include "CameraControllable.h"
+#include "MotionSystem.h"
 
 #include "EventManager.h"
 #include "ConfigurationManager.h"
@@ -38,6 +40,7 @@
 #include "SceneManager.h"
 #include "WorldStream.h"
 #include "UiModule.h"
+#include "HighPerfClock.h"
 
 // Ogre -specific
 #include "Renderer.h"
@@ -63,6 +66,8 @@
 #include <OgreViewport.h>
 #include <OgreEntity.h>
 
+#include <algorithm>
+
 #include "MemoryLeakCheck.h"
 
 namespace RexLogic
@@ -71,6 +76,7 @@ namespace RexLogic
 RexLogicModule::RexLogicModule() : ModuleInterfaceImpl(type_static_),
     send_input_state_(false),
     movement_damping_constant_(10.0f),
+    motion_system_(new MotionSystem()),
     camera_state_(CS_Follow),
     network_handler_(0),
     input_handler_(0),
@@ -212,6 +218,10 @@ void RexLogicModule::PostInitialize()
     else
         LogError("Unable to find event category for Framework");
 
+    // Receive only the categories that have handlers
+    for(LogicEventHandlerMap::const_iterator iter = event_handlers_.begin(); iter != event_handlers_.end(); ++iter)
+        framework_->GetEventManager()->SubscribeEventCategory(this, iter->first);
+
     send_input_state_ = true;
 
     // Create login handlers, get login notifier from ether and pass
@@ -246,6 +256,20 @@ void RexLogicModule::PostInitialize()
         "Adds/removes EC_Highlight for every prim and mesh. Usage: highlight(add|remove)."
         "If add is called and EC already exists for entity, EC's visibility is toggled.",
         Console::Bind(this, &RexLogicModule::ConsoleHighlightTest)));
+
+    RegisterConsoleCommand(Console::CreateCommand("ComponentLookupBenchmark",
+        "Measures looking up components by type name and by type id in a temporary scene. "
+        "Usage: ComponentLookupBenchmark(entities, iterations)",
+        Console::Bind(this, &RexLogicModule::ConsoleComponentLookupBenchmark)));
+
+    RegisterConsoleCommand(Console::CreateCommand("SpatialQueryBenchmark",
+        "Measures radius and nearest entity queries with the scene's spatial index against scanning all entities, "
+        "in a temporary scene. Usage: SpatialQueryBenchmark(entities, queries, radius)",
+        Console::Bind(this, &RexLogicModule::ConsoleSpatialQueryBenchmark)));
+
+    RegisterConsoleCommand(Console::CreateCommand("PrimMeshCacheStats",
+        "Prints the number of cached prim shapes and meshes, and the cache hit rates.",
+        Console::Bind(this, &RexLogicModule::ConsolePrimMeshCacheStats)));
 }
 
 void RexLogicModule::SubscribeToNetworkEvents(boost::weak_ptr<ProtocolUtilities::ProtocolModuleInterface> currentProtocolModule)
@@ -260,6 +284,7 @@ void RexLogicModule::SubscribeToNetworkEvents(boost::weak_ptr<ProtocolUtilities:
         {
             event_handlers_[eventcategoryid].push_back(boost::bind(
                 &NetworkStateEventHandler::HandleNetworkStateEvent, network_state_handler_, _1, _2));
+            framework_->GetEventManager()->SubscribeEventCategory(this, eventcategoryid);
             LogInfo("System " + Name() + " subscribed to network events [NetworkState] and added to LogicEventHandlerMap");
         }
         else
@@ -279,6 +304,7 @@ void RexLogicModule::SubscribeToNetworkEvents(boost::weak_ptr<ProtocolUtilities:
         {
             event_handlers_[eventcategoryid].push_back(boost::bind(
                 &NetworkEventHandler::HandleOpenSimNetworkEvent, network_handler_, _1, _2));
+            framework_->GetEventManager()->SubscribeEventCategory(this, eventcategoryid);
             LogInfo("System " + Name() + " subscribed to network events [NetworkIn]");
         }
         else
@@ -367,6 +393,10 @@ void RexLogicModule::Update(f64 frametime)
         // interpolate & animate objects
         UpdateObjects(frametime);
 
+        // show prim geometry built in the task pool
+        if (primitive_)
+            primitive_->Update();
+
         // update avatar stuff (download requests etc.)
         avatar_->Update(frametime);
         UpdateAvatarNameTags(avatar_->GetUserAvatar());
@@ -682,6 +712,205 @@ Console::CommandResult RexLogicModule::ConsoleHighlightTest(const StringVector &
     return Console::ResultSuccess();
 }
 
+//! Looks up a component the way Scene::Entity::GetComponent<T>() did before type ids, for comparison
+template <class T> static boost::shared_ptr<T> GetComponentByTypeName(const Scene::Entity &entity)
+{
+    const Scene::Entity::ComponentVector &components = entity.GetComponentVector();
+    for(size_t i = 0; i < components.size(); ++i)
+        if (components[i]->TypeName() == T::TypeNameStatic())
+            return boost::dynamic_pointer_cast<T>(components[i]);
+    return boost::shared_ptr<T>();
+}
+
+Console::CommandResult RexLogicModule::ConsoleComponentLookupBenchmark(const StringVector &params)
+{
+    int num_entities = 50000;
+    int iterations = 10;
+    try
+    {
+        if (params.size() > 0)
+            num_entities = ParseString<int>(params[0]);
+        if (params.size() > 1)
+            iterations = ParseString<int>(params[1]);
+    }
+    catch (std::exception &)
+    {
+        return Console::ResultFailure("Usage: ComponentLookupBenchmark(entities, iterations)");
+    }
+    if ((num_entities <= 0) || (iterations <= 0))
+        return Console::ResultFailure("Usage: ComponentLookupBenchmark(entities, iterations)");
+
+    const std::string scene_name = "ComponentLookupBenchmark";
+    Scene::ScenePtr scene = framework_->CreateScene(scene_name);
+    if (!scene)
+        return Console::ResultFailure("Could not create the benchmark scene.");
+
+    // A prim-like component setup. Ids are picked from the top of the range so that handlers of the entity added
+    // events don't mistake the entities for ones in the world scene.
+    StringVector components;
+    components.push_back(EC_OpenSimPrim::TypeNameStatic());
+    components.push_back(EC_FreeData::TypeNameStatic());
+    components.push_back(EC_NetworkPosition::TypeNameStatic());
+    std::vector<Scene::EntityPtr> entities;
+    entities.reserve(num_entities);
+    for(int i = 0; i < num_entities; ++i)
+        entities.push_back(scene->CreateEntity(0x80000000 + i, components));
+
+    // Look up one component every entity has, and one that none has, as per-frame loops do.
+    size_t by_name_found = 0;
+    Core::tick_t start = Core::GetCurrentClockTime();
+    for(int n = 0; n < iterations; ++n)
+        for(size_t i = 0; i < entities.size(); ++i)
+        {
+            if (GetComponentByTypeName<EC_NetworkPosition>(*entities[i]))
+                ++by_name_found;
+            if (GetComponentByTypeName<EC_OpenSimAvatar>(*entities[i]))
+                ++by_name_found;
+        }
+    Core::tick_t by_name_time = Core::GetCurrentClockTime() - start;
+
+    size_t by_id_found = 0;
+    start = Core::GetCurrentClockTime();
+    for(int n = 0; n < iterations; ++n)
+        for(size_t i = 0; i < entities.size(); ++i)
+        {
+            if (entities[i]->GetComponent<EC_NetworkPosition>())
+                ++by_id_found;
+            if (entities[i]->GetComponent<EC_OpenSimAvatar>())
+                ++by_id_found;
+        }
+    Core::tick_t by_id_time = Core::GetCurrentClockTime() - start;
+
+    entities.clear();
+    scene.reset();
+    framework_->RemoveScene(scene_name);
+
+    if (by_name_found != by_id_found)
+        return Console::ResultFailure("Lookups by type name and type id found different components.");
+
+    double freq = (double)Core::GetCurrentClockFreq();
+    double by_name_ms = by_name_time * 1000.0 / freq / iterations;
+    double by_id_ms = by_id_time * 1000.0 / freq / iterations;
+    return Console::ResultSuccess("Two component lookups on each of " + ToString(num_entities) + " entities: by type name " +
+        ToString(by_name_ms) + " ms, by type id " + ToString(by_id_ms) + " ms");
+}
+
+Console::CommandResult RexLogicModule::ConsoleSpatialQueryBenchmark(const StringVector &params)
+{
+    int num_entities = 100000;
+    int num_queries = 1000;
+    float radius = 20.0f;
+    try
+    {
+        if (params.size() > 0)
+            num_entities = ParseString<int>(params[0]);
+        if (params.size() > 1)
+            num_queries = ParseString<int>(params[1]);
+        if (params.size() > 2)
+            radius = ParseString<float>(params[2]);
+    }
+    catch (std::exception &)
+    {
+        return Console::ResultFailure("Usage: SpatialQueryBenchmark(entities, queries, radius)");
+    }
+    if ((num_entities <= 0) || (num_queries <= 0) || (radius < 0.0f))
+        return Console::ResultFailure("Usage: SpatialQueryBenchmark(entities, queries, radius)");
+
+    const std::string scene_name = "SpatialQueryBenchmark";
+    Scene::ScenePtr scene = framework_->CreateScene(scene_name);
+    if (!scene)
+        return Console::ResultFailure("Could not create the benchmark scene.");
+
+    // Spread the entities over a grid of 8x8 regions, near the ground, with the same seed on every run
+    const float world_size = 2048.0f;
+    srand(1);
+    std::vector<entity_id_t> ids(num_entities);
+    std::vector<Vector3df> positions(num_entities);
+    for(int i = 0; i < num_entities; ++i)
+    {
+        ids[i] = 0x80000000 + i;
+        positions[i] = Vector3df(rand() * world_size / RAND_MAX, rand() * world_size / RAND_MAX, 20.0f + rand() * 40.0f / RAND_MAX);
+        scene->CreateEntity(ids[i]);
+    }
+
+    Core::tick_t start = Core::GetCurrentClockTime();
+    for(int i = 0; i < num_entities; ++i)
+        scene->UpdateEntityPosition(ids[i], positions[i]);
+    Core::tick_t insert_time = Core::GetCurrentClockTime() - start;
+
+    // Move every entity a little, as the motion system does
+    start = Core::GetCurrentClockTime();
+    for(int i = 0; i < num_entities; ++i)
+    {
+        positions[i].x += 0.5f;
+        scene->UpdateEntityPosition(ids[i], positions[i]);
+    }
+    Core::tick_t move_time = Core::GetCurrentClockTime() - start;
+
+    std::vector<Vector3df> centers(num_queries);
+    for(int n = 0; n < num_queries; ++n)
+        centers[n] = Vector3df(rand() * world_size / RAND_MAX, rand() * world_size / RAND_MAX, 40.0f);
+
+    const Scene::SpatialIndex &index = scene->GetSpatialIndex();
+    std::vector<entity_id_t> found;
+    size_t index_found = 0;
+    start = Core::GetCurrentClockTime();
+    for(int n = 0; n < num_queries; ++n)
+    {
+        index.QueryRadius(centers[n], radius, found);
+        index_found += found.size();
+    }
+    Core::tick_t index_radius_time = Core::GetCurrentClockTime() - start;
+
+    size_t scan_found = 0;
+    const float radius_sq = radius * radius;
+    start = Core::GetCurrentClockTime();
+    for(int n = 0; n < num_queries; ++n)
+        for(int i = 0; i < num_entities; ++i)
+            if ((positions[i] - centers[n]).getLengthSQ() <= radius_sq)
+                ++scan_found;
+    Core::tick_t scan_radius_time = Core::GetCurrentClockTime() - start;
+
+    const size_t k = 10;
+    start = Core::GetCurrentClockTime();
+    for(int n = 0; n < num_queries; ++n)
+        index.QueryNearest(centers[n], k, found);
+    Core::tick_t index_nearest_time = Core::GetCurrentClockTime() - start;
+
+    scene.reset();
+    framework_->RemoveScene(scene_name);
+
+    if (index_found != scan_found)
+        return Console::ResultFailure("The spatial index and the scan found different entities.");
+
+    double freq = (double)Core::GetCurrentClockFreq();
+    return Console::ResultSuccess(ToString(num_entities) + " entities: insert " + ToString(insert_time * 1000.0 / freq) +
+        " ms, move " + ToString(move_time * 1000.0 / freq) + " ms. Radius " + ToString(radius) + " query: index " +
+        ToString(index_radius_time * 1000000.0 / freq / num_queries) + " us, scan " +
+        ToString(scan_radius_time * 1000000.0 / freq / num_queries) + " us, " + ToString((double)index_found / num_queries) +
+        " entities found on average. Nearest " + ToString(k) + " query: index " +
+        ToString(index_nearest_time * 1000000.0 / freq / num_queries) + " us");
+}
+
+static std::string FormatHitRate(uint hits, uint misses)
+{
+    uint lookups = hits + misses;
+    double rate = lookups ? hits * 100.0 / lookups : 0.0;
+    return "hit rate " + ToString(rate) + "% (" + ToString(hits) + " hits, " + ToString(misses) + " misses)";
+}
+
+Console::CommandResult RexLogicModule::ConsolePrimMeshCacheStats(const StringVector &params)
+{
+    if (!primitive_)
+        return Console::ResultFailure("Primitive handler does not exist.");
+
+    const PrimMeshCache &cache = primitive_->GetMeshCache();
+    const PrimMeshCache::Stats &stats = cache.GetStats();
+    return Console::ResultSuccess("Prim shapes: " + ToString(cache.GetNumShapes()) + " cached, " + ToString(cache.GetNumPendingShapes()) +
+        " building, " + FormatHitRate(stats.shape_hits_, stats.shape_misses_) + "\nPrim meshes: " + ToString(cache.GetNumMeshes()) +
+        " cached, " + FormatHitRate(stats.mesh_hits_, stats.mesh_misses_));
+}
+
 void RexLogicModule::SwitchCameraState()
 {
     if (camera_state_ == CS_Follow)
@@ -830,85 +1059,48 @@ void RexLogicModule::UpdateObjects(f64 frametime)
     if (!activeScene_)
         return;
 
-    // Damping interpolation factor, dependent on frame time
-    Real factor = pow(2.0, -frametime * movement_damping_constant_);
-    if (factor < 0.0) factor = 0.0;
-    if (factor > 1.0) factor = 1.0;
-    Real rev_factor = 1.0 - factor;
+    // Interpolate the entities that have moved recently, without touching the rest
+    motion_system_->Update(frametime, movement_damping_constant_, dead_reckoning_time_);
 
     found_avatars_.clear();
-    
-    for(Scene::SceneManager::iterator iter = activeScene_->begin();
-        iter != activeScene_->end(); ++iter)
-    {
-        Scene::Entity &entity = **iter;
-        Foundation::ComponentPtr ogrepos_ptr = entity.GetComponent(OgreRenderer::EC_OgrePlaceable::TypeNameStatic());
-        Foundation::ComponentPtr netpos_ptr = entity.GetComponent(EC_NetworkPosition::TypeNameStatic());
-        if (ogrepos_ptr && netpos_ptr)
-        {
-            OgreRenderer::EC_OgrePlaceable &ogrepos = *checked_static_cast<OgreRenderer::EC_OgrePlaceable*>(ogrepos_ptr.get()); 
-            EC_NetworkPosition &netpos = *checked_static_cast<EC_NetworkPosition*>(netpos_ptr.get()); 
-
-            if (netpos.time_since_update_ <= dead_reckoning_time_)
-            {
-                netpos.time_since_update_ += frametime; 
-
-                // Interpolate motion
-                // acceleration disabled until figured out what goes wrong. possibly mostly irrelevant with OpenSim server
-                // netpos.velocity_ += netpos.accel_ * frametime;
-                netpos.position_ += netpos.velocity_ * frametime;
-
-                // Interpolate rotation
-                if (netpos.rotvel_.getLengthSQ() > 0.001)
-                {
-                    Quaternion rot_quat1;
-                    Quaternion rot_quat2;
-                    Quaternion rot_quat3;
-
-                    rot_quat1.fromAngleAxis(netpos.rotvel_.x * 0.5 * frametime, Vector3df(1,0,0));
-                    rot_quat2.fromAngleAxis(netpos.rotvel_.y * 0.5 * frametime, Vector3df(0,1,0));
-                    rot_quat3.fromAngleAxis(netpos.rotvel_.z * 0.5 * frametime, Vector3df(0,0,1));
 
-                    netpos.orientation_ *= rot_quat1;
-                    netpos.orientation_ *= rot_quat2;
-                    netpos.orientation_ *= rot_quat3;
-                }
+    // Iterate only the components each update is about, as most entities have none of them. The registries are
+    // framework-wide, so skip the components of entities that are not in the active scene.
+    Foundation::ComponentManagerPtr component_manager = framework_->GetComponentManager();
 
-                // Dampened (smooth) movement
-                if (netpos.damped_position_ != netpos.position_)
-                    netpos.damped_position_ = netpos.position_ * rev_factor + netpos.damped_position_ * factor;
-
-                if (netpos.damped_orientation_ != netpos.orientation_)
-                    netpos.damped_orientation_.slerp(netpos.orientation_, netpos.damped_orientation_, factor);
+    // Handle update for avatar animations
+    const Foundation::ComponentManager::ComponentList &avatars = component_manager->GetComponents<EC_OpenSimAvatar>();
+    for(size_t i = 0; i < avatars.size(); ++i)
+    {
+        Scene::EntityPtr entity = activeScene_->GetEntity(avatars[i]->GetParentEntity()->GetId());
+        if (entity.get() != avatars[i]->GetParentEntity())
+            continue;
+        found_avatars_.push_back(entity);
+        avatar_->UpdateAvatarAnimations(entity->GetId(), frametime);
+    }
 
-                ogrepos.SetPosition(netpos.damped_position_);
-                ogrepos.SetOrientation(netpos.damped_orientation_);
-            }
-        }
+    // General animation controller update
+    const Foundation::ComponentManager::ComponentList &animctrls = component_manager->GetComponents<OgreRenderer::EC_OgreAnimationController>();
+    for(size_t i = 0; i < animctrls.size(); ++i)
+    {
+        Scene::Entity *entity = animctrls[i]->GetParentEntity();
+        if (activeScene_->GetEntity(entity->GetId()).get() == entity)
+            checked_static_cast<OgreRenderer::EC_OgreAnimationController*>(animctrls[i])->Update(frametime);
+    }
 
-        // If is an avatar, handle update for avatar animations
-        if (entity.GetComponent(EC_OpenSimAvatar::TypeNameStatic()))
-        {
-            found_avatars_.push_back(*iter);
-            avatar_->UpdateAvatarAnimations(entity.GetId(), frametime);
-        }
-           
-        Foundation::ComponentPtr animctrl_ptr = entity.GetComponent(OgreRenderer::EC_OgreAnimationController::TypeNameStatic());
-        if (animctrl_ptr)
-        {
-            // General animation controller update
-            OgreRenderer::EC_OgreAnimationController &animctrl = *checked_static_cast<OgreRenderer::EC_OgreAnimationController*>(animctrl_ptr.get());
-            animctrl.Update(frametime);
-        }
-        
-        // Attached sound update
-        Foundation::ComponentPtr sound_ptr = entity.GetComponent(EC_AttachedSound::TypeNameStatic());
-        if (ogrepos_ptr && sound_ptr)
+    // Attached sound update
+    const Foundation::ComponentManager::ComponentList &sounds = component_manager->GetComponents<EC_AttachedSound>();
+    for(size_t i = 0; i < sounds.size(); ++i)
+    {
+        Scene::Entity *entity = sounds[i]->GetParentEntity();
+        if (activeScene_->GetEntity(entity->GetId()).get() != entity)
+            continue;
+        EC_AttachedSound *sound = checked_static_cast<EC_AttachedSound*>(sounds[i]);
+        boost::shared_ptr<OgreRenderer::EC_OgrePlaceable> ogrepos = entity->GetComponent<OgreRenderer::EC_OgrePlaceable>();
+        if (ogrepos)
         {
-            OgreRenderer::EC_OgrePlaceable &ogrepos = *checked_static_cast<OgreRenderer::EC_OgrePlaceable*>(ogrepos_ptr.get());
-            EC_AttachedSound &sound = *checked_static_cast<EC_AttachedSound*>(sound_ptr.get());
-            sound.Update(frametime);
-            sound.SetPosition(ogrepos.GetPosition());
+            sound->Update(frametime);
+            sound->SetPosition(ogrepos->GetPosition());
         }
     }
 }
@@ -1022,12 +1214,13 @@ void RexLogicModule::SetAllTextOverlaysVisible(bool visible)
     Scene::ScenePtr word_scene = framework_->GetDefaultWorldScene();
     if (word_scene.get())
     {
-        for (Scene::SceneManager::iterator iter = word_scene->begin(); iter != word_scene->end(); ++iter)
+        // The registry is framework-wide, so take only the texts of the world scene's entities
+        const Foundation::ComponentManager::ComponentList &texts = framework_->GetComponentManager()->GetComponents<EC_HoveringText>();
+        for (size_t i = 0; i < texts.size(); ++i)
         {
-            Scene::Entity &entity = **iter;
-            EC_HoveringText *overlay = entity.GetComponent<EC_HoveringText>().get();
-            if (overlay)
-                overlays.append(overlay);
+            Scene::Entity *entity = texts[i]->GetParentEntity();
+            if (word_scene->GetEntity(entity->GetId()).get() == entity)
+                overlays.append(checked_static_cast<EC_HoveringText *>(texts[i]));
         }
     }
 
@@ -1045,7 +1238,10 @@ void RexLogicModule::EntityClicked(Scene::Entity* entity)
 {
     boost::shared_ptr<EC_HoveringText> name_tag = entity->GetComponent<EC_HoveringText>();
     if (name_tag.get())
+    {
         name_tag->Clicked();
+        name_tag_avatars_.insert(entity->GetId());
+    }
 }
 
 void RexLogicModule::AboutToDeleteWorld()
@@ -1113,48 +1309,57 @@ void RexLogicModule::AboutToDeleteWorld()
 
 void RexLogicModule::UpdateAvatarNameTags(Scene::EntityPtr users_avatar)
 {
-    QList<Scene::EntityPtr> all_avatars;
+    // Distance within which the name tags of other avatars are shown
+    const float name_tag_distance = 13.0f;
 
     Scene::ScenePtr current_scene = framework_->GetDefaultWorldScene();
     if (!current_scene.get() || !users_avatar.get())
         return;
 
-    // Iterate all avatars to a list
-    Scene::SceneManager::iterator iter = current_scene->begin();
-    Scene::SceneManager::iterator end = current_scene->end();
-    while (iter != end)
-    {
-        Scene::EntityPtr entity = (*iter);
-        ++iter;
-        if (!entity.get() || entity.get() == users_avatar.get())
-            continue;
-        if (entity->GetComponent<EC_OpenSimPresence>().get())
-            all_avatars.append(entity);
-    }
-
-    // Get users position
+    // Get users world position from the index, as the placeable position is relative to the parent while sitting
     boost::shared_ptr<EC_HoveringText> name_tag;
-    boost::shared_ptr<OgreRenderer::EC_OgrePlaceable> placable = users_avatar->GetComponent<OgreRenderer::EC_OgrePlaceable>();
-    if (!placable.get())
+    Vector3df users_position;
+    if (!current_scene->GetSpatialIndex().GetPosition(users_avatar->GetId(), users_position))
         return;
 
-    Vector3Df users_position = placable->GetPosition();
-    foreach (Scene::EntityPtr avatar, all_avatars)
+    // Show the name tags of the avatars in range
+    current_scene->GetSpatialIndex().QueryRadius(users_position, name_tag_distance, nearby_entities_);
+    std::sort(nearby_entities_.begin(), nearby_entities_.end());
+    for (size_t i = 0; i < nearby_entities_.size(); ++i)
     {
-        placable = avatar->GetComponent<OgreRenderer::EC_OgrePlaceable>();
+        if (nearby_entities_[i] == users_avatar->GetId())
+            continue;
+        Scene::EntityPtr avatar = current_scene->GetEntity(nearby_entities_[i]);
+        if (!avatar.get() || !avatar->GetComponent<EC_OpenSimPresence>().get())
+            continue;
         name_tag = avatar->GetComponent<EC_HoveringText>();
-        if (!placable.get() || !name_tag.get())
+        if (!name_tag.get())
             continue;
 
-        // Check distance, update name tag visibility
-        f32 distance = users_position.getDistanceFrom(placable->GetPosition());
-        if (distance > 13.0)
+        if (!name_tag->IsVisible())
+            name_tag->AnimatedShow();
+        name_tag_avatars_.insert(avatar->GetId());
+    }
+
+    // Hide the name tags of the avatars out of range. Avatars are forgotten once their name tags are hidden.
+    std::set<entity_id_t>::iterator iter = name_tag_avatars_.begin();
+    while (iter != name_tag_avatars_.end())
+    {
+        if (std::binary_search(nearby_entities_.begin(), nearby_entities_.end(), *iter))
         {
-            if (name_tag->IsVisible())
-                name_tag->AnimatedHide();
+            ++iter;
+            continue;
         }
-        else if (!name_tag->IsVisible())
-            name_tag->AnimatedShow();
+
+        Scene::EntityPtr avatar = current_scene->GetEntity(*iter);
+        name_tag = avatar.get() ? avatar->GetComponent<EC_HoveringText>() : boost::shared_ptr<EC_HoveringText>();
+        if (name_tag.get() && name_tag->IsVisible())
+        {
+            name_tag->AnimatedHide();
+            ++iter;
+        }
+        else
+            name_tag_avatars_.erase(iter++);
     }
 }
 
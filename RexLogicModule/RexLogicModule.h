@@ -53,12 +53,14 @@ namespace RexLogic
     class TaigaLoginHandler;
     class MainPanelHandler;
     class WorldInputLogic;
+    class MotionSystem;
 
     typedef boost::shared_ptr<Avatar> AvatarPtr;
     typedef boost::shared_ptr<AvatarEditor> AvatarEditorPtr;
     typedef boost::shared_ptr<Primitive> PrimitivePtr;
     typedef boost::shared_ptr<AvatarControllable> AvatarControllablePtr;
     typedef boost::shared_ptr<CameraControllable> CameraControllablePtr;
+    typedef boost::shared_ptr<MotionSystem> MotionSystemPtr;
 
     //! Camera states handled by rex logic
     enum CameraState
@@ -118,6 +120,9 @@ namespace RexLogic
         //! Returns the avatar controllable
         AvatarControllablePtr GetAvatarControllable()  const { return avatar_controllable_; }
 
+        //! Returns the motion system that performs dead-reckoning for network positioned entities
+        MotionSystemPtr GetMotionSystem() const { return motion_system_; }
+
         //! Return camera entity. Note: may be expired if scene got deleted and new scene not created yet
         Scene::EntityWeakPtr GetCameraEntity() const { return camera_entity_; }
         
@@ -169,9 +174,9 @@ namespace RexLogic
         bool HandleAssetEvent(event_id_t event_id, Foundation::EventDataInterface* data);
 
         //! Handle real-time update of scene objects
-        /*! Performs dead-reckoning and damped motion for all scene entities which have an OgrePlaceable and a NetworkPosition
-            component. If the OgrePlaceable position/rotation is set anywhere else, it will be overridden by the next
-            call to this, so it should be avoided.
+        /*! Performs dead-reckoning and damped motion, through the motion system, for the scene entities which have an
+            OgrePlaceable and a recently updated NetworkPosition component. If the OgrePlaceable position/rotation is
+            set anywhere else, it will be overridden by the next call to this, so it should be avoided.
 
             Performs animation update to all objects that have an OgreAnimationController component.
          */
@@ -198,6 +203,15 @@ namespace RexLogic
         //! Console command for test EC_Highlight. Adds EC_Highlight for every avatar.
         Console::CommandResult ConsoleHighlightTest(const StringVector &params);
 
+        //! Console command for measuring component lookup by type name against lookup by type id.
+        Console::CommandResult ConsoleComponentLookupBenchmark(const StringVector &params);
+
+        //! Console command for measuring spatial index queries against scanning all entities.
+        Console::CommandResult ConsoleSpatialQueryBenchmark(const StringVector &params);
+
+        //! Console command for printing the prim mesh cache contents and hit rates.
+        Console::CommandResult ConsolePrimMeshCacheStats(const StringVector &params);
+
         //! logout from server and delete current scene
         void LogoutAndDeleteWorld();
 
@@ -241,8 +255,8 @@ namespace RexLogic
         //! Add functionality if you need something done before logout.
         void AboutToDeleteWorld();
 
-        //! Gets a map of all avatars in world and the distance from users avatar,
-        //! for updating the name tag fades after certain discanse
+        //! Finds the avatars near the users avatar with the scene's spatial index,
+        //! for updating the name tag fades after certain distance
         void UpdateAvatarNameTags(Scene::EntityPtr users_avatar);
 
         /// Returns Ogre renderer pointer. Convenience function for making code cleaner.
@@ -272,6 +286,9 @@ namespace RexLogic
         //! How long to keep doing dead reckoning
         f64 dead_reckoning_time_;
 
+        //! Dead-reckoning and damped motion of network positioned entities
+        MotionSystemPtr motion_system_;
+
         typedef boost::function<bool(event_id_t,Foundation::EventDataInterface*)> LogicEventHandlerFunction;
         typedef std::vector<LogicEventHandlerFunction> EventHandlerVector;
         typedef std::map<event_category_id_t, EventHandlerVector> LogicEventHandlerMap;
@@ -325,6 +342,12 @@ namespace RexLogic
         //! Avatar entities found this frame. Needed so that we can update name overlays last, after all other updates
         std::vector<Scene::EntityWeakPtr> found_avatars_;
 
+        //! Avatars whose name tags may be visible, so that the name tags can be hidden when the avatars leave the range
+        std::set<entity_id_t> name_tag_avatars_;
+
+        //! Entities near the user's avatar, kept between frames to avoid reallocating
+        std::vector<entity_id_t> nearby_entities_;
+
         //! current camera state
         CameraState camera_state_;
 
@@ -11,21 +11,27 @@
 namespace Scene
 {
     Entity::Entity(Foundation::Framework* framework) : 
-        framework_(framework)
+        framework_(framework),
+        indexed_types_(0)
     {
     }
     
     Entity::Entity(Foundation::Framework* framework, uint id) : 
         framework_(framework),
-        id_(id)
+        id_(id),
+        indexed_types_(0)
     {
     }
 
     Entity::~Entity()
     {
         // If components still alive, they become free-floating
+        Foundation::ComponentManagerPtr component_manager = framework_->GetComponentManager();
         for (size_t i=0 ; i<components_.size() ; ++i)
+        {
+            component_manager->UnregisterComponent(components_[i].get(), component_type_ids_[i]);
             components_[i]->SetParentEntity(0);
+        }
     }
     
     void Entity::SetNewId(entity_id_t id)
@@ -40,6 +46,9 @@ namespace Scene
         {
             component->SetParentEntity(this);
             components_.push_back(component);
+            component_type_ids_.push_back(GetComponentTypeId(component->TypeName()));
+            UpdateTypeIndex();
+            framework_->GetComponentManager()->RegisterComponent(component.get(), component_type_ids_.back());
         
             ///\todo Ali: send event
         }
@@ -52,8 +61,12 @@ namespace Scene
             ComponentVector::iterator iter = std::find(components_.begin(), components_.end(), component);
             if (iter != components_.end())
             {
+                const size_t index = iter - components_.begin();
+                framework_->GetComponentManager()->UnregisterComponent(iter->get(), component_type_ids_[index]);
                 (*iter)->SetParentEntity(0);
+                component_type_ids_.erase(component_type_ids_.begin() + index);
                 components_.erase(iter);
+                UpdateTypeIndex();
                 ///\todo Ali: send event
             } else
             {
@@ -98,6 +111,41 @@ namespace Scene
         return Foundation::ComponentInterfacePtr();
     }
 
+    Foundation::ComponentInterfacePtr Entity::GetComponentByTypeId(uint type_id, const std::string& name) const
+    {
+        for (size_t i=0 ; i<components_.size() ; ++i)
+            if ((component_type_ids_[i] == type_id) && (components_[i]->Name() == name))
+                return components_[i];
+
+        return Foundation::ComponentInterfacePtr();
+    }
+
+    uint Entity::GetComponentTypeId(const std::string &type_name) const
+    {
+        return framework_->GetComponentManager()->GetTypeId(type_name);
+    }
+
+    void Entity::UpdateTypeIndex()
+    {
+        indexed_types_ = 0;
+        for (size_t i=0 ; i<component_type_ids_.size() ; ++i)
+            if (component_type_ids_[i] < cIndexedTypeIds)
+                indexed_types_ |= (boost::uint64_t)1 << component_type_ids_[i];
+
+        // One slot per indexed type, in type id order, pointing to the first component of that type
+        indexed_components_.resize(CountBits(indexed_types_));
+        for (size_t i=components_.size() ; i-- > 0 ;)
+        {
+            const uint type_id = component_type_ids_[i];
+            if (type_id < cIndexedTypeIds)
+            {
+                assert(i <= 0xffff);
+                const boost::uint64_t bit = (boost::uint64_t)1 << type_id;
+                indexed_components_[CountBits(indexed_types_ & (bit - 1))] = (u16)i;
+            }
+        }
+    }
+
     const Entity::ComponentVector &Entity::GetComponentVector() const { return components_; }
 
 }
@@ -8,6 +8,8 @@
 
 #include <QObject>
 
+#include <boost/cstdint.hpp>
+
 namespace Foundation
 {
     class Framework;
@@ -97,10 +99,13 @@ namespace Scene
 
         //! Returns a component with certain type, already cast to correct type, or empty pointer if component was not found
         /*! If there are several components with the specified type, returns the first component found (arbitrary).
+
+            Looks the component up by its type id, without comparing type names, so this is the preferred way to
+            get components in per-frame code.
         */
         template <class T> boost::shared_ptr<T> GetComponent() const
         {
-            return boost::dynamic_pointer_cast<T>(GetComponent(T::TypeNameStatic()));
+            return boost::static_pointer_cast<T>(GetComponentByTypeId(GetComponentTypeId<T>()));
         }
 
         //! Returns a component with certain type and name, already cast to correct type, or empty pointer if component was not found
@@ -109,9 +114,53 @@ namespace Scene
         */
         template <class T> boost::shared_ptr<T> GetComponent(const std::string& name) const
         {
-            return boost::dynamic_pointer_cast<T>(GetComponent(T::TypeNameStatic(), name));
+            return boost::static_pointer_cast<T>(GetComponentByTypeId(GetComponentTypeId<T>(), name));
+        }
+
+        //! Returns a component with the given type id, or empty pointer if component was not found
+        /*! If there are several components with the specified type, returns the first component found (arbitrary).
+
+            \param type_id type id of the component, see Foundation::ComponentManager::GetTypeId()
+        */
+        Foundation::ComponentInterfacePtr GetComponentByTypeId(uint type_id) const
+        {
+            if (type_id < cIndexedTypeIds)
+            {
+                const boost::uint64_t bit = (boost::uint64_t)1 << type_id;
+                if (!(indexed_types_ & bit))
+                    return Foundation::ComponentInterfacePtr();
+                return components_[indexed_components_[CountBits(indexed_types_ & (bit - 1))]];
+            }
+
+            for (size_t i=0 ; i<component_type_ids_.size() ; ++i)
+                if (component_type_ids_[i] == type_id)
+                    return components_[i];
+
+            return Foundation::ComponentInterfacePtr();
+        }
+
+        //! Returns a component with the given type id and name, or empty pointer if component was not found
+        /*! 
+            \param type_id type id of the component
+            \param name name of the component
+        */
+        Foundation::ComponentInterfacePtr GetComponentByTypeId(uint type_id, const std::string& name) const;
+
+        //! Returns the type id of a component type.
+        /*! The id is looked up once per type and cached, as type ids stay the same for the lifetime of the framework.
+        */
+        template <class T> uint GetComponentTypeId() const
+        {
+            static const uint type_id = GetComponentTypeId(T::TypeNameStatic());
+            return type_id;
         }
 
+        //! Returns the type id of a component type.
+        /*! 
+            \param type_name type of the component
+        */
+        uint GetComponentTypeId(const std::string &type_name) const;
+
         //! Returns the unique id of this entity
         entity_id_t GetId() const { return id_; }
 
@@ -122,9 +171,33 @@ namespace Scene
         Foundation::Framework* GetFramework() { return framework_; }
         
     private:
+        //! Number of type ids that are looked up through indexed_types_
+        static const uint cIndexedTypeIds = 64;
+
+        //! Returns the number of set bits
+        static uint CountBits(boost::uint64_t bits)
+        {
+            bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+            bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+            bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return (uint)((bits * 0x0101010101010101ULL) >> 56);
+        }
+
+        //! Rebuilds the type index after components have been added or removed
+        void UpdateTypeIndex();
+
         //! a list of all components
         ComponentVector components_;
 
+        //! type ids of the components, in the same order as components_
+        std::vector<uint> component_type_ids_;
+
+        //! bit per type id below cIndexedTypeIds, set if the entity has a component of that type
+        boost::uint64_t indexed_types_;
+
+        //! for each bit set in indexed_types_, in order, the index of the first component of that type in components_
+        std::vector<u16> indexed_components_;
+
         //! Unique id for this entity
         entity_id_t id_;
         
@@ -29,7 +29,7 @@ namespace Scene
             newentityid = GetNextFreeId();
         else
         {
-            if(entities_.find(id) != entities_.end())
+            if(HasEntity(id))
             {
                 Foundation::RootLogError("Can't create entity with given id because it's already used: " + ToString(id));
                 return Scene::EntityPtr();
@@ -44,7 +44,12 @@ namespace Scene
             entity->AddComponent(framework_->GetComponentManager()->CreateComponent(components[i]));
         }
         
-        entities_[entity->GetId()] = entity;
+        if ((entities_.size() + 1) * 2 > id_slots_.size())
+            GrowSlots();
+        IdSlot &slot = id_slots_[FindSlot(newentityid)];
+        slot.id = newentityid;
+        slot.index = entities_.size();
+        entities_.push_back(std::make_pair(newentityid, entity));
         
         // Send event.
         Events::SceneEventData event_data(entity->GetId());
@@ -56,16 +61,19 @@ namespace Scene
 
     Scene::EntityPtr SceneManager::GetEntity(entity_id_t id) const
     {
-        EntityMap::const_iterator it = entities_.find(id);
-        if (it != entities_.end())
-            return it->second;
+        if (id_slots_.empty())
+            return Scene::EntityPtr();
+
+        const IdSlot &slot = id_slots_[FindSlot(id)];
+        if (slot.index != cEmptySlot)
+            return entities_[slot.index].second;
 
         return Scene::EntityPtr();
     }
 
     entity_id_t SceneManager::GetNextFreeId()
     {
-        while(entities_.find(gid_) != entities_.end())
+        while(HasEntity(gid_))
             gid_ = (gid_ + 1) % static_cast<uint>(-1);
         
         return gid_;
@@ -73,18 +81,71 @@ namespace Scene
 
     void SceneManager::RemoveEntity(entity_id_t id)
     {
-        EntityMap::iterator it = entities_.find(id);
-        if (it != entities_.end())    
+        if (!HasEntity(id))
+            return;
+
+        // Send event.         
+        Events::SceneEventData event_data(id);
+        event_category_id_t cat_id = framework_->GetEventManager()->QueryEventCategory("Scene");
+        framework_->GetEventManager()->SendEvent(cat_id, Events::EVENT_ENTITY_DELETED, &event_data);
+
+        // Event handlers may have removed the entity already
+        size_t slot = FindSlot(id);
+        const uint index = id_slots_[slot].index;
+        if (index == cEmptySlot)
+            return;
+
+        Scene::EntityPtr del_entity = entities_[index].second;
+
+        // Move the last entity in place of the removed one
+        const uint last = entities_.size() - 1;
+        if (index != last)
+        {
+            entities_[index] = entities_[last];
+            id_slots_[FindSlot(entities_[index].first)].index = index;
+        }
+        entities_.pop_back();
+        EraseSlot(slot);
+        spatial_index_.Remove(id);
+
+        del_entity.reset();
+    }
+
+    void SceneManager::EraseSlot(size_t slot)
+    {
+        // Shift the following slots of the probe sequence back, so that no lookup stops at the freed slot too early
+        const size_t mask = id_slots_.size() - 1;
+        size_t next = slot;
+        for(;;)
+        {
+            id_slots_[slot].index = cEmptySlot;
+            for(;;)
+            {
+                next = (next + 1) & mask;
+                if (id_slots_[next].index == cEmptySlot)
+                    return;
+
+                size_t home = HomeSlot(id_slots_[next].id, mask);
+                // Move the entry if its home slot is not cyclically within (slot, next]
+                if (slot <= next ? (home <= slot || home > next) : (home <= slot && home > next))
+                    break;
+            }
+            id_slots_[slot] = id_slots_[next];
+            slot = next;
+        }
+    }
+
+    void SceneManager::GrowSlots()
+    {
+        size_t size = id_slots_.empty() ? 64 : id_slots_.size() * 2;
+        IdSlot empty = { 0, cEmptySlot };
+        id_slots_.assign(size, empty);
+
+        for(size_t i = 0; i < entities_.size(); ++i)
         {
-            Scene::EntityPtr del_entity = it->second;    
-            
-            // Send event.         
-            Events::SceneEventData event_data(id);
-            event_category_id_t cat_id = framework_->GetEventManager()->QueryEventCategory("Scene");
-            framework_->GetEventManager()->SendEvent(cat_id, Events::EVENT_ENTITY_DELETED, &event_data);
-
-            entities_.erase(it); 
-            del_entity.reset();
+            IdSlot &slot = id_slots_[FindSlot(entities_[i].first)];
+            slot.id = entities_[i].first;
+            slot.index = i;
         }
     }
 }
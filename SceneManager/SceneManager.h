@@ -5,6 +5,7 @@
 
 #include "CoreAnyIterator.h"
 #include "Entity.h"
+#include "SpatialIndex.h"
 
 namespace Scene
 {
@@ -23,6 +24,16 @@ namespace Scene
         the entities, iterating with Foundation::ComponentManager is
         the preferred way.
 
+        Entities are stored in a dense array, and found by id through an open
+        addressing hash table, so looking up an entity is O(1) and iteration
+        runs through contiguous memory. Iteration order is arbitrary, and
+        removing an entity moves the last entity in its place, so don't remove
+        entities while iterating.
+
+        Entity positions are kept in a spatial index for proximity queries, see
+        GetSpatialIndex(). Placeable components report their positions with
+        UpdateEntityPosition().
+
         \ingroup Scene_group
     */
     class SceneManager
@@ -33,7 +44,7 @@ namespace Scene
         //! constructor that takes a name and parent module
         SceneManager(const std::string &name, Foundation::Framework *framework) :  name_(name), framework_(framework) {}
         //! copy constructor that also takes a name
-        SceneManager( const SceneManager &other, const std::string &name ) : framework_(other.framework_), entities_(other.entities_) { }
+        SceneManager( const SceneManager &other, const std::string &name ) : framework_(other.framework_), spatial_index_(other.spatial_index_), entities_(other.entities_), id_slots_(other.id_slots_) { }
         // copy constuctor
         SceneManager( const SceneManager &other);
 
@@ -43,7 +54,8 @@ namespace Scene
         static uint gid_;
 
     public:
-        typedef std::map<entity_id_t, Scene::EntityPtr> EntityMap;
+        //! Dense array of entities and their ids, in no particular order
+        typedef std::vector<std::pair<entity_id_t, Scene::EntityPtr> > EntityMap;
         //! entity iterator, see begin() and end()
         typedef MapIterator<EntityMap::iterator, Scene::EntityPtr> iterator;
         //! const entity iterator. see begin() and end()
@@ -58,6 +70,8 @@ namespace Scene
             if (&other != this)
             {
                 entities_ = other.entities_;
+                id_slots_ = other.id_slots_;
+                spatial_index_ = other.spatial_index_;
             }
             return *this;
         }
@@ -97,7 +111,7 @@ namespace Scene
         //! Returns true if entity with the specified id exists in this scene, false otherwise
         bool HasEntity(entity_id_t id) const
         {
-            return (entities_.find(id) != entities_.end());
+            return !id_slots_.empty() && id_slots_[FindSlot(id)].index != cEmptySlot;
         }
 
         //! Remove entity with specified id
@@ -109,6 +123,8 @@ namespace Scene
         void RemoveEntity(entity_id_t id);
 
         //! Get the next free entity id. Can be used with CreateEntity().
+        /*! Ids are handed out in increasing order, so this is O(1) unless ids given by the server are in the way.
+        */
         entity_id_t GetNextFreeId();
 
         iterator begin() { return iterator(entities_.begin()); }
@@ -118,11 +134,63 @@ namespace Scene
 
         //! Returns entity map for introspection purposes
         const EntityMap &GetEntityMap() const { return entities_; }    
+
+        //! Sets the world position of an entity in the spatial index
+        /*! Ignored if the entity is not in this scene. The entity stays in the index until removed from the scene.
+        */
+        void UpdateEntityPosition(entity_id_t id, const Vector3df &position)
+        {
+            if (HasEntity(id))
+                spatial_index_.Update(id, position);
+        }
+
+        //! Returns the spatial index of entity positions, for radius, box and nearest entity queries
+        const SpatialIndex &GetSpatialIndex() const { return spatial_index_; }
     private:
+        //! Slot in the id hash table
+        struct IdSlot
+        {
+            //! Id of the entity
+            entity_id_t id;
+            //! Index of the entity in entities_, or cEmptySlot
+            uint index;
+        };
+
+        //! Index of an empty slot
+        static const uint cEmptySlot = (uint)-1;
 
-        //! Entities in a map
+        //! Returns the slot where the probe sequence for an id starts
+        static size_t HomeSlot(entity_id_t id, size_t mask)
+        {
+            uint hash = id * 2654435769u;
+            return (hash ^ (hash >> 16)) & mask;
+        }
+
+        //! Returns the slot the id is in, or the empty slot where it would go. The table must not be empty.
+        size_t FindSlot(entity_id_t id) const
+        {
+            const size_t mask = id_slots_.size() - 1;
+            size_t slot = HomeSlot(id, mask);
+            while (id_slots_[slot].index != cEmptySlot && id_slots_[slot].id != id)
+                slot = (slot + 1) & mask;
+            return slot;
+        }
+
+        //! Removes an id from the hash table
+        void EraseSlot(size_t slot);
+
+        //! Rebuilds the hash table with room for more entities
+        void GrowSlots();
+
+        //! Positions of the entities. Declared before entities_, so that it is destroyed after the entities.
+        SpatialIndex spatial_index_;
+
+        //! Entities in a dense array
         EntityMap entities_;
 
+        //! Hash table from entity id to the index of the entity in entities_. Size is zero or a power of two.
+        std::vector<IdSlot> id_slots_;
+
         //! parent framework
         Foundation::Framework *framework_;
 
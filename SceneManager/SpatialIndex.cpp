@@ -0,0 +1,295 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Scene
+{
+    namespace
+    {
+        //! Cell coordinates are clamped to this, so that huge query volumes do not overflow
+        const float cMaxCell = (float)(1 << 28);
+
+        //! Returns the cell coordinate of a position coordinate divided by the cell size
+        int ToCell(float x)
+        {
+            return (int)floor(std::max(-cMaxCell, std::min(x, cMaxCell)));
+        }
+
+        //! Collects the items of cells that are within a sphere
+        struct RadiusCollector
+        {
+            Vector3df center;
+            float radius_sq;
+            std::vector<entity_id_t> *ids;
+
+            template <typename C> void operator()(const C &cell)
+            {
+                for(size_t i = 0; i < cell.size(); ++i)
+                    if ((cell[i].position - center).getLengthSQ() <= radius_sq)
+                        ids->push_back(cell[i].id);
+            }
+        };
+
+        //! Collects the items of cells that are inside a box
+        struct BoxCollector
+        {
+            Vector3df min;
+            Vector3df max;
+            std::vector<entity_id_t> *ids;
+
+            template <typename C> void operator()(const C &cell)
+            {
+                for(size_t i = 0; i < cell.size(); ++i)
+                {
+                    const Vector3df &pos = cell[i].position;
+                    if (pos.x >= min.x && pos.y >= min.y && pos.z >= min.z && pos.x <= max.x && pos.y <= max.y && pos.z <= max.z)
+                        ids->push_back(cell[i].id);
+                }
+            }
+        };
+    }
+
+    const float SpatialIndex::cDefaultCellSize = 16.0f;
+
+    SpatialIndex::SpatialIndex(float cell_size) :
+        cell_size_(cell_size > 0.0f ? cell_size : cDefaultCellSize),
+        inv_cell_size_(1.0f / cell_size_)
+    {
+    }
+
+    SpatialIndex::SpatialIndex(const SpatialIndex &other) :
+        cell_size_(other.cell_size_),
+        inv_cell_size_(other.inv_cell_size_),
+        cells_(other.cells_)
+    {
+        RebuildLocations();
+    }
+
+    SpatialIndex &SpatialIndex::operator =(const SpatialIndex &other)
+    {
+        if (&other != this)
+        {
+            cell_size_ = other.cell_size_;
+            inv_cell_size_ = other.inv_cell_size_;
+            cells_ = other.cells_;
+            RebuildLocations();
+        }
+        return *this;
+    }
+
+    void SpatialIndex::Update(entity_id_t id, const Vector3df &position)
+    {
+        CellKey key = GetKey(position);
+
+        LocationMap::iterator i = entities_.find(id);
+        if (i != entities_.end())
+        {
+            Location &location = i->second;
+            if (location.key == key)
+            {
+                (*location.cell)[location.index].position = position;
+                return;
+            }
+            RemoveFromCell(location);
+        }
+        else
+            i = entities_.insert(std::make_pair(id, Location())).first;
+
+        Cell &cell = cells_[key];
+        Item item = { id, position };
+        Location &location = i->second;
+        location.key = key;
+        location.cell = &cell;
+        location.index = cell.size();
+        cell.push_back(item);
+    }
+
+    void SpatialIndex::Remove(entity_id_t id)
+    {
+        LocationMap::iterator i = entities_.find(id);
+        if (i == entities_.end())
+            return;
+
+        RemoveFromCell(i->second);
+        entities_.erase(i);
+    }
+
+    void SpatialIndex::Clear()
+    {
+        cells_.clear();
+        entities_.clear();
+    }
+
+    bool SpatialIndex::GetPosition(entity_id_t id, Vector3df &position) const
+    {
+        LocationMap::const_iterator i = entities_.find(id);
+        if (i == entities_.end())
+            return false;
+
+        position = (*i->second.cell)[i->second.index].position;
+        return true;
+    }
+
+    void SpatialIndex::QueryRadius(const Vector3df &center, float radius, std::vector<entity_id_t> &ids) const
+    {
+        ids.clear();
+        if (radius < 0.0f)
+            return;
+
+        Vector3df extent(radius, radius, radius);
+        RadiusCollector collector = { center, radius * radius, &ids };
+        ForCells(GetKey(center - extent), GetKey(center + extent), collector);
+    }
+
+    void SpatialIndex::QueryBox(const Vector3df &min, const Vector3df &max, std::vector<entity_id_t> &ids) const
+    {
+        ids.clear();
+        if (min.x > max.x || min.y > max.y || min.z > max.z)
+            return;
+
+        BoxCollector collector = { min, max, &ids };
+        ForCells(GetKey(min), GetKey(max), collector);
+    }
+
+    void SpatialIndex::QueryNearest(const Vector3df &point, size_t count, std::vector<entity_id_t> &ids, float max_distance) const
+    {
+        ids.clear();
+        if (!count || entities_.empty())
+            return;
+
+        float max_distance_sq = max_distance < 0.0f ? std::numeric_limits<float>::max() : max_distance * max_distance;
+
+        // Max-heap of the nearest candidates found so far
+        std::vector<DistanceItem> heap;
+        heap.reserve(count + 1);
+
+        // Search shells of cells around the point's cell, until the unvisited shells are farther than the farthest
+        // candidate. Points in shell r + 1 are at least r cells away. When the shells would cover more cells than
+        // there are occupied, test all cells instead.
+        CellKey center = GetKey(point);
+        for(int r = 0; ; ++r)
+        {
+            float shell_distance = (float)(r - 1) * cell_size_;
+            if (r > 0 && shell_distance > 0.0f && shell_distance * shell_distance > max_distance_sq)
+                break;
+            if (heap.size() == count && r > 0 && shell_distance > 0.0f && shell_distance * shell_distance >= heap.front().first)
+                break;
+
+            double covered = (double)(2 * r + 1) * (2 * r + 1) * (2 * r + 1);
+            if (covered > (double)cells_.size())
+            {
+                heap.clear();
+                for(CellMap::const_iterator i = cells_.begin(); i != cells_.end(); ++i)
+                    OfferNearest(i->second, point, count, max_distance_sq, heap);
+                break;
+            }
+
+            for(int dx = -r; dx <= r; ++dx)
+                for(int dy = -r; dy <= r; ++dy)
+                {
+                    // Inside the shell's x and y faces every z is on the shell, elsewhere only the z faces are
+                    bool xy_face = dx == -r || dx == r || dy == -r || dy == r;
+                    int step = (xy_face || r == 0) ? 1 : 2 * r;
+                    for(int dz = -r; dz <= r; dz += step)
+                    {
+                        CellKey key = { center.x + dx, center.y + dy, center.z + dz };
+                        CellMap::const_iterator i = cells_.find(key);
+                        if (i != cells_.end())
+                            OfferNearest(i->second, point, count, max_distance_sq, heap);
+                    }
+                }
+        }
+
+        std::sort_heap(heap.begin(), heap.end());
+        ids.reserve(heap.size());
+        for(size_t i = 0; i < heap.size(); ++i)
+            ids.push_back(heap[i].second);
+    }
+
+    SpatialIndex::CellKey SpatialIndex::GetKey(const Vector3df &position) const
+    {
+        CellKey key = { ToCell(position.x * inv_cell_size_), ToCell(position.y * inv_cell_size_),
+            ToCell(position.z * inv_cell_size_) };
+        return key;
+    }
+
+    void SpatialIndex::RebuildLocations()
+    {
+        entities_.clear();
+        for(CellMap::iterator i = cells_.begin(); i != cells_.end(); ++i)
+        {
+            Cell &cell = i->second;
+            for(uint j = 0; j < cell.size(); ++j)
+            {
+                Location &location = entities_[cell[j].id];
+                location.key = i->first;
+                location.cell = &cell;
+                location.index = j;
+            }
+        }
+    }
+
+    void SpatialIndex::RemoveFromCell(const Location &location)
+    {
+        Cell &cell = *location.cell;
+        const uint last = cell.size() - 1;
+        if (location.index != last)
+        {
+            cell[location.index] = cell[last];
+            entities_[cell[location.index].id].index = location.index;
+        }
+        cell.pop_back();
+
+        if (cell.empty())
+            cells_.erase(location.key);
+    }
+
+    template <typename F> void SpatialIndex::ForCells(const CellKey &min, const CellKey &max, F &func) const
+    {
+        double range = (double)(max.x - min.x + 1) * (max.y - min.y + 1) * (max.z - min.z + 1);
+        if (range > (double)cells_.size())
+        {
+            for(CellMap::const_iterator i = cells_.begin(); i != cells_.end(); ++i)
+            {
+                const CellKey &key = i->first;
+                if (key.x >= min.x && key.y >= min.y && key.z >= min.z && key.x <= max.x && key.y <= max.y && key.z <= max.z)
+                    func(i->second);
+            }
+            return;
+        }
+
+        CellKey key;
+        for(key.x = min.x; key.x <= max.x; ++key.x)
+            for(key.y = min.y; key.y <= max.y; ++key.y)
+                for(key.z = min.z; key.z <= max.z; ++key.z)
+                {
+                    CellMap::const_iterator i = cells_.find(key);
+                    if (i != cells_.end())
+                        func(i->second);
+                }
+    }
+
+    void SpatialIndex::OfferNearest(const Cell &cell, const Vector3df &point, size_t count, float max_distance_sq, std::vector<DistanceItem> &heap)
+    {
+        for(size_t i = 0; i < cell.size(); ++i)
+        {
+            float distance_sq = (cell[i].position - point).getLengthSQ();
+            if (distance_sq > max_distance_sq)
+                continue;
+            if (heap.size() == count)
+            {
+                if (distance_sq >= heap.front().first)
+                    continue;
+                std::pop_heap(heap.begin(), heap.end());
+                heap.pop_back();
+            }
+            heap.push_back(DistanceItem(distance_sq, cell[i].id));
+            std::push_heap(heap.begin(), heap.end());
+        }
+    }
+}
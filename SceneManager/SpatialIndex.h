@@ -0,0 +1,154 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_SceneSpatialIndex_h
+#define incl_SceneSpatialIndex_h
+
+#include "CoreTypes.h"
+#include "Vector3D.h"
+
+#include <boost/unordered_map.hpp>
+
+namespace Scene
+{
+    //! Uniform hash grid of entity positions, for proximity queries
+    /*! Entities are points, bucketed into cubic cells that are kept in a hash table by their integer coordinates,
+        so only occupied cells take memory and moving an entity within its cell costs one lookup. A query visits
+        the cells that overlap its volume, or all occupied cells when that is fewer.
+
+        The index does not know about components. Positions are given with Update(), and the scene removes
+        entities from the index when they are removed from the scene.
+
+        \ingroup Scene_group
+    */
+    class SpatialIndex
+    {
+    public:
+        //! Default cell edge length, in world units
+        static const float cDefaultCellSize;
+
+        //! Constructor
+        /*! \param cell_size Edge length of a cell. Queries are fastest when their radius is a cell or two.
+         */
+        explicit SpatialIndex(float cell_size = cDefaultCellSize);
+
+        //! Copy constructor. The copy has cells of its own.
+        SpatialIndex(const SpatialIndex &other);
+
+        //! Assignment operator. The copy has cells of its own.
+        SpatialIndex &operator =(const SpatialIndex &other);
+
+        //! Sets the position of an entity, adding it to the index if not there
+        void Update(entity_id_t id, const Vector3df &position);
+
+        //! Removes an entity from the index
+        void Remove(entity_id_t id);
+
+        //! Removes all entities
+        void Clear();
+
+        //! Returns the position of an entity
+        /*! \return false if the entity is not in the index
+         */
+        bool GetPosition(entity_id_t id, Vector3df &position) const;
+
+        //! Returns number of entities in the index
+        size_t Size() const { return entities_.size(); }
+
+        //! Returns number of occupied cells
+        size_t GetNumCells() const { return cells_.size(); }
+
+        //! Finds the entities within a distance of a point, in no particular order
+        /*! \param center Center of the sphere
+            \param radius Radius of the sphere
+            \param ids Receives the entity ids. Cleared first.
+         */
+        void QueryRadius(const Vector3df &center, float radius, std::vector<entity_id_t> &ids) const;
+
+        //! Finds the entities inside an axis-aligned box, in no particular order
+        /*! \param min Minimum corner of the box
+            \param max Maximum corner of the box
+            \param ids Receives the entity ids. Cleared first.
+         */
+        void QueryBox(const Vector3df &min, const Vector3df &max, std::vector<entity_id_t> &ids) const;
+
+        //! Finds the entities nearest to a point, nearest first
+        /*! \param point Point
+            \param count Maximum number of entities to find
+            \param ids Receives the entity ids. Cleared first.
+            \param max_distance Entities farther than this are not found
+         */
+        void QueryNearest(const Vector3df &point, size_t count, std::vector<entity_id_t> &ids, float max_distance = -1.0f) const;
+
+    private:
+        //! Integer coordinates of a cell
+        struct CellKey
+        {
+            int x;
+            int y;
+            int z;
+
+            bool operator ==(const CellKey &other) const { return x == other.x && y == other.y && z == other.z; }
+        };
+
+        struct CellKeyHash
+        {
+            size_t operator()(const CellKey &key) const
+            {
+                return (size_t)((uint)key.x * 73856093u ^ (uint)key.y * 19349663u ^ (uint)key.z * 83492791u);
+            }
+        };
+
+        //! Entity in a cell. The position is stored with the id, so that queries read only the cell.
+        struct Item
+        {
+            entity_id_t id;
+            Vector3df position;
+        };
+
+        typedef std::vector<Item> Cell;
+        typedef boost::unordered_map<CellKey, Cell, CellKeyHash> CellMap;
+
+        //! Where an entity is. Pointers to cells stay valid when the cell map is rehashed.
+        struct Location
+        {
+            CellKey key;
+            Cell *cell;
+            //! Index of the entity in the cell
+            uint index;
+        };
+
+        typedef boost::unordered_map<entity_id_t, Location> LocationMap;
+
+        //! Entity and its squared distance, for k-nearest queries
+        typedef std::pair<float, entity_id_t> DistanceItem;
+
+        //! Returns the cell coordinates of a position
+        CellKey GetKey(const Vector3df &position) const;
+
+        //! Rebuilds the entity locations to point to the cells of this index
+        void RebuildLocations();
+
+        //! Removes an item from its cell, moving the cell's last item in its place, and removes the cell if empty
+        void RemoveFromCell(const Location &location);
+
+        //! Calls a function with each cell that overlaps the cell range, visiting the range or all cells, whichever is fewer
+        template <typename F> void ForCells(const CellKey &min, const CellKey &max, F &func) const;
+
+        //! Offers the items of a cell to the nearest candidates
+        static void OfferNearest(const Cell &cell, const Vector3df &point, size_t count, float max_distance_sq, std::vector<DistanceItem> &heap);
+
+        //! Edge length of a cell
+        float cell_size_;
+
+        //! 1 / cell_size_
+        float inv_cell_size_;
+
+        //! Occupied cells by coordinates
+        CellMap cells_;
+
+        //! Locations of the entities by id
+        LocationMap entities_;
+    };
+}
+
+#endif
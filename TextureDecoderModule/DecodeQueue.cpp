@@ -0,0 +1,135 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "DecodeQueue.h"
+#include "ThreadTaskManager.h"
+
+namespace TextureDecoder
+{
+    DecodeQueue::DecodeQueue() :
+        sequence_(0),
+        shutdown_(false),
+        active_decodes_(0)
+    {
+    }
+
+    DecodeQueue::~DecodeQueue()
+    {
+        Shutdown();
+    }
+
+    void DecodeQueue::Push(DecodeRequestPtr request, f32 priority)
+    {
+        if (!request)
+            return;
+
+        {
+            MutexLock lock(mutex_);
+
+            EntryMap::iterator i = entries_.find(request->id_);
+            if (i != entries_.end())
+            {
+                queue_.erase(i->second);
+                entries_.erase(i);
+            }
+
+            Entry entry;
+            entry.priority_ = priority;
+            entry.sequence_ = sequence_++;
+            entry.request_ = request;
+            entries_[request->id_] = queue_.insert(entry).first;
+        }
+
+        condition_.notify_one();
+    }
+
+    bool DecodeQueue::Cancel(const std::string& id)
+    {
+        MutexLock lock(mutex_);
+
+        EntryMap::iterator i = entries_.find(id);
+        if (i == entries_.end())
+            return false;
+
+        queue_.erase(i->second);
+        entries_.erase(i);
+        return true;
+    }
+
+    void DecodeQueue::SetPriority(const std::string& id, f32 priority)
+    {
+        MutexLock lock(mutex_);
+
+        EntryMap::iterator i = entries_.find(id);
+        if ((i == entries_.end()) || (i->second->priority_ == priority))
+            return;
+
+        // Keep the original sequence number, so the request does not lose its place among equal priorities
+        Entry entry = *i->second;
+        entry.priority_ = priority;
+        queue_.erase(i->second);
+        i->second = queue_.insert(entry).first;
+    }
+
+    bool DecodeQueue::IsQueued(const std::string& id)
+    {
+        MutexLock lock(mutex_);
+        return entries_.find(id) != entries_.end();
+    }
+
+    uint DecodeQueue::GetSize()
+    {
+        MutexLock lock(mutex_);
+        return queue_.size();
+    }
+
+    DecodeRequestPtr DecodeQueue::Pop(uint timeout_ms)
+    {
+        ScopedLock lock(mutex_);
+
+        boost::system_time timeout = boost::get_system_time() + boost::posix_time::milliseconds(timeout_ms);
+        while (queue_.empty() && !shutdown_)
+        {
+            if (!condition_.timed_wait(lock, timeout))
+                break;
+        }
+
+        if (queue_.empty() || shutdown_)
+            return DecodeRequestPtr();
+
+        DecodeRequestPtr request = queue_.begin()->request_;
+        entries_.erase(request->id_);
+        queue_.erase(queue_.begin());
+        return request;
+    }
+
+    void DecodeQueue::Shutdown()
+    {
+        {
+            MutexLock lock(mutex_);
+            shutdown_ = true;
+        }
+
+        condition_.notify_all();
+    }
+
+    bool DecodeQueue::BeginDecode(Foundation::ThreadTaskManager* manager, const std::string& task_description, uint max_decodes)
+    {
+        // Count the results while holding the lock, so that another thread can not finish a decode in between
+        MutexLock lock(decode_mutex_);
+
+        uint results = manager ? manager->GetNumResults(task_description) : 0;
+        if (results + active_decodes_ >= max_decodes)
+            return false;
+
+        ++active_decodes_;
+        return true;
+    }
+
+    void DecodeQueue::EndDecode()
+    {
+        MutexLock lock(decode_mutex_);
+        if (active_decodes_)
+            --active_decodes_;
+    }
+}
@@ -0,0 +1,128 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_TextureDecoder_DecodeQueue_h
+#define incl_TextureDecoder_DecodeQueue_h
+
+#include "TextureRequest.h"
+#include "CoreThread.h"
+
+namespace Foundation
+{
+    class ThreadTaskManager;
+}
+
+namespace TextureDecoder
+{
+    //! Priority queue of decode requests, shared by the OpenJpegDecoder threads. Used internally by TextureService.
+    /*! There is at most one queued request per texture. Requests that have not yet been taken by a decoder thread
+        can be reprioritized or canceled. The queue also limits how many decodes the threads run at once. All
+        functions are threadsafe.
+     */
+    class DecodeQueue
+    {
+    public:
+        //! Constructor
+        DecodeQueue();
+
+        //! Destructor
+        ~DecodeQueue();
+
+        //! Queues a decode request
+        /*! If a request for the same texture is already queued, it is replaced.
+            \param request Decode request
+            \param priority Priority, higher is decoded first
+         */
+        void Push(DecodeRequestPtr request, f32 priority);
+
+        //! Cancels a queued decode request
+        /*! \param id Texture asset ID
+            \return true if a request was queued and is now removed, false if none queued (it may already be decoding)
+         */
+        bool Cancel(const std::string& id);
+
+        //! Changes priority of a queued decode request
+        /*! \param id Texture asset ID
+            \param priority New priority
+         */
+        void SetPriority(const std::string& id, f32 priority);
+
+        //! Returns whether a decode request is queued for a texture
+        bool IsQueued(const std::string& id);
+
+        //! Returns amount of queued requests
+        uint GetSize();
+
+        //! Takes the highest priority request from the queue. Called from decoder threads.
+        /*! Waits for a request to arrive if the queue is empty.
+            \param timeout_ms Maximum time to wait in milliseconds
+            \return Request, or null if none arrived within the timeout or the queue has been shut down
+         */
+        DecodeRequestPtr Pop(uint timeout_ms);
+
+        //! Wakes up all waiting decoder threads and makes Pop() return null from now on
+        void Shutdown();
+
+        //! Reserves a decode slot for a decoder thread, before taking a request. Called from decoder threads.
+        /*! The decodes in progress and the results the main thread has not handled yet together may not exceed
+            max_decodes, so that the decoder threads do not produce more textures per frame than allowed.
+            \param manager Thread task manager holding the results, or null to count only the decodes in progress
+            \param task_description Task description of the decoders
+            \param max_decodes Maximum amount of decodes in progress and results waiting
+            eturn true if a slot was reserved. Release it with EndDecode() after the result has been queued.
+         */
+        bool BeginDecode(Foundation::ThreadTaskManager* manager, const std::string& task_description, uint max_decodes);
+
+        //! Releases a decode slot reserved with BeginDecode()
+        void EndDecode();
+
+    private:
+        //! Queue entry
+        struct Entry
+        {
+            //! Priority
+            f32 priority_;
+            //! Sequence number, to serve requests with equal priority in the order they were queued
+            uint sequence_;
+            //! The request
+            DecodeRequestPtr request_;
+
+            bool operator < (const Entry& rhs) const
+            {
+                if (priority_ != rhs.priority_)
+                    return priority_ > rhs.priority_;
+                return sequence_ < rhs.sequence_;
+            }
+        };
+
+        typedef std::set<Entry> EntrySet;
+        typedef std::map<std::string, EntrySet::iterator> EntryMap;
+
+        //! Queued requests in priority order
+        EntrySet queue_;
+
+        //! Queued requests by texture asset ID
+        EntryMap entries_;
+
+        //! Next sequence number
+        uint sequence_;
+
+        //! Shutdown flag
+        bool shutdown_;
+
+        //! Mutex for the queue
+        Mutex mutex_;
+
+        //! Condition for the queue
+        Condition condition_;
+
+        //! Amount of reserved decode slots
+        uint active_decodes_;
+
+        //! Mutex for the decode slots
+        Mutex decode_mutex_;
+    };
+
+    typedef boost::shared_ptr<DecodeQueue> DecodeQueuePtr;
+}
+
+#endif
@@ -40,14 +40,20 @@
 #include "TextureDecoderModule.h"
 #include "ThreadTaskManager.h"
 #include "OpenJpegDecoder.h"
+#include "PixelConversion.h"
+#include "HighPerfClock.h"
 #include "Profiler.h"
 
 #include <openjpeg.h>
 
 namespace TextureDecoder
 {
-    OpenJpegDecoder::OpenJpegDecoder() :
+    //! How long to wait for requests at a time, so that a stop request is noticed
+    static const uint QUEUE_WAIT_MS = 100;
+
+    OpenJpegDecoder::OpenJpegDecoder(DecodeQueuePtr queue) :
         Foundation::ThreadTask("TextureDecoder"),
+        queue_(queue),
         decodes_per_frame_(1)
     {
     }
@@ -62,32 +68,24 @@ namespace TextureDecoder
     {
         while (ShouldRun())
         {
-            WaitForRequests();
+            // Wait if "too many" results already produced or being produced by all the decoder threads, to prevent 
+            // slowing down the main thread with too many texture creations per frame. Done before taking a request, 
+            // so that the queued requests can still be reprioritized or canceled meanwhile.
+            if (!queue_->BeginDecode(GetThreadTaskManager(), GetTaskDescription(), decodes_per_frame_))
+            {
+                boost::this_thread::sleep(boost::posix_time::milliseconds(20));
+                continue;
+            }
             
-            DecodeRequestPtr request = GetNextRequest<DecodeRequest>();
+            DecodeRequestPtr request = queue_->Pop(QUEUE_WAIT_MS);
             if (request)
             {
-                // Wait if "too many" results already produced, to prevent slowing down the main thread with 
-                // too many texture creations per frame
-                Foundation::ThreadTaskManager* manager = GetThreadTaskManager();
-                if (manager)
-                {
-                    for (;;)
-                    {
-                        uint results = manager->GetNumResults(GetTaskDescription());
-                        if (results < decodes_per_frame_)
-                            break;
-                        if (!ShouldRun())
-                            return;
-                        boost::this_thread::sleep(boost::posix_time::milliseconds(20));
-                    }
-                }
-                
                 {
                     PROFILE(OpenJpegDecoder_Decode);
                     PerformDecode(request);
                 }
             }
+            queue_->EndDecode();
 
             RESETPROFILER
         }
@@ -120,6 +118,7 @@ namespace TextureDecoder
         result->original_width_ = 0;
         result->original_height_ = 0;
         result->components_ = 0;
+        result->decode_time_ = 0.0;
         result->tag_ = request->tag_;
 
         // Guard against OpenJpeg crash on illegal data at an early phase
@@ -147,6 +146,8 @@ namespace TextureDecoder
         opj_set_default_decoder_parameters(&parameters);
         parameters.cp_reduce = request->level_;
         
+        Core::tick_t start_time = Core::GetCurrentClockTime();
+
         dinfo = opj_create_decompress(CODEC_J2K);
         opj_setup_decoder(dinfo, &parameters);
         opj_set_event_mgr((opj_common_ptr)dinfo, &event_mgr, this);
@@ -173,19 +174,12 @@ namespace TextureDecoder
             // Create a (possibly temporary, if no-one stores the pointer) raw texture resource
             Foundation::ResourcePtr resource(new TextureResource(request->source_->GetId(), actual_width, actual_height, image->numcomps));
             TextureResource* texture = checked_static_cast<TextureResource*>(resource.get());
-            u8* data = texture->GetData();
             texture->SetLevel(request->level_);
-            for (int y = 0; y < actual_height; ++y)
-            {
-                for (int x = 0; x < actual_width; ++x)
-                {
-                    for (int c = 0; c < image->numcomps; ++c)
-                    {
-                        *data = image->comps[c].data[y * actual_width + x];
-                        data++;
-                    }
-                }
-            }
+
+            std::vector<const int*> planes(image->numcomps);
+            for (int c = 0; c < image->numcomps; ++c)
+                planes[c] = image->comps[c].data;
+            PlanarToInterleaved(&planes[0], image->numcomps, actual_width * actual_height, texture->GetData());
      
             result->texture_ = resource;
         }
@@ -193,6 +187,8 @@ namespace TextureDecoder
         if (image)
             opj_image_destroy(image);
 
+        result->decode_time_ = (Core::GetCurrentClockTime() - start_time) / (f64)Core::GetCurrentClockFreq();
+
         QueueResult<DecodeResult>(result);
     }
 }
@@ -6,17 +6,22 @@
 #include "AssetInterface.h"
 #include "TextureInterface.h"
 #include "TextureRequest.h"
+#include "DecodeQueue.h"
 
 #include "ThreadTask.h"
 
 namespace TextureDecoder
 {
     //! OpenJpeg decoder that runs in a thread and serves decode requests, used internally by TextureService
+    /*! Several decoders take their requests from a shared DecodeQueue, instead of the request queue of the thread task.
+     */
     class OpenJpegDecoder : public Foundation::ThreadTask
     {
     public:
         //! Constructor
-        OpenJpegDecoder();
+        /*! \param queue Decode queue to serve requests from
+         */
+        OpenJpegDecoder(DecodeQueuePtr queue);
         
         //! Work function
         virtual void Work();
@@ -32,6 +37,9 @@ namespace TextureDecoder
          */
         void PerformDecode(DecodeRequestPtr request);
         
+        //! Shared decode queue
+        DecodeQueuePtr queue_;
+
         uint decodes_per_frame_;
     };
 }
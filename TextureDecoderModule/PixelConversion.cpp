@@ -0,0 +1,193 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#include "StableHeaders.h"
+#include "PixelConversion.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PIXELCONVERSION_AVX2
+#define PIXELCONVERSION_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PIXELCONVERSION_SSE2
+#endif
+
+namespace TextureDecoder
+{
+    static inline u8 ClampToByte(int value)
+    {
+        return (u8)(value < 0 ? 0 : (value > 255 ? 255 : value));
+    }
+
+    void PlanarToInterleavedScalar(const int* const* planes, uint components, uint count, u8* dest)
+    {
+        for (uint i = 0; i < count; ++i)
+            for (uint c = 0; c < components; ++c)
+                *dest++ = ClampToByte(planes[c][i]);
+    }
+
+#ifdef PIXELCONVERSION_SSE2
+    //! Loads 16 values from a plane at offset i and packs them to bytes, with saturation to 0-255
+    static inline __m128i LoadPack16(const int* plane, uint i)
+    {
+        const __m128i* src = (const __m128i*)(plane + i);
+        __m128i lo = _mm_packs_epi32(_mm_loadu_si128(src), _mm_loadu_si128(src + 1));
+        __m128i hi = _mm_packs_epi32(_mm_loadu_si128(src + 2), _mm_loadu_si128(src + 3));
+        return _mm_packus_epi16(lo, hi);
+    }
+
+    static void Convert1SSE2(const int* const* planes, uint count, u8* dest, uint& i)
+    {
+        for (; i + 16 <= count; i += 16)
+            _mm_storeu_si128((__m128i*)(dest + i), LoadPack16(planes[0], i));
+    }
+
+    static void Convert4SSE2(const int* const* planes, uint count, u8* dest, uint& i)
+    {
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i r = LoadPack16(planes[0], i);
+            __m128i g = LoadPack16(planes[1], i);
+            __m128i b = LoadPack16(planes[2], i);
+            __m128i a = LoadPack16(planes[3], i);
+            __m128i rg_lo = _mm_unpacklo_epi8(r, g);
+            __m128i rg_hi = _mm_unpackhi_epi8(r, g);
+            __m128i ba_lo = _mm_unpacklo_epi8(b, a);
+            __m128i ba_hi = _mm_unpackhi_epi8(b, a);
+            __m128i* out = (__m128i*)(dest + i * 4);
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(rg_lo, ba_lo));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(rg_lo, ba_lo));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(rg_hi, ba_hi));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(rg_hi, ba_hi));
+        }
+    }
+
+    //! Stores the 4 pixels of an RGBx vector as 3-byte pixels. Writes one byte past the last pixel.
+    static inline void Store3Overlapping(__m128i pixels, u8* dest)
+    {
+        for (int p = 0; p < 4; ++p)
+        {
+            int value = _mm_cvtsi128_si32(pixels);
+            memcpy(dest + p * 3, &value, 4);
+            pixels = _mm_srli_si128(pixels, 4);
+        }
+    }
+
+    static void Convert3SSE2(const int* const* planes, uint count, u8* dest, uint& i)
+    {
+        // The pixels are written 4 bytes at a time, overwriting the first byte of the next pixel, so stop before the last block
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 < count; i += 16)
+        {
+            __m128i r = LoadPack16(planes[0], i);
+            __m128i g = LoadPack16(planes[1], i);
+            __m128i b = LoadPack16(planes[2], i);
+            __m128i rg_lo = _mm_unpacklo_epi8(r, g);
+            __m128i rg_hi = _mm_unpackhi_epi8(r, g);
+            __m128i b0_lo = _mm_unpacklo_epi8(b, zero);
+            __m128i b0_hi = _mm_unpackhi_epi8(b, zero);
+            u8* out = dest + i * 3;
+            Store3Overlapping(_mm_unpacklo_epi16(rg_lo, b0_lo), out);
+            Store3Overlapping(_mm_unpackhi_epi16(rg_lo, b0_lo), out + 12);
+            Store3Overlapping(_mm_unpacklo_epi16(rg_hi, b0_hi), out + 24);
+            Store3Overlapping(_mm_unpackhi_epi16(rg_hi, b0_hi), out + 36);
+        }
+    }
+#endif
+
+#ifdef PIXELCONVERSION_AVX2
+    //! Loads 32 values from a plane at offset i and packs them to bytes in order, with saturation to 0-255
+    static inline __m256i LoadPack32(const int* plane, uint i)
+    {
+        const __m256i* src = (const __m256i*)(plane + i);
+        __m256i lo = _mm256_packs_epi32(_mm256_loadu_si256(src), _mm256_loadu_si256(src + 1));
+        __m256i hi = _mm256_packs_epi32(_mm256_loadu_si256(src + 2), _mm256_loadu_si256(src + 3));
+        // The packs work within 128-bit lanes, so the 4-byte groups need to be reordered
+        return _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    }
+
+    static void Convert1AVX2(const int* const* planes, uint count, u8* dest, uint& i)
+    {
+        for (; i + 32 <= count; i += 32)
+            _mm256_storeu_si256((__m256i*)(dest + i), LoadPack32(planes[0], i));
+    }
+
+    static void Convert4AVX2(const int* const* planes, uint count, u8* dest, uint& i)
+    {
+        for (; i + 32 <= count; i += 32)
+        {
+            __m256i r = LoadPack32(planes[0], i);
+            __m256i g = LoadPack32(planes[1], i);
+            __m256i b = LoadPack32(planes[2], i);
+            __m256i a = LoadPack32(planes[3], i);
+            __m256i rg_lo = _mm256_unpacklo_epi8(r, g);
+            __m256i rg_hi = _mm256_unpackhi_epi8(r, g);
+            __m256i ba_lo = _mm256_unpacklo_epi8(b, a);
+            __m256i ba_hi = _mm256_unpackhi_epi8(b, a);
+            // Low lanes hold pixels 0-15, high lanes pixels 16-31
+            __m256i p0 = _mm256_unpacklo_epi16(rg_lo, ba_lo);
+            __m256i p1 = _mm256_unpackhi_epi16(rg_lo, ba_lo);
+            __m256i p2 = _mm256_unpacklo_epi16(rg_hi, ba_hi);
+            __m256i p3 = _mm256_unpackhi_epi16(rg_hi, ba_hi);
+            __m256i* out = (__m256i*)(dest + i * 4);
+            _mm256_storeu_si256(out, _mm256_permute2x128_si256(p0, p1, 0x20));
+            _mm256_storeu_si256(out + 1, _mm256_permute2x128_si256(p2, p3, 0x20));
+            _mm256_storeu_si256(out + 2, _mm256_permute2x128_si256(p0, p1, 0x31));
+            _mm256_storeu_si256(out + 3, _mm256_permute2x128_si256(p2, p3, 0x31));
+        }
+    }
+#endif
+
+    void PlanarToInterleaved(const int* const* planes, uint components, uint count, u8* dest)
+    {
+        uint i = 0;
+
+#ifdef PIXELCONVERSION_SSE2
+        switch (components)
+        {
+        case 1:
+#ifdef PIXELCONVERSION_AVX2
+            Convert1AVX2(planes, count, dest, i);
+#endif
+            Convert1SSE2(planes, count, dest, i);
+            break;
+        case 3:
+            Convert3SSE2(planes, count, dest, i);
+            break;
+        case 4:
+#ifdef PIXELCONVERSION_AVX2
+            Convert4AVX2(planes, count, dest, i);
+#endif
+            Convert4SSE2(planes, count, dest, i);
+            break;
+        }
+#endif
+
+        // Remaining pixels
+        if (i < count)
+        {
+            const int* remaining[4];
+            const int* const* remaining_planes = planes;
+            if (i && components <= 4)
+            {
+                for (uint c = 0; c < components; ++c)
+                    remaining[c] = planes[c] + i;
+                remaining_planes = remaining;
+            }
+            else
+                i = 0;
+            PlanarToInterleavedScalar(remaining_planes, components, count - i, dest + i * components);
+        }
+    }
+
+    const char* GetPixelConversionInstructionSet()
+    {
+#if defined(PIXELCONVERSION_AVX2)
+        return "AVX2";
+#elif defined(PIXELCONVERSION_SSE2)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+}
@@ -0,0 +1,28 @@
+// For conditions of distribution and use, see copyright notice in license.txt
+
+#ifndef incl_TextureDecoder_PixelConversion_h
+#define incl_TextureDecoder_PixelConversion_h
+
+#include "CoreTypes.h"
+
+namespace TextureDecoder
+{
+    //! Converts planar 32-bit image components, as produced by OpenJpeg, to interleaved 8-bit pixels.
+    /*! Values are clamped to 0-255. Uses SSE2 or AVX2 when the build targets them, for 1, 3 and 4 components.
+        \param planes Array of pointers to the component planes
+        \param components Amount of components
+        \param count Amount of pixels in each plane
+        \param dest Destination buffer, count * components bytes
+     */
+    void PlanarToInterleaved(const int* const* planes, uint components, uint count, u8* dest);
+
+    //! Converts planar 32-bit image components to interleaved 8-bit pixels with plain scalar code.
+    /*! Same result as PlanarToInterleaved(). Used for the remainders of the vectorized conversions and for comparison.
+     */
+    void PlanarToInterleavedScalar(const int* const* planes, uint components, uint count, u8* dest);
+
+    //! Returns name of the instruction set used by PlanarToInterleaved()
+    const char* GetPixelConversionInstructionSet();
+}
+
+#endif
@@ -7,6 +7,8 @@
 #include "Framework.h"
 #include "EventManager.h"
 #include "ServiceManager.h"
+#include "PixelConversion.h"
+#include "HighPerfClock.h"
 
 namespace TextureDecoder
 {
@@ -30,7 +32,11 @@ namespace TextureDecoder
     {   
         Foundation::EventManagerPtr event_manager = framework_->GetEventManager();
         asset_event_category_ = event_manager->QueryEventCategory("Asset");
-        task_event_category_ = event_manager->QueryEventCategory("Task");
+        event_manager->SubscribeEventCategory(this, asset_event_category_);
+
+        RegisterConsoleCommand(Console::CreateCommand("PixelConversionBenchmark", 
+            "Measures conversion of decoded texture data to pixels. Usage: PixelConversionBenchmark(size, iterations)",
+            Console::Bind(this, &TextureDecoderModule::ConsolePixelConversionBenchmark)));
     }
     
     // virtual
@@ -61,13 +67,67 @@ namespace TextureDecoder
                 return texture_service_->HandleAssetEvent(event_id, data);
             else return false;
         }
-        if (category_id == task_event_category_)
+        return false;
+    }
+
+    //! The per-pixel loop that was used before PlanarToInterleaved(), for comparison
+    static void PlanarToInterleavedLoop(const int* const* planes, int components, int width, int height, u8* data)
+    {
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                for (int c = 0; c < components; ++c)
+                    *data++ = planes[c][y * width + x];
+    }
+
+    Console::CommandResult TextureDecoderModule::ConsolePixelConversionBenchmark(const StringVector &params)
+    {
+        int size = 1024;
+        int iterations = 20;
+        try
         {
-            if (texture_service_)
-                return texture_service_->HandleTaskEvent(event_id, data);
-            else return false;
+            if (params.size() > 0)
+                size = ParseString<int>(params[0]);
+            if (params.size() > 1)
+                iterations = ParseString<int>(params[1]);
         }
-        return false;
+        catch (std::exception &)
+        {
+            return Console::ResultFailure("Usage: PixelConversionBenchmark(size, iterations)");
+        }
+        if ((size <= 0) || (iterations <= 0))
+            return Console::ResultFailure("Usage: PixelConversionBenchmark(size, iterations)");
+
+        const uint count = size * size;
+        std::vector<int> source(count * 4);
+        for (uint i = 0; i < source.size(); ++i)
+            source[i] = rand() & 0xff;
+        std::vector<u8> dest(count * 4);
+        const int* planes[4] = { &source[0], &source[count], &source[count * 2], &source[count * 3] };
+
+        std::string result = "Pixel conversion of " + ToString(size) + "x" + ToString(size) + " using " + GetPixelConversionInstructionSet() + ":";
+        const uint component_counts[3] = { 1, 3, 4 };
+        for (uint j = 0; j < 3; ++j)
+        {
+            uint components = component_counts[j];
+
+            Core::tick_t start = Core::GetCurrentClockTime();
+            for (int i = 0; i < iterations; ++i)
+                PlanarToInterleavedLoop(planes, components, size, size, &dest[0]);
+            Core::tick_t loop_time = Core::GetCurrentClockTime() - start;
+
+            start = Core::GetCurrentClockTime();
+            for (int i = 0; i < iterations; ++i)
+                PlanarToInterleaved(planes, components, count, &dest[0]);
+            Core::tick_t conversion_time = Core::GetCurrentClockTime() - start;
+
+            double freq = (double)Core::GetCurrentClockFreq();
+            double loop_ms = loop_time * 1000.0 / freq / iterations;
+            double conversion_ms = conversion_time * 1000.0 / freq / iterations;
+            result += "\n" + ToString(components) + " components: loop " + ToString(loop_ms) + " ms, converted " +
+                ToString(conversion_ms) + " ms";
+        }
+
+        return Console::ResultSuccess(result);
     }
 }
 
@@ -5,6 +5,7 @@
 
 #include "ModuleInterface.h"
 #include "ModuleLoggingFunctions.h"
+#include "ConsoleCommandServiceInterface.h"
 #include "TextureDecoderModuleApi.h"
 
 namespace Foundation
@@ -41,15 +42,15 @@ namespace TextureDecoder
 
         bool HandleEvent(event_category_id_t category_id, event_id_t event_id, Foundation::EventDataInterface* data);
 
+        //! Console command for measuring the decoded pixel conversion against a plain loop
+        Console::CommandResult ConsolePixelConversionBenchmark(const StringVector &params);
+
     private:
         //! Texture service
         TextureServicePtr texture_service_;
         
         //! Asset event category
         event_category_id_t asset_event_category_;
-        
-        //! Task event category
-        event_category_id_t task_event_category_;
     };
 }
 
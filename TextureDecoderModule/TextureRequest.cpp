@@ -13,7 +13,8 @@ namespace TextureDecoder
         height_(0),
         levels_(-1),
         decoded_level_(-1),
-        next_level_(5)
+        next_level_(5),
+        priority_(0.0f)
     {
     }
     
@@ -27,7 +28,8 @@ namespace TextureDecoder
         height_(0),
         levels_(-1),
         decoded_level_(-1),
-        next_level_(5)       
+        next_level_(5),
+        priority_(0.0f)       
     {
     }
     
@@ -50,6 +52,27 @@ namespace TextureDecoder
         return received_ >= EstimateDataSize(next_level_);
     }
 
+    int TextureRequest::SkipLevels()
+    {
+        // Until the first decode the dimensions, and therefore data needed per level, are unknown
+        if ((!width_) || (!height_) || (!components_))
+            return 0;
+
+        int skipped = 0;
+        while ((next_level_ > 0) && (received_ >= EstimateDataSize(next_level_ - 1)))
+        {
+            next_level_--;
+            skipped++;
+        }
+        return skipped;
+    }
+
+    uint TextureRequest::GetLevelPixels(int level) const
+    {
+        if (level < 0) level = 0;
+        return (width_ >> level) * (height_ >> level);
+    }
+
     uint TextureRequest::EstimateDataSize(int level) const
     {
         if (level < 0) level = 0;
@@ -93,7 +116,7 @@ namespace TextureDecoder
                 height_ =  result->original_height_;
                 components_ = result->components_;
                        
-                decoded_level_ = next_level_;  
+                decoded_level_ = result->level_;  
             }
             
             // Set next quality level to decode
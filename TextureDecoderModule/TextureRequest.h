@@ -49,6 +49,9 @@ namespace TextureDecoder
 
         //! Amount of components in texture
         uint components_;
+
+        //! Time taken by the decode, in seconds
+        f64 decode_time_;
     };
     
     typedef boost::shared_ptr<DecodeResult> DecodeResultPtr;
@@ -74,6 +77,9 @@ namespace TextureDecoder
         //! Sets decode request status
         void SetDecodeRequested(bool requested) { decode_requested_ = requested; }
 
+        //! Sets decode priority hint
+        void SetPriority(f32 priority) { priority_ = priority; }
+
         //! Updates size & received count
         /*! \param size Total size of asset (from asset service)
             \param received Received continuous bytes (from asset service)
@@ -101,6 +107,16 @@ namespace TextureDecoder
         //! Checks if enough data to decode next level
         bool HasEnoughData() const;
 
+        //! Skips quality levels for which a better level already has enough data
+        /*! The levels are decoded separately from the whole codestream, so decoding a level that a better level
+            will replace right after would be wasted work.
+            \return Amount of levels skipped
+         */
+        int SkipLevels();
+
+        //! Returns amount of pixels in a quality level, 0 if dimensions not yet known
+        uint GetLevelPixels(int level) const;
+
         //! Returns asset id
         const std::string& GetId() const { return id_; }
 
@@ -133,6 +149,14 @@ namespace TextureDecoder
 
         //! Returns next level to decode
         int GetNextLevel() const { return next_level_; }
+
+        //! Returns decode priority hint
+        f32 GetPriority() const { return priority_; }
+
+        //! Returns decode priority of next level, combined from the priority hint and the level
+        /*! Lower quality levels are decoded first, as they need less data & time and give something to show quickly.
+         */
+        f32 GetDecodePriority() const { return priority_ + next_level_; }
         
         //! List of request tags associated with this transfer
         RequestTagVector tags_;
@@ -175,6 +199,9 @@ namespace TextureDecoder
 
         //! Next quality level to decode
         int next_level_;     
+
+        //! Decode priority hint from requesters
+        f32 priority_;
     };
 }
 #endif
\ No newline at end of file
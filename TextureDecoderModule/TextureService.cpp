@@ -31,15 +31,36 @@ namespace TextureDecoder
         if (max_decodes_per_frame_ <= 0) 
             max_decodes_per_frame_ = 1;
 
-        // Create decoder thread task and let the framework thread task manager handle it
-        OpenJpegDecoder* decoder = new OpenJpegDecoder();
-        decoder->SetDecodesPerFrame(max_decodes_per_frame_);
+        // By default leave one core for the main thread
+        int default_threads = boost::thread::hardware_concurrency() - 1;
+        if (default_threads <= 0)
+            default_threads = 1;
+        int decode_threads = framework_->GetDefaultConfig().DeclareSetting("TextureDecoder", "decode_threads", default_threads);
+        if (decode_threads <= 0)
+            decode_threads = 1;
 
-        framework_->GetThreadTaskManager()->AddThreadTask(Foundation::ThreadTaskPtr(decoder));
+        // Create decoder thread tasks serving a shared queue, and let the framework thread task manager handle them
+        decode_queue_ = DecodeQueuePtr(new DecodeQueue());
+        for (int i = 0; i < decode_threads; ++i)
+        {
+            OpenJpegDecoder* decoder = new OpenJpegDecoder(decode_queue_);
+            decoder->SetDecodesPerFrame(max_decodes_per_frame_);
+
+            Foundation::ThreadTaskPtr task(decoder);
+            framework_->GetThreadTaskManager()->AddThreadTask(task);
+            decoders_.push_back(task);
+            decoder->Start();
+        }
+        
+        framework_->GetThreadTaskManager()->SetResultHandler("TextureDecoder", boost::bind(&TextureService::HandleDecodeResult, this, _1));
     }
     
     TextureService::~TextureService()
     {
+        framework_->GetThreadTaskManager()->RemoveResultHandler("TextureDecoder");
+        decode_queue_->Shutdown();
+        for (uint i = 0; i < decoders_.size(); ++i)
+            framework_->GetThreadTaskManager()->RemoveThreadTask(decoders_[i]);
     }
 
     request_tag_t TextureService::RequestTexture(const std::string& asset_id)
@@ -60,6 +81,17 @@ namespace TextureDecoder
         return tag;
     }
     
+    void TextureService::SetTexturePriority(const std::string& asset_id, float priority)
+    {
+        TextureRequestMap::iterator i = requests_.find(asset_id);
+        if (i == requests_.end())
+            return;
+        
+        i->second.SetPriority(priority);
+        if (i->second.IsDecodeRequested())
+            decode_queue_->SetPriority(asset_id, i->second.GetDecodePriority());
+    }
+    
     void TextureService::Update(f64 frametime)
     {
         Foundation::ServiceManagerPtr service_manager = framework_->GetServiceManager(); 
@@ -90,9 +122,26 @@ namespace TextureDecoder
     
     void TextureService::UpdateRequest(TextureRequest& request, Foundation::AssetServiceInterface* asset_service)
     {
-        // If pending decode request, do nothing; wait for the result
+        // If pending decode request, wait for the result. However, if the asset has been fully received meanwhile 
+        // and the decode has not started yet, supersede it with a decode of the highest quality level.
         if (request.IsDecodeRequested())
-            return;
+        {
+            if (request.GetNextLevel() == 0)
+                return;
+            
+            uint size = 0;
+            uint received = 0;
+            uint received_continuous = 0;
+            if (!asset_service->QueryAssetStatus(request.GetId(), size, received, received_continuous))
+                return;
+            if ((!size) || (received_continuous < size))
+                return;
+            if (!decode_queue_->Cancel(request.GetId()))
+                return;
+            
+            request.SetDecodeRequested(false);
+            statistics_.superseded_decodes_++;
+        }
 
         // If asset not yet requested, request now
         if (!request.IsRequested())
@@ -108,7 +157,9 @@ namespace TextureDecoder
         if (!asset_service->QueryAssetStatus(request.GetId(), size, received, received_continuous))
             return;
         
+        int previous_level = request.GetNextLevel();
         request.UpdateSizeReceived(size, received_continuous);
+        request.SkipLevels();
 
         if (request.HasEnoughData())
         {
@@ -120,29 +171,39 @@ namespace TextureDecoder
                 new_decode_request->id_ = request.GetId();
                 new_decode_request->level_ = request.GetNextLevel();
                 new_decode_request->source_ = asset;
-                framework_->GetThreadTaskManager()->AddRequest<DecodeRequest>("TextureDecoder", new_decode_request);
+                new_decode_request->tag_ = framework_->GetEventManager()->GetNextRequestTag();
+                decode_queue_->Push(new_decode_request, request.GetDecodePriority());
+                
+                // Count the levels between the previous and the now queued level as saved work
+                for (int level = previous_level; level > request.GetNextLevel(); --level)
+                {
+                    statistics_.skipped_levels_++;
+                    statistics_.skipped_pixels_ += request.GetLevelPixels(level);
+                }
                 
                 request.SetDecodeRequested(true);
             }
         }
     }  
     
-    bool TextureService::HandleTaskEvent(event_id_t event_id, Foundation::EventDataInterface* data)
+    void TextureService::HandleDecodeResult(Foundation::ThreadTaskResultPtr task_result)
     {
-        if (event_id != Task::Events::REQUEST_COMPLETED)
-            return false;
-        DecodeResult* result = dynamic_cast<DecodeResult*>(data);
-        if (!result || result->task_description_ != "TextureDecoder")
-            return false;
+        DecodeResult* result = dynamic_cast<DecodeResult*>(task_result.get());
+        if (!result)
+            return;
         
         TextureRequestMap::iterator i = requests_.find(result->id_);
         if (i != requests_.end())
         {
             bool done = i->second.UpdateWithDecodeResult(result);
+            
+            statistics_.decodes_++;
+            statistics_.decode_time_ += result->decode_time_;
   
             if (result->texture_)
             {
                 TextureResource* texture = checked_static_cast<TextureResource*>(result->texture_.get());
+                statistics_.decoded_pixels_ += texture->GetWidth() * texture->GetHeight();
                 TextureDecoderModule::LogDebug("Decoded texture w " + ToString<uint>(texture->GetWidth()) + " h " +
                     ToString<uint>(texture->GetHeight()) + " level " + ToString<int>(result->level_));
 
@@ -161,8 +222,6 @@ namespace TextureDecoder
             if (done)
                 requests_.erase(i);
         }
-        
-        return true;
     }
     
     bool TextureService::HandleAssetEvent(event_id_t event_id, Foundation::EventDataInterface* data)
@@ -174,6 +233,7 @@ namespace TextureDecoder
             if (i != requests_.end())
             {
                 TextureDecoderModule::LogDebug("Texture decode request " + i->second.GetId() + " canceled");
+                decode_queue_->Cancel(i->first);
                 
                 // Send a RESOURCE_CANCELED event for each request that was made for this texture
                 const RequestTagVector& tags = i->second.GetTags();
@@ -4,6 +4,8 @@
 #define incl_TextureDecoder_Decoder_h
 
 #include "TextureRequest.h"
+#include "DecodeQueue.h"
+#include "ThreadTask.h"
 #include "TextureServiceInterface.h"
 
 namespace Foundation
@@ -29,6 +31,15 @@ namespace TextureDecoder
             \return request tag, will be used in eventual RESOURCE_READY event
          */
         virtual request_tag_t RequestTexture(const std::string& asset_id);
+
+        //! Sets decode priority of a requested texture
+        /*! \param asset_id asset ID of texture
+            \param priority decode priority, higher is decoded first
+         */
+        virtual void SetTexturePriority(const std::string& asset_id, float priority);
+
+        //! Returns statistics of the decoding work done and avoided
+        virtual Foundation::TextureDecodeStatistics GetDecodeStatistics() const { return statistics_; }
         
         //! Updates texture requests. Called by TextureDecoderModule
         void Update(f64 frametime);
@@ -36,10 +47,10 @@ namespace TextureDecoder
         //! Handles an asset event. Called by TextureDecoderModule
         bool HandleAssetEvent(event_id_t event_id, Foundation::EventDataInterface* data);
         
-        //! Handles a thread task event. Called by TextureDecoderModule
-        bool HandleTaskEvent(event_id_t event_id, Foundation::EventDataInterface* data);
-        
     private:
+        //! Handles a decode result. Called by the framework's thread task manager
+        void HandleDecodeResult(Foundation::ThreadTaskResultPtr task_result);
+        
         //! Updates a texture request
         /*! Polls the asset service & queues decode requests to the decode thread as necessary
          */
@@ -58,6 +69,15 @@ namespace TextureDecoder
 
         //! Max decodes per frame
         int max_decodes_per_frame_;
+
+        //! Decode queue shared by the decoder threads
+        DecodeQueuePtr decode_queue_;
+
+        //! Decoder threads
+        std::vector<Foundation::ThreadTaskPtr> decoders_;
+
+        //! Decoding statistics
+        Foundation::TextureDecodeStatistics statistics_;
     };
 }
 